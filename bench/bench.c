@@ -0,0 +1,306 @@
+#include "raylib.h"
+#include "rlgl.h"
+#include <time.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "defs.h"
+#include "game.h"
+#include "sweep.h"
+
+// Internal raudio mixer, not part of the public raylib API
+typedef struct rAudioBuffer rAudioBuffer;
+void MixAudioFrames(float *framesOut, const float *framesIn, unsigned int frameCount, rAudioBuffer *buffer);
+
+#define MIN_BENCH_SECONDS 0.25
+#define MIX_FRAMES 1024
+
+typedef struct Bench {
+	const char *name;
+	long iterations;
+	clock_t start;
+} Bench;
+
+static const char *filter = NULL;
+
+// Results are printed as one JSON object per line so runs can be diffed and tracked
+static void report(const char *name, long iterations, long opsPerIteration, double seconds) {
+	printf("{\"name\":\"%s\",\"iterations\":%ld,\"seconds\":%.6f,\"ns_per_op\":%.3f}\n",
+		name, iterations, seconds, seconds*1e9/((double)iterations*opsPerIteration));
+	fflush(stdout);
+}
+
+static bool want(const char *name) {
+	return !filter || strstr(name, filter);
+}
+
+static double seconds(clock_t start) {
+	return (double)(clock() - start)/CLOCKS_PER_SEC;
+}
+
+static volatile int sink;
+
+static void benchBrickScan(Game *game) {
+	if (!want("brick_scan"))
+		return;
+
+	Rectangle ball = ballRect(&game->balls, 0);
+	Vector2 delta = { 6, 5 };
+	long iterations = 0;
+	clock_t start = clock();
+
+	// Sweep the ball over the whole brick field the way a tick would
+	do {
+		for (int y = 40; y < 200; y += 7) {
+			for (int x = 0; x < SCREEN_WIDTH; x += 13) {
+				ball.x = x;
+				ball.y = y;
+
+				Rectangle swept = { ball.x, ball.y, ball.width+delta.x, ball.height+delta.y };
+				int nearby[GRID_MAX_QUERY];
+				int n = gridQuery(&game->grid, swept, nearby, GRID_MAX_QUERY);
+
+				for (int c = 0; c < n; c++) {
+					float t;
+					Vector2 normal;
+					if (brickLive(&game->bricks, nearby[c]) && sweepRect(ball, delta, brickRect(&game->bricks, nearby[c]), &t, &normal))
+						sink++;
+				}
+				iterations++;
+			}
+		}
+	} while (seconds(start) < MIN_BENCH_SECONDS);
+
+	report("brick_scan", iterations, 1, seconds(start));
+}
+
+static void benchBrickScanLinear(Game *game) {
+	if (!want("brick_scan_linear"))
+		return;
+
+	Rectangle ball = ballRect(&game->balls, 0);
+	long iterations = 0;
+	clock_t start = clock();
+
+	do {
+		for (int y = 40; y < 200; y += 7) {
+			for (int x = 0; x < SCREEN_WIDTH; x += 13) {
+				ball.x = x;
+				ball.y = y;
+
+				FOR_EACH_BRICK(&game->bricks, i) {
+					if (CheckCollisionRecs(ball, brickRect(&game->bricks, i)))
+						sink++;
+				}
+				iterations++;
+			}
+		}
+	} while (seconds(start) < MIN_BENCH_SECONDS);
+
+	report("brick_scan_linear", iterations, 1, seconds(start));
+}
+
+// brick_scan_linear with the store's arrays tested 64 bricks at a time, the live words as the filter
+static void benchBrickScanMask(Game *game) {
+	if (!want("brick_scan_mask"))
+		return;
+
+	const BrickStore *store = &game->bricks;
+	Rectangle ball = ballRect(&game->balls, 0);
+	long iterations = 0;
+	clock_t start = clock();
+
+	do {
+		for (int y = 40; y < 200; y += 7) {
+			for (int x = 0; x < SCREEN_WIDTH; x += 13) {
+				ball.x = x;
+				ball.y = y;
+
+				for (int base = 0; base < store->used; base += 64) {
+					uint64_t hits = store->live[base >> 6] & CheckCollisionRecsMask(ball,
+						store->x + base, store->y + base, store->w + base, store->h + base, store->used - base);
+					for (; hits; hits &= hits - 1)
+						sink++;
+				}
+				iterations++;
+			}
+		}
+	} while (seconds(start) < MIN_BENCH_SECONDS);
+
+	report("brick_scan_mask", iterations, 1, seconds(start));
+}
+
+static void benchCheckCollisionRecs(void) {
+	if (!want("check_collision_recs"))
+		return;
+
+	Rectangle a = { 0, 0, 25, 25 };
+	Rectangle b = { 10, 10, 40, 20 };
+	long iterations = 0;
+	clock_t start = clock();
+
+	do {
+		for (int i = 0; i < 100000; i++) {
+			a.x = (float)(i & 63);
+			sink += CheckCollisionRecs(a, b);
+		}
+		iterations += 100000;
+	} while (seconds(start) < MIN_BENCH_SECONDS);
+
+	report("check_collision_recs", iterations, 1, seconds(start));
+}
+
+// With more than one ball the result is per ball-tick, flat if the cost per ball doesn't grow with the count
+static void benchSimTick(int balls, bool fixedPhysics) {
+	char name[64];
+	if (balls == 1)
+		sprintf(name, "sim_tick%s", fixedPhysics ? "_fixed" : "");
+	else
+		sprintf(name, "sim_tick%s_balls_%d", fixedPhysics ? "_fixed" : "", balls);
+	if (!want(name))
+		return;
+
+	static Game game;
+	game.fixedPhysics = fixedPhysics;
+	gameSeed(&game, 1);
+	gameInit(&game);
+	gameAddBalls(&game, balls-1);
+	game.state = STATE_PLAYING;
+
+	GameEvents events = { 0 };
+	long iterations = 0;
+	clock_t start = clock();
+
+	do {
+		for (int i = 0; i < 10000; i++) {
+			GameInput input = { { game.balls.x[0] + BALL_SIZE/2.0f, 0 }, false };
+			gameTick(&game, input, &events);
+
+			if (game.state == STATE_WON) {
+				gameInit(&game);
+				gameAddBalls(&game, balls-1);
+				game.state = STATE_PLAYING;
+			}
+		}
+		iterations += 10000;
+	} while (seconds(start) < MIN_BENCH_SECONDS);
+
+	report(name, iterations, balls, seconds(start));
+}
+
+static void benchDrawCircleSector(void) {
+	if (!want("draw_circle_sector"))
+		return;
+
+	long iterations = 0;
+	clock_t start = clock();
+
+	BeginDrawing();
+	do {
+		for (int i = 0; i < 1000; i++) {
+			DrawCircleSector((Vector2){ 400, 240 }, 12.5f, 0, 360, 36, GRAY);
+		}
+		iterations += 1000;
+	} while (seconds(start) < MIN_BENCH_SECONDS);
+	report("draw_circle_sector", iterations, 1, seconds(start));
+	EndDrawing();
+}
+
+static void benchRenderBatch(void) {
+	if (!want("render_batch_upload"))
+		return;
+
+	long iterations = 0;
+	double elapsed = 0;
+
+	BeginDrawing();
+	do {
+		// Fill the batch with a brick field worth of quads, then time only the flush
+		for (int i = 0; i < 1000; i++) {
+			DrawRectangle((i*45) % SCREEN_WIDTH, (i/19)*25 % SCREEN_HEIGHT, 40, 20, RED);
+		}
+
+		clock_t start = clock();
+		rlDrawRenderBatchActive();
+		elapsed += seconds(start);
+		iterations++;
+	} while (elapsed < MIN_BENCH_SECONDS && iterations < 100000);
+	report("render_batch_upload", iterations, 1, elapsed);
+	EndDrawing();
+}
+
+static void benchMixAudioFrames(Sound sound, int voices) {
+	char name[64];
+	sprintf(name, "mix_audio_frames_%d", voices);
+	if (!want(name))
+		return;
+
+	static float framesIn[MIX_FRAMES*2];
+	static float framesOut[MIX_FRAMES*2];
+	for (int i = 0; i < MIX_FRAMES*2; i++) {
+		framesIn[i] = (float)(i % 100)/100.0f - 0.5f;
+	}
+
+	long iterations = 0;
+	clock_t start = clock();
+
+	do {
+		memset(framesOut, 0, sizeof(framesOut));
+		for (int v = 0; v < voices; v++) {
+			MixAudioFrames(framesOut, framesIn, MIX_FRAMES, (rAudioBuffer *)sound.stream.buffer);
+		}
+		iterations++;
+	} while (seconds(start) < MIN_BENCH_SECONDS);
+
+	// Reported per mixed frame of one voice
+	report(name, iterations, (long)voices*MIX_FRAMES, seconds(start));
+}
+
+int main(int argc, char **argv)
+{
+	if (argc > 1)
+		filter = argv[1];
+
+	SetTraceLogLevel(LOG_WARNING);
+
+	static Game game;
+	gameSeed(&game, 1);
+	gameInit(&game);
+
+	benchBrickScan(&game);
+	benchBrickScanLinear(&game);
+	benchBrickScanMask(&game);
+	benchCheckCollisionRecs();
+	int ballCounts[] = { 1, 16, 256 };
+	for (int i = 0; i < 3; i++) {
+		benchSimTick(ballCounts[i], false);
+		benchSimTick(ballCounts[i], true);
+	}
+
+	// Render benchmarks need a GL context, skip them on machines without a display
+	SetConfigFlags(FLAG_WINDOW_HIDDEN);
+	InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "attack breaker bench");
+	if (IsWindowReady()) {
+		benchDrawCircleSector();
+		benchRenderBatch();
+		CloseWindow();
+	}
+
+	InitAudioDevice();
+	if (IsAudioDeviceReady()) {
+		Wave wave = { MIX_FRAMES, 48000, 32, 2, MemAlloc(MIX_FRAMES*2*sizeof(float)) };
+		Sound sound = LoadSoundFromWave(wave);
+		UnloadWave(wave);
+
+		int voiceCounts[] = { 1, 4, 16, 64 };
+		for (int i = 0; i < 4; i++) {
+			benchMixAudioFrames(sound, voiceCounts[i]);
+		}
+
+		UnloadSound(sound);
+		CloseAudioDevice();
+	}
+
+	return 0;
+}
@@ -55,10 +55,15 @@
 //#define SUPPORT_BUSY_WAIT_LOOP          1
 // Use a partial-busy wait loop, in this case frame sleeps for most of the time, but then runs a busy loop at the end for accuracy
 #define SUPPORT_PARTIALBUSY_WAIT_LOOP
+// Schedule frames against absolute deadlines, sleeping on a high-resolution timer and only spinning for its measured wake up lateness
+#define SUPPORT_FRAME_PACING            1
 // Wait for events passively (sleeping while no events) instead of polling them actively every frame
 //#define SUPPORT_EVENTS_WAITING          1
 // Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
 //#define SUPPORT_SCREEN_CAPTURE          1
+// Read screenshots back through pixel buffers and encode them on a worker thread, TakeScreenshotAsync()
+// NOTE: Requires OpenGL 3.3 and pthreads, falls back to TakeScreenshot() otherwise
+#define SUPPORT_ASYNC_CAPTURE           1
 // Support automatic generated events, loading and recording of those events when required
 //#define SUPPORT_EVENTS_AUTOMATION       1
 // Support custom frame control, only for advance users
@@ -79,8 +84,12 @@
 #define MAX_TOUCH_POINTS                8       // Maximum number of touch points supported
 #define MAX_KEY_PRESSED_QUEUE          16       // Maximum number of keys in the key input queue
 #define MAX_CHAR_PRESSED_QUEUE         16       // Maximum number of characters in the char input queue
+#define MAX_MOUSE_EVENT_QUEUE          64       // Maximum number of mouse events kept from one input poll
 
 #define MAX_DECOMPRESSION_SIZE         64       // Max size allocated for decompression in MB
+#define MAX_CAPTURE_READBACKS           3       // Screenshots and video frames read back by the GPU at the same time
+#define MAX_CAPTURE_JOBS                4       // Screenshots and video frames waiting to be encoded, more are dropped
+#define FRAME_MEMORY_SIZE       (256*1024)      // Per-frame arena size in bytes, MemAllocFrame() and TextFormat() while drawing
 
 
 //------------------------------------------------------------------------------------
@@ -94,7 +103,8 @@
 //#define RLGL_SHOW_GL_DETAILS_INFO              1
 
 //#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS    4096    // Default internal render batch elements limits
-#define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
+#define RL_DEFAULT_BATCH_BUFFERS               3      // Default number of batch buffers (multi-buffering, persistently mapped if supported)
+#define RL_DEFAULT_BATCH_MAX_BUFFER_ELEMENTS 32768   // Elements the default batch may grow to between frames instead of flushing mid-frame
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
 #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS     4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 
@@ -172,9 +182,10 @@
 //------------------------------------------------------------------------------------
 #define AUDIO_DEVICE_FORMAT    ma_format_f32    // Device output format (miniaudio: float-32bit)
 #define AUDIO_DEVICE_CHANNELS              2    // Device output channels: stereo
-#define AUDIO_DEVICE_SAMPLE_RATE           0    // Device sample rate (device default)
+#define AUDIO_DEVICE_SAMPLE_RATE       48000    // Device sample rate, matches the game's pre-converted asset pack sounds
 
-#define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define MAX_AUDIO_BUFFER_POOL_CHANNELS    32    // Maximum number of audio pool channels
+#define AUDIO_VOICE_BUDGET                16    // Pool voices mixed per period, the rest advance without mixing
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
@@ -185,9 +196,16 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Allow TRACELOG() output to be written by a background thread, see SetTraceLogAsync()
+#define SUPPORT_TRACELOG_ASYNC          1
+// Record timeline zones, see BeginTraceZone() and ExportTraceZones(). raylib marks its batch draw, buffer swap,
+// frame wait, events poll and audio mixing. Not defined, every zone compiles to nothing
+//#define SUPPORT_TRACE_ZONES             1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define TRACELOG_LEVEL_MIN              0       // Lowest TRACELOG() level compiled in, i.e. 4 (LOG_WARNING) removes every info message
+#define TRACE_ZONE_EVENTS            8192       // Zones kept per thread, power of two, the oldest are overwritten
 
 #endif // CONFIG_H
@@ -118,8 +118,13 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
         if (getEGLConfigAttrib(n, EGL_COLOR_BUFFER_TYPE) != EGL_RGB_BUFFER)
             continue;
 
-        // Only consider window EGLConfigs
-        if (!(getEGLConfigAttrib(n, EGL_SURFACE_TYPE) & EGL_WINDOW_BIT))
+        // Only consider window EGLConfigs, or pbuffer ones for the Null platform
+        if (_glfw.platform.platformID == GLFW_PLATFORM_NULL)
+        {
+            if (!(getEGLConfigAttrib(n, EGL_SURFACE_TYPE) & EGL_PBUFFER_BIT))
+                continue;
+        }
+        else if (!(getEGLConfigAttrib(n, EGL_SURFACE_TYPE) & EGL_WINDOW_BIT))
             continue;
 
 #if defined(_GLFW_X11)
@@ -388,6 +393,8 @@ GLFWbool _glfwInitEGL(void)
         _glfwPlatformGetModuleSymbol(_glfw.egl.handle, "eglDestroyContext");
     _glfw.egl.CreateWindowSurface = (PFN_eglCreateWindowSurface)
         _glfwPlatformGetModuleSymbol(_glfw.egl.handle, "eglCreateWindowSurface");
+    _glfw.egl.CreatePbufferSurface = (PFN_eglCreatePbufferSurface)
+        _glfwPlatformGetModuleSymbol(_glfw.egl.handle, "eglCreatePbufferSurface");
     _glfw.egl.MakeCurrent = (PFN_eglMakeCurrent)
         _glfwPlatformGetModuleSymbol(_glfw.egl.handle, "eglMakeCurrent");
     _glfw.egl.SwapBuffers = (PFN_eglSwapBuffers)
@@ -435,6 +442,8 @@ GLFWbool _glfwInitEGL(void)
             _glfwStringInExtensionString("EGL_EXT_platform_x11", extensions);
         _glfw.egl.EXT_platform_wayland =
             _glfwStringInExtensionString("EGL_EXT_platform_wayland", extensions);
+        _glfw.egl.MESA_platform_surfaceless =
+            _glfwStringInExtensionString("EGL_MESA_platform_surfaceless", extensions);
         _glfw.egl.ANGLE_platform_angle =
             _glfwStringInExtensionString("EGL_ANGLE_platform_angle", extensions);
         _glfw.egl.ANGLE_platform_angle_opengl =
@@ -680,9 +689,23 @@ GLFWbool _glfwCreateContextEGL(_GLFWwindow* window,
     SET_ATTRIB(EGL_NONE, EGL_NONE);
 
     native = _glfw.platform.getEGLNativeWindow(window);
+    // The Null platform has no window to draw to, it renders to a pbuffer of the window size instead
+    if (_glfw.platform.platformID == GLFW_PLATFORM_NULL)
+    {
+        EGLint pbufferAttribs[] = { EGL_WIDTH, 0, EGL_HEIGHT, 0, EGL_NONE };
+        _glfw.platform.getFramebufferSize(window, &pbufferAttribs[1], &pbufferAttribs[3]);
+
+        if (_glfw.egl.CreatePbufferSurface)
+        {
+            window->context.egl.surface =
+                eglCreatePbufferSurface(_glfw.egl.display, config, pbufferAttribs);
+        }
+        else
+            window->context.egl.surface = EGL_NO_SURFACE;
+    }
     // HACK: ANGLE does not implement eglCreatePlatformWindowSurfaceEXT
     //       despite reporting EGL_EXT_platform_base
-    if (_glfw.egl.platform && _glfw.egl.platform != EGL_PLATFORM_ANGLE_ANGLE)
+    else if (_glfw.egl.platform && _glfw.egl.platform != EGL_PLATFORM_ANGLE_ANGLE)
     {
         window->context.egl.surface =
             eglCreatePlatformWindowSurfaceEXT(_glfw.egl.display, config, native, attribs);
@@ -71,7 +71,7 @@ GLFWbool _glfwSelectPlatform(int desiredID, _GLFWplatform* platform)
 
     // Only allow the Null platform if specifically requested
     if (desiredID == GLFW_PLATFORM_NULL)
-        return GLFW_FALSE; //_glfwConnectNull(desiredID, platform);  // @raysan5
+        return _glfwConnectNull(desiredID, platform);
     else if (count == 0)
     {
         _glfwInputError(GLFW_PLATFORM_UNAVAILABLE, "This binary only supports the Null platform");
@@ -66,6 +66,7 @@
 #if defined(RAUDIO_STANDALONE)
     #include "raudio.h"
 #else
+    #define RL_MEMORY_TAG MEMORY_TAG_AUDIO  // Everything allocated here, miniaudio included, is accounted to audio
     #include "raylib.h"         // Declares module functions
 
     // Check if config flags have been externally provided on compilation line
@@ -155,6 +156,7 @@ typedef struct tagBITMAPINFOHEADER {
 #endif
 
 #define MA_MALLOC RL_MALLOC
+#define MA_REALLOC RL_REALLOC
 #define MA_FREE RL_FREE
 
 #define MA_NO_JACK
@@ -162,6 +164,15 @@ typedef struct tagBITMAPINFOHEADER {
 #define MA_NO_FLAC
 #define MA_NO_MP3
 
+// NOTE: raudio mixes its own buffers and decodes with stb_vorbis, it only needs miniaudio's
+// device, data conversion and ring buffer, the higher level APIs are not compiled
+#define MA_NO_DECODING
+#define MA_NO_ENCODING
+#define MA_NO_GENERATION
+#define MA_NO_RESOURCE_MANAGER
+#define MA_NO_NODE_GRAPH
+#define MA_NO_ENGINE
+
 // Threading model: Default: [0] COINIT_MULTITHREADED: COM calls objects on any thread (free threading)
 #define MA_COINIT_VALUE  2              // [2] COINIT_APARTMENTTHREADED: Each object has its own thread (apartment model)
 
@@ -178,6 +189,9 @@ typedef struct tagBITMAPINFOHEADER {
     #ifndef TRACELOG
         #define TRACELOG(level, ...)    printf(__VA_ARGS__)
     #endif
+    #define TraceStartupPhase(phase)    // Startup trace is provided by rcore
+    #define TRACE_ZONE_BEGIN(name)      // Trace zones are provided by utils
+    #define TRACE_ZONE_END()
 
     // Allow custom memory allocators
     #ifndef RL_MALLOC
@@ -213,9 +227,25 @@ typedef struct tagBITMAPINFOHEADER {
 #endif
 
 #ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
-    #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
+    #define MAX_AUDIO_BUFFER_POOL_CHANNELS    32    // Audio pool channels (sound voices)
+#endif
+#ifndef AUDIO_VOICE_BUDGET
+    #define AUDIO_VOICE_BUDGET                16    // Pool voices mixed per period by default (real voices)
+#endif
+#ifndef AUDIO_COMMAND_QUEUE_SIZE
+    #define AUDIO_COMMAND_QUEUE_SIZE         256    // Audio commands queue size (must be a power of two)
+#endif
+#ifndef AUDIO_EFFECT_CHUNK_FRAMES
+    #define AUDIO_EFFECT_CHUNK_FRAMES         64    // Frames per block of the built-in effects, the limiter adapts once a block
 #endif
 
+#define AUDIO_REVERB_COMBS                     4    // Parallel feedback comb filters of the built-in reverb
+#define AUDIO_REVERB_LINE_FRAMES            5373    // Frames of all comb delay lines together
+#define AUDIO_VOICE_PITCH_UNIT           65536    // Voice pitch step for the original pitch (16.16 fixed point)
+#define AUDIO_VOICE_PITCH_MIN              0.25f    // Voice pitch range, two octaves down and up
+#define AUDIO_VOICE_PITCH_MAX              4.0f
+#define AUDIO_LIMITER_RELEASE              0.15f    // Seconds for the limiter gain to recover most of the way
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -258,9 +288,11 @@ typedef enum {
 // Audio buffer struct
 struct rAudioBuffer {
     ma_data_converter converter;    // Audio data converter
+    bool passthrough;               // Audio data already in mixing format at pitch 1.0, converter is bypassed
 
     AudioCallback callback;         // Audio buffer callback for buffer filling on audio threads
     rAudioProcessor *processor;     // Audio processor
+    struct rMusicDecoder *decoder;  // Music decoder filling the buffer from its ring, NULL for UpdateMusicStream() streaming
 
     float volume;                   // Audio buffer volume
     float pitch;                    // Audio buffer pitch
@@ -282,6 +314,18 @@ struct rAudioBuffer {
     rAudioBuffer *prev;             // Previous audio buffer on the list
 };
 
+// Music decoder, decodes a music stream ahead of the mixer on its own thread
+// NOTE: The ring is single-producer (decoder thread) single-consumer (audio thread), neither side locks
+typedef struct rMusicDecoder {
+    ma_thread thread;               // Decoder thread
+    ma_mutex lock;                  // Held by the decoder while decoding, so seeking never races it
+    ma_pcm_rb ring;                 // Decoded frames waiting to be mixed, in the stream format
+    Music music;                    // Music being decoded, copied on start
+    ma_uint32 sleepMs;              // Time the decoder waits between refills, a quarter of the ring
+    volatile ma_bool32 quit;        // Decoder thread exit request
+    volatile ma_bool32 ended;       // Non-looping music decoded to the end, stop once the ring drains
+} rMusicDecoder;
+
 // Audio processor struct
 // NOTE: Useful to apply effects to an AudioBuffer
 struct rAudioProcessor {
@@ -292,6 +336,39 @@ struct rAudioProcessor {
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Sound voice, one instance of a sound playing from the voices pool
+// NOTE: Voices only keep their own cursor and gains, sample data is read from the sound buffer (shared, read-only)
+typedef struct AudioVoice {
+    AudioBuffer *source;            // Sound buffer played by the voice, NULL if the voice is free
+    unsigned int frameCursorPos;    // Voice frame cursor position in source data
+    unsigned int frameFraction;     // Voice cursor position between source frames (16.16 fixed point fraction)
+    unsigned int pitchStep;         // Source frames advanced per output frame (16.16 fixed point), AUDIO_VOICE_PITCH_UNIT mixes directly
+    float volume;                   // Voice volume
+    float pan;                      // Voice pan (0.0f to 1.0f)
+    unsigned int id;                // Voice id, assigned in play order: the oldest voice is stolen when the pool is full
+} AudioVoice;
+
+// Audio command type, applied by the audio thread at the start of each mixing period
+typedef enum {
+    AUDIO_COMMAND_PLAY_VOICE = 0,   // Start a voice for buffer
+    AUDIO_COMMAND_STOP_VOICES,      // Stop all voices playing buffer
+    AUDIO_COMMAND_VOICE_VOLUME,     // Set voice volume
+    AUDIO_COMMAND_VOICE_PAN,        // Set voice pan
+    AUDIO_COMMAND_VOICE_BUDGET,     // Set voices mixed per period
+    AUDIO_COMMAND_SET_EFFECT,       // Start or update a built-in effect
+    AUDIO_COMMAND_STOP_EFFECT       // Stop a built-in effect
+} AudioCommandType;
+
+// Audio command, queued from the game thread to the audio thread
+typedef struct AudioCommand {
+    int type;                       // Command type: AudioCommandType
+    AudioBuffer *buffer;            // Sound buffer (play/stop)
+    unsigned int voiceId;           // Voice id (play/volume/pan) or AudioEffect (effects)
+    float value;                    // Volume, pan, budget or effect value
+    float pan;                      // Voice pan (play) or effect second value
+    float pitch;                    // Voice pitch (play)
+} AudioCommand;
+
 // Audio data context
 typedef struct AudioData {
     struct {
@@ -299,6 +376,8 @@ typedef struct AudioData {
         ma_device device;           // miniaudio device
         ma_mutex lock;              // miniaudio mutex lock
         bool isReady;               // Check if audio device is ready
+        int threadPriority;         // Audio thread priority requested (ThreadPriority)
+        bool threadPriorityApplied; // Audio thread priority was applied by the first callback
         size_t pcmBufferSize;       // Pre-allocated buffer size
         void *pcmBuffer;            // Pre-allocated buffer to read audio data from file/memory
     } System;
@@ -307,9 +386,41 @@ typedef struct AudioData {
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
+    struct {
+        AudioVoice pool[MAX_AUDIO_BUFFER_POOL_CHANNELS];    // Sound voices, preallocated so playing never allocates
+        unsigned int playCounter;   // Voices played counter, used to assign voice ids
+        int budget;                 // Voices mixed per period, only read and written by the audio thread
+    } Voice;
+    struct {
+        AudioCommand queue[AUDIO_COMMAND_QUEUE_SIZE];   // Single-producer single-consumer commands ring
+        ma_uint32 head;             // Next command to write, only written by the game thread
+        ma_uint32 tail;             // Next command to read, only written by the consumer (audio thread)
+    } Command;
+    struct {
+        unsigned int enabled;       // Built-in effects running, one bit per AudioEffect
+        float highpass;             // High-pass one-pole coefficient
+        float highpassState[2];     // High-pass low-passed signal at the last frame, per channel
+        float lowpass;              // Low-pass one-pole coefficient
+        float lowpassState[2];      // Low-pass output at the last frame, per channel
+        float reverbWet;            // Reverb level mixed over the dry signal
+        float reverbDecay;          // Reverb comb filters feedback
+        ma_uint32 reverbCursor[AUDIO_REVERB_COMBS];             // Frame position in each comb delay line
+        float reverbLines[AUDIO_REVERB_LINE_FRAMES*2];          // Comb delay lines back to back, stereo interleaved
+        float gain;                 // Limiter input gain
+        float ceiling;              // Limiter peak level
+        float release;              // Limiter gain recovery per block
+        float limiterGain;          // Limiter gain reduction at the end of the last block
+    } Effects;                      // NOTE: Only used by the audio thread, configured through the commands queue
+    struct {
+        ma_uint32 callbacks;        // Mixing callbacks measured, first one initializes the average
+        AudioMixerStats stats;      // Mixer statistics, only written by the audio thread
+    } Stats;
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
+// Mixing kernel: out[i] += in[i]*gain, with gain alternating between left and right levels for even/odd samples
+typedef void (*MixSamplesFunc)(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float left, float right);
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -320,15 +431,34 @@ static AudioData AUDIO = {          // Global AUDIO context
     // standard double-buffering system, a 4096 samples buffer has been chosen, it should be enough
     // In case of music-stalls, just increase this number
     .Buffer.defaultSize = 0,
+    .Voice.budget = AUDIO_VOICE_BUDGET,
     .mixedProcessor = NULL
 };
 
+static void MixSamplesScalar(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float left, float right);
+static MixSamplesFunc MixSamples = MixSamplesScalar;    // Mixing kernel, selected on InitAudioDevice() depending on the CPU
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage);
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
-static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
+static void GetPanGains(float volume, float pan, float *gainLeft, float *gainRight);
+static void MixAudioFramesGain(float *framesOut, const float *framesIn, ma_uint32 frameCount, float volume, float pan);
+static ma_uint32 MixAudioFramesResampled(float *framesOut, ma_uint32 frameCount, const AudioBuffer *source, ma_uint64 *position, ma_uint32 step, float volume, float pan);
+static void SelectMixSamplesKernel(void);               // Select the fastest mixing kernel supported by the CPU
+static void MixAudioBufferDirect(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);    // Mix a static buffer in device format straight from its data
+static bool PushAudioCommand(AudioCommand command);     // Queue a command for the audio thread (lock-free)
+static void ProcessAudioCommands(void);                 // Apply all queued commands, AUDIO.System.lock must be held
+static void SetAudioEffectState(const AudioCommand *command);   // Configure a built-in effect, from the audio thread
+static void ProcessAudioEffects(float *samples, ma_uint32 frameCount); // Run the built-in effects over stereo frames
+
+static ma_uint32 ReadMusicFrames(Music music, void *framesOut, ma_uint32 frameCount);  // Decode music frames in the stream format
+static void SeekMusicFrames(Music music, unsigned int positionInFrames);                // Move the music decoding position
+static void RefillMusicDecoder(rMusicDecoder *decoder);                                 // Decode into all free space of the ring
+static void RewindMusicDecoder(rMusicDecoder *decoder, unsigned int positionInFrames); // Drop decoded frames and decode from a new position
+static ma_uint32 ReadMusicDecoderFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount);  // Audio thread side of the ring
+static ma_thread_result MA_THREADCALL MusicDecoderThread(void *pUserData);             // Music decoder thread entry point
 
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
@@ -357,16 +487,34 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan);
 void TrackAudioBuffer(AudioBuffer *buffer);
 void UntrackAudioBuffer(AudioBuffer *buffer);
 
+void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);   // Mix buffer frames into output, applying volume and pan
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Device initialization and Closing
 //----------------------------------------------------------------------------------
 // Initialize audio device
+// NOTE: Backend default period, low latency profile
 void InitAudioDevice(void)
+{
+    InitAudioDeviceEx((AudioDeviceConfig){ 0, 0, true, PRIORITY_NORMAL });
+}
+
+// Initialize audio device with requested playback period
+// NOTE: Request is a hint, backends round it to what they support, check GetAudioDeviceLatency()
+void InitAudioDeviceEx(AudioDeviceConfig deviceConfig)
 {
     // Init audio context
     ma_context_config ctxConfig = ma_context_config_init();
     ma_log_callback_init(OnLog, NULL);
 
+    // NOTE: Backends that run their own audio thread (ALSA, PulseAudio, JACK...) take it from the context, as a hint
+    // the scheduler may ignore. The first callback also sets it on whatever thread calls it, see OnSendAudioDataToDevice()
+    AUDIO.System.threadPriority = deviceConfig.threadPriority;
+    AUDIO.System.threadPriorityApplied = false;
+    if (deviceConfig.threadPriority == PRIORITY_LOW) ctxConfig.threadPriority = ma_thread_priority_low;
+    else if (deviceConfig.threadPriority == PRIORITY_HIGH) ctxConfig.threadPriority = ma_thread_priority_highest;
+    else if (deviceConfig.threadPriority == PRIORITY_REALTIME) ctxConfig.threadPriority = ma_thread_priority_realtime;
+
     ma_result result = ma_context_init(NULL, 0, &ctxConfig, &AUDIO.System.context);
     if (result != MA_SUCCESS)
     {
@@ -374,6 +522,8 @@ void InitAudioDevice(void)
         return;
     }
 
+    TraceStartupPhase("audio context");     // Backend probing
+
     // Init audio device
     // NOTE: Using the default device. Format is floating point because it simplifies mixing.
     ma_device_config config = ma_device_config_init(ma_device_type_playback);
@@ -384,9 +534,15 @@ void InitAudioDevice(void)
     config.capture.format = ma_format_s16;
     config.capture.channels = 1;
     config.sampleRate = AUDIO_DEVICE_SAMPLE_RATE;
+    config.periodSizeInFrames = deviceConfig.periodSizeInFrames;    // 0 for backend default
+    config.periods = deviceConfig.periods;                          // 0 for backend default
+    config.performanceProfile = deviceConfig.lowLatency? ma_performance_profile_low_latency : ma_performance_profile_conservative;
     config.dataCallback = OnSendAudioDataToDevice;
     config.pUserData = NULL;
 
+    // NOTE: Kernel must be selected before the device starts calling OnSendAudioDataToDevice()
+    SelectMixSamplesKernel();
+
     result = ma_device_init(&AUDIO.System.context, &config, &AUDIO.System.device);
     if (result != MA_SUCCESS)
     {
@@ -395,6 +551,8 @@ void InitAudioDevice(void)
         return;
     }
 
+    TraceStartupPhase("audio device");
+
     // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
     // while there's at least one sound being played.
     result = ma_device_start(&AUDIO.System.device);
@@ -422,8 +580,11 @@ void InitAudioDevice(void)
     TRACELOG(LOG_INFO, "    > Channels:      %d -> %d", AUDIO.System.device.playback.channels, AUDIO.System.device.playback.internalChannels);
     TRACELOG(LOG_INFO, "    > Sample rate:   %d -> %d", AUDIO.System.device.sampleRate, AUDIO.System.device.playback.internalSampleRate);
     TRACELOG(LOG_INFO, "    > Periods size:  %d", AUDIO.System.device.playback.internalPeriodSizeInFrames*AUDIO.System.device.playback.internalPeriods);
+    TRACELOG(LOG_INFO, "    > Periods:       %d x %d frames (%.2f ms latency)", AUDIO.System.device.playback.internalPeriods,
+        AUDIO.System.device.playback.internalPeriodSizeInFrames, GetAudioDeviceLatency()*1000.0f);
 
     AUDIO.System.isReady = true;
+    TraceStartupPhase("audio start");
 }
 
 // Close the audio device for all contexts
@@ -431,10 +592,13 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
-        ma_mutex_uninit(&AUDIO.System.lock);
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
 
+        // Device is stopped, leftover commands are applied here so no voice keeps a stale buffer
+        ProcessAudioCommands();
+        ma_mutex_uninit(&AUDIO.System.lock);
+
         AUDIO.System.isReady = false;
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
@@ -451,6 +615,30 @@ bool IsAudioDeviceReady(void)
     return AUDIO.System.isReady;
 }
 
+// Get audio device playback latency in seconds
+// NOTE: Buffered periods the device plays before a new sound is heard, backend and hardware latency not included
+float GetAudioDeviceLatency(void)
+{
+    ma_uint32 sampleRate = AUDIO.System.device.playback.internalSampleRate;
+    if (sampleRate == 0) return 0.0f;
+
+    return (float)(AUDIO.System.device.playback.internalPeriodSizeInFrames*AUDIO.System.device.playback.internalPeriods)/sampleRate;
+}
+
+// Get audio mixer statistics
+// NOTE: Values are written by the audio thread without locking, the ones returned can span two callbacks
+AudioMixerStats GetAudioMixerStats(void)
+{
+    return AUDIO.Stats.stats;
+}
+
+// Reset audio mixer statistics
+void ResetAudioMixerStats(void)
+{
+    AUDIO.Stats.stats = (AudioMixerStats){ 0 };
+    AUDIO.Stats.callbacks = 0;
+}
+
 // Set master volume (listener)
 void SetMasterVolume(float volume)
 {
@@ -492,8 +680,12 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->pitch = 1.0f;
     audioBuffer->pan = 0.5f;
 
+    // Identity conversion is just a copy, converter only gets involved once pitch changes
+    audioBuffer->passthrough = (format == AUDIO_DEVICE_FORMAT) && (channels == AUDIO_DEVICE_CHANNELS) && (sampleRate == AUDIO.System.device.sampleRate);
+
     audioBuffer->callback = NULL;
     audioBuffer->processor = NULL;
+    audioBuffer->decoder = NULL;
 
     audioBuffer->playing = false;
     audioBuffer->paused = false;
@@ -597,6 +789,8 @@ void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
         ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
 
         buffer->pitch = pitch;
+        buffer->passthrough = (buffer->converter.formatIn == buffer->converter.formatOut) && (buffer->converter.channelsIn == buffer->converter.channelsOut) &&
+                              (buffer->converter.sampleRateIn == buffer->converter.sampleRateOut) && (pitch == 1.0f);
     }
 }
 
@@ -639,6 +833,15 @@ void UntrackAudioBuffer(AudioBuffer *buffer)
 
         buffer->prev = NULL;
         buffer->next = NULL;
+
+        // Queued commands could still refer to this buffer, apply them now the audio thread is locked out
+        ProcessAudioCommands();
+
+        // Free any voice still playing from this buffer data
+        for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+        {
+            if (AUDIO.Voice.pool[i].source == buffer) AUDIO.Voice.pool[i].source = NULL;
+        }
     }
     ma_mutex_unlock(&AUDIO.System.lock);
 }
@@ -652,6 +855,7 @@ Wave LoadWave(const char *fileName)
 {
     Wave wave = { 0 };
 
+#if defined(RAUDIO_STANDALONE)
     // Loading file to memory
     unsigned int fileSize = 0;
     unsigned char *fileData = LoadFileData(fileName, &fileSize);
@@ -660,6 +864,14 @@ Wave LoadWave(const char *fileName)
     if (fileData != NULL) wave = LoadWaveFromMemory(GetFileExtension(fileName), fileData, fileSize);
 
     RL_FREE(fileData);
+#else
+    // Decoding straight from the file view, no copy of the encoded data
+    FileView view = LoadFileView(fileName);
+
+    if (view.data != NULL) wave = LoadWaveFromMemory(GetFileExtension(fileName), view.data, view.size);
+
+    UnloadFileView(view);
+#endif
 
     return wave;
 }
@@ -765,7 +977,10 @@ Sound LoadSoundFromWave(Wave wave)
         ma_format formatIn = ((wave.sampleSize == 8)? ma_format_u8 : ((wave.sampleSize == 16)? ma_format_s16 : ma_format_f32));
         ma_uint32 frameCountIn = wave.frameCount;
 
-        ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, 0, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, NULL, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+        // Wave data already in device format (i.e. pre-converted at build time) only needs a copy
+        bool passthrough = (formatIn == AUDIO_DEVICE_FORMAT) && (wave.channels == AUDIO_DEVICE_CHANNELS) && (wave.sampleRate == AUDIO.System.device.sampleRate);
+
+        ma_uint32 frameCount = passthrough? frameCountIn : (ma_uint32)ma_convert_frames(NULL, 0, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, NULL, frameCountIn, formatIn, wave.channels, wave.sampleRate);
         if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed to get frame count for format conversion");
 
         AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, frameCount, AUDIO_BUFFER_USAGE_STATIC);
@@ -775,8 +990,15 @@ Sound LoadSoundFromWave(Wave wave)
             return sound; // early return to avoid dereferencing the audioBuffer null pointer
         }
 
-        frameCount = (ma_uint32)ma_convert_frames(audioBuffer->data, frameCount, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
-        if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed format conversion");
+        if (passthrough)
+        {
+            memcpy(audioBuffer->data, wave.data, frameCount*AUDIO_DEVICE_CHANNELS*ma_get_bytes_per_sample(AUDIO_DEVICE_FORMAT));
+        }
+        else
+        {
+            frameCount = (ma_uint32)ma_convert_frames(audioBuffer->data, frameCount, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+            if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed format conversion");
+        }
 
         sound.frameCount = frameCount;
         sound.stream.sampleRate = AUDIO.System.device.sampleRate;
@@ -958,6 +1180,73 @@ void SetSoundPan(Sound sound, float pan)
     SetAudioBufferPan(sound.stream.buffer, pan);
 }
 
+// Play a sound on a pool voice, layered over any other plays of the same sound
+// NOTE: Voices share the sound data and are scaled by the sound volume, pitch and processors are not applied.
+// The voice starts on the next mixing period, plays of the same sound in one period share a voice and
+// when all voices are busy the oldest one is stolen.
+// Returns the voice id, 0 on failure
+unsigned int PlaySoundVoice(Sound sound, float volume, float pan)
+{
+    return PlaySoundVoiceEx(sound, volume, pan, 1.0f);
+}
+
+// Play a sound on a pool voice with its own pitch
+// NOTE: The voice resamples the shared sound data as it mixes (linear interpolation), so unlike SetSoundPitch()
+// nothing is reconfigured and every play can have a different pitch. Pitch is clamped to [0.25f..4.0f]
+unsigned int PlaySoundVoiceEx(Sound sound, float volume, float pan, float pitch)
+{
+    AudioBuffer *buffer = sound.stream.buffer;
+
+    if ((buffer == NULL) || (buffer->usage != AUDIO_BUFFER_USAGE_STATIC) || (buffer->sizeInFrames == 0)) return 0;
+
+    if (pan < 0.0f) pan = 0.0f;
+    else if (pan > 1.0f) pan = 1.0f;
+
+    if (!(pitch >= AUDIO_VOICE_PITCH_MIN)) pitch = AUDIO_VOICE_PITCH_MIN;
+    else if (pitch > AUDIO_VOICE_PITCH_MAX) pitch = AUDIO_VOICE_PITCH_MAX;
+
+    unsigned int id = AUDIO.Voice.playCounter + 1;
+    if (id == 0) id = 1;    // Id 0 is reserved for failure
+
+    if (!PushAudioCommand((AudioCommand){ AUDIO_COMMAND_PLAY_VOICE, buffer, id, volume, pan, pitch })) return 0;
+
+    AUDIO.Voice.playCounter = id;
+
+    return id;
+}
+
+// Stop all pool voices playing a sound
+void StopSoundVoices(Sound sound)
+{
+    if (sound.stream.buffer != NULL) PushAudioCommand((AudioCommand){ AUDIO_COMMAND_STOP_VOICES, sound.stream.buffer, 0, 0.0f, 0.0f, 0.0f });
+}
+
+// Set volume for a pool voice, ignored if the voice already finished
+void SetSoundVoiceVolume(unsigned int voice, float volume)
+{
+    PushAudioCommand((AudioCommand){ AUDIO_COMMAND_VOICE_VOLUME, NULL, voice, volume, 0.0f, 0.0f });
+}
+
+// Set pan for a pool voice, ignored if the voice already finished
+void SetSoundVoicePan(unsigned int voice, float pan)
+{
+    if (pan < 0.0f) pan = 0.0f;
+    else if (pan > 1.0f) pan = 1.0f;
+
+    PushAudioCommand((AudioCommand){ AUDIO_COMMAND_VOICE_PAN, NULL, voice, pan, 0.0f, 0.0f });
+}
+
+// Set how many pool voices are mixed per period, the default is AUDIO_VOICE_BUDGET
+// NOTE: Voices beyond the budget are virtual: the quietest and nearest to their end keep advancing their
+// cursor without being mixed, and are mixed again as soon as they rank within the budget
+void SetSoundVoiceBudget(int voices)
+{
+    if (voices < 1) voices = 1;
+    else if (voices > MAX_AUDIO_BUFFER_POOL_CHANNELS) voices = MAX_AUDIO_BUFFER_POOL_CHANNELS;
+
+    PushAudioCommand((AudioCommand){ AUDIO_COMMAND_VOICE_BUDGET, NULL, 0, (float)voices, 0.0f, 0.0f });
+}
+
 // Convert wave data to desired format
 void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
 {
@@ -1115,6 +1404,8 @@ Music LoadMusicStream(const char *fileName)
 
 // Load music stream from memory buffer, fileType refers to extension: i.e. ".wav"
 // WARNING: File extension must be provided in lower-case
+// NOTE: The data is decoded in place while the music plays, not copied. It must stay valid until
+// UnloadMusicStream(), a FileView from LoadFileView() streams a large file without reading it all in
 Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data, int dataSize)
 {
     Music music = { 0 };
@@ -1181,6 +1472,7 @@ bool IsMusicReady(Music music)
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+    StopMusicStreamDecoder(music);
     UnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
@@ -1224,6 +1516,12 @@ void StopMusicStream(Music music)
 {
     StopAudioStream(music.stream);
 
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL))
+    {
+        RewindMusicDecoder(music.stream.buffer->decoder, 0);
+        return;
+    }
+
     switch (music.ctxType)
     {
 #if defined(SUPPORT_FILEFORMAT_OGG)
@@ -1241,6 +1539,12 @@ void SeekMusicStream(Music music, float position)
 
     unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
 
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL))
+    {
+        RewindMusicDecoder(music.stream.buffer->decoder, positionInFrames);
+        return;
+    }
+
     switch (music.ctxType)
     {
 #if defined(SUPPORT_FILEFORMAT_OGG)
@@ -1257,6 +1561,9 @@ void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
 
+    // Decoder thread keeps the ring filled by itself
+    if (music.stream.buffer->decoder != NULL) return;
+
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
 
     // On first call of this function we lazily pre-allocated a temp buffer to read audio files/memory data in
@@ -1322,6 +1629,76 @@ void UpdateMusicStream(Music music)
     if (IsMusicStreamPlaying(music)) PlayMusicStream(music);
 }
 
+// Start decoding music on a background thread
+// NOTE: Decoded frames wait in a ring of bufferMs milliseconds, mixed straight from there on the audio thread,
+// so the game never has to call UpdateMusicStream(). Music looping is taken from the music passed in
+bool StartMusicStreamDecoder(Music music, unsigned int bufferMs)
+{
+    AudioBuffer *buffer = music.stream.buffer;
+    if ((buffer == NULL) || (music.ctxData == NULL) || (buffer->decoder != NULL)) return false;
+
+    rMusicDecoder *decoder = (rMusicDecoder *)RL_CALLOC(1, sizeof(rMusicDecoder));
+    if (decoder == NULL) return false;
+
+    ma_uint32 ringFrames = music.stream.sampleRate*bufferMs/1000;
+    if (ringFrames < 1024) ringFrames = 1024;
+
+    decoder->music = music;
+    decoder->sleepMs = (bufferMs/4 > 0)? bufferMs/4 : 1;
+
+    if (ma_pcm_rb_init(buffer->converter.formatIn, buffer->converter.channelsIn, ringFrames, NULL, NULL, &decoder->ring) != MA_SUCCESS)
+    {
+        RL_FREE(decoder);
+        TRACELOG(LOG_WARNING, "STREAM: Failed to create music decoder ring");
+        return false;
+    }
+    ma_mutex_init(&decoder->lock);
+
+    // Fill the whole ring before the mixer sees it, playback starts with no gap
+    RefillMusicDecoder(decoder);
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    buffer->decoder = decoder;
+    ma_mutex_unlock(&AUDIO.System.lock);
+
+    if (ma_thread_create(&decoder->thread, ma_thread_priority_normal, 0, MusicDecoderThread, decoder, NULL) != MA_SUCCESS)
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+        buffer->decoder = NULL;
+        ma_mutex_unlock(&AUDIO.System.lock);
+
+        ma_mutex_uninit(&decoder->lock);
+        ma_pcm_rb_uninit(&decoder->ring);
+        RL_FREE(decoder);
+        TRACELOG(LOG_WARNING, "STREAM: Failed to create music decoder thread");
+        return false;
+    }
+
+    TRACELOG(LOG_INFO, "STREAM: Music decoder started, %i ms ring (%i frames)", bufferMs, ringFrames);
+
+    return true;
+}
+
+// Stop the background decoder
+// NOTE: Frames still in the ring are dropped, the music keeps decoding from where the decoder got to
+void StopMusicStreamDecoder(Music music)
+{
+    AudioBuffer *buffer = music.stream.buffer;
+    if ((buffer == NULL) || (buffer->decoder == NULL)) return;
+
+    rMusicDecoder *decoder = buffer->decoder;
+    decoder->quit = true;
+    ma_thread_wait(&decoder->thread);
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    buffer->decoder = NULL;
+    ma_mutex_unlock(&AUDIO.System.lock);
+
+    ma_mutex_uninit(&decoder->lock);
+    ma_pcm_rb_uninit(&decoder->ring);
+    RL_FREE(decoder);
+}
+
 // Check if any music is playing
 bool IsMusicStreamPlaying(Music music)
 {
@@ -1360,7 +1737,12 @@ float GetMusicTimeLength(Music music)
 float GetMusicTimePlayed(Music music)
 {
     float secondsPlayed = 0.0f;
-    if (music.stream.buffer != NULL)
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL))
+    {
+        // Decoder mode tracks frames actually handed to the mixer
+        secondsPlayed = (float)music.stream.buffer->framesProcessed/music.stream.sampleRate;
+    }
+    else if (music.stream.buffer != NULL)
     {
         //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
         int framesProcessed = (int)music.stream.buffer->framesProcessed;
@@ -1651,6 +2033,16 @@ void DetachAudioMixedProcessor(AudioCallback process)
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
+// Set a built-in effect for the entire audio pipeline, applied after the mixed processors
+// NOTE: Effects run in blocks of vectorized kernels over the stereo output and are configured through the
+// commands queue, so changing them never waits on the mixer. Effects need a stereo device
+void SetAudioMixedEffect(int effect, bool enabled, float value, float value2)
+{
+    if ((effect < AUDIO_EFFECT_HIGHPASS) || (effect > AUDIO_EFFECT_LIMITER)) return;
+
+    PushAudioCommand((AudioCommand){ enabled? AUDIO_COMMAND_SET_EFFECT : AUDIO_COMMAND_STOP_EFFECT, NULL, (unsigned int)effect, value, value2, 0.0f });
+}
+
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
@@ -1662,9 +2054,132 @@ static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage)
     TRACELOG(LOG_WARNING, "miniaudio: %s", pMessage);   // All log messages from miniaudio are errors
 }
 
+// Decode music frames in the stream format, returns less than frameCount at the end of the music
+static ma_uint32 ReadMusicFrames(Music music, void *framesOut, ma_uint32 frameCount)
+{
+    ma_uint32 framesRead = 0;
+
+    switch (music.ctxType)
+    {
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: framesRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)framesOut, frameCount*music.stream.channels); break;
+    #endif
+        default: break;
+    }
+
+    return framesRead;
+}
+
+// Move the music decoding position
+static void SeekMusicFrames(Music music, unsigned int positionInFrames)
+{
+    switch (music.ctxType)
+    {
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek_frame((stb_vorbis *)music.ctxData, positionInFrames); break;
+    #endif
+        default: break;
+    }
+}
+
+// Decode into all free space of the ring, the decoder lock must be held
+static void RefillMusicDecoder(rMusicDecoder *decoder)
+{
+    while (!decoder->ended)
+    {
+        ma_uint32 frameCount = ma_pcm_rb_available_write(&decoder->ring);
+        void *framesOut = NULL;
+
+        if ((frameCount == 0) || (ma_pcm_rb_acquire_write(&decoder->ring, &frameCount, &framesOut) != MA_SUCCESS) || (frameCount == 0)) break;
+
+        ma_uint32 framesRead = ReadMusicFrames(decoder->music, framesOut, frameCount);
+        ma_pcm_rb_commit_write(&decoder->ring, framesRead);
+
+        if (framesRead < frameCount)
+        {
+            if (decoder->music.looping) SeekMusicFrames(decoder->music, 0);
+            else decoder->ended = true;
+
+            // Nothing decoded even from the start, try again on the next wake up
+            if (framesRead == 0) break;
+        }
+    }
+}
+
+// Drop decoded frames and decode again from a new position
+// NOTE: Both locks are taken so neither the decoder thread nor the mixer touch the ring meanwhile
+static void RewindMusicDecoder(rMusicDecoder *decoder, unsigned int positionInFrames)
+{
+    ma_mutex_lock(&decoder->lock);
+    ma_mutex_lock(&AUDIO.System.lock);
+
+    SeekMusicFrames(decoder->music, positionInFrames);
+    ma_pcm_rb_reset(&decoder->ring);
+    decoder->ended = false;
+    decoder->music.stream.buffer->framesProcessed = positionInFrames;
+
+    ma_mutex_unlock(&AUDIO.System.lock);
+
+    RefillMusicDecoder(decoder);
+    ma_mutex_unlock(&decoder->lock);
+}
+
+// Read music frames from the decoder ring, on the audio thread
+// NOTE: Missing frames are mixed as silence rather than waited for, the mixer never blocks on the decoder
+static ma_uint32 ReadMusicDecoderFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount)
+{
+    rMusicDecoder *decoder = audioBuffer->decoder;
+    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+    ma_uint32 framesRead = 0;
+
+    while (framesRead < frameCount)
+    {
+        ma_uint32 framesToRead = frameCount - framesRead;
+        void *framesIn = NULL;
+
+        if ((ma_pcm_rb_acquire_read(&decoder->ring, &framesToRead, &framesIn) != MA_SUCCESS) || (framesToRead == 0)) break;
+
+        memcpy((unsigned char *)framesOut + framesRead*frameSizeInBytes, framesIn, framesToRead*frameSizeInBytes);
+        ma_pcm_rb_commit_read(&decoder->ring, framesToRead);
+        framesRead += framesToRead;
+    }
+
+    if (decoder->music.frameCount > 0) audioBuffer->framesProcessed = (audioBuffer->framesProcessed + framesRead)%decoder->music.frameCount;
+
+    if (framesRead < frameCount)
+    {
+        memset((unsigned char *)framesOut + framesRead*frameSizeInBytes, 0, (frameCount - framesRead)*frameSizeInBytes);
+
+        if (decoder->ended) StopAudioBuffer(audioBuffer);
+        else AUDIO.Stats.stats.musicStarved += frameCount - framesRead;
+    }
+
+    return frameCount;
+}
+
+// Music decoder thread, tops the ring up a few times per ring length
+static ma_thread_result MA_THREADCALL MusicDecoderThread(void *pUserData)
+{
+    rMusicDecoder *decoder = (rMusicDecoder *)pUserData;
+
+    while (!decoder->quit)
+    {
+        ma_mutex_lock(&decoder->lock);
+        RefillMusicDecoder(decoder);
+        ma_mutex_unlock(&decoder->lock);
+
+        ma_sleep(decoder->sleepMs);
+    }
+
+    return (ma_thread_result)0;
+}
+
 // Reads audio data from an AudioBuffer object in internal format.
 static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount)
 {
+    // Music decoded ahead on its own thread
+    if (audioBuffer->decoder) return ReadMusicDecoderFrames(audioBuffer, framesOut, frameCount);
+
     // Using audio buffer callback
     if (audioBuffer->callback)
     {
@@ -1760,6 +2275,9 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
 // Reads audio data from an AudioBuffer object in device format. Returned data will be in a format appropriate for mixing.
 static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
 {
+    // Data is already in mixing format, no conversion required
+    if (audioBuffer->passthrough) return ReadAudioBufferFramesInInternalFormat(audioBuffer, framesOut, frameCount);
+
     // What's going on here is that we're continuously converting data from the AudioBuffer's internal format to the mixing format, which
     // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
     // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
@@ -1810,18 +2328,52 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 {
     (void)pDevice;
 
+    TRACE_ZONE_BEGIN("audio callback");
+
+#if !defined(RAUDIO_STANDALONE)
+    if (!AUDIO.System.threadPriorityApplied)
+    {
+        if (AUDIO.System.threadPriority != PRIORITY_NORMAL) SetCurrentThreadPriority(AUDIO.System.threadPriority);
+        AUDIO.System.threadPriorityApplied = true;
+    }
+#endif
+
+    ma_timer timer;
+    ma_timer_init(&timer);
+
+    int activeBuffers = 0;
+    int activeVoices = 0;
+
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
+    double lockStart = ma_timer_get_time_in_seconds(&timer);
+
     // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
+    // NOTE: Sound voices play/stop/volume/pan go through the lock-free commands queue instead,
+    // the game thread only takes this lock to load/unload buffers and attach/detach processors
     ma_mutex_lock(&AUDIO.System.lock);
     {
+        AUDIO.Stats.stats.lockWait = (float)(ma_timer_get_time_in_seconds(&timer) - lockStart);
+
+        ProcessAudioCommands();
+
         for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
         {
             // Ignore stopped or paused sounds
             if (!audioBuffer->playing || audioBuffer->paused) continue;
 
+            // Sounds already in device format are accumulated from their data, no intermediate buffer required
+            // NOTE: Processors modify the frames they get, so those sounds still go through a copy
+            if (audioBuffer->passthrough && (audioBuffer->usage == AUDIO_BUFFER_USAGE_STATIC) && (audioBuffer->sizeInFrames > 0) && (audioBuffer->callback == NULL) && (audioBuffer->processor == NULL))
+            {
+                MixAudioBufferDirect(audioBuffer, (float *)pFramesOut, frameCount);
+                activeBuffers++;
+                continue;
+            }
+
+            activeBuffers++;
+
             ma_uint32 framesRead = 0;
 
             while (1)
@@ -1833,7 +2385,7 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 
                 while (framesToRead > 0)
                 {
-                    float tempBuffer[1024] = { 0 }; // Frames for stereo
+                    float tempBuffer[1024];         // Frames for stereo, no need to clear: only the frames read are mixed
 
                     ma_uint32 framesToReadRightNow = framesToRead;
                     if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
@@ -1844,6 +2396,9 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
                     ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
                     if (framesJustRead > 0)
                     {
+                        if (audioBuffer->passthrough) AUDIO.Stats.stats.framesPassthrough += framesJustRead;
+                        else AUDIO.Stats.stats.framesConverted += framesJustRead;
+
                         float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
                         float *framesIn = tempBuffer;
 
@@ -1892,6 +2447,85 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
         }
     }
 
+    // Mix sound voices, straight from the shared sound data (sounds are always stored in device format)
+    // NOTE: Over the voices budget only the most audible voices are mixed, audibility being the gain scaled by
+    // the part of the sound still to play. The rest only advance their cursor, so mixing cost is capped
+    float audibility[MAX_AUDIO_BUFFER_POOL_CHANNELS] = { 0 };
+    int playingVoices = 0;
+    int virtualVoices = 0;
+
+    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+    {
+        AudioVoice *voice = &AUDIO.Voice.pool[i];
+        if (voice->source == NULL) continue;
+
+        audibility[i] = voice->volume*voice->source->volume*(float)(voice->source->sizeInFrames - voice->frameCursorPos)/voice->source->sizeInFrames;
+        playingVoices++;
+    }
+
+    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+    {
+        AudioVoice *voice = &AUDIO.Voice.pool[i];
+        if (voice->source == NULL) continue;
+
+        // Ranked by audibility, ties going to the lower pool index so exactly budget voices are mixed
+        bool mixed = true;
+        if (playingVoices > AUDIO.Voice.budget)
+        {
+            int ranked = 0;
+            for (int j = 0; j < MAX_AUDIO_BUFFER_POOL_CHANNELS; j++)
+            {
+                if ((j == i) || (AUDIO.Voice.pool[j].source == NULL)) continue;
+                if ((audibility[j] > audibility[i]) || ((audibility[j] == audibility[i]) && (j < i))) ranked++;
+            }
+
+            mixed = (ranked < AUDIO.Voice.budget);
+        }
+
+        if (voice->pitchStep != AUDIO_VOICE_PITCH_UNIT)
+        {
+            // Pitched voices resample as they mix, virtual ones only move the fixed point cursor
+            ma_uint64 position = ((ma_uint64)voice->frameCursorPos << 16) | voice->frameFraction;
+
+            if (mixed)
+            {
+                ma_uint32 framesMixed = MixAudioFramesResampled((float *)pFramesOut, frameCount, voice->source, &position, voice->pitchStep, voice->volume*voice->source->volume, voice->pan);
+                AUDIO.Stats.stats.framesPassthrough += framesMixed;
+                activeVoices++;
+            }
+            else
+            {
+                position += (ma_uint64)frameCount*voice->pitchStep;
+                virtualVoices++;
+            }
+
+            if (position >= ((ma_uint64)voice->source->sizeInFrames << 16)) voice->source = NULL;
+            else
+            {
+                voice->frameCursorPos = (unsigned int)(position >> 16);
+                voice->frameFraction = (unsigned int)(position & 0xFFFF);
+            }
+
+            continue;
+        }
+
+        ma_uint32 framesLeft = voice->source->sizeInFrames - voice->frameCursorPos;
+        ma_uint32 framesToMix = (frameCount < framesLeft)? frameCount : framesLeft;
+
+        if (mixed)
+        {
+            const float *framesIn = (const float *)voice->source->data + voice->frameCursorPos*AUDIO_DEVICE_CHANNELS;
+
+            MixAudioFramesGain((float *)pFramesOut, framesIn, framesToMix, voice->volume*voice->source->volume, voice->pan);
+            AUDIO.Stats.stats.framesPassthrough += framesToMix;
+            activeVoices++;
+        }
+        else virtualVoices++;
+
+        voice->frameCursorPos += framesToMix;
+        if (voice->frameCursorPos >= voice->source->sizeInFrames) voice->source = NULL;
+    }
+
     rAudioProcessor *processor = AUDIO.mixedProcessor;
     while (processor)
     {
@@ -1899,52 +2533,669 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
         processor = processor->next;
     }
 
+    if ((AUDIO.Effects.enabled != 0) && (pDevice->playback.channels == 2)) ProcessAudioEffects((float *)pFramesOut, frameCount);
+
     ma_mutex_unlock(&AUDIO.System.lock);
+
+    // Callback deadline is the time it takes to play the frames it produced
+    AudioMixerStats *stats = &AUDIO.Stats.stats;
+    float duration = (float)ma_timer_get_time_in_seconds(&timer);
+
+    stats->callbackLast = duration;
+    stats->callbackAvg = (AUDIO.Stats.callbacks == 0)? duration : stats->callbackAvg + (duration - stats->callbackAvg)/64.0f;
+    if (duration > stats->callbackMax) stats->callbackMax = duration;
+    stats->callbackBudget = (float)frameCount/pDevice->sampleRate;
+    if (duration > stats->callbackBudget) stats->underruns++;
+    stats->activeBuffers = activeBuffers;
+    stats->activeVoices = activeVoices;
+    stats->virtualVoices = virtualVoices;
+
+    AUDIO.Stats.callbacks++;
+
+    TRACE_ZONE_END();
+}
+
+// Mix a static buffer in device format straight from its data, following the buffer cursor
+// NOTE: Same playback rules as ReadAudioBufferFramesInInternalFormat(): loop or stop at the end of data
+static void MixAudioBufferDirect(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
+{
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+    ma_uint32 framesMixed = 0;
+
+    while (framesMixed < frameCount)
+    {
+        ma_uint32 framesToMix = audioBuffer->sizeInFrames - audioBuffer->frameCursorPos;
+        if (framesToMix > (frameCount - framesMixed)) framesToMix = frameCount - framesMixed;
+
+        MixAudioFrames(framesOut + framesMixed*channels, (const float *)audioBuffer->data + audioBuffer->frameCursorPos*channels, framesToMix, audioBuffer);
+
+        framesMixed += framesToMix;
+        audioBuffer->frameCursorPos += framesToMix;
+        AUDIO.Stats.stats.framesPassthrough += framesToMix;
+
+        if (audioBuffer->frameCursorPos >= audioBuffer->sizeInFrames)
+        {
+            if (!audioBuffer->looping)
+            {
+                StopAudioBuffer(audioBuffer);
+                break;
+            }
+
+            audioBuffer->frameCursorPos = 0;
+        }
+    }
 }
 
 // Main mixing function, pretty simple in this project, just an accumulation
 // NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
-static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
+void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
 {
-    const float localVolume = buffer->volume;
-    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+    MixAudioFramesGain(framesOut, framesIn, frameCount, buffer->volume, buffer->pan);
+}
 
-    if (channels == 2)  // We consider panning
+// Get the left and right channel gains for a volume and pan
+// NOTE: Mono output does not consider panning, both gains are the volume
+static void GetPanGains(float volume, float pan, float *gainLeft, float *gainRight)
+{
+    if (AUDIO.System.device.playback.channels == 2)
     {
-        const float left = buffer->pan;
+        const float left = pan;
         const float right = 1.0f - left;
 
         // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
-        const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
+        *gainLeft = volume*0.5f*left*(3.0f - left*left);
+        *gainRight = volume*0.5f*right*(3.0f - right*right);
+    }
+    else
+    {
+        *gainLeft = volume;
+        *gainRight = volume;
+    }
+}
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+// Mix frames into output with the given volume and pan
+// NOTE: Frames are interleaved, so they are mixed as a flat array of samples
+static void MixAudioFramesGain(float *framesOut, const float *framesIn, ma_uint32 frameCount, float volume, float pan)
+{
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+    float left = 0.0f;
+    float right = 0.0f;
 
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+    GetPanGains(volume, pan, &left, &right);
+    MixSamples(framesOut, framesIn, frameCount*channels, left, right);
+}
 
-            frameOut += 2;
-            frameIn += 2;
+// Mix a sound buffer into output resampled by a pitch step, with the given volume and pan
+// NOTE: The position is 16.16 fixed point in source frames and advances by step every output frame, each frame
+// interpolated linearly between the two source frames around it (the one after the last reads as silence).
+// Cost is a lerp per sample over MixAudioFramesGain(), no converter is involved.
+// Returns the number of frames mixed, less than frameCount if the buffer ends
+static ma_uint32 MixAudioFramesResampled(float *framesOut, ma_uint32 frameCount, const AudioBuffer *source, ma_uint64 *position, ma_uint32 step, float volume, float pan)
+{
+    static const float silence[AUDIO_DEVICE_CHANNELS] = { 0 };
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+    const float *samples = (const float *)source->data;
+    const ma_uint64 end = (ma_uint64)source->sizeInFrames << 16;
+    ma_uint64 cursor = *position;
+    float left = 0.0f;
+    float right = 0.0f;
+    ma_uint32 i = 0;
+
+    GetPanGains(volume, pan, &left, &right);
+
+    for (; (i < frameCount) && (cursor < end); i++, cursor += step)
+    {
+        ma_uint32 frame = (ma_uint32)(cursor >> 16);
+        float t = (float)(cursor & 0xFFFF)*(1.0f/AUDIO_VOICE_PITCH_UNIT);
+        const float *a = samples + frame*channels;
+        const float *b = ((frame + 1) < source->sizeInFrames)? a + channels : silence;
+
+        if (channels == 2)
+        {
+            framesOut[i*2] += (a[0] + (b[0] - a[0])*t)*left;
+            framesOut[i*2 + 1] += (a[1] + (b[1] - a[1])*t)*right;
         }
+        else
+        {
+            for (ma_uint32 c = 0; c < channels; c++) framesOut[i*channels + c] += (a[c] + (b[c] - a[c])*t)*left;
+        }
+    }
+
+    *position = cursor;
+
+    return i;
+}
+
+// Mixing kernel, portable version
+// NOTE: Also used for the samples left over by the vectorized kernels
+static void MixSamplesScalar(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float left, float right)
+{
+    ma_uint32 i = 0;
+
+    for (; (i + 1) < sampleCount; i += 2)
+    {
+        samplesOut[i] += (samplesIn[i]*left);
+        samplesOut[i + 1] += (samplesIn[i + 1]*right);
+    }
+
+    if (i < sampleCount) samplesOut[i] += (samplesIn[i]*left);
+}
+
+// Mixing kernels, vectorized versions
+// NOTE: Kernels process 8 samples per iteration (4 stereo frames) and leave the rest to MixSamplesScalar(),
+// sample count is always a multiple of channels so the left/right gain pattern stays aligned
+#if defined(MA_SUPPORT_SSE2)
+static void MixSamplesSSE2(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float left, float right)
+{
+    const __m128 gain = _mm_setr_ps(left, right, left, right);
+    ma_uint32 i = 0;
+
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        __m128 out0 = _mm_add_ps(_mm_loadu_ps(samplesOut + i), _mm_mul_ps(_mm_loadu_ps(samplesIn + i), gain));
+        __m128 out1 = _mm_add_ps(_mm_loadu_ps(samplesOut + i + 4), _mm_mul_ps(_mm_loadu_ps(samplesIn + i + 4), gain));
+        _mm_storeu_ps(samplesOut + i, out0);
+        _mm_storeu_ps(samplesOut + i + 4, out1);
+    }
+
+    MixSamplesScalar(samplesOut + i, samplesIn + i, sampleCount - i, left, right);
+}
+#endif
+
+// NOTE: AVX2 kernel is built even if the compiler is not allowed to freely generate AVX2 code (GCC/Clang),
+// it is only called when the CPU supports it
+#if defined(MA_SUPPORT_AVX2)
+    #define RAUDIO_SUPPORT_AVX2
+    #define RAUDIO_TARGET_AVX2
+#elif (defined(MA_X64) || defined(MA_X86)) && (defined(__GNUC__) || defined(__clang__)) && !defined(MA_NO_AVX2) && !defined(__COSMOPOLITAN__)
+    #include <immintrin.h>
+    #define RAUDIO_SUPPORT_AVX2
+    #define RAUDIO_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+#if defined(RAUDIO_SUPPORT_AVX2)
+RAUDIO_TARGET_AVX2 static void MixSamplesAVX2(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float left, float right)
+{
+    const __m256 gain = _mm256_setr_ps(left, right, left, right, left, right, left, right);
+    ma_uint32 i = 0;
+
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        _mm256_storeu_ps(samplesOut + i, _mm256_add_ps(_mm256_loadu_ps(samplesOut + i), _mm256_mul_ps(_mm256_loadu_ps(samplesIn + i), gain)));
+    }
+
+    MixSamplesScalar(samplesOut + i, samplesIn + i, sampleCount - i, left, right);
+}
+#endif
+
+// NOTE: WebAssembly SIMD can't be detected at run time, a module built with -msimd128 only loads on
+// browsers that support it, so the kernel is used whenever it is compiled in
+#if defined(__wasm_simd128__)
+    #include <wasm_simd128.h>
+
+static void MixSamplesWasmSIMD(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float left, float right)
+{
+    const v128_t gain = wasm_f32x4_make(left, right, left, right);
+    ma_uint32 i = 0;
+
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        v128_t out0 = wasm_f32x4_add(wasm_v128_load(samplesOut + i), wasm_f32x4_mul(wasm_v128_load(samplesIn + i), gain));
+        v128_t out1 = wasm_f32x4_add(wasm_v128_load(samplesOut + i + 4), wasm_f32x4_mul(wasm_v128_load(samplesIn + i + 4), gain));
+        wasm_v128_store(samplesOut + i, out0);
+        wasm_v128_store(samplesOut + i + 4, out1);
+    }
+
+    MixSamplesScalar(samplesOut + i, samplesIn + i, sampleCount - i, left, right);
+}
+#endif
+
+#if defined(MA_SUPPORT_NEON)
+static void MixSamplesNEON(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float left, float right)
+{
+    const float levels[4] = { left, right, left, right };
+    const float32x4_t gain = vld1q_f32(levels);
+    ma_uint32 i = 0;
+
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        float32x4_t out0 = vmlaq_f32(vld1q_f32(samplesOut + i), vld1q_f32(samplesIn + i), gain);
+        float32x4_t out1 = vmlaq_f32(vld1q_f32(samplesOut + i + 4), vld1q_f32(samplesIn + i + 4), gain);
+        vst1q_f32(samplesOut + i, out0);
+        vst1q_f32(samplesOut + i + 4, out1);
+    }
+
+    MixSamplesScalar(samplesOut + i, samplesIn + i, sampleCount - i, left, right);
+}
+#endif
+
+// Select the fastest mixing kernel supported by the CPU
+static void SelectMixSamplesKernel(void)
+{
+    const char *name = "scalar";
+    MixSamples = MixSamplesScalar;
+
+#if defined(__wasm_simd128__)
+    MixSamples = MixSamplesWasmSIMD; name = "WebAssembly SIMD";
+#endif
+#if defined(MA_SUPPORT_NEON)
+    if (ma_has_neon()) { MixSamples = MixSamplesNEON; name = "NEON"; }
+#endif
+#if defined(MA_SUPPORT_SSE2)
+    if (ma_has_sse2()) { MixSamples = MixSamplesSSE2; name = "SSE2"; }
+#endif
+#if defined(MA_SUPPORT_AVX2)
+    if (ma_has_avx2()) { MixSamples = MixSamplesAVX2; name = "AVX2"; }
+#elif defined(RAUDIO_SUPPORT_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) { MixSamples = MixSamplesAVX2; name = "AVX2"; }
+#endif
+
+    TRACELOG(LOG_INFO, "AUDIO: Mixing kernel: %s", name);
+}
+
+// Built-in effects kernels, written once over 4-wide vectors of the target's SIMD extension
+// NOTE: A vector holds 2 stereo frames, the scalar loops take what is left and builds without SIMD.
+// SIMD is required by the x86_64 and arm64 ABIs, so it is selected at compile time
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define RAUDIO_EFFECTS_SIMD
+    typedef __m128 EffectVector;
+    #define EffectLoad(p)           _mm_loadu_ps(p)
+    #define EffectStore(p, v)       _mm_storeu_ps(p, v)
+    #define EffectSet(a, b, c, d)   _mm_setr_ps(a, b, c, d)
+    #define EffectAdd(a, b)         _mm_add_ps(a, b)
+    #define EffectSub(a, b)         _mm_sub_ps(a, b)
+    #define EffectMul(a, b)         _mm_mul_ps(a, b)
+    #define EffectMax(a, b)         _mm_max_ps(a, b)
+    #define EffectAbs(v)            _mm_andnot_ps(_mm_set1_ps(-0.0f), v)
+    #define EffectShiftFrame(v)     _mm_movelh_ps(_mm_setzero_ps(), v)    // { 0, 0, v0, v1 }
+    #define EffectHighFrame(v)      _mm_movehl_ps(v, v)                   // { v2, v3, v2, v3 }
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define RAUDIO_EFFECTS_SIMD
+    typedef float32x4_t EffectVector;
+    static inline float32x4_t EffectSet(float a, float b, float c, float d) { const float v[4] = { a, b, c, d }; return vld1q_f32(v); }
+    #define EffectLoad(p)           vld1q_f32(p)
+    #define EffectStore(p, v)       vst1q_f32(p, v)
+    #define EffectAdd(a, b)         vaddq_f32(a, b)
+    #define EffectSub(a, b)         vsubq_f32(a, b)
+    #define EffectMul(a, b)         vmulq_f32(a, b)
+    #define EffectMax(a, b)         vmaxq_f32(a, b)
+    #define EffectAbs(v)            vabsq_f32(v)
+    #define EffectShiftFrame(v)     vcombine_f32(vdup_n_f32(0.0f), vget_low_f32(v))
+    #define EffectHighFrame(v)      vcombine_f32(vget_high_f32(v), vget_high_f32(v))
+#elif defined(__wasm_simd128__)
+    #define RAUDIO_EFFECTS_SIMD
+    typedef v128_t EffectVector;
+    #define EffectLoad(p)           wasm_v128_load(p)
+    #define EffectStore(p, v)       wasm_v128_store(p, v)
+    #define EffectSet(a, b, c, d)   wasm_f32x4_make(a, b, c, d)
+    #define EffectAdd(a, b)         wasm_f32x4_add(a, b)
+    #define EffectSub(a, b)         wasm_f32x4_sub(a, b)
+    #define EffectMul(a, b)         wasm_f32x4_mul(a, b)
+    #define EffectMax(a, b)         wasm_f32x4_max(a, b)
+    #define EffectAbs(v)            wasm_f32x4_abs(v)
+    #define EffectShiftFrame(v)     wasm_i32x4_shuffle(wasm_f32x4_splat(0.0f), v, 0, 1, 4, 5)
+    #define EffectHighFrame(v)      wasm_i32x4_shuffle(v, v, 2, 3, 2, 3)
+#endif
+
+// Delay line length of each reverb comb filter, mutually prime so their echoes don't line up
+static const ma_uint32 reverbCombFrames[AUDIO_REVERB_COMBS] = { 1214, 1293, 1390, 1476 };
+
+// One-pole low-pass over stereo samples in place, y = a*x + (1 - a)*y[-1], or the high-pass x - y
+// NOTE: The filter is recursive, vectors take 2 frames at a time by expanding the second frame
+// output: y1 = a*x1 + b*a*x0 + b*b*y[-1], which halves the dependency chain
+static void EffectOnePole(float *samples, ma_uint32 sampleCount, float a, float *state, bool highpass)
+{
+    const float b = 1.0f - a;
+    float left = state[0];
+    float right = state[1];
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_EFFECTS_SIMD)
+    const EffectVector gain = EffectSet(a, a, a, a);
+    const EffectVector feedback = EffectSet(b, b, b, b);
+    const EffectVector history = EffectSet(b, b, b*b, b*b);
+    EffectVector previous = EffectSet(left, right, left, right);
+
+    for (; (i + 4) <= sampleCount; i += 4)
+    {
+        EffectVector x = EffectLoad(samples + i);
+        EffectVector t = EffectMul(x, gain);
+        EffectVector y = EffectAdd(EffectAdd(t, EffectMul(EffectShiftFrame(t), feedback)), EffectMul(previous, history));
+
+        previous = EffectHighFrame(y);
+        EffectStore(samples + i, highpass? EffectSub(x, y) : y);
+    }
+
+    float last[4];
+    EffectStore(last, previous);
+    left = last[0];
+    right = last[1];
+#endif
+
+    for (; (i + 1) < sampleCount; i += 2)
+    {
+        left = a*samples[i] + b*left;
+        right = a*samples[i + 1] + b*right;
+        samples[i] = highpass? samples[i] - left : left;
+        samples[i + 1] = highpass? samples[i + 1] - right : right;
+    }
+
+    state[0] = left;
+    state[1] = right;
+}
+
+// Feedback comb filter over a run of a delay line: the line sample is the signal delayed by its length,
+// added to output and fed back into the line with the input
+static void EffectComb(const float *samplesIn, float *line, float *samplesOut, ma_uint32 sampleCount, float decay)
+{
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_EFFECTS_SIMD)
+    const EffectVector feedback = EffectSet(decay, decay, decay, decay);
+
+    for (; (i + 4) <= sampleCount; i += 4)
+    {
+        EffectVector delayed = EffectLoad(line + i);
+        EffectStore(line + i, EffectAdd(EffectLoad(samplesIn + i), EffectMul(delayed, feedback)));
+        EffectStore(samplesOut + i, EffectAdd(EffectLoad(samplesOut + i), delayed));
+    }
+#endif
+
+    for (; i < sampleCount; i++)
+    {
+        float delayed = line[i];
+        line[i] = samplesIn[i] + delayed*decay;
+        samplesOut[i] += delayed;
+    }
+}
+
+// Largest absolute sample
+static float EffectPeak(const float *samples, ma_uint32 sampleCount)
+{
+    float peak = 0.0f;
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_EFFECTS_SIMD)
+    EffectVector peaks = EffectSet(0.0f, 0.0f, 0.0f, 0.0f);
+    for (; (i + 4) <= sampleCount; i += 4) peaks = EffectMax(peaks, EffectAbs(EffectLoad(samples + i)));
+
+    float lanes[4];
+    EffectStore(lanes, peaks);
+    for (int k = 0; k < 4; k++) if (lanes[k] > peak) peak = lanes[k];
+#endif
+
+    for (; i < sampleCount; i++)
+    {
+        float level = (samples[i] < 0.0f)? -samples[i] : samples[i];
+        if (level > peak) peak = level;
     }
-    else  // We do not consider panning
+
+    return peak;
+}
+
+// Scale stereo samples by a gain going linearly from start, one step per frame
+static void EffectGainRamp(float *samples, ma_uint32 sampleCount, float start, float step)
+{
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_EFFECTS_SIMD)
+    EffectVector gain = EffectSet(start, start, start + step, start + step);
+    const EffectVector increment = EffectSet(2*step, 2*step, 2*step, 2*step);
+
+    for (; (i + 4) <= sampleCount; i += 4)
+    {
+        EffectStore(samples + i, EffectMul(EffectLoad(samples + i), gain));
+        gain = EffectAdd(gain, increment);
+    }
+#endif
+
+    for (; (i + 1) < sampleCount; i += 2)
+    {
+        float gain = start + step*(i/2);
+        samples[i] *= gain;
+        samples[i + 1] *= gain;
+    }
+}
+
+// Add scaled samples into output
+static void EffectAddScaled(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float scale)
+{
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_EFFECTS_SIMD)
+    const EffectVector gain = EffectSet(scale, scale, scale, scale);
+    for (; (i + 4) <= sampleCount; i += 4) EffectStore(samplesOut + i, EffectAdd(EffectLoad(samplesOut + i), EffectMul(EffectLoad(samplesIn + i), gain)));
+#endif
+
+    for (; i < sampleCount; i++) samplesOut[i] += samplesIn[i]*scale;
+}
+
+// One-pole coefficient for a cutoff frequency
+static float OnePoleCoefficient(float cutoff, float sampleRate)
+{
+    if (cutoff < 1.0f) cutoff = 1.0f;
+    else if (cutoff > sampleRate*0.5f) cutoff = sampleRate*0.5f;
+
+    return 1.0f - (float)ma_expd(-MA_TAU_D*cutoff/sampleRate);
+}
+
+// Configure a built-in effect from its command
+// NOTE: An effect that was off starts from silence, not from whatever it held when it was turned off
+static void SetAudioEffectState(const AudioCommand *command)
+{
+    const unsigned int bit = 1u << command->voiceId;
+    const bool starting = ((AUDIO.Effects.enabled & bit) == 0);
+    const float sampleRate = (float)AUDIO.System.device.sampleRate;
+
+    switch (command->voiceId)
+    {
+        case AUDIO_EFFECT_HIGHPASS:
+        {
+            AUDIO.Effects.highpass = OnePoleCoefficient(command->value, sampleRate);
+            if (starting) memset(AUDIO.Effects.highpassState, 0, sizeof(AUDIO.Effects.highpassState));
+        } break;
+        case AUDIO_EFFECT_LOWPASS:
+        {
+            AUDIO.Effects.lowpass = OnePoleCoefficient(command->value, sampleRate);
+            if (starting) memset(AUDIO.Effects.lowpassState, 0, sizeof(AUDIO.Effects.lowpassState));
+        } break;
+        case AUDIO_EFFECT_REVERB:
+        {
+            AUDIO.Effects.reverbWet = command->value;
+            AUDIO.Effects.reverbDecay = (command->pan < 0.0f)? 0.0f : (command->pan > 0.98f)? 0.98f : command->pan;
+            if (starting)
+            {
+                memset(AUDIO.Effects.reverbLines, 0, sizeof(AUDIO.Effects.reverbLines));
+                memset(AUDIO.Effects.reverbCursor, 0, sizeof(AUDIO.Effects.reverbCursor));
+            }
+        } break;
+        case AUDIO_EFFECT_LIMITER:
+        {
+            AUDIO.Effects.gain = command->value;
+            AUDIO.Effects.ceiling = (command->pan > 0.0f)? command->pan : 1.0f;
+            AUDIO.Effects.release = 1.0f - (float)ma_expd(-(double)AUDIO_EFFECT_CHUNK_FRAMES/(sampleRate*AUDIO_LIMITER_RELEASE));
+            if (starting) AUDIO.Effects.limiterGain = 1.0f;
+        } break;
+        default: break;
+    }
+
+    AUDIO.Effects.enabled |= bit;
+}
+
+// Run the enabled built-in effects over stereo frames, a block of AUDIO_EFFECT_CHUNK_FRAMES at a time
+static void ProcessAudioEffects(float *samples, ma_uint32 frameCount)
+{
+    const unsigned int enabled = AUDIO.Effects.enabled;
+
+    for (ma_uint32 frame = 0; frame < frameCount; frame += AUDIO_EFFECT_CHUNK_FRAMES)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
+        ma_uint32 frames = (frameCount - frame < AUDIO_EFFECT_CHUNK_FRAMES)? frameCount - frame : AUDIO_EFFECT_CHUNK_FRAMES;
+        float *block = samples + frame*2;
+
+        if (enabled & (1u << AUDIO_EFFECT_HIGHPASS)) EffectOnePole(block, frames*2, AUDIO.Effects.highpass, AUDIO.Effects.highpassState, true);
+        if (enabled & (1u << AUDIO_EFFECT_LOWPASS)) EffectOnePole(block, frames*2, AUDIO.Effects.lowpass, AUDIO.Effects.lowpassState, false);
+
+        if (enabled & (1u << AUDIO_EFFECT_REVERB))
         {
-            for (ma_uint32 c = 0; c < channels; c++)
+            float wet[AUDIO_EFFECT_CHUNK_FRAMES*2] = { 0 };
+            float *line = AUDIO.Effects.reverbLines;
+
+            for (int c = 0; c < AUDIO_REVERB_COMBS; c++)
             {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
+                // Runs split where the delay line wraps, so the kernel always sees contiguous samples
+                ma_uint32 *cursor = &AUDIO.Effects.reverbCursor[c];
+                for (ma_uint32 done = 0; done < frames;)
+                {
+                    ma_uint32 run = reverbCombFrames[c] - *cursor;
+                    if (run > frames - done) run = frames - done;
+
+                    EffectComb(block + done*2, line + (*cursor)*2, wet + done*2, run*2, AUDIO.Effects.reverbDecay);
+
+                    *cursor += run;
+                    if (*cursor == reverbCombFrames[c]) *cursor = 0;
+                    done += run;
+                }
 
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
+                line += reverbCombFrames[c]*2;
             }
+
+            EffectAddScaled(block, wet, frames*2, AUDIO.Effects.reverbWet/AUDIO_REVERB_COMBS);
+        }
+
+        if (enabled & (1u << AUDIO_EFFECT_LIMITER))
+        {
+            // The block's peak is known before its gain is set, so a gain reduction takes effect from the block
+            // start and nothing goes over the ceiling. Gain recovers towards unity ramped over each block
+            float gain = AUDIO.Effects.gain;
+            float peak = EffectPeak(block, frames*2)*gain;
+            float target = (peak > AUDIO.Effects.ceiling)? AUDIO.Effects.ceiling/peak : 1.0f;
+
+            float start = AUDIO.Effects.limiterGain;
+            float end = target;
+            if (target >= start) end = start + (target - start)*AUDIO.Effects.release;
+            else start = target;
+
+            EffectGainRamp(block, frames*2, start*gain, (end - start)*gain/frames);
+            AUDIO.Effects.limiterGain = end;
         }
     }
 }
 
+// Queue a command for the audio thread
+// NOTE: Single producer (game thread), the queue is lock-free and never blocks.
+// Returns false if the device is not ready or the queue is full
+static bool PushAudioCommand(AudioCommand command)
+{
+    if (!AUDIO.System.isReady) return false;
+
+    ma_uint32 head = AUDIO.Command.head;
+    ma_uint32 tail = c89atomic_load_explicit_32(&AUDIO.Command.tail, c89atomic_memory_order_acquire);
+
+    if ((head - tail) >= AUDIO_COMMAND_QUEUE_SIZE)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Commands queue is full, command dropped");
+        return false;
+    }
+
+    AUDIO.Command.queue[head & (AUDIO_COMMAND_QUEUE_SIZE - 1)] = command;
+    c89atomic_store_explicit_32(&AUDIO.Command.head, head + 1, c89atomic_memory_order_release);
+
+    return true;
+}
+
+// Apply all queued commands
+// NOTE: AUDIO.System.lock must be held (or the device stopped), so there is only one consumer at a time
+static void ProcessAudioCommands(void)
+{
+    ma_uint32 tail = AUDIO.Command.tail;
+    ma_uint32 head = c89atomic_load_explicit_32(&AUDIO.Command.head, c89atomic_memory_order_acquire);
+
+    for (; tail != head; tail++)
+    {
+        const AudioCommand *command = &AUDIO.Command.queue[tail & (AUDIO_COMMAND_QUEUE_SIZE - 1)];
+
+        switch (command->type)
+        {
+            case AUDIO_COMMAND_PLAY_VOICE:
+            {
+                // Plays of a sound at the same pitch in the same period would start on the same frame, they are
+                // mixed as one voice with the gains summed and the pans weighted by gain
+                // NOTE: The merged play's id is not kept, volume and pan changes for it are ignored
+                unsigned int pitchStep = (unsigned int)(command->pitch*AUDIO_VOICE_PITCH_UNIT + 0.5f);
+                AudioVoice *merged = NULL;
+                for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+                {
+                    AudioVoice *voice = &AUDIO.Voice.pool[i];
+                    if ((voice->source == command->buffer) && (voice->frameCursorPos == 0) && (voice->frameFraction == 0) && (voice->pitchStep == pitchStep))
+                    {
+                        merged = voice;
+                        break;
+                    }
+                }
+
+                if (merged != NULL)
+                {
+                    float volume = merged->volume + command->value;
+                    if (volume > 0.0f) merged->pan = (merged->pan*merged->volume + command->pan*command->value)/volume;
+                    merged->volume = volume;
+                    AUDIO.Stats.stats.mergedVoices++;
+                    break;
+                }
+
+                // Look for a free voice, keeping track of the oldest one in case there is none
+                int index = 0;
+                for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+                {
+                    if (AUDIO.Voice.pool[i].source == NULL)
+                    {
+                        index = i;
+                        break;
+                    }
+
+                    if ((int)(AUDIO.Voice.pool[i].id - AUDIO.Voice.pool[index].id) < 0) index = i;
+                }
+
+                AudioVoice *voice = &AUDIO.Voice.pool[index];
+                voice->source = command->buffer;
+                voice->frameCursorPos = 0;
+                voice->frameFraction = 0;
+                voice->pitchStep = pitchStep;
+                voice->volume = command->value;
+                voice->pan = command->pan;
+                voice->id = command->voiceId;
+            } break;
+            case AUDIO_COMMAND_STOP_VOICES:
+            {
+                for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+                {
+                    if (AUDIO.Voice.pool[i].source == command->buffer) AUDIO.Voice.pool[i].source = NULL;
+                }
+            } break;
+            case AUDIO_COMMAND_VOICE_VOLUME:
+            case AUDIO_COMMAND_VOICE_PAN:
+            {
+                for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+                {
+                    AudioVoice *voice = &AUDIO.Voice.pool[i];
+                    if ((voice->source == NULL) || (voice->id != command->voiceId)) continue;
+
+                    if (command->type == AUDIO_COMMAND_VOICE_VOLUME) voice->volume = command->value;
+                    else voice->pan = command->value;
+                }
+            } break;
+            case AUDIO_COMMAND_VOICE_BUDGET: AUDIO.Voice.budget = (int)command->value; break;
+            case AUDIO_COMMAND_SET_EFFECT: SetAudioEffectState(command); break;
+            case AUDIO_COMMAND_STOP_EFFECT: AUDIO.Effects.enabled &= ~(1u << command->voiceId); break;
+            default: break;
+        }
+    }
+
+    c89atomic_store_explicit_32(&AUDIO.Command.tail, tail, c89atomic_memory_order_release);
+}
+
 // Some required functions for audio standalone module version
 #if defined(RAUDIO_STANDALONE)
 // Check file extension
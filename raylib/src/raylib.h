@@ -115,7 +115,19 @@
 #endif
 
 // Allow custom memory allocators
-// NOTE: Require recompiling raylib sources
+// NOTE: Require recompiling raylib sources. Left undefined, allocations go through MemAllocTagged() and
+// friends, so the allocator can still be swapped at runtime (SetMemoryAllocator()) and every block is
+// accounted to the RL_MEMORY_TAG of the module that allocated it
+#if !defined(RL_MALLOC) && !defined(RL_CALLOC) && !defined(RL_REALLOC) && !defined(RL_FREE)
+    #define RL_MEMORY_HOOKS
+    #ifndef RL_MEMORY_TAG
+        #define RL_MEMORY_TAG   MEMORY_TAG_GENERAL
+    #endif
+    #define RL_MALLOC(sz)       MemAllocTagged(sz, RL_MEMORY_TAG)
+    #define RL_CALLOC(n,sz)     MemCallocTagged(n, sz, RL_MEMORY_TAG)
+    #define RL_REALLOC(ptr,sz)  MemReallocTagged(ptr, sz, RL_MEMORY_TAG)
+    #define RL_FREE(ptr)        MemFree(ptr)
+#endif
 #ifndef RL_MALLOC
     #define RL_MALLOC(sz)       malloc(sz)
 #endif
@@ -299,6 +311,10 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// Opaque struct declaration
+// NOTE: Actual struct is defined internally in rtext module
+typedef struct rGlyphLookup rGlyphLookup;
+
 // Font, font texture and GlyphInfo array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
@@ -307,6 +323,7 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    rGlyphLookup *lookup;   // Glyph index lookup table, built on font loading (optional)
 } Font;
 
 // Camera, defines position/orientation in 3d space
@@ -504,6 +521,145 @@ typedef struct FilePathList {
     char **paths;                   // Filepaths entries
 } FilePathList;
 
+// File view, read-only contents of a whole file
+typedef struct FileView {
+    const unsigned char *data;      // File contents, NULL if it could not be loaded
+    unsigned int size;              // File size in bytes
+    bool mapped;                    // Memory-mapped from the file, otherwise a copy loaded with LoadFileData()
+} FileView;
+
+// File watch, reports writes to a file without blocking
+typedef struct FileWatch {
+    void *state;                    // Platform watch state, NULL if the file could not be watched
+} FileWatch;
+
+// Mouse event, one cursor move or button change handled by PollInputEvents()
+typedef struct MouseEvent {
+    double time;                    // When the event was handled, GetTime() clock
+    Vector2 position;               // Mouse position after the event
+    int button;                     // Button that changed, -1 for a cursor move
+    unsigned int buttons;           // Buttons down after the event, bit per MouseButton
+} MouseEvent;
+
+// Gamepad sample, the state of a gamepad when it was read by StartGamepadSampling()
+typedef struct GamepadSample {
+    double time;                    // When it was read, GetTime() clock
+    float axes[6];                  // Axis values by GamepadAxis, the device's own order where it is read directly (Linux)
+    unsigned int buttons;           // Buttons down, bit per GamepadButton
+} GamepadSample;
+
+// Frame timings, breakdown of the last EndDrawing() call
+typedef struct FrameTimings {
+    double batch;                   // Seconds spent flushing the render batch
+    double swap;                    // Seconds spent swapping screen buffers
+    double swapEnd;                 // Time the swap returned, GetTime() clock
+    double wait;                    // Seconds spent waiting for the target frame time
+    int drawCalls;                  // Draw calls submitted during the frame
+    int vertices;                   // Vertices submitted during the frame
+    int batchOverflows;             // Render batch flushes forced by a full batch during the frame
+    int culled;                     // Shapes and glyphs skipped during the frame as outside viewport/scissor
+    double gpuFrame;                // Seconds the GPU spent on a recent frame, 0 without timer queries
+    double gpuBatch;                // Seconds of gpuFrame spent drawing render batches
+    int gpuLatency;                 // Frames ago the GPU timings were measured (read back without stalling)
+    double latencyWait;             // Seconds spent waiting for the GPU to keep within the frame latency limit
+} FrameTimings;
+
+// Startup trace, launch timeline marked with TraceStartupPhase()
+// NOTE: Each mark is the end of a phase, the time since the previous mark went to it
+typedef struct StartupTrace {
+    int phaseCount;                 // Phases marked, later marks are dropped once the arrays are full
+    const char *phases[32];         // Phase names (static strings)
+    double times[32];               // Seconds since the first mark each phase ended at
+} StartupTrace;
+
+// Frame memory, per-frame linear arena usage
+typedef struct FrameMemoryStats {
+    unsigned int capacity;          // Arena size in bytes (FRAME_MEMORY_SIZE)
+    unsigned int used;              // Bytes allocated during the last finished frame, overflow included
+    unsigned int highWater;         // Most bytes any frame has allocated, size the arena above this
+    unsigned int overflows;         // Allocations that did not fit and went to the heap instead
+} FrameMemoryStats;
+
+// Memory tags, the subsystem an allocation is accounted to
+typedef enum {
+    MEMORY_TAG_GENERAL = 0,         // Anything not listed below: files, strings, core
+    MEMORY_TAG_AUDIO,               // Waves, sounds, music streams and the audio device
+    MEMORY_TAG_TEXTURES,            // Image pixel data
+    MEMORY_TAG_TEXT,                // Fonts, glyphs and text layouts
+    MEMORY_TAG_BATCH,               // rlgl render batches, shaders and meshes data
+    MEMORY_TAG_GAME,                // Free for the application
+    MEMORY_TAG_COUNT
+} MemoryTag;
+
+// Memory tag stats, also the totals of all tags
+typedef struct MemoryTagStats {
+    unsigned int liveBytes;         // Bytes currently allocated
+    unsigned int peakBytes;         // Most bytes allocated at once
+    unsigned int liveCount;         // Allocations not freed yet
+    unsigned int totalCount;        // Allocations made since start
+    unsigned int failures;          // Allocations the allocator returned NULL for
+    unsigned int operations;        // Allocations, reallocations and frees since start, diff it to count a frame's
+} MemoryTagStats;
+
+// Memory allocator backend
+// NOTE: Sizes and tags are passed through so a backend can keep one arena per tag. reallocate may be NULL,
+// then blocks are moved with allocate() and deallocate(), and deallocate may do nothing for an arena
+typedef struct MemoryAllocator {
+    void *(*allocate)(unsigned int size, int tag, void *user);
+    void *(*reallocate)(void *ptr, unsigned int size, int tag, void *user);
+    void (*deallocate)(void *ptr, int tag, void *user);
+    void *user;                     // Passed to every call, the arena state for example
+} MemoryAllocator;
+
+// Random stream, xoshiro128** generator state
+// NOTE: Streams are independent, drawing from one never moves another, and each is only as
+// thread-safe as its owner makes it. Seed with SetRandomStreamSeed() before use
+typedef struct RandomStream {
+    unsigned int state[4];          // Generator state, never all zero once seeded
+} RandomStream;
+
+// Audio device config, requested playback period
+typedef struct AudioDeviceConfig {
+    unsigned int periodSizeInFrames; // Period size in frames requested (0 for backend default)
+    unsigned int periods;           // Periods count requested (0 for backend default)
+    bool lowLatency;                // Low latency performance profile (smaller default periods, more CPU)
+    int threadPriority;             // Audio thread priority (ThreadPriority), PRIORITY_NORMAL keeps the backend default (already elevated)
+} AudioDeviceConfig;
+
+// Built-in effects for the mixed output, applied in this order after the mixed processors
+typedef enum {
+    AUDIO_EFFECT_HIGHPASS = 0,      // One-pole high-pass, value: cutoff in Hz
+    AUDIO_EFFECT_LOWPASS,           // One-pole low-pass, value: cutoff in Hz
+    AUDIO_EFFECT_REVERB,            // Comb filter reverb, value: wet level, value2: decay (0.0f to 1.0f)
+    AUDIO_EFFECT_LIMITER            // Output gain and peak limiter, value: gain, value2: ceiling (peak level)
+} AudioEffect;
+
+// Audio mixer statistics, measured on the audio thread
+typedef struct AudioMixerStats {
+    float callbackLast;             // Seconds spent in the last mixing callback
+    float callbackAvg;              // Seconds spent per mixing callback, running average
+    float callbackMax;              // Seconds spent in the slowest mixing callback
+    float callbackBudget;           // Seconds of audio produced by the last mixing callback (its deadline)
+    float lockWait;                 // Seconds waited for the mixer lock in the last callback
+    int activeBuffers;              // Audio buffers playing in the last callback
+    int activeVoices;               // Sound pool voices mixed in the last callback
+    int virtualVoices;              // Sound pool voices over the budget in the last callback, advanced without mixing
+    unsigned int framesConverted;   // Frames read through the data converter
+    unsigned int framesPassthrough; // Frames mixed without conversion
+    unsigned int underruns;         // Mixing callbacks that took longer than their deadline
+    unsigned int musicStarved;      // Frames of silence mixed because a music decoder fell behind
+    unsigned int mergedVoices;      // Voice plays merged into a play of the same sound in the same period
+} AudioMixerStats;
+
+// Text layout, glyph quads of a string built once to be drawn many times
+typedef struct TextLayout {
+    unsigned int textureId;         // Font texture id (OpenGL) the glyphs are sampled from
+    int quadCount;                  // Glyph quads count
+    Rectangle *quads;               // Glyph quads, relative to layout position
+    Rectangle *texcoords;           // Glyph quads normalized texture coordinates
+    Rectangle bounds;               // Bounding rectangle of all glyph quads, relative to layout position
+} TextLayout;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -525,9 +681,27 @@ typedef enum {
     FLAG_WINDOW_HIGHDPI     = 0x00002000,   // Set to support HighDPI
     FLAG_WINDOW_MOUSE_PASSTHROUGH = 0x00004000, // Set to support mouse passthrough, only supported when FLAG_WINDOW_UNDECORATED
     FLAG_MSAA_4X_HINT       = 0x00000020,   // Set to try enabling MSAA 4X
-    FLAG_INTERLACED_HINT    = 0x00010000    // Set to try enabling interlaced video format (for V3D)
+    FLAG_INTERLACED_HINT    = 0x00010000,   // Set to try enabling interlaced video format (for V3D)
+    FLAG_WINDOW_OFFSCREEN   = 0x00020000    // Set to render without a display, surfaceless EGL or OSMesa context (PLATFORM_DESKTOP)
 } ConfigFlags;
 
+// Presentation modes, how finished frames reach the display
+// NOTE: Only PLATFORM_DESKTOP chooses, the other platforms always present on vertical blank
+typedef enum {
+    PRESENT_IMMEDIATE = 0,          // No V-Sync, frames are shown as soon as they are done and may tear
+    PRESENT_VSYNC,                  // V-Sync, a frame that misses a vertical blank waits for the next one
+    PRESENT_ADAPTIVE_VSYNC,         // V-Sync, a late frame is shown right away and may tear (EXT_swap_control_tear)
+    PRESENT_VARIABLE_REFRESH        // V-Sync with frames limited just under the refresh rate, for G-Sync/FreeSync displays
+} PresentMode;
+
+// Thread priority, for SetCurrentThreadPriority() and the audio device thread
+typedef enum {
+    PRIORITY_LOW = -1,              // Background work: loaders, encoders, writers
+    PRIORITY_NORMAL = 0,            // Default priority
+    PRIORITY_HIGH,                  // Elevated priority, may need privileges
+    PRIORITY_REALTIME               // Real-time scheduling, needs privileges on most systems
+} ThreadPriority;
+
 // Trace log level
 // NOTE: Organized by priority level
 typedef enum {
@@ -868,7 +1042,8 @@ typedef enum {
     BLEND_SUBTRACT_COLORS,          // Blend textures subtracting colors (alternative)
     BLEND_ALPHA_PREMULTIPLY,        // Blend premultiplied textures considering alpha
     BLEND_CUSTOM,                   // Blend textures using custom src/dst factors (use rlSetBlendFactors())
-    BLEND_CUSTOM_SEPARATE           // Blend textures using custom rgb/alpha separate src/dst factors (use rlSetBlendFactorsSeparate())
+    BLEND_CUSTOM_SEPARATE,          // Blend textures using custom rgb/alpha separate src/dst factors (use rlSetBlendFactorsSeparate())
+    BLEND_OPAQUE                    // Blending disabled, source overwrites destination (draw opaque layers first)
 } BlendMode;
 
 // Gesture
@@ -976,6 +1151,10 @@ RLAPI void SetClipboardText(const char *text);                    // Set clipboa
 RLAPI const char *GetClipboardText(void);                         // Get clipboard text content
 RLAPI void EnableEventWaiting(void);                              // Enable waiting for events on EndDrawing(), no automatic event polling
 RLAPI void DisableEventWaiting(void);                             // Disable waiting for events on EndDrawing(), automatic events polling
+RLAPI void SetPresentMode(int mode);                              // Set presentation mode (PresentMode), falls back to V-Sync if not supported
+RLAPI int GetPresentMode(void);                                   // Get presentation mode in use
+RLAPI void SetFrameLatencyLimit(int frames);                      // Set maximum frames queued on the GPU after a swap, 0 leaves it to the driver
+RLAPI int GetFrameLatencyLimit(void);                             // Get maximum frames queued on the GPU after a swap
 
 // Custom frame control functions
 // NOTE: Those functions are intended for advance users that want full control over the frame processing
@@ -1043,18 +1222,45 @@ RLAPI void SetTargetFPS(int fps);                                 // Set target
 RLAPI int GetFPS(void);                                           // Get current FPS
 RLAPI float GetFrameTime(void);                                   // Get time in seconds for last frame drawn (delta time)
 RLAPI double GetTime(void);                                       // Get elapsed time in seconds since InitWindow()
+RLAPI FrameTimings GetFrameTimings(void);                         // Get time and draw statistics breakdown for last frame drawn
+RLAPI void TraceStartupPhase(const char *phase);                  // Mark the end of a startup phase, the first mark starts the trace (any thread, can be called before InitWindow())
+RLAPI StartupTrace GetStartupTrace(void);                         // Get startup phases marked so far, raylib marks its own init and the first presented frame
+RLAPI bool SetCurrentThreadPriority(int priority);                // Set the calling thread priority (ThreadPriority), false if the system refused
+RLAPI bool SetCurrentThreadAffinity(int core);                    // Pin the calling thread to a CPU core (-1 for any core), false if not supported
 
 // Misc. functions
 RLAPI int GetRandomValue(int min, int max);                       // Get a random value between min and max (both included)
 RLAPI void SetRandomSeed(unsigned int seed);                      // Set the seed for the random number generator
+RLAPI void SetRandomStreamSeed(RandomStream *stream, unsigned int seed, unsigned int id); // Seed a random stream, streams with the same seed and different ids are independent
+RLAPI unsigned int GetRandomStreamBits(RandomStream *stream);     // Get 32 random bits from a stream
+RLAPI int GetRandomStreamValue(RandomStream *stream, int min, int max); // Get a random value between min and max (both included), unbiased over any range
+RLAPI float GetRandomStreamFloat(RandomStream *stream);           // Get a random value in [0.0f, 1.0f)
+RLAPI void FillRandomStreamValues(RandomStream *stream, int *values, int count, int min, int max); // Fill values with random values between min and max (both included)
+RLAPI void FillRandomStreamFloats(RandomStream *stream, float *values, int count); // Fill values with random values in [0.0f, 1.0f)
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (filename extension defines format)
+RLAPI void TakeScreenshotAsync(const char *fileName);             // Takes a screenshot without stalling, read back and written over the next frames (.tga always supported)
+RLAPI void StartVideoRecording(const char *fileName, int fps);    // Start recording the screen to a .y4m video, frames are dropped rather than stalling
+RLAPI void StopVideoRecording(void);                              // Stop recording, frames in flight are still written
+RLAPI bool IsVideoRecording(void);                                // Check if the screen is being recorded
 RLAPI void SetConfigFlags(unsigned int flags);                    // Setup init configuration flags (view FLAGS)
 
 RLAPI void TraceLog(int logLevel, const char *text, ...);         // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR...)
 RLAPI void SetTraceLogLevel(int logLevel);                        // Set the current threshold (minimum) log level
+RLAPI void SetTraceLogAsync(bool enabled);                        // Set trace log messages to be written by a background thread, TraceLog() never blocks
+RLAPI void BeginTraceZone(const char *name);                      // Begin a timeline zone on the calling thread, zones nest (name must be a static string)
+RLAPI void EndTraceZone(void);                                    // End the innermost zone open on the calling thread
+RLAPI bool ExportTraceZones(const char *fileName);                // Export recent zones of every thread as Chrome trace event JSON (chrome://tracing, ui.perfetto.dev)
 RLAPI void *MemAlloc(unsigned int size);                          // Internal memory allocator
 RLAPI void *MemRealloc(void *ptr, unsigned int size);             // Internal memory reallocator
 RLAPI void MemFree(void *ptr);                                    // Internal memory free
+RLAPI void *MemAllocFrame(unsigned int size);                     // Frame memory allocator, released on the next BeginDrawing(), never freed by the caller
+RLAPI FrameMemoryStats GetFrameMemoryStats(void);                 // Get frame memory arena usage and high-water mark
+RLAPI void *MemAllocTagged(unsigned int size, int tag);           // Memory allocator accounted to a tag (MemoryTag), not zeroed
+RLAPI void *MemCallocTagged(unsigned int count, unsigned int size, int tag); // Memory allocator accounted to a tag, zeroed
+RLAPI void *MemReallocTagged(void *ptr, unsigned int size, int tag); // Memory reallocator, a block keeps the tag it was allocated with
+RLAPI void SetMemoryAllocator(MemoryAllocator allocator);         // Set memory allocator backend, call before anything is allocated
+RLAPI MemoryTagStats GetMemoryTagStats(int tag);                  // Get live and peak bytes and allocation counts for a tag
+RLAPI MemoryTagStats GetMemoryStats(void);                        // Get live and peak bytes and allocation counts for all tags together
 
 RLAPI void OpenURL(const char *url);                              // Open URL with default system browser (if available)
 
@@ -1069,6 +1275,11 @@ RLAPI void SetSaveFileTextCallback(SaveFileTextCallback callback); // Set custom
 // Files management functions
 RLAPI unsigned char *LoadFileData(const char *fileName, unsigned int *bytesRead);       // Load file data as byte array (read)
 RLAPI void UnloadFileData(unsigned char *data);                   // Unload file data allocated by LoadFileData()
+RLAPI FileView LoadFileView(const char *fileName);                // Load file as a read-only view, memory-mapped where supported (no copy)
+RLAPI void UnloadFileView(FileView view);                         // Unload file view loaded by LoadFileView()
+RLAPI FileWatch LoadFileWatch(const char *fileName);              // Load a watch on a file, its directory must exist
+RLAPI bool IsFileWatchChanged(FileWatch watch);                   // Check if the watched file was written since the last check (does not block)
+RLAPI void UnloadFileWatch(FileWatch watch);                      // Unload file watch loaded by LoadFileWatch()
 RLAPI bool SaveFileData(const char *fileName, void *data, unsigned int bytesToWrite);   // Save data to file from byte array (write), returns true on success
 RLAPI bool ExportDataAsCode(const unsigned char *data, unsigned int size, const char *fileName); // Export data to code (.h), returns true on success
 RLAPI char *LoadFileText(const char *fileName);                   // Load text data from file (read), returns a '\0' terminated string
@@ -1125,6 +1336,9 @@ RLAPI int GetGamepadButtonPressed(void);                      // Get the last ga
 RLAPI int GetGamepadAxisCount(int gamepad);                   // Get gamepad axis count for a gamepad
 RLAPI float GetGamepadAxisMovement(int gamepad, int axis);    // Get axis movement value for a gamepad axis
 RLAPI int SetGamepadMappings(const char *mappings);           // Set internal gamepad mappings (SDL_GameControllerDB)
+RLAPI bool StartGamepadSampling(int gamepad, int rate);       // Start sampling a gamepad on a background thread at rate polls per second, false if sampled once per frame
+RLAPI void StopGamepadSampling(void);                         // Stop sampling the gamepad
+RLAPI int GetGamepadSamples(GamepadSample *samples, int maxSamples); // Get gamepad samples taken since the last call, oldest first, returns count
 
 // Input-related functions: mouse
 RLAPI bool IsMouseButtonPressed(int button);                  // Check if a mouse button has been pressed once
@@ -1134,6 +1348,8 @@ RLAPI bool IsMouseButtonUp(int button);                       // Check if a mous
 RLAPI int GetMouseX(void);                                    // Get mouse position X
 RLAPI int GetMouseY(void);                                    // Get mouse position Y
 RLAPI Vector2 GetMousePosition(void);                         // Get mouse position XY
+RLAPI Vector2 GetMousePositionLatest(void);                   // Get mouse position XY, queried now instead of on last events poll
+RLAPI int GetMouseEvents(MouseEvent *events, int maxEvents);      // Get mouse events of the last events poll in arrival order, returns count
 RLAPI Vector2 GetMouseDelta(void);                            // Get mouse delta between frames
 RLAPI void SetMousePosition(int x, int y);                    // Set mouse position XY
 RLAPI void SetMouseOffset(int offsetX, int offsetY);          // Set mouse offset
@@ -1174,6 +1390,9 @@ RLAPI void UpdateCameraPro(Camera *camera, Vector3 movement, Vector3 rotation, f
 // NOTE: It can be useful when using basic shapes and one single font,
 // defining a font char white rectangle would allow drawing everything in a single draw call
 RLAPI void SetShapesTexture(Texture2D texture, Rectangle source);       // Set texture and rectangle to be used on shapes drawing
+RLAPI Texture2D GetShapesTexture(void);                                 // Get texture that is used for shapes drawing
+RLAPI Rectangle GetShapesTextureRectangle(void);                        // Get texture source rectangle that is used for shapes drawing
+RLAPI void SetShapesCircleErrorRate(float rate);                        // Set error allowed when circles are drawn as segments, larger draws fewer (default SMOOTH_CIRCLE_ERROR_RATE)
 
 // Basic shapes drawing functions
 RLAPI void DrawPixel(int posX, int posY, Color color);                                                   // Draw a pixel
@@ -1206,6 +1425,10 @@ RLAPI void DrawRectangleLines(int posX, int posY, int width, int height, Color c
 RLAPI void DrawRectangleLinesEx(Rectangle rec, float lineThick, Color color);                            // Draw rectangle outline with extended parameters
 RLAPI void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color color);              // Draw rectangle with rounded edges
 RLAPI void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, float lineThick, Color color); // Draw rectangle with rounded edges outline
+RLAPI void BeginShapesSDF(void);                                                                         // Begin signed distance shapes mode, SDF shapes share one draw call until EndShapesSDF()
+RLAPI void EndShapesSDF(void);                                                                           // End signed distance shapes mode (returns to default shader)
+RLAPI void DrawCircleSDF(Vector2 center, float radius, Color color);                                     // Draw a color-filled circle as one antialiased quad, shader distance instead of segments
+RLAPI void DrawRectangleRoundedSDF(Rectangle rec, float radius, Color color);                            // Draw rectangle with rounded corners of radius in pixels, antialiased by shader distance
 RLAPI void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color);                                // Draw a color-filled triangle (vertex in counter-clockwise order!)
 RLAPI void DrawTriangleLines(Vector2 v1, Vector2 v2, Vector2 v3, Color color);                           // Draw triangle outline (vertex in counter-clockwise order!)
 RLAPI void DrawTriangleFan(Vector2 *points, int pointCount, Color color);                                // Draw a triangle fan defined by points (first vertex is the center)
@@ -1216,6 +1439,7 @@ RLAPI void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotati
 
 // Basic shapes collision detection functions
 RLAPI bool CheckCollisionRecs(Rectangle rec1, Rectangle rec2);                                           // Check collision between two rectangles
+RLAPI unsigned long long CheckCollisionRecsMask(Rectangle rec, const float *x, const float *y, const float *width, const float *height, int count); // Check collision between a rectangle and up to 64 rectangles in separate arrays, returns a bit per collision
 RLAPI bool CheckCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2);        // Check collision between two circles
 RLAPI bool CheckCollisionCircleRec(Vector2 center, float radius, Rectangle rec);                         // Check collision between circle and rectangle
 RLAPI bool CheckCollisionPointRec(Vector2 point, Rectangle rec);                                         // Check if point is inside rectangle
@@ -1225,6 +1449,8 @@ RLAPI bool CheckCollisionPointPoly(Vector2 point, Vector2 *points, int pointCoun
 RLAPI bool CheckCollisionLines(Vector2 startPos1, Vector2 endPos1, Vector2 startPos2, Vector2 endPos2, Vector2 *collisionPoint); // Check the collision between two lines defined by two points each, returns collision point by reference
 RLAPI bool CheckCollisionPointLine(Vector2 point, Vector2 p1, Vector2 p2, int threshold);                // Check if point belongs to line created between two points [p1] and [p2] with defined margin in pixels [threshold]
 RLAPI Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2);                                         // Get collision rectangle for two rectangles collision
+RLAPI bool GetCollisionRecsContact(Rectangle rec1, Rectangle rec2, Vector2 *normal, float *depth);      // Get collision normal and penetration depth to separate rec1 from rec2
+RLAPI bool GetCollisionCircleRecContact(Vector2 center, float radius, Rectangle rec, Vector2 *normal, float *depth); // Get collision normal and penetration depth to separate circle from rectangle
 
 //------------------------------------------------------------------------------------
 // Texture Loading and Drawing Functions (Module: textures)
@@ -1317,6 +1543,7 @@ RLAPI Texture2D LoadTextureFromImage(Image image);
 RLAPI TextureCubemap LoadTextureCubemap(Image image, int layout);                                        // Load cubemap from image, multiple image cubemap layouts supported
 RLAPI RenderTexture2D LoadRenderTexture(int width, int height);                                          // Load texture for rendering (framebuffer)
 RLAPI bool IsTextureReady(Texture2D texture);                                                            // Check if a texture is ready
+RLAPI bool IsTextureFormatSupported(int format);                                                         // Check if a pixel format can be loaded in GPU, compressed formats depend on the GPU
 RLAPI void UnloadTexture(Texture2D texture);                                                             // Unload texture from GPU memory (VRAM)
 RLAPI bool IsRenderTextureReady(RenderTexture2D target);                                                       // Check if a render texture is ready
 RLAPI void UnloadRenderTexture(RenderTexture2D target);                                                  // Unload render texture from GPU memory (VRAM)
@@ -1364,6 +1591,7 @@ RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int gl
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
 RLAPI bool IsFontReady(Font font);                                                          // Check if a font is ready
+RLAPI Font LoadFontSDF(Font font, int scale, int spread);                                   // Load signed distance field font from a bitmap font with glyph images, drawn sharp at any size within BeginTextSDF()
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *chars, Rectangle **recs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
 RLAPI void UnloadFontData(GlyphInfo *chars, int glyphCount);                                // Unload font chars info data (RAM)
@@ -1376,6 +1604,11 @@ RLAPI void DrawTextEx(Font font, const char *text, Vector2 position, float fontS
 RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint); // Draw text using Font and pro parameters (rotation)
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
 RLAPI void DrawTextCodepoints(Font font, const int *codepoints, int count, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple character (codepoint)
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing); // Load text layout, glyph quads built once for repeated drawing
+RLAPI void UnloadTextLayout(TextLayout layout);                                             // Unload text layout data
+RLAPI void DrawTextLayout(TextLayout layout, Vector2 position, Color tint);                 // Draw text layout, no codepoint decoding or glyph lookup
+RLAPI void BeginTextSDF(void);                                                              // Begin signed distance field text mode, SDF font text shares one draw call until EndTextSDF()
+RLAPI void EndTextSDF(void);                                                                // End signed distance field text mode (returns to default shader)
 
 // Text font info functions
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
@@ -1516,8 +1749,12 @@ typedef void (*AudioCallback)(void *bufferData, unsigned int frames);
 
 // Audio device management functions
 RLAPI void InitAudioDevice(void);                                     // Initialize audio device and context
+RLAPI void InitAudioDeviceEx(AudioDeviceConfig config);               // Initialize audio device and context with requested playback period
 RLAPI void CloseAudioDevice(void);                                    // Close the audio device and context
 RLAPI bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
+RLAPI float GetAudioDeviceLatency(void);                              // Get audio device playback latency in seconds
+RLAPI AudioMixerStats GetAudioMixerStats(void);                       // Get audio mixer statistics
+RLAPI void ResetAudioMixerStats(void);                                // Reset audio mixer statistics (counters and max callback time)
 RLAPI void SetMasterVolume(float volume);                             // Set master volume (listener)
 
 // Wave/Sound loading/unloading functions
@@ -1542,6 +1779,12 @@ RLAPI bool IsSoundPlaying(Sound sound);                               // Check i
 RLAPI void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 RLAPI void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
 RLAPI void SetSoundPan(Sound sound, float pan);                       // Set pan for a sound (0.5 is center)
+RLAPI unsigned int PlaySoundVoice(Sound sound, float volume, float pan); // Play a sound on a pooled voice, layered over other plays (returns voice id, 0 on failure)
+RLAPI unsigned int PlaySoundVoiceEx(Sound sound, float volume, float pan, float pitch); // Play a sound on a pooled voice with its own pitch, resampled while mixing
+RLAPI void StopSoundVoices(Sound sound);                              // Stop all pooled voices playing a sound
+RLAPI void SetSoundVoiceVolume(unsigned int voice, float volume);     // Set volume for a pooled voice
+RLAPI void SetSoundVoicePan(unsigned int voice, float pan);           // Set pan for a pooled voice (0.5 is center)
+RLAPI void SetSoundVoiceBudget(int voices);                           // Set how many pooled voices are mixed at once, quieter ones play on unmixed
 RLAPI Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
 RLAPI void WaveCrop(Wave *wave, int initSample, int finalSample);     // Crop a wave to defined samples range
 RLAPI void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels); // Convert wave data to desired format
@@ -1556,6 +1799,8 @@ RLAPI void UnloadMusicStream(Music music);                            // Unload
 RLAPI void PlayMusicStream(Music music);                              // Start music playing
 RLAPI bool IsMusicStreamPlaying(Music music);                         // Check if music is playing
 RLAPI void UpdateMusicStream(Music music);                            // Updates buffers for music streaming
+RLAPI bool StartMusicStreamDecoder(Music music, unsigned int bufferMs); // Decode music on a background thread into a bufferMs ring, no UpdateMusicStream() calls needed
+RLAPI void StopMusicStreamDecoder(Music music);                       // Stop the background decoder, music goes back to UpdateMusicStream() streaming
 RLAPI void StopMusicStream(Music music);                              // Stop music playing
 RLAPI void PauseMusicStream(Music music);                             // Pause music playing
 RLAPI void ResumeMusicStream(Music music);                            // Resume playing paused music
@@ -1588,6 +1833,7 @@ RLAPI void DetachAudioStreamProcessor(AudioStream stream, AudioCallback processo
 
 RLAPI void AttachAudioMixedProcessor(AudioCallback processor); // Attach audio stream processor to the entire audio pipeline
 RLAPI void DetachAudioMixedProcessor(AudioCallback processor); // Detach audio stream processor from the entire audio pipeline
+RLAPI void SetAudioMixedEffect(int effect, bool enabled, float value, float value2); // Set a built-in effect for the entire audio pipeline (lock-free)
 
 #if defined(__cplusplus)
 }
@@ -109,8 +109,17 @@
 
 #include "utils.h"                  // Required for: TRACELOG() macros
 
+// NOTE: rlgl allocations (render batches, shader locations, glad extension lists) are accounted to the batch
+#if defined(RL_MEMORY_HOOKS)
+    #undef RL_MEMORY_TAG
+    #define RL_MEMORY_TAG MEMORY_TAG_BATCH
+#endif
 #define RLGL_IMPLEMENTATION
 #include "rlgl.h"                   // OpenGL abstraction layer to OpenGL 1.1, 3.3+ or ES2
+#if defined(RL_MEMORY_HOOKS)
+    #undef RL_MEMORY_TAG
+    #define RL_MEMORY_TAG MEMORY_TAG_GENERAL
+#endif
 
 #define RAYMATH_IMPLEMENTATION      // Define external out-of-line implementation
 #include "raymath.h"                // Vector3, Quaternion and Matrix functionality
@@ -150,7 +159,28 @@
     #endif // OSs
 #endif // PLATFORM_DESKTOP
 
-#include <stdlib.h>                 // Required for: srand(), rand(), atexit()
+#if defined(__linux__)
+    #include <pthread.h>            // Required for: pthread_setschedparam() [Used in SetCurrentThreadPriority()]
+    #include <sched.h>              // Required for: sched_setaffinity() [Used in SetCurrentThreadAffinity()]
+    #include <sys/resource.h>       // Required for: setpriority() [Used in SetCurrentThreadPriority()]
+    #include <sys/syscall.h>        // Required for: SYS_gettid [Used in SetCurrentThreadPriority()]
+#elif defined(__APPLE__)
+    #include <pthread.h>            // Required for: pthread_setschedparam() [Used in SetCurrentThreadPriority()]
+#endif
+
+// Gamepads are sampled on their own thread where some API reads them off the main thread: Linux joystick
+// devices and XInput. GLFW joysticks can only be read on the main thread, so elsewhere PollInputEvents() samples
+#if defined(PLATFORM_DESKTOP) && !defined(_MSC_VER) && (defined(__linux__) || defined(_WIN32))
+    #define SUPPORT_GAMEPAD_SAMPLER_THREAD
+    #include <pthread.h>            // Required for: pthread_create() [Used in StartGamepadSampling()]
+    #if defined(__linux__)
+        #include <fcntl.h>          // Required for: open() [Used in StartGamepadSampling()]
+        #include <unistd.h>         // Required for: read(), close() [Used in GamepadSamplerThread()]
+        #include <linux/joystick.h> // Required for: struct js_event [Used in GamepadSamplerThread()]
+    #endif
+#endif
+
+#include <stdlib.h>                 // Required for: atexit(), abs()
 #include <stdio.h>                  // Required for: sprintf() [Used in OpenURL()]
 #include <string.h>                 // Required for: strrchr(), strcmp(), strlen(), memset()
 #include <time.h>                   // Required for: time() [Used in InitTimer()]
@@ -177,6 +207,13 @@
     #define GETCWD _getcwd          // NOTE: MSDN recommends not to use getcwd(), chdir()
     #define CHDIR _chdir
     #include <io.h>                 // Required for: _access() [Used in FileExists()]
+    #if defined(_MSC_VER)
+        #include <intrin.h>         // Required for: _InterlockedIncrement() [Used in TraceStartupPhase()]
+    #endif
+
+    // NOTE: Declared here to avoid including windows.h
+    int __stdcall QueryPerformanceCounter(unsigned long long int *lpPerformanceCount);   // Used in GetStartupClock()
+    int __stdcall QueryPerformanceFrequency(unsigned long long int *lpFrequency);
 #else
     #include <unistd.h>             // Required for: getch(), chdir() (POSIX), access()
     #define GETCWD getcwd
@@ -256,6 +293,8 @@
     #include <gbm.h>                    // Generic Buffer Management (native platform for EGL on DRM)
     #include <xf86drm.h>                // Direct Rendering Manager user-level library interface
     #include <xf86drmMode.h>            // Direct Rendering Manager mode setting (KMS) interface
+    #include <poll.h>                   // Required for: poll() [Used in WaitPageFlip()]
+    #include <errno.h>                  // Required for: errno, EINTR [Used in WaitPageFlip()]
 #endif
 
     #include "EGL/egl.h"                // Native platform windowing system interface
@@ -314,11 +353,18 @@
 #ifndef MAX_CHAR_PRESSED_QUEUE
     #define MAX_CHAR_PRESSED_QUEUE        16        // Maximum number of characters in the char input queue
 #endif
+#ifndef MAX_MOUSE_EVENT_QUEUE
+    #define MAX_MOUSE_EVENT_QUEUE         64        // Maximum number of mouse events kept from one input poll
+#endif
 
 #ifndef MAX_DECOMPRESSION_SIZE
     #define MAX_DECOMPRESSION_SIZE        64        // Maximum size allocated for decompression in MB
 #endif
 
+#ifndef MAX_FRAME_LATENCY
+    #define MAX_FRAME_LATENCY              3        // Maximum frame latency limit, frames queued on the GPU after a swap
+#endif
+
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
 #define FLAG_CLEAR(n, f) ((n) &= ~(f))
@@ -363,8 +409,11 @@ typedef struct CoreData {
         int modeIndex;                      // Index of the used mode of connector->modes
         struct gbm_device *gbmDevice;       // GBM device
         struct gbm_surface *gbmSurface;     // GBM surface
-        struct gbm_bo *prevBO;              // Previous GBM buffer object (during frame swapping)
-        uint32_t prevFB;                    // Previous GBM framebufer (during frame swapping)
+        struct gbm_bo *prevBO;              // Previous GBM buffer object (on screen until the next flip completes)
+        bool modeSet;                       // Mode set with the first frame, later frames are page flipped
+        bool flipPending;                   // Page flip queued, waiting for its vertical blank event
+        bool flipped;                       // Last frame was presented with a page flip (paced by vertical blank)
+        double refreshPeriod;               // Refresh period of the selected mode, in seconds
 #endif  // PLATFORM_DRM
         EGLDisplay device;                  // Native display device (physical screen connection)
         EGLSurface surface;                 // Surface to draw on, framebuffers (connected to context)
@@ -378,6 +427,10 @@ typedef struct CoreData {
         bool shouldClose;                   // Check if window set for closing
         bool resizedLastFrame;              // Check if window has been resized last frame
         bool eventWaiting;                  // Wait for events before ending frame
+        int presentMode;                    // Presentation mode (PresentMode)
+        int frameLatencyLimit;              // Maximum frames queued on the GPU after a swap, 0 for no limit
+        void *latencyFences[MAX_FRAME_LATENCY + 1]; // Fences after the latest swaps, by frame number
+        unsigned int latencyFrame;          // Frames swapped since the limit was set, for the fences ring
 
         Point position;                     // Window position on screen (required on fullscreen toggle)
         Size display;                       // Display width and height (monitor, device-screen, LCD, ...)
@@ -441,6 +494,9 @@ typedef struct CoreData {
             char previousButtonState[MAX_MOUSE_BUTTONS];    // Registers previous mouse button state
             Vector2 currentWheelMove;       // Registers current mouse wheel variation
             Vector2 previousWheelMove;      // Registers previous mouse wheel variation
+
+            MouseEvent eventQueue[MAX_MOUSE_EVENT_QUEUE];   // Mouse events of the last poll, unscaled positions
+            int eventQueueCount;            // Mouse events queue count
 #if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
             // NOTE: currentButtonState[] can't be written directly due to multithreading, app could miss the update
             char currentButtonStateEvdev[MAX_MOUSE_BUTTONS]; // Holds the new mouse state for the next polling event to grab
@@ -478,6 +534,15 @@ typedef struct CoreData {
         unsigned long long base;            // Base time measure for hi-res timer
 #endif
         unsigned int frameCounter;          // Frame counter
+        FrameTimings timings;               // Breakdown of the last frame drawn
+        StartupTrace startup;               // Startup phases marked so far, times are startup clock values
+        volatile long startupMarks;         // Marks taken, could pass the trace capacity
+        bool presented;                     // First frame has been presented
+#if defined(SUPPORT_FRAME_PACING)
+        double deadline;                    // Absolute time the current frame wait ends
+        double wakeSlack;                   // Measured pacing timer wake up lateness, spun instead of slept
+        double presentLimit;                // Minimum frame time the presentation mode needs, 0 for none
+#endif
     } Time;
 } CoreData;
 
@@ -488,10 +553,128 @@ RLAPI const char *raylib_version = RAYLIB_VERSION;  // raylib version exported s
 
 static CoreData CORE = { 0 };               // Global CORE state context
 
+// Default random stream, GetRandomValue(). Seeded on InitWindow(), usable before
+static RandomStream randomDefault = { { 0x9e3779b9u, 0x243f6a88u, 0xb7e15162u, 0x85a308d3u } };
+
 #if defined(SUPPORT_SCREEN_CAPTURE)
 static int screenshotCounter = 0;           // Screenshots counter
 #endif
 
+#ifndef MAX_GAMEPAD_SAMPLES
+    #define MAX_GAMEPAD_SAMPLES     1024    // Gamepad samples held between two GetGamepadSamples() calls, 1 s at 1000 Hz
+#endif
+
+// Samples of the gamepad picked with StartGamepadSampling(), a ring with one producer and one consumer
+// NOTE: Only the sampler writes head and only GetGamepadSamples() writes tail, each publishes with a release store
+typedef struct GamepadSampler {
+    bool enabled;                           // Sampling started
+    bool threaded;                          // Sampled on its own thread, otherwise once per PollInputEvents()
+    volatile int quit;                      // Set to stop the thread
+    int gamepad;
+    double period;                          // Seconds between polls on the thread
+#if defined(SUPPORT_GAMEPAD_SAMPLER_THREAD)
+    pthread_t thread;
+    #if defined(__linux__)
+    int fd;                                 // Joystick device, read without blocking
+    #else
+    unsigned long (__stdcall *getState)(unsigned long index, void *state);  // XInputGetState()
+    #endif
+#endif
+    GamepadSample ring[MAX_GAMEPAD_SAMPLES];
+    volatile long head;                     // Samples pushed
+    volatile long tail;                     // Samples taken
+} GamepadSampler;
+
+static GamepadSampler gamepadSampler = { 0 };
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define SAMPLER_LOAD(var)           __atomic_load_n(&(var), __ATOMIC_ACQUIRE)
+    #define SAMPLER_STORE(var, value)   __atomic_store_n(&(var), (value), __ATOMIC_RELEASE)
+#else
+    // NOTE: No sampler thread without GCC-style builtins, both sides run on the main thread
+    #define SAMPLER_LOAD(var)           (var)
+    #define SAMPLER_STORE(var, value)   ((var) = (value))
+#endif
+
+#if defined(SUPPORT_ASYNC_CAPTURE) && (defined(_MSC_VER) || defined(PLATFORM_WEB))
+    #undef SUPPORT_ASYNC_CAPTURE            // No pthreads to encode on
+#endif
+
+#if defined(SUPPORT_ASYNC_CAPTURE)
+#include <pthread.h>                        // Required for: pthread_create(), pthread_mutex_lock() [Used in async capture]
+
+#ifndef MAX_CAPTURE_READBACKS
+    #define MAX_CAPTURE_READBACKS       3   // Screenshots and video frames read back by the GPU at the same time
+#endif
+#ifndef MAX_CAPTURE_JOBS
+    #define MAX_CAPTURE_JOBS            4   // Screenshots and video frames waiting to be encoded, more are dropped
+#endif
+
+// What a readback or job carries
+typedef enum {
+    CAPTURE_SCREENSHOT = 0,                 // One image file
+    CAPTURE_VIDEO_FRAME,                    // One frame appended to the recording, maybe repeated
+    CAPTURE_VIDEO_END                       // No pixels, the recording file is closed
+} CaptureKind;
+
+// Screenshot or video frame in flight on the GPU, its pixel buffer is kept for reuse
+typedef struct CaptureReadback {
+    unsigned int pbo;                       // Pixel pack buffer id
+    int size;                               // Pixel buffer size in bytes
+    int width;
+    int height;
+    void *fence;                            // Signaled when the pixels have landed in the buffer, NULL if free
+    unsigned int sequence;                  // Issue order, fences signal in this order
+    CaptureKind kind;
+    int repeat;                             // Video frame periods this frame covers
+    char path[2048];
+} CaptureReadback;
+
+// Screenshot or video frame waiting for the worker to flip, encode and write it
+typedef struct CaptureJob {
+    unsigned char *pixels;                  // Bottom-up RGBA, as read from the framebuffer
+    int width;
+    int height;
+    CaptureKind kind;
+    bool tga;                               // Screenshot written directly instead of through ExportImage()
+    bool header;                            // First video frame, the stream header goes first
+    int repeat;                             // Times the video frame is written
+    int fps;
+    FILE *file;                             // Recording the video frame goes to
+    char path[2048];
+} CaptureJob;
+
+static struct {
+    bool requested;                         // TakeScreenshotAsync() called this frame
+    char requestName[2048];
+    CaptureReadback readbacks[MAX_CAPTURE_READBACKS];
+    unsigned int sequence;
+
+    struct {
+        FILE *file;                         // NULL if not recording, handed to the worker on stop
+        bool stopping;                      // StopVideoRecording() called, waiting on frames in flight
+        int fps;
+        double period;
+        double nextTime;                    // Time the next frame is due
+        int width;                          // Size of the first frame, later frames must match
+        int height;
+        int carry;                          // Periods of dropped frames, added to the next frame written
+        int frames;
+        int dropped;
+        char path[2048];
+    } video;
+
+    CaptureJob jobs[MAX_CAPTURE_JOBS];      // Ring, shared with the worker under lock
+    int jobHead;
+    int jobCount;
+    bool quit;
+    bool started;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+} capture = { 0 };
+#endif
+
 #if defined(SUPPORT_EVENTS_AUTOMATION)
 #define MAX_CODE_AUTOMATION_EVENTS      16384
 
@@ -584,18 +767,36 @@ static bool eventsRecording = false;    // Record events
 // Other Modules Functions Declaration (required by core)
 //----------------------------------------------------------------------------------
 #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
-extern void LoadFontDefault(void);          // [Module: text] Loads default font on InitWindow()
+extern void LoadFontDefault(void);          // [Module: text] Loads default font, on first use after InitWindow()
 extern void UnloadFontDefault(void);        // [Module: text] Unloads default font from GPU memory
 #endif
+#if defined(SUPPORT_MODULE_RSHAPES)
+extern void UnloadShapesSDF(void);          // [Module: shapes] Unloads signed distance shapes shader
+#endif
+#if defined(SUPPORT_MODULE_RTEXT)
+extern void UnloadTextSDF(void);            // [Module: text] Unloads signed distance field text shader
+#endif
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static void InitTimer(void);                            // Initialize timer (hi-resolution if available)
+static double GetStartupClock(void);                    // Get startup trace clock, seconds from an arbitrary monotonic point
 static bool InitGraphicsDevice(int width, int height);  // Initialize graphics device
 static void SetupFramebuffer(int width, int height);    // Setup main framebuffer
 static void SetupViewport(int width, int height);       // Set viewport for a provided width and height
 
+#if defined(SUPPORT_ASYNC_CAPTURE)
+static void UpdateAsyncCapture(void);                   // Start requested readbacks and hand finished ones to the worker
+static void CloseAsyncCapture(void);                    // Wait for pending screenshots and video frames and stop the worker
+static CaptureReadback *StartCaptureReadback(CaptureKind kind, const char *name);  // Read back the screen into a free pixel buffer
+static void FinishCaptureReadback(CaptureReadback *readback);     // Copy out mapped pixels and queue them for the worker
+static bool QueueCaptureJob(CaptureJob job, int reserve);         // Hand a job to the worker, false if the queue is full
+static void *CaptureThread(void *arg);                  // Capture worker, encodes and writes screenshots and video frames
+static bool ExportCapture(const CaptureJob *job);       // Write one screenshot
+static bool WriteCaptureVideoFrame(const CaptureJob *job);        // Append one frame to a recording as YUV 4:2:0
+#endif
+
 static void ScanDirectoryFiles(const char *basePath, FilePathList *list, const char *filter);   // Scan all files and directories in a base path
 static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *list, const char *filter);  // Scan all files and directories recursively from a base path
 
@@ -614,6 +815,7 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
 static void CharCallback(GLFWwindow *window, unsigned int key);                            // GLFW3 Char Key Callback, runs on key pressed (get char value)
 static void MouseButtonCallback(GLFWwindow *window, int button, int action, int mods);     // GLFW3 Mouse Button Callback, runs on mouse button pressed
 static void MouseCursorPosCallback(GLFWwindow *window, double x, double y);                // GLFW3 Cursor Position Callback, runs on mouse move
+static void RecordMouseEvent(int button);                                                  // Add current mouse state to the events queue
 static void MouseScrollCallback(GLFWwindow *window, double xoffset, double yoffset);       // GLFW3 Srolling Callback, runs on mouse wheel
 static void CursorEnterCallback(GLFWwindow *window, int enter);                            // GLFW3 Cursor Enter Callback, cursor enters client area
 #endif
@@ -652,6 +854,10 @@ static void *GamepadThread(void *arg);                  // Mouse reading thread
 static int FindMatchingConnectorMode(const drmModeConnector *connector, const drmModeModeInfo *mode);                               // Search matching DRM mode in connector's mode list
 static int FindExactConnectorMode(const drmModeConnector *connector, uint width, uint height, uint fps, bool allowInterlaced);      // Search exactly matching DRM connector mode in connector's list
 static int FindNearestConnectorMode(const drmModeConnector *connector, uint width, uint height, uint fps, bool allowInterlaced);    // Search the nearest matching DRM connector mode in connector's list
+static uint32_t GetBufferFramebuffer(struct gbm_bo *bo);                                                                           // Get the DRM framebuffer of a GBM buffer, added on first use
+static void DestroyBufferFramebuffer(struct gbm_bo *bo, void *data);                                                               // Remove the DRM framebuffer of a GBM buffer being destroyed
+static void PageFlipHandler(int fd, unsigned int frame, unsigned int sec, unsigned int usec, void *data);                          // Page flip completion event callback
+static void WaitPageFlip(void);                                                                                                    // Wait for the queued page flip to complete
 #endif
 
 #endif  // PLATFORM_RPI || PLATFORM_DRM
@@ -666,8 +872,29 @@ static void PlayAutomationEvent(unsigned int frame);        // Play frame events
 #if defined(_WIN32)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
+// NOTE: Thread priority and affinity, used by SetCurrentThreadPriority() and SetCurrentThreadAffinity()
+__declspec(dllimport) void *__stdcall GetCurrentThread(void);
+__declspec(dllimport) void *__stdcall GetCurrentProcess(void);
+__declspec(dllimport) int __stdcall SetThreadPriority(void *hThread, int nPriority);
+__declspec(dllimport) size_t __stdcall SetThreadAffinityMask(void *hThread, size_t dwThreadAffinityMask);
+__declspec(dllimport) int __stdcall GetProcessAffinityMask(void *hProcess, size_t *lpProcessAffinityMask, size_t *lpSystemAffinityMask);
+#if defined(SUPPORT_GAMEPAD_SAMPLER_THREAD)
+// NOTE: XInput is loaded at runtime, there is no import library to link
+__declspec(dllimport) void *__stdcall LoadLibraryA(const char *lpLibFileName);
+__declspec(dllimport) void *__stdcall GetProcAddress(void *hModule, const char *lpProcName);
+#endif
+#if defined(SUPPORT_FRAME_PACING)
+__declspec(dllimport) void *__stdcall CreateWaitableTimerExW(void *lpTimerAttributes, const void *lpTimerName, unsigned long dwFlags, unsigned long dwDesiredAccess);
+__declspec(dllimport) int __stdcall SetWaitableTimer(void *hTimer, const long long *lpDueTime, long lPeriod, void *pfnCompletionRoutine, void *lpArgToCompletionRoutine, int fResume);
+__declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+#endif
 #endif
 
+#if defined(SUPPORT_FRAME_PACING)
+static void WaitUntilTime(double deadline);                 // Wait until an absolute time, GetTime() clock
+#endif
+static void LimitFrameLatency(void);                        // Wait for the GPU until no more frames than the limit are queued
+
 #if !defined(SUPPORT_MODULE_RTEXT)
 const char *TextFormat(const char *text, ...);       // Formatting of text with variables to 'embed'
 #endif // !SUPPORT_MODULE_RTEXT
@@ -841,36 +1068,17 @@ void InitWindow(int width, int height, const char *title)
     InitTimer();
 
     // Initialize random seed
-    srand((unsigned int)time(NULL));
+    SetRandomSeed((unsigned int)time(NULL));
 
     // Initialize base path for storage
     CORE.Storage.basePath = GetWorkingDirectory();
 
-#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
-    // Load default font
-    // WARNING: External function: Module required: rtext
-    LoadFontDefault();
-    #if defined(SUPPORT_MODULE_RSHAPES)
-    Rectangle rec = GetFontDefault().recs[95];
-    // NOTE: We set up a 1px padding on char rectangle to avoid pixel bleeding on MSAA filtering
-    SetShapesTexture(GetFontDefault().texture, (Rectangle){ rec.x + 1, rec.y + 1, rec.width - 2, rec.height - 2 }); // WARNING: Module required: rshapes
-    #endif
-#else
-    #if defined(SUPPORT_MODULE_RSHAPES)
+#if defined(SUPPORT_MODULE_RSHAPES)
     // Set default texture and rectangle to be used for shapes drawing
-    // NOTE: rlgl default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
+    // NOTE: rlgl default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8. The default font is not loaded
+    // here, GetFontDefault() loads it on first use and shapes move to its texture then
     Texture2D texture = { rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
     SetShapesTexture(texture, (Rectangle){ 0.0f, 0.0f, 1.0f, 1.0f });    // WARNING: Module required: rshapes
-    #endif
-#endif
-#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
-    if ((CORE.Window.flags & FLAG_WINDOW_HIGHDPI) > 0)
-    {
-        // Set default font texture filter for HighDPI (blurry)
-        // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-        rlTextureParameters(GetFontDefault().texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
-        rlTextureParameters(GetFontDefault().texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-    }
 #endif
 
 #if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
@@ -915,6 +1123,7 @@ void InitWindow(int width, int height, const char *title)
     CORE.Time.frameCounter = 0;
 #endif
 
+    TraceStartupPhase("init window");
 #endif        // PLATFORM_DESKTOP || PLATFORM_WEB || PLATFORM_RPI || PLATFORM_DRM
 }
 
@@ -926,8 +1135,24 @@ void CloseWindow(void)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+#if defined(SUPPORT_MODULE_RSHAPES)
+    UnloadShapesSDF();          // WARNING: Module required: rshapes
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXT)
+    UnloadTextSDF();            // WARNING: Module required: rtext
+#endif
+
+#if defined(SUPPORT_ASYNC_CAPTURE)
+    CloseAsyncCapture();        // Pending screenshots are still written
+#endif
+
+    StopGamepadSampling();      // The sampler thread reads the timer
+
     rlglClose();                // De-init rlgl
 
+    UnloadFrameMemory();        // Free per-frame arena
+
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
     glfwDestroyWindow(CORE.Window.handle);
     glfwTerminate();
@@ -961,10 +1186,12 @@ void CloseWindow(void)
 #endif
 
 #if defined(PLATFORM_DRM)
-    if (CORE.Window.prevFB)
+    // NOTE: The original mode is restored before the buffers go, destroying them removes their
+    // framebuffers and the one on screen can't be removed while it is scanned out
+    if (CORE.Window.crtc && CORE.Window.connector)
     {
-        drmModeRmFB(CORE.Window.fd, CORE.Window.prevFB);
-        CORE.Window.prevFB = 0;
+        drmModeSetCrtc(CORE.Window.fd, CORE.Window.crtc->crtc_id, CORE.Window.crtc->buffer_id,
+            CORE.Window.crtc->x, CORE.Window.crtc->y, &CORE.Window.connector->connector_id, 1, &CORE.Window.crtc->mode);
     }
 
     if (CORE.Window.prevBO)
@@ -989,8 +1216,6 @@ void CloseWindow(void)
     {
         if (CORE.Window.connector)
         {
-            drmModeSetCrtc(CORE.Window.fd, CORE.Window.crtc->crtc_id, CORE.Window.crtc->buffer_id,
-                CORE.Window.crtc->x, CORE.Window.crtc->y, &CORE.Window.connector->connector_id, 1, &CORE.Window.crtc->mode);
             drmModeFreeConnector(CORE.Window.connector);
             CORE.Window.connector = NULL;
         }
@@ -1201,9 +1426,8 @@ void ToggleFullscreen(void)
         glfwSetWindowMonitor(CORE.Window.handle, NULL, CORE.Window.position.x, CORE.Window.position.y, CORE.Window.screen.width, CORE.Window.screen.height, GLFW_DONT_CARE);
     }
 
-    // Try to enable GPU V-Sync, so frames are limited to screen refresh rate (60Hz -> 60 FPS)
-    // NOTE: V-Sync can be enabled by graphic driver configuration
-    if (CORE.Window.flags & FLAG_VSYNC_HINT) glfwSwapInterval(1);
+    // The monitor changed, so the swap interval and any variable refresh limit are set again
+    SetPresentMode(CORE.Window.presentMode);
 #endif
 #if defined(PLATFORM_WEB)
 /*
@@ -1325,6 +1549,8 @@ void SetWindowState(unsigned int flags)
     {
         glfwSwapInterval(1);
         CORE.Window.flags |= FLAG_VSYNC_HINT;
+        CORE.Window.presentMode = PRESENT_VSYNC;
+        CORE.Time.presentLimit = 0.0;
     }
 
     // State change: FLAG_FULLSCREEN_MODE
@@ -1435,6 +1661,8 @@ void ClearWindowState(unsigned int flags)
     {
         glfwSwapInterval(0);
         CORE.Window.flags &= ~FLAG_VSYNC_HINT;
+        CORE.Window.presentMode = PRESENT_IMMEDIATE;
+        CORE.Time.presentLimit = 0.0;
     }
 
     // State change: FLAG_FULLSCREEN_MODE
@@ -2021,11 +2249,87 @@ void DisableEventWaiting(void)
     CORE.Window.eventWaiting = false;
 }
 
+// Set presentation mode
+// NOTE: Adaptive V-Sync needs EXT_swap_control_tear (WGL/GLX), anything else would take the negative
+// swap interval as an error. Variable refresh is switched on by the driver for fullscreen windows, the
+// frames only have to stay inside the display's range: V-Sync catches anything faster than its maximum
+// and frames are limited a little under it, so they never wait for a whole refresh
+void SetPresentMode(int mode)
+{
+#if defined(PLATFORM_DESKTOP)
+    static const char *modeNames[] = { "immediate", "V-Sync", "adaptive V-Sync", "variable refresh" };
+    int interval = 0;
+
+    if ((mode < PRESENT_IMMEDIATE) || (mode > PRESENT_VARIABLE_REFRESH)) mode = PRESENT_VSYNC;
+    CORE.Time.presentLimit = 0.0;
+
+    if (mode == PRESENT_VSYNC) interval = 1;
+    else if (mode == PRESENT_ADAPTIVE_VSYNC)
+    {
+        if (glfwExtensionSupported("WGL_EXT_swap_control_tear") || glfwExtensionSupported("GLX_EXT_swap_control_tear")) interval = -1;
+        else
+        {
+            TRACELOG(LOG_WARNING, "DISPLAY: Adaptive V-Sync not supported, using V-Sync");
+            mode = PRESENT_VSYNC;
+            interval = 1;
+        }
+    }
+    else if (mode == PRESENT_VARIABLE_REFRESH)
+    {
+        int refreshRate = GetMonitorRefreshRate(GetCurrentMonitor());
+
+        interval = 1;
+        if (refreshRate > 0) CORE.Time.presentLimit = 1.0/(refreshRate*0.97);
+    }
+
+    glfwSwapInterval(interval);
+
+    if (interval != 0) CORE.Window.flags |= FLAG_VSYNC_HINT;
+    else CORE.Window.flags &= ~FLAG_VSYNC_HINT;
+    CORE.Window.presentMode = mode;
+
+    TRACELOG(LOG_INFO, "DISPLAY: Present mode: %s", modeNames[mode]);
+#else
+    if (mode != PRESENT_VSYNC) TRACELOG(LOG_WARNING, "DISPLAY: Present mode can't be changed on this platform");
+#endif
+}
+
+// Get presentation mode in use
+int GetPresentMode(void)
+{
+    return CORE.Window.presentMode;
+}
+
+// Set maximum frames queued on the GPU after a swap
+// NOTE: With V-Sync the driver lets the CPU run a few frames ahead of the display, each one adds its
+// latency to input. A limit of 1 keeps one frame queued while the next one is built
+void SetFrameLatencyLimit(int frames)
+{
+    if (frames < 0) frames = 0;
+    if (frames > MAX_FRAME_LATENCY) frames = MAX_FRAME_LATENCY;
+
+    for (int i = 0; i < (MAX_FRAME_LATENCY + 1); i++)
+    {
+        rlUnloadFence(CORE.Window.latencyFences[i]);
+        CORE.Window.latencyFences[i] = NULL;
+    }
+
+    CORE.Window.frameLatencyLimit = frames;
+    CORE.Window.latencyFrame = 0;
+}
+
+// Get maximum frames queued on the GPU after a swap
+int GetFrameLatencyLimit(void)
+{
+    return CORE.Window.frameLatencyLimit;
+}
+
 // Show mouse cursor
 void ShowCursor(void)
 {
 #if defined(PLATFORM_DESKTOP)
     glfwSetInputMode(CORE.Window.handle, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
+    if (glfwRawMouseMotionSupported()) glfwSetInputMode(CORE.Window.handle, GLFW_RAW_MOUSE_MOTION, GLFW_FALSE);
 #endif
 
     CORE.Input.Mouse.cursorHidden = false;
@@ -2067,6 +2371,8 @@ void DisableCursor(void)
 {
 #if defined(PLATFORM_DESKTOP)
     glfwSetInputMode(CORE.Window.handle, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+    // NOTE: Unaccelerated motion straight from the device, only available with a disabled cursor
+    if (glfwRawMouseMotionSupported()) glfwSetInputMode(CORE.Window.handle, GLFW_RAW_MOUSE_MOTION, GLFW_TRUE);
 #endif
 #if defined(PLATFORM_WEB)
     emscripten_request_pointerlock("#canvas", 1);
@@ -2100,6 +2406,9 @@ void BeginDrawing(void)
     CORE.Time.update = CORE.Time.current - CORE.Time.previous;
     CORE.Time.previous = CORE.Time.current;
 
+    BeginFrameMemory();                 // Release last frame's MemAllocFrame() allocations
+    rlBeginGpuFrame();                  // Time the frame on the GPU, if timer queries are supported
+
     rlLoadIdentity();                   // Reset current matrix (modelview)
     rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling
 
@@ -2110,7 +2419,11 @@ void BeginDrawing(void)
 // End canvas drawing and swap buffers (double buffering)
 void EndDrawing(void)
 {
+    double batchStart = GetTime();
+    TRACE_ZONE_BEGIN("rlDrawRenderBatch");
     rlDrawRenderBatchActive();      // Update and draw internal render batch
+    TRACE_ZONE_END();
+    CORE.Time.timings.batch = GetTime() - batchStart;
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
     // Draw record/play indicator
@@ -2140,29 +2453,87 @@ void EndDrawing(void)
     }
 #endif
 
+#if defined(SUPPORT_ASYNC_CAPTURE)
+    UpdateAsyncCapture();           // Read back before the swap, the back buffer is undefined after it
+#endif
+
+    rlEndGpuFrame();                // Everything before the swap is GPU frame time, results come a few frames later
+    rlGpuTimings gpuTimings = rlGetGpuTimings();
+    CORE.Time.timings.gpuFrame = gpuTimings.frame;
+    CORE.Time.timings.gpuBatch = gpuTimings.batches;
+    CORE.Time.timings.gpuLatency = gpuTimings.latency;
+
+    rlRenderStats stats = rlGetRenderStats();
+    CORE.Time.timings.drawCalls = stats.drawCalls;
+    CORE.Time.timings.vertices = stats.vertices;
+    CORE.Time.timings.batchOverflows = stats.batchOverflows;
+    CORE.Time.timings.culled = stats.culled;
+    rlResetRenderStats();
+    rlUpdateRenderBatchSize();      // Grow the batch if it overflowed, only between frames
+
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
+    double swapStart = GetTime();
+    TRACE_ZONE_BEGIN("SwapScreenBuffer");
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
+    TRACE_ZONE_END();
 
     // Frame time control system
     CORE.Time.current = GetTime();
     CORE.Time.draw = CORE.Time.current - CORE.Time.previous;
     CORE.Time.previous = CORE.Time.current;
+    CORE.Time.timings.swap = CORE.Time.current - swapStart;
+    CORE.Time.timings.swapEnd = CORE.Time.current;
+    CORE.Time.timings.wait = 0.0;
+
+    if (!CORE.Time.presented)
+    {
+        TraceStartupPhase("first frame");
+        CORE.Time.presented = true;
+    }
 
     CORE.Time.frame = CORE.Time.update + CORE.Time.draw;
 
+    // The presentation mode may need frames slower than the target
+    double target = (CORE.Time.presentLimit > CORE.Time.target) ? CORE.Time.presentLimit : CORE.Time.target;
+
+#if defined(SUPPORT_FRAME_PACING)
+    // Frames are scheduled against absolute deadlines, a late wake up or a slow swap is absorbed
+    // by the next wait instead of pushing all the following frames back
+    if (target > 0.0)
+    {
+#if defined(PLATFORM_DRM)
+        // A page flip already waited for vertical blank, at targets the display keeps up with it is
+        // the clock and a timer wait on top would only drift against it and miss a blank now and then
+        if (CORE.Window.flipped && (target < CORE.Window.refreshPeriod*1.5)) CORE.Time.deadline = CORE.Time.current - target;
+#endif
+        CORE.Time.deadline += target;
+
+        // More than a frame off schedule (first frame, hitch, target change), start again from now
+        if ((CORE.Time.deadline < (CORE.Time.current - target)) || (CORE.Time.deadline > (CORE.Time.current + target))) CORE.Time.deadline = CORE.Time.current;
+
+        TRACE_ZONE_BEGIN("WaitTime");
+        if (CORE.Time.deadline > CORE.Time.current) WaitUntilTime(CORE.Time.deadline);
+        TRACE_ZONE_END();
+#else
     // Wait for some milliseconds...
-    if (CORE.Time.frame < CORE.Time.target)
+    if (CORE.Time.frame < target)
     {
-        WaitTime(CORE.Time.target - CORE.Time.frame);
+        TRACE_ZONE_BEGIN("WaitTime");
+        WaitTime(target - CORE.Time.frame);
+        TRACE_ZONE_END();
+#endif
 
         CORE.Time.current = GetTime();
         double waitTime = CORE.Time.current - CORE.Time.previous;
         CORE.Time.previous = CORE.Time.current;
 
         CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
+        CORE.Time.timings.wait = waitTime;
     }
 
+    TRACE_ZONE_BEGIN("PollInputEvents");
     PollInputEvents();      // Poll user events (before next frame update)
+    TRACE_ZONE_END();
 #endif
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
@@ -2176,6 +2547,8 @@ void EndDrawing(void)
     }
 #endif
 
+    EndFrameMemory();       // Frame allocations stay valid until the next BeginDrawing()
+
     CORE.Time.frameCounter++;
 }
 
@@ -2826,6 +3199,46 @@ float GetFrameTime(void)
     return (float)CORE.Time.frame;
 }
 
+// Get time and draw statistics breakdown for last frame drawn
+FrameTimings GetFrameTimings(void)
+{
+    return CORE.Time.timings;
+}
+
+// Mark the end of a startup phase
+// NOTE: Timed with its own monotonic clock, GetTime() is not available before InitWindow().
+// Any thread can mark (audio device init may run on a worker), each mark takes its own slot.
+// Phase must be a static string
+void TraceStartupPhase(const char *phase)
+{
+    StartupTrace *trace = &CORE.Time.startup;
+    double now = GetStartupClock();
+
+#if defined(_MSC_VER)
+    long index = _InterlockedIncrement(&CORE.Time.startupMarks) - 1;
+#else
+    long index = __sync_fetch_and_add(&CORE.Time.startupMarks, 1);
+#endif
+    if (index >= (long)(sizeof(trace->times)/sizeof(trace->times[0]))) return;
+
+    trace->phases[index] = phase;
+    trace->times[index] = now;
+}
+
+// Get startup phases marked so far
+// NOTE: Phases marked by other threads are only complete once those threads are done marking
+StartupTrace GetStartupTrace(void)
+{
+    StartupTrace trace = CORE.Time.startup;
+    long marks = CORE.Time.startupMarks;
+    int capacity = (int)(sizeof(trace.times)/sizeof(trace.times[0]));
+
+    trace.phaseCount = (marks < capacity)? (int)marks : capacity;
+    for (int i = trace.phaseCount - 1; i >= 0; i--) trace.times[i] -= trace.times[0];
+
+    return trace;
+}
+
 // Get elapsed time measure in seconds since InitTimer()
 // NOTE: On PLATFORM_DESKTOP InitTimer() is called on InitWindow()
 // NOTE: On PLATFORM_DESKTOP, timer is initialized on glfwInit()
@@ -2870,29 +3283,533 @@ void TakeScreenshot(const char *fileName)
     unsigned char *imgData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
     Image image = { imgData, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y), 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
 
-    char path[2048] = { 0 };
-    strcpy(path, TextFormat("%s/%s", CORE.Storage.basePath, fileName));
+    char path[2048] = { 0 };
+    strcpy(path, TextFormat("%s/%s", CORE.Storage.basePath, fileName));
+
+    ExportImage(image, path);           // WARNING: Module required: rtextures
+    RL_FREE(imgData);
+
+#if defined(PLATFORM_WEB)
+    // Download file from MEMFS (emscripten memory filesystem)
+    // saveFileFromMEMFSToDisk() function is defined in raylib/src/shell.html
+    emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(path), GetFileName(path)));
+#endif
+
+    TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", path);
+#else
+    TRACELOG(LOG_WARNING,"IMAGE: ExportImage() requires module: rtextures");
+#endif
+}
+
+// Takes a screenshot of current screen without stalling the frame
+// NOTE: The screen is read back at the end of this frame's EndDrawing() through a pixel buffer,
+// mapped once the GPU is done with it a frame or two later, then flipped, encoded and written on
+// a worker thread. Without async capture support it is the same as TakeScreenshot()
+void TakeScreenshotAsync(const char *fileName)
+{
+#if defined(SUPPORT_ASYNC_CAPTURE)
+    if (strchr(fileName, '\'') != NULL) { TRACELOG(LOG_WARNING, "SYSTEM: Provided fileName could be potentially malicious, avoid [\'] character");  return; }
+
+    if (capture.requested) TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screenshot already requested this frame, replaced", capture.requestName);
+
+    snprintf(capture.requestName, sizeof(capture.requestName), "%s", fileName);
+    capture.requested = true;
+#else
+    TakeScreenshot(fileName);
+#endif
+}
+
+// Start recording the screen to a video file
+// NOTE: Frames go through the same pixel buffers and worker as TakeScreenshotAsync(), one every 1/fps seconds.
+// Frames are never waited on: if the GPU or the worker fall behind, frames are dropped and the next
+// written frame is repeated to keep the clip in time. Written as uncompressed YUV4MPEG2 (.y4m)
+void StartVideoRecording(const char *fileName, int fps)
+{
+#if defined(SUPPORT_ASYNC_CAPTURE)
+    if (strchr(fileName, '\'') != NULL) { TRACELOG(LOG_WARNING, "SYSTEM: Provided fileName could be potentially malicious, avoid [\'] character");  return; }
+
+    if (capture.video.file != NULL) { TRACELOG(LOG_WARNING, "SYSTEM: [%s] Video already recording", capture.video.path); return; }
+    if (fps <= 0) fps = 30;
+
+    snprintf(capture.video.path, sizeof(capture.video.path), "%s/%s", CORE.Storage.basePath, fileName);
+    capture.video.file = fopen(capture.video.path, "wb");
+    if (capture.video.file == NULL) { TRACELOG(LOG_WARNING, "SYSTEM: [%s] Failed to open video file", capture.video.path); return; }
+
+    capture.video.stopping = false;
+    capture.video.fps = fps;
+    capture.video.period = 1.0/fps;
+    capture.video.nextTime = GetTime();
+    capture.video.width = 0;
+    capture.video.height = 0;
+    capture.video.carry = 0;
+    capture.video.frames = 0;
+    capture.video.dropped = 0;
+
+    TRACELOG(LOG_INFO, "SYSTEM: [%s] Video recording started at %i fps", capture.video.path, fps);
+#else
+    TRACELOG(LOG_WARNING, "SYSTEM: [%s] Video recording requires async capture support", fileName);
+#endif
+}
+
+// Stop recording, frames still in flight are written before the file is closed
+void StopVideoRecording(void)
+{
+#if defined(SUPPORT_ASYNC_CAPTURE)
+    if (capture.video.file != NULL) capture.video.stopping = true;
+#endif
+}
+
+// Check if the screen is being recorded
+bool IsVideoRecording(void)
+{
+#if defined(SUPPORT_ASYNC_CAPTURE)
+    return (capture.video.file != NULL) && !capture.video.stopping;
+#else
+    return false;
+#endif
+}
+
+#if defined(SUPPORT_ASYNC_CAPTURE)
+// Start requested readbacks and hand finished ones to the worker
+// NOTE: Only a mapped buffer copy happens on this thread, fences are polled, never waited on
+static void UpdateAsyncCapture(void)
+{
+    if (capture.requested)
+    {
+        capture.requested = false;
+
+        CaptureReadback *readback = StartCaptureReadback(CAPTURE_SCREENSHOT, capture.requestName);
+        if (readback == NULL) TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screenshot dropped, too many in flight", capture.requestName);
+    }
+
+    if ((capture.video.file != NULL) && !capture.video.stopping)
+    {
+        double time = GetTime();
+        if (time >= capture.video.nextTime)
+        {
+            // A slow frame covers every period that has passed since the last one
+            int repeat = 1 + (int)((time - capture.video.nextTime)/capture.video.period);
+            capture.video.nextTime += repeat*capture.video.period;
+
+            CaptureReadback *readback = StartCaptureReadback(CAPTURE_VIDEO_FRAME, capture.video.path);
+            if (readback != NULL) readback->repeat = repeat;
+            else
+            {
+                capture.video.carry += repeat;
+                capture.video.dropped++;
+            }
+        }
+    }
+
+    // Finish readbacks in the order they were issued, a video must not come out shuffled
+    while (true)
+    {
+        CaptureReadback *next = NULL;
+        for (int i = 0; i < MAX_CAPTURE_READBACKS; i++)
+        {
+            CaptureReadback *readback = &capture.readbacks[i];
+            if ((readback->fence != NULL) && ((next == NULL) || ((int)(readback->sequence - next->sequence) < 0))) next = readback;
+        }
+
+        if ((next == NULL) || !rlIsFenceSignaled(next->fence, 0.0)) break;
+
+        rlUnloadFence(next->fence);
+        next->fence = NULL;
+        FinishCaptureReadback(next);
+    }
+
+    if ((capture.video.file != NULL) && capture.video.stopping)
+    {
+        bool inFlight = false;
+        for (int i = 0; i < MAX_CAPTURE_READBACKS; i++) if ((capture.readbacks[i].fence != NULL) && (capture.readbacks[i].kind == CAPTURE_VIDEO_FRAME)) inFlight = true;
+
+        CaptureJob job = { NULL, 0, 0, CAPTURE_VIDEO_END, false, false, 0, 0, capture.video.file, { 0 } };
+        strcpy(job.path, capture.video.path);
+
+        // Closed by the worker after the frames queued before it, retried next frame while the queue is full
+        if (!inFlight && QueueCaptureJob(job, 0))
+        {
+            TRACELOG(LOG_INFO, "SYSTEM: [%s] Video recording stopped, %i frames, %i dropped", capture.video.path, capture.video.frames, capture.video.dropped);
+            capture.video.file = NULL;
+            capture.video.stopping = false;
+        }
+    }
+}
+
+// Read back the screen into a free pixel buffer, NULL if all are in flight
+static CaptureReadback *StartCaptureReadback(CaptureKind kind, const char *name)
+{
+    Vector2 scale = GetWindowScaleDPI();
+    int width = (int)((float)CORE.Window.render.width*scale.x);
+    int height = (int)((float)CORE.Window.render.height*scale.y);
+
+    CaptureReadback *readback = NULL;
+    for (int i = 0; (i < MAX_CAPTURE_READBACKS) && (readback == NULL); i++) if (capture.readbacks[i].fence == NULL) readback = &capture.readbacks[i];
+    if (readback == NULL) return NULL;
+
+    if (kind == CAPTURE_VIDEO_FRAME)
+    {
+        // The stream header fixes the size, frames after a window resize are still read back at it
+        if (capture.video.width == 0)
+        {
+            capture.video.width = width;
+            capture.video.height = height;
+        }
+        width = capture.video.width;
+        height = capture.video.height;
+    }
+
+    int size = width*height*4;
+    if (readback->size != size)
+    {
+        if (readback->pbo != 0) rlUnloadPixelBuffer(readback->pbo);
+        readback->pbo = rlLoadPixelBuffer(size);
+        readback->size = size;
+    }
+
+    if (readback->pbo != 0)
+    {
+        readback->width = width;
+        readback->height = height;
+        readback->kind = kind;
+        readback->repeat = 1;
+        readback->sequence = capture.sequence++;
+        if (kind == CAPTURE_SCREENSHOT) snprintf(readback->path, sizeof(readback->path), "%s/%s", CORE.Storage.basePath, name);
+        else snprintf(readback->path, sizeof(readback->path), "%s", name);
+        readback->fence = rlReadScreenPixelsAsync(readback->pbo, width, height);
+    }
+
+    if (readback->fence == NULL)
+    {
+        readback->size = 0;
+
+        // No pixel buffers on this graphics API, screenshots are read back the slow way, video can't be
+        if (kind == CAPTURE_SCREENSHOT) TakeScreenshot(name);
+        else return NULL;
+    }
+
+    return readback;
+}
+
+// Copy out mapped pixels and queue them for the worker, dropped if it is behind
+static void FinishCaptureReadback(CaptureReadback *readback)
+{
+    bool video = (readback->kind == CAPTURE_VIDEO_FRAME);
+
+    // NOTE: IsFileExtension() uses rtext static buffers, so it is checked here and not on the worker
+    CaptureJob job = { NULL, readback->width, readback->height, readback->kind, false, false, readback->repeat, capture.video.fps, NULL, { 0 } };
+    strcpy(job.path, readback->path);
+    if (video)
+    {
+        job.repeat += capture.video.carry;
+        job.header = (capture.video.frames == 0);
+        job.file = capture.video.file;
+    }
+    else job.tga = IsFileExtension(readback->path, ".tga");
+
+    const unsigned char *mapped = (const unsigned char *)rlMapPixelBuffer(readback->pbo, readback->size);
+    if (mapped != NULL)
+    {
+        job.pixels = (unsigned char *)RL_MALLOC(readback->size);
+        if (job.pixels != NULL) memcpy(job.pixels, mapped, readback->size);
+        rlUnmapPixelBuffer(readback->pbo);
+    }
+
+    // The last slot is kept for screenshots and the end of a recording, video frames can't starve them
+    if ((job.pixels != NULL) && QueueCaptureJob(job, video? 1 : 0))
+    {
+        if (video)
+        {
+            capture.video.frames += job.repeat;
+            capture.video.carry = 0;
+        }
+        return;
+    }
+
+    if (video)
+    {
+        capture.video.carry = job.repeat;
+        capture.video.dropped++;
+    }
+    else TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screenshot dropped, encoder busy", job.path);
+
+    RL_FREE(job.pixels);
+}
+
+// Hand a job to the worker, starting it on first use
+// NOTE: reserve slots are left free, false if the queue is fuller than that
+static bool QueueCaptureJob(CaptureJob job, int reserve)
+{
+    if (!capture.started)
+    {
+        pthread_mutex_init(&capture.lock, NULL);
+        pthread_cond_init(&capture.wake, NULL);
+        capture.started = (pthread_create(&capture.thread, NULL, CaptureThread, NULL) == 0);
+        if (!capture.started)
+        {
+            TRACELOG(LOG_WARNING, "SYSTEM: Failed to start capture thread");
+            pthread_cond_destroy(&capture.wake);
+            pthread_mutex_destroy(&capture.lock);
+            return false;
+        }
+    }
+
+    bool queued = false;
+    pthread_mutex_lock(&capture.lock);
+    if (capture.jobCount < MAX_CAPTURE_JOBS - reserve)
+    {
+        capture.jobs[(capture.jobHead + capture.jobCount)%MAX_CAPTURE_JOBS] = job;
+        capture.jobCount++;
+        queued = true;
+        pthread_cond_signal(&capture.wake);
+    }
+    pthread_mutex_unlock(&capture.lock);
+
+    return queued;
+}
+
+// Wait for pending screenshots and video frames and stop the worker
+static void CloseAsyncCapture(void)
+{
+    // A fence is waited on here only, everything requested still reaches the disk
+    for (int i = 0; i < MAX_CAPTURE_READBACKS; i++)
+    {
+        if (capture.readbacks[i].fence != NULL) rlIsFenceSignaled(capture.readbacks[i].fence, 1.0);
+    }
+    capture.requested = false;
+    StopVideoRecording();
+    UpdateAsyncCapture();
+
+    if (capture.started)
+    {
+        pthread_mutex_lock(&capture.lock);
+        capture.quit = true;
+        pthread_cond_signal(&capture.wake);
+        pthread_mutex_unlock(&capture.lock);
+
+        pthread_join(capture.thread, NULL);
+        pthread_cond_destroy(&capture.wake);
+        pthread_mutex_destroy(&capture.lock);
+    }
+
+    // The end of the recording didn't fit in the queue, the worker has drained it by now
+    if (capture.video.file != NULL) fclose(capture.video.file);
+
+    for (int i = 0; i < MAX_CAPTURE_READBACKS; i++)
+    {
+        if (capture.readbacks[i].fence != NULL) rlUnloadFence(capture.readbacks[i].fence);
+        if (capture.readbacks[i].pbo != 0) rlUnloadPixelBuffer(capture.readbacks[i].pbo);
+    }
+
+    memset(&capture, 0, sizeof(capture));
+}
+
+// Capture worker, encodes and writes screenshots and video frames until told to quit and the queue is empty
+static void *CaptureThread(void *arg)
+{
+    // Encoding is background work, it should never take a core from the game or audio threads
+    SetCurrentThreadPriority(PRIORITY_LOW);
+
+    pthread_mutex_lock(&capture.lock);
+
+    while (true)
+    {
+        while (!capture.quit && (capture.jobCount == 0)) pthread_cond_wait(&capture.wake, &capture.lock);
+        if (capture.jobCount == 0) break;
+
+        CaptureJob job = capture.jobs[capture.jobHead];
+        capture.jobHead = (capture.jobHead + 1)%MAX_CAPTURE_JOBS;
+        capture.jobCount--;
+        pthread_mutex_unlock(&capture.lock);
+
+        if (job.kind == CAPTURE_SCREENSHOT)
+        {
+            if (ExportCapture(&job)) TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", job.path);
+        }
+        else if (job.kind == CAPTURE_VIDEO_FRAME)
+        {
+            if (!WriteCaptureVideoFrame(&job)) TRACELOG(LOG_WARNING, "SYSTEM: [%s] Failed to write video frame", job.path);
+        }
+        else if (fclose(job.file) != 0) TRACELOG(LOG_WARNING, "SYSTEM: [%s] Failed to close video file", job.path);
+        RL_FREE(job.pixels);
+
+        pthread_mutex_lock(&capture.lock);
+    }
+
+    pthread_mutex_unlock(&capture.lock);
+
+    return NULL;
+}
+
+// Write one screenshot
+// NOTE: .tga is written directly, bottom-up as read back, no flip or encoder needed.
+// Anything else is flipped and goes through ExportImage() with whatever formats are enabled
+static bool ExportCapture(const CaptureJob *job)
+{
+    int rowSize = job->width*4;
+    unsigned char *pixels = job->pixels;
+
+    // Alpha has already been applied to RGB in framebuffer, screenshots are opaque
+    for (int i = 3; i < rowSize*job->height; i += 4) pixels[i] = 255;
+
+    if (job->tga)
+    {
+        unsigned char *fileData = (unsigned char *)RL_MALLOC(18 + rowSize*job->height);
+        if (fileData == NULL) return false;
+
+        unsigned char header[18] = { 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            (unsigned char)(job->width & 0xff), (unsigned char)(job->width >> 8),
+            (unsigned char)(job->height & 0xff), (unsigned char)(job->height >> 8), 32, 8 };
+        memcpy(fileData, header, 18);
+
+        // Uncompressed true-color TGA stores BGRA, bottom-left origin
+        unsigned char *out = fileData + 18;
+        for (int i = 0; i < rowSize*job->height; i += 4)
+        {
+            out[i] = pixels[i + 2];
+            out[i + 1] = pixels[i + 1];
+            out[i + 2] = pixels[i];
+            out[i + 3] = pixels[i + 3];
+        }
+
+        bool success = SaveFileData(job->path, fileData, 18 + rowSize*job->height);
+        RL_FREE(fileData);
+
+        return success;
+    }
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    // Flip rows in place, the framebuffer is bottom-up
+    unsigned char *row = (unsigned char *)RL_MALLOC(rowSize);
+    if (row == NULL) return false;
+    for (int y = 0; y < job->height/2; y++)
+    {
+        unsigned char *top = pixels + y*rowSize;
+        unsigned char *bottom = pixels + (job->height - 1 - y)*rowSize;
+        memcpy(row, top, rowSize);
+        memcpy(top, bottom, rowSize);
+        memcpy(bottom, row, rowSize);
+    }
+    RL_FREE(row);
+
+    Image image = { pixels, job->width, job->height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    return ExportImage(image, job->path);       // WARNING: Module required: rtextures
+#else
+    TRACELOG(LOG_WARNING,"IMAGE: ExportImage() requires module: rtextures");
+    return false;
+#endif
+}
+
+// Append one frame to a recording, written once per period it covers
+// NOTE: YUV4MPEG2 takes planar 4:2:0 in BT.601 limited range, top-down and with even dimensions,
+// the odd last row and column of the framebuffer are left out
+static bool WriteCaptureVideoFrame(const CaptureJob *job)
+{
+    int width = job->width & ~1;
+    int height = job->height & ~1;
+    int rowSize = job->width*4;
+
+    if (job->header && (fprintf(job->file, "YUV4MPEG2 W%i H%i F%i:1 Ip A1:1 C420jpeg\n", width, height, job->fps) < 0)) return false;
+
+    unsigned char *frame = (unsigned char *)RL_MALLOC(width*height*3/2);
+    if (frame == NULL) return false;
+
+    unsigned char *planeY = frame;
+    unsigned char *planeU = frame + width*height;
+    unsigned char *planeV = planeU + width*height/4;
+
+    for (int y = 0; y < height; y += 2)
+    {
+        // Framebuffer rows are bottom-up
+        const unsigned char *row0 = job->pixels + (job->height - 1 - y)*rowSize;
+        const unsigned char *row1 = row0 - rowSize;
+
+        for (int x = 0; x < width; x += 2)
+        {
+            const unsigned char *p[4] = { row0 + x*4, row0 + x*4 + 4, row1 + x*4, row1 + x*4 + 4 };
+            int r = 0, g = 0, b = 0;
+
+            for (int i = 0; i < 4; i++)
+            {
+                planeY[(y + i/2)*width + x + i%2] = (unsigned char)(16 + ((66*p[i][0] + 129*p[i][1] + 25*p[i][2] + 128) >> 8));
+                r += p[i][0];
+                g += p[i][1];
+                b += p[i][2];
+            }
+
+            r /= 4; g /= 4; b /= 4;
+            planeU[(y/2)*(width/2) + x/2] = (unsigned char)(128 + ((-38*r - 74*g + 112*b + 128) >> 8));
+            planeV[(y/2)*(width/2) + x/2] = (unsigned char)(128 + ((112*r - 94*g - 18*b + 128) >> 8));
+        }
+    }
+
+    bool success = true;
+    for (int i = 0; (i < job->repeat) && success; i++)
+    {
+        success = (fputs("FRAME\n", job->file) >= 0) && (fwrite(frame, 1, width*height*3/2, job->file) == (size_t)(width*height*3/2));
+    }
+    RL_FREE(frame);
+
+    return success;
+}
+#endif  // SUPPORT_ASYNC_CAPTURE
+
+// Get a random value between min and max (both included)
+// NOTE: Drawn from the default stream, shared by every caller and not thread-safe
+int GetRandomValue(int min, int max)
+{
+    return GetRandomStreamValue(&randomDefault, min, max);
+}
+
+// Set the seed for the random number generator
+void SetRandomSeed(unsigned int seed)
+{
+    SetRandomStreamSeed(&randomDefault, seed, 0);
+}
+
+// Seed a random stream
+// NOTE: seed and id go through splitmix64, so nearby seeds or ids still give unrelated streams
+void SetRandomStreamSeed(RandomStream *stream, unsigned int seed, unsigned int id)
+{
+    unsigned long long x = ((unsigned long long)id << 32) | seed;
+
+    for (int i = 0; i < 4; i += 2)
+    {
+        x += 0x9e3779b97f4a7c15ull;
+        unsigned long long z = x;
+        z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27))*0x94d049bb133111ebull;
+        z ^= z >> 31;
+
+        stream->state[i] = (unsigned int)z;
+        stream->state[i + 1] = (unsigned int)(z >> 32);
+    }
+
+    // An all zero state only ever produces zeros
+    if ((stream->state[0] | stream->state[1] | stream->state[2] | stream->state[3]) == 0) stream->state[0] = 1;
+}
 
-    ExportImage(image, path);           // WARNING: Module required: rtextures
-    RL_FREE(imgData);
+// Get 32 random bits from a stream, xoshiro128**
+unsigned int GetRandomStreamBits(RandomStream *stream)
+{
+    unsigned int *s = stream->state;
+    unsigned int x = s[1]*5;
+    unsigned int result = ((x << 7) | (x >> 25))*9;
+    unsigned int t = s[1] << 9;
 
-#if defined(PLATFORM_WEB)
-    // Download file from MEMFS (emscripten memory filesystem)
-    // saveFileFromMEMFSToDisk() function is defined in raylib/src/shell.html
-    emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(path), GetFileName(path)));
-#endif
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 11) | (s[3] >> 21);
 
-    TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", path);
-#else
-    TRACELOG(LOG_WARNING,"IMAGE: ExportImage() requires module: rtextures");
-#endif
+    return result;
 }
 
 // Get a random value between min and max (both included)
-// WARNING: Ranges higher than RAND_MAX will return invalid results
-// More specifically, if (max - min) > INT_MAX there will be an overflow,
-// and otherwise if (max - min) > RAND_MAX the random value will incorrectly never exceed a certain threshold
-int GetRandomValue(int min, int max)
+// NOTE: Multiply-shift with rejection of the few low values that would bias the result, any range up to the full int is valid
+int GetRandomStreamValue(RandomStream *stream, int min, int max)
 {
     if (min > max)
     {
@@ -2901,18 +3818,38 @@ int GetRandomValue(int min, int max)
         min = tmp;
     }
 
-    if ((unsigned int)(max - min) > (unsigned int)RAND_MAX)
+    unsigned long long range = (unsigned long long)((long long)max - min) + 1;
+    if (range > 0xffffffffull) return (int)GetRandomStreamBits(stream);
+
+    unsigned long long m = (unsigned long long)GetRandomStreamBits(stream)*range;
+    if ((unsigned int)m < range)
     {
-        TRACELOG(LOG_WARNING, "Invalid GetRandomValue() arguments, range should not be higher than %i", RAND_MAX);
+        unsigned int threshold = (unsigned int)(0x100000000ull%range);
+        while ((unsigned int)m < threshold) m = (unsigned long long)GetRandomStreamBits(stream)*range;
     }
 
-    return (rand()%(abs(max - min) + 1) + min);
+    return (int)((long long)min + (long long)(m >> 32));
 }
 
-// Set the seed for the random number generator
-void SetRandomSeed(unsigned int seed)
+// Get a random value in [0.0f, 1.0f), every float step of 2^-24 equally likely
+float GetRandomStreamFloat(RandomStream *stream)
+{
+    return (float)(GetRandomStreamBits(stream) >> 8)*(1.0f/16777216.0f);
+}
+
+// Fill values with random values between min and max (both included)
+void FillRandomStreamValues(RandomStream *stream, int *values, int count, int min, int max)
+{
+    for (int i = 0; i < count; i++) values[i] = GetRandomStreamValue(stream, min, max);
+}
+
+// Fill values with random values in [0.0f, 1.0f)
+void FillRandomStreamFloats(RandomStream *stream, float *values, int count)
 {
-    srand(seed);
+    // Local copy of the state, it stays in registers for the whole loop
+    RandomStream local = *stream;
+    for (int i = 0; i < count; i++) values[i] = (float)(GetRandomStreamBits(&local) >> 8)*(1.0f/16777216.0f);
+    *stream = local;
 }
 
 // Check if the file exists
@@ -3717,6 +4654,164 @@ int SetGamepadMappings(const char *mappings)
     return result;
 }
 
+// Push a gamepad sample, a full ring drops it
+static void PushGamepadSample(const GamepadSample *sample)
+{
+    long head = gamepadSampler.head;
+    if ((head - SAMPLER_LOAD(gamepadSampler.tail)) >= MAX_GAMEPAD_SAMPLES) return;
+
+    gamepadSampler.ring[head%MAX_GAMEPAD_SAMPLES] = *sample;
+    SAMPLER_STORE(gamepadSampler.head, head + 1);
+}
+
+#if defined(SUPPORT_GAMEPAD_SAMPLER_THREAD)
+// Gamepad sampling thread, a sample is pushed for every poll that found the state changed
+static void *GamepadSamplerThread(void *arg)
+{
+    GamepadSample sample = { 0 };
+
+#if defined(_WIN32)
+    // XINPUT_STATE, and the XINPUT_GAMEPAD wButtons bits in GamepadButton order
+    struct { unsigned long packet; unsigned short buttons; unsigned char triggers[2]; short thumbs[4]; } state = { 0 };
+    static const unsigned short xinputButtons[] = { 0, 0x0001, 0x0008, 0x0002, 0x0004, 0x8000, 0x2000, 0x1000, 0x4000, 0x0100, 0, 0x0200, 0, 0x0020, 0, 0x0010, 0x0040, 0x0080 };
+    unsigned long lastPacket = 0;
+#endif
+
+    SetCurrentThreadPriority(PRIORITY_HIGH);
+
+    while (!gamepadSampler.quit)
+    {
+        bool changed = false;
+
+#if defined(__linux__)
+        // NOTE: Axes and buttons are the device's own numbering, not the GLFW gamepad mapping
+        struct js_event event = { 0 };
+        while (read(gamepadSampler.fd, &event, sizeof(event)) == (int)sizeof(event))
+        {
+            int type = event.type & ~JS_EVENT_INIT;
+            if ((type == JS_EVENT_AXIS) && (event.number < 6)) sample.axes[event.number] = (float)event.value/32768;
+            else if ((type == JS_EVENT_BUTTON) && (event.number < 32))
+            {
+                if (event.value) sample.buttons |= 1u << event.number;
+                else sample.buttons &= ~(1u << event.number);
+            }
+            changed = true;
+        }
+#else
+        if ((gamepadSampler.getState(gamepadSampler.gamepad, &state) == 0) && (state.packet != lastPacket))      // ERROR_SUCCESS
+        {
+            lastPacket = state.packet;
+
+            // NOTE: Y axes point down like the GLFW mapping, triggers go from -1 released to 1
+            sample.axes[GAMEPAD_AXIS_LEFT_X] = (float)state.thumbs[0]/32768;
+            sample.axes[GAMEPAD_AXIS_LEFT_Y] = -(float)state.thumbs[1]/32768;
+            sample.axes[GAMEPAD_AXIS_RIGHT_X] = (float)state.thumbs[2]/32768;
+            sample.axes[GAMEPAD_AXIS_RIGHT_Y] = -(float)state.thumbs[3]/32768;
+            sample.axes[GAMEPAD_AXIS_LEFT_TRIGGER] = state.triggers[0]/127.5f - 1.0f;
+            sample.axes[GAMEPAD_AXIS_RIGHT_TRIGGER] = state.triggers[1]/127.5f - 1.0f;
+
+            sample.buttons = 0;
+            for (int i = 0; i < (int)(sizeof(xinputButtons)/sizeof(xinputButtons[0])); i++)
+            {
+                if (state.buttons & xinputButtons[i]) sample.buttons |= 1u << i;
+            }
+            if (state.triggers[0] > 25) sample.buttons |= 1u << GAMEPAD_BUTTON_LEFT_TRIGGER_2;
+            if (state.triggers[1] > 25) sample.buttons |= 1u << GAMEPAD_BUTTON_RIGHT_TRIGGER_2;
+            changed = true;
+        }
+#endif
+
+        if (changed)
+        {
+            sample.time = GetTime();
+            PushGamepadSample(&sample);
+        }
+
+        WaitTime(gamepadSampler.period);
+    }
+
+    return NULL;
+}
+#endif
+
+// Start sampling a gamepad at rate polls per second, samples are read back with GetGamepadSamples()
+// NOTE: Returns false when the platform can't read it off the main thread, it is then sampled once per PollInputEvents()
+bool StartGamepadSampling(int gamepad, int rate)
+{
+    StopGamepadSampling();
+    if ((gamepad < 0) || (gamepad >= MAX_GAMEPADS)) return false;
+
+    gamepadSampler.gamepad = gamepad;
+    gamepadSampler.period = 1.0/((rate > 0)? rate : 1000);
+    gamepadSampler.quit = 0;
+    gamepadSampler.head = 0;
+    gamepadSampler.tail = 0;
+    gamepadSampler.threaded = false;
+    gamepadSampler.enabled = true;
+
+#if defined(SUPPORT_GAMEPAD_SAMPLER_THREAD)
+    bool ready = false;
+    #if defined(__linux__)
+    // NOTE: Gamepad n is /dev/input/js<n>, as PLATFORM_DRM reads them
+    char device[32] = { 0 };
+    sprintf(device, "/dev/input/js%i", gamepad);
+    gamepadSampler.fd = open(device, O_RDONLY | O_NONBLOCK);
+    ready = (gamepadSampler.fd >= 0);
+    #else
+    void *xinput = LoadLibraryA("xinput1_4.dll");
+    if (xinput == NULL) xinput = LoadLibraryA("xinput9_1_0.dll");
+    if (xinput != NULL) *(void **)&gamepadSampler.getState = GetProcAddress(xinput, "XInputGetState");
+    ready = (xinput != NULL) && (gamepadSampler.getState != NULL);
+    #endif
+
+    if (ready)
+    {
+        gamepadSampler.threaded = (pthread_create(&gamepadSampler.thread, NULL, GamepadSamplerThread, NULL) == 0);
+    #if defined(__linux__)
+        if (!gamepadSampler.threaded) close(gamepadSampler.fd);
+    #endif
+    }
+
+    if (gamepadSampler.threaded) TRACELOG(LOG_INFO, "INPUT: Gamepad %i sampled at %i Hz", gamepad, (int)(1.0/gamepadSampler.period + 0.5));
+    else TRACELOG(LOG_WARNING, "INPUT: Gamepad %i can't be sampled on a thread, sampling once per frame", gamepad);
+#endif
+
+    return gamepadSampler.threaded;
+}
+
+// Stop sampling the gamepad started with StartGamepadSampling()
+void StopGamepadSampling(void)
+{
+#if defined(SUPPORT_GAMEPAD_SAMPLER_THREAD)
+    if (gamepadSampler.threaded)
+    {
+        gamepadSampler.quit = 1;
+        pthread_join(gamepadSampler.thread, NULL);
+    #if defined(__linux__)
+        close(gamepadSampler.fd);
+    #endif
+    }
+#endif
+
+    gamepadSampler.threaded = false;
+    gamepadSampler.enabled = false;
+}
+
+// Get gamepad samples taken since the last call, oldest first, returns count
+// NOTE: Only the newest maxSamples are returned, older ones are skipped
+int GetGamepadSamples(GamepadSample *samples, int maxSamples)
+{
+    long tail = gamepadSampler.tail;
+    long head = SAMPLER_LOAD(gamepadSampler.head);
+    if ((head - tail) > maxSamples) tail = head - maxSamples;
+
+    int count = (int)(head - tail);
+    for (int i = 0; i < count; i++) samples[i] = gamepadSampler.ring[(tail + i)%MAX_GAMEPAD_SAMPLES];
+    SAMPLER_STORE(gamepadSampler.tail, head);
+
+    return count;
+}
+
 // Check if a mouse button has been pressed once
 bool IsMouseButtonPressed(int button)
 {
@@ -3797,6 +4892,42 @@ Vector2 GetMousePosition(void)
     return position;
 }
 
+// Get mouse position XY, queried from the platform instead of the last polled events
+// NOTE: Useful to late-latch the cursor right before using it, mouse state (delta, buttons) is not modified
+Vector2 GetMousePositionLatest(void)
+{
+#if defined(PLATFORM_DESKTOP)
+    double mouseX = 0.0;
+    double mouseY = 0.0;
+    glfwGetCursorPos(CORE.Window.handle, &mouseX, &mouseY);
+
+    Vector2 position = { 0 };
+    position.x = ((float)mouseX + CORE.Input.Mouse.offset.x)*CORE.Input.Mouse.scale.x;
+    position.y = ((float)mouseY + CORE.Input.Mouse.offset.y)*CORE.Input.Mouse.scale.y;
+
+    return position;
+#else
+    return GetMousePosition();
+#endif
+}
+
+// Get mouse events handled by the last events poll, in the order they arrived
+// NOTE: Positions are scaled like GetMousePosition(), so the last one matches it
+int GetMouseEvents(MouseEvent *events, int maxEvents)
+{
+    int count = CORE.Input.Mouse.eventQueueCount;
+    if (count > maxEvents) count = maxEvents;
+
+    for (int i = 0; i < count; i++)
+    {
+        events[i] = CORE.Input.Mouse.eventQueue[i];
+        events[i].position.x = (events[i].position.x + CORE.Input.Mouse.offset.x)*CORE.Input.Mouse.scale.x;
+        events[i].position.y = (events[i].position.y + CORE.Input.Mouse.offset.y)*CORE.Input.Mouse.scale.y;
+    }
+
+    return count;
+}
+
 // Get mouse delta between frames
 Vector2 GetMouseDelta(void)
 {
@@ -3941,6 +5072,7 @@ static bool InitGraphicsDevice(int width, int height)
     CORE.Window.screen.width = width;            // User desired width
     CORE.Window.screen.height = height;          // User desired height
     CORE.Window.screenScale = MatrixIdentity();  // No draw scaling required by default
+    CORE.Window.presentMode = PRESENT_VSYNC;     // Platforms without a choice present on vertical blank
 
     // NOTE: Framebuffer (render area - CORE.Window.render.width, CORE.Window.render.height) could include black bars...
     // ...in top-down or left-right to match display aspect ratio (no weird scaling)
@@ -3961,6 +5093,15 @@ static bool InitGraphicsDevice(int width, int height)
 #if defined(__APPLE__)
     glfwInitHint(GLFW_COCOA_CHDIR_RESOURCES, GLFW_FALSE);
 #endif
+#if defined(PLATFORM_DESKTOP)
+    // NOTE: Offscreen rendering runs on GLFW Null platform, no display server is required,
+    // the window is a pbuffer of the screen size and input comes only from the program
+    if ((CORE.Window.flags & FLAG_WINDOW_OFFSCREEN) > 0)
+    {
+        glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+        CORE.Window.flags &= ~(FLAG_FULLSCREEN_MODE | FLAG_WINDOW_HIGHDPI | FLAG_VSYNC_HINT);
+    }
+#endif
 
     if (!glfwInit())
     {
@@ -3968,6 +5109,8 @@ static bool InitGraphicsDevice(int width, int height)
         return false;
     }
 
+    TraceStartupPhase("glfw init");
+
     glfwDefaultWindowHints();                       // Set default windows hints
     //glfwWindowHint(GLFW_RED_BITS, 8);             // Framebuffer red color component bits
     //glfwWindowHint(GLFW_GREEN_BITS, 8);           // Framebuffer green color component bits
@@ -4088,6 +5231,9 @@ static bool InitGraphicsDevice(int width, int height)
     }
 
 #if defined(PLATFORM_DESKTOP)
+    // Surfaceless EGL is tried first, OSMesa if it fails
+    if ((CORE.Window.flags & FLAG_WINDOW_OFFSCREEN) > 0) glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);
+
     // NOTE: GLFW 3.4+ defers initialization of the Joystick subsystem on the first call to any Joystick related functions.
     // Forcing this initialization here avoids doing it on PollInputEvents() called by EndDrawing() after first frame has been just drawn.
     // The initialization will still happen and possible delays still occur, but before the window is shown, which is a nicer experience.
@@ -4187,6 +5333,19 @@ static bool InitGraphicsDevice(int width, int height)
         // No-fullscreen window creation
         CORE.Window.handle = glfwCreateWindow(CORE.Window.screen.width, CORE.Window.screen.height, (CORE.Window.title != 0)? CORE.Window.title : " ", NULL, NULL);
 
+#if defined(PLATFORM_DESKTOP)
+        if ((CORE.Window.flags & FLAG_WINDOW_OFFSCREEN) > 0)
+        {
+            if (!CORE.Window.handle)
+            {
+                TRACELOG(LOG_INFO, "DISPLAY: Surfaceless EGL not available, trying OSMesa");
+                glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+                CORE.Window.handle = glfwCreateWindow(CORE.Window.screen.width, CORE.Window.screen.height, (CORE.Window.title != 0)? CORE.Window.title : " ", NULL, NULL);
+            }
+            else TRACELOG(LOG_INFO, "DISPLAY: Rendering offscreen with surfaceless EGL");
+        }
+#endif
+
         if (CORE.Window.handle)
         {
             CORE.Window.render.width = CORE.Window.screen.width;
@@ -4234,6 +5393,9 @@ static bool InitGraphicsDevice(int width, int height)
         glfwSwapInterval(1);
         TRACELOG(LOG_INFO, "DISPLAY: Trying to enable VSYNC");
     }
+#if defined(PLATFORM_DESKTOP)
+    CORE.Window.presentMode = (CORE.Window.flags & FLAG_VSYNC_HINT)? PRESENT_VSYNC : PRESENT_IMMEDIATE;
+#endif
 
     int fbWidth = CORE.Window.screen.width;
     int fbHeight = CORE.Window.screen.height;
@@ -4291,7 +5453,10 @@ static bool InitGraphicsDevice(int width, int height)
     CORE.Window.gbmDevice = NULL;
     CORE.Window.gbmSurface = NULL;
     CORE.Window.prevBO = NULL;
-    CORE.Window.prevFB = 0;
+    CORE.Window.modeSet = false;
+    CORE.Window.flipPending = false;
+    CORE.Window.flipped = false;
+    CORE.Window.refreshPeriod = 0.0;
 
 #if defined(DEFAULT_GRAPHIC_DEVICE_DRM)
     CORE.Window.fd = open(DEFAULT_GRAPHIC_DEVICE_DRM, O_RDWR);
@@ -4382,15 +5547,16 @@ static bool InitGraphicsDevice(int width, int height)
             return false;
         }
 
-        CORE.Window.screen.width = CORE.Window.display.width;
-        CORE.Window.screen.height = CORE.Window.display.height;
+        // NOTE: The display size isn't known yet, the screen takes the size of the mode in use
+        CORE.Window.screen.width = CORE.Window.connector->modes[CORE.Window.modeIndex].hdisplay;
+        CORE.Window.screen.height = CORE.Window.connector->modes[CORE.Window.modeIndex].vdisplay;
     }
 
     const bool allowInterlaced = CORE.Window.flags & FLAG_INTERLACED_HINT;
     const int fps = (CORE.Time.target > 0) ? (1.0/CORE.Time.target) : 60;
 
-    // Try to find an exact matching mode
-    CORE.Window.modeIndex = FindExactConnectorMode(CORE.Window.connector, CORE.Window.screen.width, CORE.Window.screen.height, fps, allowInterlaced);
+    // Try to find an exact matching mode, the current one is kept when it was requested
+    if (CORE.Window.modeIndex < 0) CORE.Window.modeIndex = FindExactConnectorMode(CORE.Window.connector, CORE.Window.screen.width, CORE.Window.screen.height, fps, allowInterlaced);
 
     // If nothing found, try to find a nearly matching mode
     if (CORE.Window.modeIndex < 0) CORE.Window.modeIndex = FindNearestConnectorMode(CORE.Window.connector, CORE.Window.screen.width, CORE.Window.screen.height, fps, allowInterlaced);
@@ -4418,6 +5584,8 @@ static bool InitGraphicsDevice(int width, int height)
         (CORE.Window.connector->modes[CORE.Window.modeIndex].flags & DRM_MODE_FLAG_INTERLACE) ? 'i' : 'p',
         CORE.Window.connector->modes[CORE.Window.modeIndex].vrefresh);
 
+    if (CORE.Window.connector->modes[CORE.Window.modeIndex].vrefresh > 0) CORE.Window.refreshPeriod = 1.0/CORE.Window.connector->modes[CORE.Window.modeIndex].vrefresh;
+
     // Use the width and height of the surface for render
     CORE.Window.render.width = CORE.Window.screen.width;
     CORE.Window.render.height = CORE.Window.screen.height;
@@ -4522,7 +5690,7 @@ static bool InitGraphicsDevice(int width, int height)
     if (!eglChooseConfig(CORE.Window.device, framebufferAttribs, configs, numConfigs, &matchingNumConfigs))
     {
         TRACELOG(LOG_WARNING, "DISPLAY: Failed to choose EGL config: 0x%x", eglGetError());
-        free(configs);
+        RL_FREE(configs);
         return false;
     }
 
@@ -4685,6 +5853,8 @@ static bool InitGraphicsDevice(int width, int height)
     }
 #endif  // PLATFORM_ANDROID || PLATFORM_RPI || PLATFORM_DRM
 
+    TraceStartupPhase("window and context");
+
     // Load OpenGL extensions
     // NOTE: GL procedures address loader is required to load extensions
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
@@ -4692,10 +5862,12 @@ static bool InitGraphicsDevice(int width, int height)
 #else
     rlLoadExtensions(eglGetProcAddress);
 #endif
+    TraceStartupPhase("gl extensions");
 
     // Initialize OpenGL context (states and resources)
     // NOTE: CORE.Window.currentFbo.width and CORE.Window.currentFbo.height not used, just stored as globals in rlgl
     rlglInit(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
+    TraceStartupPhase("rlgl init");     // Default texture, shaders and render batch
 
     // Setup default viewport
     // NOTE: It updated CORE.Window.render.width and CORE.Window.render.height
@@ -4840,6 +6012,25 @@ static void InitTimer(void)
     CORE.Time.previous = GetTime();     // Get time as double
 }
 
+// Get startup trace clock, seconds from an arbitrary monotonic point
+// NOTE: Independent of platform initialization, so it can time what happens before InitWindow()
+static double GetStartupClock(void)
+{
+#if defined(_WIN32)
+    unsigned long long int counter = 0;
+    unsigned long long int frequency = 1;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+
+    return (double)counter/(double)frequency;
+#else
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + (double)now.tv_nsec*1e-9;
+#endif
+}
+
 // Wait for some time (stop program execution)
 // NOTE: Sleep() granularity could be around 10 ms, it means, Sleep() could
 // take longer than expected... for that reason we use the busy wait loop
@@ -4884,6 +6075,184 @@ void WaitTime(double seconds)
 #endif
 }
 
+// Set the scheduling priority of the calling thread
+// NOTE: Elevated and real-time priorities usually need privileges (on Linux CAP_SYS_NICE, or RLIMIT_NICE and
+// RLIMIT_RTPRIO raised), the call fails and the thread keeps its priority otherwise. On Linux priorities other
+// than real-time are the thread niceness. Returns true on success
+bool SetCurrentThreadPriority(int priority)
+{
+    bool result = false;
+
+#if defined(_WIN32)
+    // THREAD_PRIORITY_BELOW_NORMAL, THREAD_PRIORITY_NORMAL, THREAD_PRIORITY_HIGHEST, THREAD_PRIORITY_TIME_CRITICAL
+    int level = 0;
+    if (priority == PRIORITY_LOW) level = -1;
+    else if (priority == PRIORITY_HIGH) level = 2;
+    else if (priority == PRIORITY_REALTIME) level = 15;
+
+    result = (SetThreadPriority(GetCurrentThread(), level) != 0);
+#elif defined(__linux__)
+    struct sched_param param = { 0 };
+
+    if (priority == PRIORITY_REALTIME)
+    {
+        param.sched_priority = sched_get_priority_min(SCHED_FIFO);
+        result = (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0);
+    }
+    else
+    {
+        // Back to time sharing in case the thread was real-time, niceness is per thread on Linux
+        pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);
+
+        int nice = 0;
+        if (priority == PRIORITY_LOW) nice = 10;
+        else if (priority == PRIORITY_HIGH) nice = -10;
+
+        result = (setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), nice) == 0);
+    }
+#elif defined(__APPLE__)
+    struct sched_param param = { 0 };
+    int policy = (priority == PRIORITY_REALTIME)? SCHED_RR : SCHED_OTHER;
+    int low = sched_get_priority_min(policy);
+    int high = sched_get_priority_max(policy);
+
+    if (priority == PRIORITY_LOW) param.sched_priority = low;
+    else if (priority == PRIORITY_NORMAL) param.sched_priority = (low + high)/2;
+    else param.sched_priority = high;
+
+    result = (pthread_setschedparam(pthread_self(), policy, &param) == 0);
+#else
+    (void)priority;
+#endif
+
+    if (!result) TRACELOG(LOG_WARNING, "SYSTEM: Failed to set thread priority %i", priority);
+
+    return result;
+}
+
+// Pin the calling thread to a CPU core, a negative core lets it run on any core again
+// NOTE: Not supported on macOS and web, returns true on success
+bool SetCurrentThreadAffinity(int core)
+{
+    bool result = false;
+
+#if defined(_WIN32)
+    size_t processMask = 0;
+    size_t systemMask = 0;
+    GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask);
+
+    size_t mask = processMask;
+    if ((core >= 0) && (core < (int)(sizeof(size_t)*8))) mask &= ((size_t)1 << core);
+    else if (core >= 0) mask = 0;
+
+    result = ((mask != 0) && (SetThreadAffinityMask(GetCurrentThread(), mask) != 0));
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+
+    if (core < 0)
+    {
+        long cores = sysconf(_SC_NPROCESSORS_CONF);
+        for (int i = 0; (i < cores) && (i < CPU_SETSIZE); i++) CPU_SET(i, &set);
+    }
+    else if (core < CPU_SETSIZE) CPU_SET(core, &set);
+
+    result = ((CPU_COUNT(&set) > 0) && (sched_setaffinity(0, sizeof(set), &set) == 0));
+#else
+    (void)core;
+#endif
+
+    if (!result) TRACELOG(LOG_WARNING, "SYSTEM: Failed to set thread affinity to core %i", core);
+
+    return result;
+}
+
+#if defined(SUPPORT_FRAME_PACING)
+// Wait until an absolute time, GetTime() clock
+// NOTE: Sleeps on a high-resolution timer until the measured wake up lateness before the deadline,
+// the remaining time is spun. Lateness is measured on every wake up, so the spin stays short
+static void WaitUntilTime(double deadline)
+{
+    double now = GetTime();
+    double sleepUntil = deadline - CORE.Time.wakeSlack;
+
+    if (sleepUntil > now)
+    {
+    #if defined(_WIN32)
+        static void *timer = NULL;
+        if (timer == NULL)
+        {
+            // NOTE: CREATE_WAITABLE_TIMER_HIGH_RESOLUTION (0x2) requires Windows 10 1803, fallback to a regular waitable timer
+            timer = CreateWaitableTimerExW(NULL, NULL, 0x00000002, 0x1F0003);
+            if (timer == NULL) timer = CreateWaitableTimerExW(NULL, NULL, 0, 0x1F0003);
+        }
+
+        if (timer != NULL)
+        {
+            long long dueTime = -(long long)((sleepUntil - now)*10000000.0);   // Relative time, 100 ns units
+            SetWaitableTimer(timer, &dueTime, 0, NULL, NULL, 0);
+            WaitForSingleObject(timer, 0xFFFFFFFF);
+        }
+        else Sleep((unsigned long)((sleepUntil - now)*1000.0));
+    #elif defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+        // NOTE: Absolute wake up time, so a signal interrupting the sleep does not extend it
+        struct timespec wakeTime = { 0 };
+        clock_gettime(CLOCK_MONOTONIC, &wakeTime);
+
+        long long nsec = wakeTime.tv_nsec + (long long)((sleepUntil - now)*1000000000.0);
+        wakeTime.tv_sec += (time_t)(nsec/1000000000LL);
+        wakeTime.tv_nsec = (long)(nsec%1000000000LL);
+
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeTime, NULL) != 0) continue;
+    #else
+        struct timespec req = { 0 };
+        double sleepSeconds = sleepUntil - now;
+        req.tv_sec = (time_t)sleepSeconds;
+        req.tv_nsec = (long)((sleepSeconds - req.tv_sec)*1000000000.0);
+
+        while (nanosleep(&req, &req) == -1) continue;
+    #endif
+
+        // Timer lateness feedback: follow a later wake up immediately, relax slowly when it gets better
+        double lateness = GetTime() - sleepUntil;
+        if (lateness > 0.002) lateness = 0.002;     // Never spin more than 2 ms
+        if (lateness > CORE.Time.wakeSlack) CORE.Time.wakeSlack = lateness;
+        else CORE.Time.wakeSlack += (lateness - CORE.Time.wakeSlack)*0.05;
+    }
+
+    while (GetTime() < deadline) { }
+}
+#endif
+
+// Wait for the GPU until no more frames than the limit are queued
+// NOTE: A fence goes in after every swap, the one from limit frames before is then waited for.
+// Fences are OpenGL 3.3 only, with other graphics APIs the limit does nothing
+static void LimitFrameLatency(void)
+{
+    CORE.Time.timings.latencyWait = 0.0;
+    if (CORE.Window.frameLatencyLimit <= 0) return;
+
+    const int ringSize = MAX_FRAME_LATENCY + 1;
+    unsigned int frame = CORE.Window.latencyFrame++;
+
+    void **fence = &CORE.Window.latencyFences[frame%ringSize];
+    rlUnloadFence(*fence);
+    *fence = rlLoadFence();
+
+    if (frame >= (unsigned int)CORE.Window.frameLatencyLimit)
+    {
+        void **oldest = &CORE.Window.latencyFences[(frame - CORE.Window.frameLatencyLimit)%ringSize];
+        double waitStart = GetTime();
+
+        // NOTE: Bounded, a lost device or a hung driver costs a slow frame instead of never returning
+        rlIsFenceSignaled(*oldest, 0.1);
+        rlUnloadFence(*oldest);
+        *oldest = NULL;
+
+        CORE.Time.timings.latencyWait = GetTime() - waitStart;
+    }
+}
+
 // Swap back buffer with front buffer (screen drawing)
 void SwapScreenBuffer(void)
 {
@@ -4899,22 +6268,43 @@ void SwapScreenBuffer(void)
     if (!CORE.Window.gbmSurface || (-1 == CORE.Window.fd) || !CORE.Window.connector || !CORE.Window.crtc) TRACELOG(LOG_ERROR, "DISPLAY: DRM initialization failed to swap");
 
     struct gbm_bo *bo = gbm_surface_lock_front_buffer(CORE.Window.gbmSurface);
-    if (!bo) TRACELOG(LOG_ERROR, "DISPLAY: Failed GBM to lock front buffer");
-
-    uint32_t fb = 0;
-    int result = drmModeAddFB(CORE.Window.fd, CORE.Window.connector->modes[CORE.Window.modeIndex].hdisplay, CORE.Window.connector->modes[CORE.Window.modeIndex].vdisplay, 24, 32, gbm_bo_get_stride(bo), gbm_bo_get_handle(bo).u32, &fb);
-    if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeAddFB() failed with result: %d", result);
+    if (!bo)
+    {
+        TRACELOG(LOG_ERROR, "DISPLAY: Failed GBM to lock front buffer");
+        return;
+    }
 
-    result = drmModeSetCrtc(CORE.Window.fd, CORE.Window.crtc->crtc_id, fb, 0, 0, &CORE.Window.connector->connector_id, 1, &CORE.Window.connector->modes[CORE.Window.modeIndex]);
-    if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeSetCrtc() failed with result: %d", result);
+    uint32_t fb = GetBufferFramebuffer(bo);
+    int result = 0;
+    CORE.Window.flipped = false;
 
-    if (CORE.Window.prevFB)
+    // NOTE: The mode is set once with the first frame, after that every frame is a page flip that
+    // lands on vertical blank, no tearing and no modeset per frame. Waiting for the flip to complete
+    // paces the loop to the display and keeps the previous buffer on screen until it is released
+    if (!CORE.Window.modeSet)
+    {
+        result = drmModeSetCrtc(CORE.Window.fd, CORE.Window.crtc->crtc_id, fb, 0, 0, &CORE.Window.connector->connector_id, 1, &CORE.Window.connector->modes[CORE.Window.modeIndex]);
+        if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeSetCrtc() failed with result: %d", result);
+        else CORE.Window.modeSet = true;
+    }
+    else
     {
-        result = drmModeRmFB(CORE.Window.fd, CORE.Window.prevFB);
-        if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeRmFB() failed with result: %d", result);
+        result = drmModePageFlip(CORE.Window.fd, CORE.Window.crtc->crtc_id, fb, DRM_MODE_PAGE_FLIP_EVENT, NULL);
+        if (result != 0) TRACELOG(LOG_WARNING, "DISPLAY: drmModePageFlip() failed with result: %d", result);
+        else
+        {
+            CORE.Window.flipPending = true;
+            WaitPageFlip();
+            CORE.Window.flipped = true;
+        }
     }
 
-    CORE.Window.prevFB = fb;
+    // A buffer that never reached the screen goes straight back to the surface
+    if (result != 0)
+    {
+        gbm_surface_release_buffer(CORE.Window.gbmSurface, bo);
+        return;
+    }
 
     if (CORE.Window.prevBO) gbm_surface_release_buffer(CORE.Window.gbmSurface, CORE.Window.prevBO);
 
@@ -4922,6 +6312,8 @@ void SwapScreenBuffer(void)
 
 #endif  // PLATFORM_DRM
 #endif  // PLATFORM_ANDROID || PLATFORM_RPI || PLATFORM_DRM
+
+    LimitFrameLatency();
 }
 
 // Register all input events
@@ -4936,6 +6328,7 @@ void PollInputEvents(void)
     // Reset keys/chars pressed registered
     CORE.Input.Keyboard.keyPressedQueueCount = 0;
     CORE.Input.Keyboard.charPressedQueueCount = 0;
+    CORE.Input.Mouse.eventQueueCount = 0;
 
 #if !(defined(PLATFORM_RPI) || defined(PLATFORM_DRM))
     // Reset last gamepad button/axis registered state
@@ -5186,6 +6579,19 @@ void PollInputEvents(void)
     // NOTE: Mouse input events polling is done asynchronously in another pthread - EventThread()
     // NOTE: Gamepad (Joystick) input events polling is done asynchonously in another pthread - GamepadThread()
 #endif
+
+    // A gamepad sampled without a thread gets the state this poll read
+    if (gamepadSampler.enabled && !gamepadSampler.threaded && CORE.Input.Gamepad.ready[gamepadSampler.gamepad])
+    {
+        GamepadSample sample = { 0 };
+        sample.time = GetTime();
+        for (int i = 0; (i < 6) && (i < MAX_GAMEPAD_AXIS); i++) sample.axes[i] = CORE.Input.Gamepad.axisState[gamepadSampler.gamepad][i];
+        for (int i = 0; (i < 32) && (i < MAX_GAMEPAD_BUTTONS); i++)
+        {
+            if (CORE.Input.Gamepad.currentButtonState[gamepadSampler.gamepad][i]) sample.buttons |= 1u << i;
+        }
+        PushGamepadSample(&sample);
+    }
 }
 
 // Scan all files and directories in a base path
@@ -5373,7 +6779,7 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
 #if defined(SUPPORT_SCREEN_CAPTURE)
     if ((key == GLFW_KEY_F12) && (action == GLFW_PRESS))
     {
-        TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
+        TakeScreenshotAsync(TextFormat("screenshot%03i.png", screenshotCounter));
         screenshotCounter++;
     }
 #endif  // SUPPORT_SCREEN_CAPTURE
@@ -5421,6 +6827,7 @@ static void MouseButtonCallback(GLFWwindow *window, int button, int action, int
     // WARNING: GLFW could only return GLFW_PRESS (1) or GLFW_RELEASE (0) for now,
     // but future releases may add more actions (i.e. GLFW_REPEAT)
     CORE.Input.Mouse.currentButtonState[button] = action;
+    RecordMouseEvent(button);
 
 #if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)         // PLATFORM_DESKTOP
     // Process mouse events as touches to be able to use mouse-gestures
@@ -5456,6 +6863,7 @@ static void MouseCursorPosCallback(GLFWwindow *window, double x, double y)
     CORE.Input.Mouse.currentPosition.x = (float)x;
     CORE.Input.Mouse.currentPosition.y = (float)y;
     CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
+    RecordMouseEvent(-1);
 
 #if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)         // PLATFORM_DESKTOP
     // Process mouse events as touches to be able to use mouse-gestures
@@ -5481,6 +6889,24 @@ static void MouseCursorPosCallback(GLFWwindow *window, double x, double y)
 #endif
 }
 
+// Add current mouse state to the events queue, button is the one that changed or -1 for motion
+// NOTE: GLFW doesn't pass the platform event time, so events are stamped when the poll handles them.
+// When the queue is full the last event is overwritten, the latest state is never lost
+static void RecordMouseEvent(int button)
+{
+    if (CORE.Input.Mouse.eventQueueCount == MAX_MOUSE_EVENT_QUEUE) CORE.Input.Mouse.eventQueueCount--;
+
+    MouseEvent *event = &CORE.Input.Mouse.eventQueue[CORE.Input.Mouse.eventQueueCount++];
+    event->time = glfwGetTime();
+    event->position = CORE.Input.Mouse.currentPosition;
+    event->button = button;
+    event->buttons = 0;
+    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++)
+    {
+        if (CORE.Input.Mouse.currentButtonState[i]) event->buttons |= 1 << i;
+    }
+}
+
 // GLFW3 Scrolling Callback, runs on mouse wheel
 static void MouseScrollCallback(GLFWwindow *window, double xoffset, double yoffset)
 {
@@ -5570,17 +6996,12 @@ static void AndroidCommandCallback(struct android_app *app, int32_t cmd)
                     InitTimer();
 
                     // Initialize random seed
-                    srand((unsigned int)time(NULL));
+                    SetRandomSeed((unsigned int)time(NULL));
 
                 #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
-                    // Load default font
+                    // Reload default font on the new context (shapes texture follows it)
                     // WARNING: External function: Module required: rtext
                     LoadFontDefault();
-                    Rectangle rec = GetFontDefault().recs[95];
-                    // NOTE: We setup a 1px padding on char rectangle to avoid pixel bleeding on MSAA filtering
-                    #if defined(SUPPORT_MODULE_RSHAPES)
-                    SetShapesTexture(GetFontDefault().texture, (Rectangle){ rec.x + 1, rec.y + 1, rec.width - 2, rec.height - 2 });  // WARNING: Module required: rshapes
-                    #endif
                 #endif
 
                     // TODO: GPU assets reload in case of lost focus (lost context)
@@ -6157,7 +7578,7 @@ static void ProcessKeyboard(void)
     // Check screen capture key (raylib key: KEY_F12)
     if (CORE.Input.Keyboard.currentKeyState[301] == 1)
     {
-        TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
+        TakeScreenshotAsync(TextFormat("screenshot%03i.png", screenshotCounter));
         screenshotCounter++;
     }
 #endif
@@ -6468,7 +7889,7 @@ static void PollKeyboardEvents(void)
                     // Check screen capture key (raylib key: KEY_F12)
                     if (CORE.Input.Keyboard.currentKeyState[301] == 1)
                     {
-                        TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
+                        TakeScreenshotAsync(TextFormat("screenshot%03i.png", screenshotCounter));
                         screenshotCounter++;
                     }
                 #endif
@@ -6839,6 +8260,68 @@ static int FindNearestConnectorMode(const drmModeConnector *connector, uint widt
 
     return nearestIndex;
 }
+
+// Get the DRM framebuffer of a GBM buffer
+// NOTE: The surface cycles through a few buffers, each one gets its framebuffer the first time it is
+// presented and keeps it until the buffer is destroyed with the surface
+static uint32_t GetBufferFramebuffer(struct gbm_bo *bo)
+{
+    uint32_t fb = (uint32_t)(uintptr_t)gbm_bo_get_user_data(bo);
+
+    if (fb == 0)
+    {
+        int result = drmModeAddFB(CORE.Window.fd, gbm_bo_get_width(bo), gbm_bo_get_height(bo), 24, 32, gbm_bo_get_stride(bo), gbm_bo_get_handle(bo).u32, &fb);
+        if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeAddFB() failed with result: %d", result);
+        else gbm_bo_set_user_data(bo, (void *)(uintptr_t)fb, DestroyBufferFramebuffer);
+    }
+
+    return fb;
+}
+
+// Remove the DRM framebuffer of a GBM buffer being destroyed
+static void DestroyBufferFramebuffer(struct gbm_bo *bo, void *data)
+{
+    (void)bo;
+    uint32_t fb = (uint32_t)(uintptr_t)data;
+
+    if (fb != 0) drmModeRmFB(CORE.Window.fd, fb);
+}
+
+// Page flip completion event callback
+static void PageFlipHandler(int fd, unsigned int frame, unsigned int sec, unsigned int usec, void *data)
+{
+    (void)fd; (void)frame; (void)sec; (void)usec; (void)data;
+
+    CORE.Window.flipPending = false;
+}
+
+// Wait for the queued page flip to complete
+// NOTE: A flip that never completes (display unplugged, VT switched away) times out instead of
+// hanging the loop, the next frame then sets the mode again
+static void WaitPageFlip(void)
+{
+    drmEventContext context = { 0 };
+    context.version = 2;
+    context.page_flip_handler = PageFlipHandler;
+
+    struct pollfd pfd = { .fd = CORE.Window.fd, .events = POLLIN };
+
+    while (CORE.Window.flipPending)
+    {
+        int result = poll(&pfd, 1, 100);
+
+        if ((result < 0) && (errno == EINTR)) continue;
+        if (result <= 0)
+        {
+            TRACELOG(LOG_WARNING, "DISPLAY: Page flip timed out");
+            CORE.Window.flipPending = false;
+            CORE.Window.modeSet = false;
+            break;
+        }
+
+        drmHandleEvent(CORE.Window.fd, &context);
+    }
+}
 #endif
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
@@ -7195,7 +8678,7 @@ static void PlayAutomationEvent(unsigned int frame)
                 // Custom events
                 case ACTION_TAKE_SCREENSHOT:
                 {
-                    TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
+                    TakeScreenshotAsync(TextFormat("screenshot%03i.png", screenshotCounter));
                     screenshotCounter++;
                 } break;
                 case ACTION_SETTARGETFPS: SetTargetFPS(events[i].params[0]); break;
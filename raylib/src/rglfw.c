@@ -66,6 +66,12 @@
 #include "external/glfw/src/input.c"
 #include "external/glfw/src/vulkan.c"
 
+// Null platform, only used when requested with glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL)
+#include "external/glfw/src/null_init.c"
+#include "external/glfw/src/null_monitor.c"
+#include "external/glfw/src/null_window.c"
+#include "external/glfw/src/null_joystick.c"
+
 #if defined(_WIN32) || defined(__CYGWIN__)
     #include "external/glfw/src/win32_init.c"
     #include "external/glfw/src/win32_module.c"
@@ -109,7 +115,6 @@
     #include "external/glfw/src/posix_thread.c"
     #include "external/glfw/src/posix_time.c"
     #include "external/glfw/src/posix_poll.c"
-    #include "external/glfw/src/null_joystick.c"
     #include "external/glfw/src/xkb_unicode.c"
 
     #include "external/glfw/src/x11_init.c"
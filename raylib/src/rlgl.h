@@ -51,6 +51,9 @@
 *
 *       #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS   8192    // Default internal render batch elements limits
 *       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
+*                                                          // NOTE: With more than one buffer and GL_ARB_buffer_storage available,
+*                                                          // batch buffers are persistently mapped and fenced instead of re-uploaded
+*       #define RL_DEFAULT_BATCH_MAX_BUFFER_ELEMENTS 8192  // Capacity the default batch may grow to between frames instead of flushing mid-frame
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 *
@@ -210,6 +213,10 @@
 #ifndef RL_DEFAULT_BATCH_BUFFERS
     #define RL_DEFAULT_BATCH_BUFFERS                 1      // Default number of batch buffers (multi-buffering)
 #endif
+#ifndef RL_DEFAULT_BATCH_MAX_BUFFER_ELEMENTS
+    // NOTE: Equal to the initial size the default batch never grows
+    #define RL_DEFAULT_BATCH_MAX_BUFFER_ELEMENTS     RL_DEFAULT_BATCH_BUFFER_ELEMENTS
+#endif
 #ifndef RL_DEFAULT_BATCH_DRAWCALLS
     #define RL_DEFAULT_BATCH_DRAWCALLS             256      // Default number of batch draw calls (by state changes: mode, texture)
 #endif
@@ -217,6 +224,14 @@
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
 
+// GPU timer queries
+#ifndef RL_GPU_TIMER_FRAMES
+    #define RL_GPU_TIMER_FRAMES                      4      // Frames timed on the GPU in flight, each is collected once its results are available
+#endif
+#ifndef RL_GPU_TIMER_BATCHES
+    #define RL_GPU_TIMER_BATCHES                    16      // Render batch draws timed per frame, later ones only count to the frame time
+#endif
+
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
     #define RL_MAX_MATRIX_STACK_SIZE                32      // Maximum size of Matrix stack
@@ -339,6 +354,15 @@ typedef struct Matrix {
 #define RL_MATRIX_TYPE
 #endif
 
+// Interleaved vertex of a compact 2D render batch, 12 bytes instead of 24
+// NOTE: Position is 13.3 fixed point (1/8 pixel, +/-4096 range) without depth,
+// texcoords are normalized to [0..1] and clamped outside of it
+typedef struct rlCompactVertex {
+    short x, y;                 // Vertex position (shader-location = 0)
+    unsigned short u, v;        // Vertex texture coordinates (shader-location = 1)
+    unsigned char r, g, b, a;   // Vertex color (shader-location = 3)
+} rlCompactVertex;
+
 // Dynamic vertex buffers (position + texcoords + colors + indices arrays)
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
@@ -346,6 +370,7 @@ typedef struct rlVertexBuffer {
     float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
     float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
     unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+    rlCompactVertex *compact;   // Interleaved vertex data of compact batches (vertices, texcoords and colors are NULL)
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
@@ -354,6 +379,10 @@ typedef struct rlVertexBuffer {
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
     unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
+    unsigned int sortVboId;     // OpenGL index buffer for sorted draws (created on first sorted draw)
+
+    bool mapped;                // Vertex data arrays point into persistently mapped VBOs (no upload required)
+    void *fence;                // OpenGL sync object, signaled once the GPU has finished reading a mapped buffer
 } rlVertexBuffer;
 
 // Draw call type
@@ -367,6 +396,7 @@ typedef struct rlDrawCall {
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
     //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShaderId
     unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
+    int layer;                  // Sorting layer, draws are only reordered within one (see rlEnableDrawSorting())
 
     //Matrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
     //Matrix modelview;         // Modelview matrix for this draw -> Using RLGL.modelview by default
@@ -381,8 +411,36 @@ typedef struct rlRenderBatch {
     rlDrawCall *draws;          // Draw calls array, depends on textureId
     int drawCounter;            // Draw calls counter
     float currentDepth;         // Current depth value for next draw
+
+    int maxElementCount;        // Elements (quads) the buffers may grow to, see rlSetRenderBatchGrowth()
+    int frameVertices;          // Vertices drawn since the last rlUpdateRenderBatchSize()
+    int frameOverflows;         // Flushes forced by a full buffer since the last rlUpdateRenderBatchSize()
 } rlRenderBatch;
 
+// rlRenderStats type, accumulated by rlDrawRenderBatch() until rlResetRenderStats()
+typedef struct rlRenderStats {
+    int drawCalls;              // Draw calls submitted to the GPU
+    int vertices;               // Vertices uploaded to the GPU
+    int batchFlushes;           // Render batch flushes with vertex data
+    int batchOverflows;         // Render batch flushes forced by a full buffer (included in batchFlushes)
+    int culled;                 // Primitives skipped by rlCheckCullRect() as outside viewport/scissor
+} rlRenderStats;
+
+// rlGpuTimings type, GPU side of a frame timed by rlBeginGpuFrame()/rlEndGpuFrame()
+typedef struct rlGpuTimings {
+    double frame;               // GPU time from the first to the last command of the frame, in seconds
+    double batches;             // GPU time spent in timed render batch draws, in seconds
+    int batchCount;             // Render batch draws timed, up to RL_GPU_TIMER_BATCHES
+    int latency;                // Frames the results arrived after, the frame timed is this many frames old
+} rlGpuTimings;
+
+// rlRectInstance type, one per rectangle drawn by rlDrawRectanglesInstanced()
+typedef struct rlRectInstance {
+    float x, y;                 // Rectangle top-left corner
+    float width, height;        // Rectangle size
+    unsigned char r, g, b, a;   // Rectangle color
+} rlRectInstance;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -453,7 +511,8 @@ typedef enum {
     RL_BLEND_SUBTRACT_COLORS,           // Blend textures subtracting colors (alternative)
     RL_BLEND_ALPHA_PREMULTIPLY,         // Blend premultiplied textures considering alpha
     RL_BLEND_CUSTOM,                    // Blend textures using custom src/dst factors (use rlSetBlendFactors())
-    RL_BLEND_CUSTOM_SEPARATE            // Blend textures using custom src/dst factors (use rlSetBlendFactorsSeparate())
+    RL_BLEND_CUSTOM_SEPARATE,           // Blend textures using custom src/dst factors (use rlSetBlendFactorsSeparate())
+    RL_BLEND_OPAQUE                     // Blending disabled, source overwrites destination (draw opaque layers first)
 } rlBlendMode;
 
 // Shader location point type
@@ -666,11 +725,24 @@ RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader lo
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
 // but this render batch API is exposed in case of custom batches are required
 RLAPI rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements);  // Load a render batch system
+RLAPI rlRenderBatch rlLoadRenderBatchCompact(int numBuffers, int bufferElements); // Load a render batch system with compact 2D vertices (see rlCompactVertex)
 RLAPI void rlUnloadRenderBatch(rlRenderBatch batch);                        // Unload render batch system
 RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);                         // Draw render batch data (Update->Draw->Reset)
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch);                    // Set the active render batch for rlgl (NULL for default internal)
 RLAPI void rlDrawRenderBatchActive(void);                                   // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);                             // Check internal buffer overflow for a given number of vertex
+RLAPI void rlSetRenderBatchGrowth(rlRenderBatch *batch, int maxElements);   // Set elements a render batch may grow to between frames (0 for fixed size)
+RLAPI void rlUpdateRenderBatchSize(void);                                   // Grow the active render batch if it overflowed since last call, between frames
+RLAPI void rlEnableDrawSorting(void);                                       // Enable sorting batch draw calls by layer and texture on draw
+RLAPI void rlDisableDrawSorting(void);                                      // Disable sorting batch draw calls, submission order (default)
+RLAPI void rlSetDrawLayer(int layer);                                       // Set draw layer for following draws, lower layers are drawn first when sorting
+RLAPI bool rlCheckCullRect(float x, float y, float width, float height);    // Check if a rectangle (current transform applied) is outside viewport/scissor, counted as culled
+RLAPI rlRenderStats rlGetRenderStats(void);                                 // Get render statistics accumulated since last reset
+RLAPI void rlResetRenderStats(void);                                        // Reset render statistics
+RLAPI void rlBeginGpuFrame(void);                                           // Begin timing a frame on the GPU, render batch draws until rlEndGpuFrame() are timed too
+RLAPI void rlEndGpuFrame(void);                                             // End timing a frame on the GPU, collects frames the GPU has finished without waiting
+RLAPI rlGpuTimings rlGetGpuTimings(void);                                   // Get GPU timings of the latest frame collected (0 without timer queries)
+RLAPI bool rlDrawRectanglesInstanced(const rlRectInstance *rects, int count); // Draw flat colored rectangles in one instanced draw call (false if not supported)
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
@@ -698,12 +770,23 @@ RLAPI unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffe
 RLAPI unsigned int rlLoadTextureCubemap(const void *data, int size, int format);                        // Load texture cubemap
 RLAPI void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data);  // Update GPU texture with new data
 RLAPI void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType);  // Get OpenGL internal formats
+RLAPI bool rlIsTextureFormatSupported(int format);                        // Check if a pixel format can be loaded in GPU (compressed formats depend on extensions)
 RLAPI const char *rlGetPixelFormatName(unsigned int format);              // Get name string for pixel format
 RLAPI void rlUnloadTexture(unsigned int id);                              // Unload texture from GPU memory
 RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format);              // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
 
+// Asynchronous readback, pixel pack buffers and fences (OpenGL 3.3 only, ids and fences are 0/NULL otherwise)
+RLAPI unsigned int rlLoadPixelBuffer(int size);                           // Load pixel pack buffer for asynchronous readback
+RLAPI void rlUnloadPixelBuffer(unsigned int id);                          // Unload pixel pack buffer
+RLAPI void *rlReadScreenPixelsAsync(unsigned int id, int width, int height); // Start screen pixels readback into pixel buffer, returns a fence, data is flipped vertically
+RLAPI void *rlMapPixelBuffer(unsigned int id, int size);                  // Map pixel buffer for reading, after its fence is signaled
+RLAPI void rlUnmapPixelBuffer(unsigned int id);                           // Unmap pixel buffer
+RLAPI void *rlLoadFence(void);                                            // Load fence after the commands submitted so far
+RLAPI bool rlIsFenceSignaled(void *fence, double timeout);                // Check if GPU passed fence, waiting up to timeout seconds (0 to poll)
+RLAPI void rlUnloadFence(void *fence);                                    // Unload fence
+
 // Framebuffer management (fbo)
 RLAPI unsigned int rlLoadFramebuffer(int width, int height);              // Load an empty framebuffer
 RLAPI void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel);  // Attach texture/renderbuffer to a framebuffer
@@ -721,6 +804,7 @@ RLAPI void rlSetUniform(int locIndex, const void *value, int uniformType, int co
 RLAPI void rlSetUniformMatrix(int locIndex, Matrix mat);                        // Set shader value matrix
 RLAPI void rlSetUniformSampler(int locIndex, unsigned int textureId);           // Set shader value sampler
 RLAPI void rlSetShader(unsigned int id, int *locs);                             // Set shader currently active (id and locations)
+RLAPI void rlSetShaderCacheDirectory(const char *path);                         // Set shader program binary cache directory, NULL to disable (call before rlglInit())
 
 // Compute shader management
 RLAPI unsigned int rlLoadComputeShaderProgram(unsigned int shaderId);           // Load compute shader program
@@ -822,6 +906,8 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #include <stdlib.h>                     // Required for: malloc(), free()
 #include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
+#include <stddef.h>                     // Required for: offsetof() [Used in compact render batch attributes]
+#include <stdio.h>                      // Required for: fopen(), fread(), fwrite(), snprintf() [Used in shader binary cache]
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -881,6 +967,24 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define GL_TEXTURE_MAX_ANISOTROPY_EXT       0x84FE
 #endif
 
+#ifndef GL_QUERY_RESULT
+    #define GL_QUERY_RESULT                     0x8866
+#endif
+#ifndef GL_QUERY_RESULT_AVAILABLE
+    #define GL_QUERY_RESULT_AVAILABLE           0x8867
+#endif
+#ifndef GL_TIMESTAMP
+    #define GL_TIMESTAMP                        0x8E28
+#endif
+#ifndef GL_GPU_DISJOINT_EXT
+    #define GL_GPU_DISJOINT_EXT                 0x8FBB
+#endif
+
+// Timestamp queries: OpenGL 3.3 core, GL_ARB_timer_query on OpenGL 2.1, GL_EXT_disjoint_timer_query on OpenGL ES 2.0
+#if defined(GRAPHICS_API_OPENGL_33) || (defined(GRAPHICS_API_OPENGL_ES2) && defined(GL_EXT_disjoint_timer_query))
+    #define RLGL_GPU_TIMER
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_11)
     #define GL_UNSIGNED_SHORT_5_6_5             0x8363
     #define GL_UNSIGNED_SHORT_5_5_5_1           0x8034
@@ -892,6 +996,13 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define GL_LUMINANCE_ALPHA                  0x190A
 #endif
 
+#ifndef GL_PROGRAM_BINARY_LENGTH
+    #define GL_PROGRAM_BINARY_LENGTH            0x8741
+#endif
+#ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+    #define GL_NUM_PROGRAM_BINARY_FORMATS       0x87FE
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_ES2)
     #define glClearDepth                 glClearDepthf
     #define GL_READ_FRAMEBUFFER         GL_FRAMEBUFFER
@@ -974,7 +1085,11 @@ typedef struct rlglData {
         unsigned int defaultVShaderId;      // Default vertex shader id (used by default shader program)
         unsigned int defaultFShaderId;      // Default fragment shader id (used by default shader program)
         unsigned int defaultShaderId;       // Default shader program id, supports vertex color and diffuse texture
+        const char *defaultVShaderCode;     // Default vertex shader code (compiled on demand when the program comes from the binary cache)
+        const char *defaultFShaderCode;     // Default fragment shader code (compiled on demand when the program comes from the binary cache)
         int *defaultShaderLocs;             // Default shader locations pointer to be used on rendering
+        unsigned int flatShaderId;          // Untextured shader program id, vertex color only (used for default texture draws)
+        int flatShaderLocs[2];              // Untextured shader locations: mvp, colDiffuse
         unsigned int currentShaderId;       // Current shader id to be used on rendering (by default, defaultShaderId)
         int *currentShaderLocs;             // Current shader locations pointer to be used on rendering (by default, defaultShaderLocs)
 
@@ -998,10 +1113,36 @@ typedef struct rlglData {
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
 
+        rlRenderStats stats;                // Render statistics since last reset
+
+        unsigned int rectShaderId;          // Instanced rectangles shader id (loaded on first use)
+        int rectShaderLocs[4];              // Instanced rectangles shader locations: corner, rect, color, mvp
+        unsigned int rectVaoId;             // Instanced rectangles VAO id
+        unsigned int rectVboId[2];          // Instanced rectangles VBO ids: unit quad, instances
+
+        bool drawSorting;                   // Sort batch draw calls by layer and texture when drawn
+        int drawLayer;                      // Layer of following draw calls
+        void *sortIndices;                  // Index data of sorted draws (unsigned int, unsigned short on ES2)
+        int sortIndexCapacity;              // Indices sortIndices can hold
+
+        int viewport[4];                    // Current viewport: x, y, width, height (framebuffer pixels, bottom-left origin)
+        int scissor[4];                     // Current scissor rectangle: x, y, width, height
+        bool scissorTest;                   // Scissor test enabled
+
+        char shaderCacheDir[512];           // Shader program binary cache directory, empty to disable the cache
+
+        unsigned int gpuQueries[RL_GPU_TIMER_FRAMES][2*RL_GPU_TIMER_BATCHES + 2];    // Timestamp query ids per frame in flight (generated on first use)
+        int gpuQueryCount[RL_GPU_TIMER_FRAMES]; // Timestamps issued per frame: frame start, batch draw start/end pairs, frame end
+        unsigned int gpuFrameHead;          // Frames issued for timing
+        unsigned int gpuFrameTail;          // Frames collected, the ones up to gpuFrameHead are in flight
+        bool gpuFrameOpen;                  // Between rlBeginGpuFrame() and rlEndGpuFrame() on a frame being timed
+        rlGpuTimings gpuTimings;            // Latest frame collected
+
     } State;            // Renderer state
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
         bool instancing;                    // Instancing supported (GL_ANGLE_instanced_arrays, GL_EXT_draw_instanced + GL_EXT_instanced_arrays)
+        bool bufferStorage;                 // Persistent mapped buffers supported (GL_ARB_buffer_storage)
         bool texNPOT;                       // NPOT textures full support (GL_ARB_texture_non_power_of_two, GL_OES_texture_npot)
         bool texDepth;                      // Depth textures supported (GL_ARB_depth_texture, GL_OES_depth_texture)
         bool texDepthWebGL;                 // Depth textures supported WebGL specific (GL_WEBGL_depth_texture)
@@ -1015,6 +1156,8 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool programBinary;                 // Shader program binaries supported (GL_ARB_get_program_binary, GL_OES_get_program_binary)
+        bool timerQuery;                    // Timestamp queries supported (GL_ARB_timer_query, GL_EXT_disjoint_timer_query)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
@@ -1043,6 +1186,19 @@ static PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArrays = NULL;
 static PFNGLDRAWARRAYSINSTANCEDEXTPROC glDrawArraysInstanced = NULL;
 static PFNGLDRAWELEMENTSINSTANCEDEXTPROC glDrawElementsInstanced = NULL;
 static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
+
+// NOTE: Program binaries functionality is exposed through extension (OES)
+static PFNGLGETPROGRAMBINARYOESPROC glGetProgramBinary = NULL;
+static PFNGLPROGRAMBINARYOESPROC glProgramBinary = NULL;
+
+#if defined(RLGL_GPU_TIMER)
+// NOTE: Timer queries functionality is exposed through extension (EXT)
+static PFNGLGENQUERIESEXTPROC glGenQueries = NULL;
+static PFNGLDELETEQUERIESEXTPROC glDeleteQueries = NULL;
+static PFNGLQUERYCOUNTEREXTPROC glQueryCounter = NULL;
+static PFNGLGETQUERYOBJECTIVEXTPROC glGetQueryObjectiv = NULL;
+static PFNGLGETQUERYOBJECTUI64VEXTPROC glGetQueryObjectui64v = NULL;
+#endif
 #endif
 
 //----------------------------------------------------------------------------------
@@ -1051,12 +1207,28 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void rlLoadShaderFlat(void);         // Load untextured color-only shader
+static void rlUnloadShaderFlat(void);       // Unload untextured color-only shader
+static void rlCompileShaderDefault(void);   // Compile default vertex/fragment shaders if not compiled yet
+static unsigned int rlLoadShaderSource(const char *vsCode, const char *fsCode);     // Load shader program from binary cache or compile it from code
+static unsigned int rlLoadShaderBinary(const char *vsCode, const char *fsCode);     // Load shader program from binary cache, 0 on miss or mismatch
+static void rlSaveShaderBinary(unsigned int id, const char *vsCode, const char *fsCode); // Save linked shader program to binary cache
+static bool rlLoadRectInstancing(void);     // Load instanced rectangles shader and buffers
+static bool rlGpuTimestamp(int reserve);    // Issue a timestamp query for the frame being timed, keeping reserve queries for later ones
+static void rlUnloadRectInstancing(void);   // Unload instanced rectangles shader and buffers
+static void rlLoadBatchBufferStorage(const void *data, int size, bool persistent); // Load data into the bound batch VBO
+static bool rlMapBatchVertexBuffer(rlVertexBuffer *buffer);  // Map batch vertex buffer VBOs persistently
+static void rlSetCompactVertexAttribs(void);                 // Set compact vertex attributes for the bound batch VBO
+static int rlCompareDrawCalls(const rlDrawCall *a, const rlDrawCall *b); // Compare draw calls sort keys: layer, texture, mode
+static short rlPackCompactPosition(float value);             // Convert position to 13.3 fixed point, clamped
+static unsigned short rlPackCompactTexcoord(float value);    // Convert texcoord to normalized 16 bit, clamped
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
+static rlRenderBatch rlLoadRenderBatchFormat(int numBuffers, int bufferElements, bool compact); // Load a render batch system, default or compact vertex format
 
 // Auxiliar matrix math functions
 static Matrix rlMatrixIdentity(void);                       // Get identity matrix
@@ -1300,6 +1472,12 @@ void rlOrtho(double left, double right, double bottom, double top, double znear,
 // NOTE: We store current viewport dimensions
 void rlViewport(int x, int y, int width, int height)
 {
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.viewport[0] = x;
+    RLGL.State.viewport[1] = y;
+    RLGL.State.viewport[2] = width;
+    RLGL.State.viewport[3] = height;
+#endif
     glViewport(x, y, width, height);
 }
 
@@ -1361,6 +1539,7 @@ void rlBegin(int mode)
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.drawLayer;
     }
 }
 
@@ -1414,6 +1593,25 @@ void rlVertex3f(float x, float y, float z)
         }
     }
 
+    // Compact batches take the whole vertex in one interleaved write, depth is dropped
+    if (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].compact != NULL)
+    {
+        rlCompactVertex *vertex = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].compact[RLGL.State.vertexCounter];
+
+        vertex->x = rlPackCompactPosition(tx);
+        vertex->y = rlPackCompactPosition(ty);
+        vertex->u = rlPackCompactTexcoord(RLGL.State.texcoordx);
+        vertex->v = rlPackCompactTexcoord(RLGL.State.texcoordy);
+        vertex->r = RLGL.State.colorr;
+        vertex->g = RLGL.State.colorg;
+        vertex->b = RLGL.State.colorb;
+        vertex->a = RLGL.State.colora;
+
+        RLGL.State.vertexCounter++;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
+        return;
+    }
+
     // Add vertices
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
@@ -1537,11 +1735,67 @@ void rlSetTexture(unsigned int id)
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.drawLayer;
         }
 #endif
     }
 }
 
+// Enable sorting batch draw calls by layer and texture on draw
+// NOTE: Within a layer draw order is not kept, only draws that don't overlap (or whose order
+// doesn't matter) should share one. Draws with equal keys stay in submission order
+void rlEnableDrawSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.drawSorting = true;
+#endif
+}
+
+// Disable sorting batch draw calls, they are drawn in submission order
+void rlDisableDrawSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.drawSorting = false;
+#endif
+}
+
+// Set draw layer for following draws
+// NOTE: Layers only take effect with draw sorting enabled, a layer change starts a new draw call
+void rlSetDrawLayer(int layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.drawLayer == layer) return;
+    RLGL.State.drawLayer = layer;
+
+    rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+    if (draw->vertexCount > 0)
+    {
+        int mode = draw->mode;
+        unsigned int textureId = draw->textureId;
+
+        // Same vertex alignment as on a texture change, see rlSetTexture()
+        if (draw->mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+        else if (draw->mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+        else draw->vertexAlignment = 0;
+
+        if (!rlCheckRenderBatchLimit(draw->vertexAlignment))
+        {
+            RLGL.State.vertexCounter += draw->vertexAlignment;
+            RLGL.currentBatch->drawCounter++;
+        }
+
+        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+
+        rlDrawCall *next = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+        next->mode = mode;
+        next->textureId = textureId;
+        next->vertexCount = 0;
+    }
+
+    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = layer;
+#endif
+}
+
 // Select and active a texture slot
 void rlActiveTextureSlot(int slot)
 {
@@ -1796,13 +2050,34 @@ void rlSetCullFace(int mode)
 }
 
 // Enable scissor test
-void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); }
+void rlEnableScissorTest(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.scissorTest = true;
+#endif
+    glEnable(GL_SCISSOR_TEST);
+}
 
 // Disable scissor test
-void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); }
+void rlDisableScissorTest(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.scissorTest = false;
+#endif
+    glDisable(GL_SCISSOR_TEST);
+}
 
 // Scissor test
-void rlScissor(int x, int y, int width, int height) { glScissor(x, y, width, height); }
+void rlScissor(int x, int y, int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.scissor[0] = x;
+    RLGL.State.scissor[1] = y;
+    RLGL.State.scissor[2] = width;
+    RLGL.State.scissor[3] = height;
+#endif
+    glScissor(x, y, width, height);
+}
 
 // Enable wire mode
 void rlEnableWireMode(void)
@@ -1926,6 +2201,10 @@ void rlSetBlendMode(int mode)
     {
         rlDrawRenderBatch(RLGL.currentBatch);
 
+        // NOTE: Opaque draws skip the destination read, which tile-based GPUs can also use to drop hidden fragments
+        if (mode == RL_BLEND_OPAQUE) glDisable(GL_BLEND);
+        else if (RLGL.State.currentBlendMode == RL_BLEND_OPAQUE) glEnable(GL_BLEND);
+
         switch (mode)
         {
             case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
@@ -2089,11 +2368,13 @@ void rlglInit(int width, int height)
     // Init default Shader (customized for GL 3.3 and ES2)
     // Loaded: RLGL.State.defaultShaderId + RLGL.State.defaultShaderLocs
     rlLoadShaderDefault();
+    rlLoadShaderFlat();
     RLGL.State.currentShaderId = RLGL.State.defaultShaderId;
     RLGL.State.currentShaderLocs = RLGL.State.defaultShaderLocs;
 
     // Init default vertex arrays buffers
     RLGL.defaultBatch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
+    rlSetRenderBatchGrowth(&RLGL.defaultBatch, RL_DEFAULT_BATCH_MAX_BUFFER_ELEMENTS);
     RLGL.currentBatch = &RLGL.defaultBatch;
 
     // Init stack matrices (emulating OpenGL 1.1)
@@ -2138,6 +2419,10 @@ void rlglInit(int width, int height)
     RLGL.State.framebufferWidth = width;
     RLGL.State.framebufferHeight = height;
 
+    // Init viewport to full framebuffer, until rlViewport() is called
+    RLGL.State.viewport[2] = width;
+    RLGL.State.viewport[3] = height;
+
     TRACELOG(RL_LOG_INFO, "RLGL: Default OpenGL state initialized successfully");
     //----------------------------------------------------------
 #endif
@@ -2155,6 +2440,18 @@ void rlglClose(void)
     rlUnloadRenderBatch(RLGL.defaultBatch);
 
     rlUnloadShaderDefault();          // Unload default shader
+    rlUnloadShaderFlat();             // Unload untextured shader
+    rlUnloadRectInstancing();         // Unload instanced rectangles resources, if loaded
+
+    RL_FREE(RLGL.State.sortIndices);
+    RLGL.State.sortIndices = NULL;
+    RLGL.State.sortIndexCapacity = 0;
+
+#if defined(RLGL_GPU_TIMER)
+    if (RLGL.State.gpuQueries[0][0] != 0) glDeleteQueries(RL_GPU_TIMER_FRAMES*(2*RL_GPU_TIMER_BATCHES + 2), &RLGL.State.gpuQueries[0][0]);
+    RLGL.State.gpuQueries[0][0] = 0;
+    RLGL.State.gpuFrameHead = RLGL.State.gpuFrameTail = 0;
+#endif
 
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
@@ -2193,6 +2490,7 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.maxDepthBits = 32;
     RLGL.ExtSupported.texAnisoFilter = GLAD_GL_EXT_texture_filter_anisotropic;
     RLGL.ExtSupported.texMirrorClamp = GLAD_GL_EXT_texture_mirror_clamp;
+    RLGL.ExtSupported.timerQuery = GLAD_GL_ARB_timer_query;
 #else
     // Register supported extensions flags
     // OpenGL 3.3 extensions supported by default (core)
@@ -2204,12 +2502,15 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.maxDepthBits = 32;
     RLGL.ExtSupported.texAnisoFilter = true;
     RLGL.ExtSupported.texMirrorClamp = true;
+    RLGL.ExtSupported.timerQuery = true;
 #endif
 
     // Optional OpenGL 3.3 extensions
+    RLGL.ExtSupported.bufferStorage = GLAD_GL_ARB_buffer_storage;         // Persistent mapped buffers
     RLGL.ExtSupported.texCompASTC = GLAD_GL_KHR_texture_compression_astc_hdr && GLAD_GL_KHR_texture_compression_astc_ldr;
     RLGL.ExtSupported.texCompDXT = GLAD_GL_EXT_texture_compression_s3tc;  // Texture compression: DXT
     RLGL.ExtSupported.texCompETC2 = GLAD_GL_ARB_ES3_compatibility;        // Texture compression: ETC2/EAC
+    RLGL.ExtSupported.programBinary = GLAD_GL_ARB_get_program_binary;     // Shader program binaries
     #if defined(GRAPHICS_API_OPENGL_43)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
@@ -2314,6 +2615,31 @@ void rlLoadExtensions(void *loader)
             }
         }
 
+        // Check program binaries support
+        if (strcmp(extList[i], (const char *)"GL_OES_get_program_binary") == 0)
+        {
+            glGetProgramBinary = (PFNGLGETPROGRAMBINARYOESPROC)((rlglLoadProc)loader)("glGetProgramBinaryOES");
+            glProgramBinary = (PFNGLPROGRAMBINARYOESPROC)((rlglLoadProc)loader)("glProgramBinaryOES");
+
+            if ((glGetProgramBinary != NULL) && (glProgramBinary != NULL)) RLGL.ExtSupported.programBinary = true;
+        }
+
+    #if defined(RLGL_GPU_TIMER)
+        // Check timer queries support
+        // NOTE: Usually not exposed by browsers, timer precision is reduced against timing attacks
+        if (strcmp(extList[i], (const char *)"GL_EXT_disjoint_timer_query") == 0)
+        {
+            glGenQueries = (PFNGLGENQUERIESEXTPROC)((rlglLoadProc)loader)("glGenQueriesEXT");
+            glDeleteQueries = (PFNGLDELETEQUERIESEXTPROC)((rlglLoadProc)loader)("glDeleteQueriesEXT");
+            glQueryCounter = (PFNGLQUERYCOUNTEREXTPROC)((rlglLoadProc)loader)("glQueryCounterEXT");
+            glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVEXTPROC)((rlglLoadProc)loader)("glGetQueryObjectivEXT");
+            glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VEXTPROC)((rlglLoadProc)loader)("glGetQueryObjectui64vEXT");
+
+            if ((glGenQueries != NULL) && (glDeleteQueries != NULL) && (glQueryCounter != NULL) &&
+                (glGetQueryObjectiv != NULL) && (glGetQueryObjectui64v != NULL)) RLGL.ExtSupported.timerQuery = true;
+        }
+    #endif
+
         // Check NPOT textures support
         // NOTE: Only check on OpenGL ES, OpenGL 3.3 has NPOT textures full support as core feature
         if (strcmp(extList[i], (const char *)"GL_OES_texture_npot") == 0) RLGL.ExtSupported.texNPOT = true;
@@ -2375,6 +2701,14 @@ void rlLoadExtensions(void *loader)
     #endif
     glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &RLGL.ExtSupported.maxAnisotropyLevel);
 
+    // NOTE: Drivers may expose the extension with no binary format at all, then binaries can not be retrieved
+    if (RLGL.ExtSupported.programBinary)
+    {
+        GLint binaryFormats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormats);
+        if (binaryFormats <= 0) RLGL.ExtSupported.programBinary = false;
+    }
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
     // Show some OpenGL GPU capabilities
     TRACELOG(RL_LOG_INFO, "GL: OpenGL capabilities:");
@@ -2421,6 +2755,7 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(RL_LOG_INFO, "GL: Shader storage buffer objects supported");
+    if (RLGL.ExtSupported.programBinary) TRACELOG(RL_LOG_INFO, "GL: Shader program binaries supported");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -2520,6 +2855,20 @@ int *rlGetShaderLocsDefault(void)
 //------------------------------------------------------------------------------------------------
 // Load render batch
 rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
+{
+    return rlLoadRenderBatchFormat(numBuffers, bufferElements, false);
+}
+
+// Load render batch with compact 2D vertices
+// NOTE: One interleaved 12 byte vertex instead of three 24 byte arrays halves the upload,
+// only valid for 2D drawing without depth and with texcoords in [0..1]
+rlRenderBatch rlLoadRenderBatchCompact(int numBuffers, int bufferElements)
+{
+    return rlLoadRenderBatchFormat(numBuffers, bufferElements, true);
+}
+
+// Load render batch, default or compact vertex format
+static rlRenderBatch rlLoadRenderBatchFormat(int numBuffers, int bufferElements, bool compact)
 {
     rlRenderBatch batch = { 0 };
 
@@ -2531,10 +2880,25 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     for (int i = 0; i < numBuffers; i++)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
+        batch.vertexBuffer[i].vertices = NULL;
+        batch.vertexBuffer[i].texcoords = NULL;
+        batch.vertexBuffer[i].colors = NULL;
+        batch.vertexBuffer[i].compact = NULL;
+
+        if (compact)
+        {
+            batch.vertexBuffer[i].compact = (rlCompactVertex *)RL_CALLOC(bufferElements*4, sizeof(rlCompactVertex));   // 4 vertex by quad
+        }
+        else
+        {
+            batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
+            batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
+            batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
 
-        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+            for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
+            for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
+            for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
+        }
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2542,10 +2906,6 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
-
         int k = 0;
 
         // Indices can be initialized right now
@@ -2568,9 +2928,17 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     //--------------------------------------------------------------------------------------------
 
     // Upload to GPU (VRAM) vertex data and initialize VAOs/VBOs
+    // NOTE: Persistent mapping is only worth it with several buffers to round-robin,
+    // with a single one every flush would have to wait for the GPU to finish the previous one
     //--------------------------------------------------------------------------------------------
+    bool persistent = (numBuffers > 1) && RLGL.ExtSupported.bufferStorage;
+
     for (int i = 0; i < numBuffers; i++)
     {
+        batch.vertexBuffer[i].mapped = false;
+        batch.vertexBuffer[i].fence = NULL;
+        batch.vertexBuffer[i].sortVboId = 0;
+
         if (RLGL.ExtSupported.vao)
         {
             // Initialize Quads VAO
@@ -2578,27 +2946,39 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
             glBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
-        // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex texcoord buffer (shader-location = 1)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        if (compact)
+        {
+            // Quads - Interleaved vertex buffer (shader-locations = 0, 1, 3)
+            // NOTE: vboId[1] and vboId[2] are left unused (0)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            rlLoadBatchBufferStorage(batch.vertexBuffer[i].compact, bufferElements*4*sizeof(rlCompactVertex), persistent);
+            rlSetCompactVertexAttribs();
+        }
+        else
+        {
+            // Quads - Vertex buffers binding and attributes enable
+            // Vertex position buffer (shader-location = 0)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            rlLoadBatchBufferStorage(batch.vertexBuffer[i].vertices, bufferElements*3*4*sizeof(float), persistent);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+
+            // Vertex texcoord buffer (shader-location = 1)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
+            rlLoadBatchBufferStorage(batch.vertexBuffer[i].texcoords, bufferElements*2*4*sizeof(float), persistent);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+
+            // Vertex color buffer (shader-location = 3)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
+            rlLoadBatchBufferStorage(batch.vertexBuffer[i].colors, bufferElements*4*4*sizeof(unsigned char), persistent);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        }
 
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
@@ -2609,9 +2989,13 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 #if defined(GRAPHICS_API_OPENGL_ES2)
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(short), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
 #endif
+
+        if (persistent) batch.vertexBuffer[i].mapped = rlMapBatchVertexBuffer(&batch.vertexBuffer[i]);
     }
 
-    TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
+    if (persistent && batch.vertexBuffer[0].mapped) TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers persistently mapped in VRAM (GPU) [%i buffers]", numBuffers);
+    else TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
+    if (compact) TRACELOG(RL_LOG_INFO, "RLGL: Render batch uses compact 2D vertices [%i bytes]", (int)sizeof(rlCompactVertex));
 
     // Unbind the current VAO
     if (RLGL.ExtSupported.vao) glBindVertexArray(0);
@@ -2629,6 +3013,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         //batch.draws[i].vaoId = 0;
         //batch.draws[i].shaderId = 0;
         batch.draws[i].textureId = RLGL.State.defaultTextureId;
+        batch.draws[i].layer = RLGL.State.drawLayer;
         //batch.draws[i].RLGL.State.projection = rlMatrixIdentity();
         //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
     }
@@ -2664,19 +3049,29 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
             glBindVertexArray(0);
         }
 
+#if defined(GRAPHICS_API_OPENGL_33)
+        if (batch.vertexBuffer[i].fence != NULL) glDeleteSync((GLsync)batch.vertexBuffer[i].fence);
+#endif
+
         // Delete VBOs from GPU (VRAM)
+        // NOTE: Deleting a mapped buffer also unmaps it
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+        if (batch.vertexBuffer[i].sortVboId != 0) glDeleteBuffers(1, &batch.vertexBuffer[i].sortVboId);
 
         // Delete VAOs from GPU (VRAM)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
 
         // Free vertex arrays memory from CPU (RAM)
-        RL_FREE(batch.vertexBuffer[i].vertices);
-        RL_FREE(batch.vertexBuffer[i].texcoords);
-        RL_FREE(batch.vertexBuffer[i].colors);
+        if (!batch.vertexBuffer[i].mapped)
+        {
+            RL_FREE(batch.vertexBuffer[i].vertices);
+            RL_FREE(batch.vertexBuffer[i].texcoords);
+            RL_FREE(batch.vertexBuffer[i].colors);
+            RL_FREE(batch.vertexBuffer[i].compact);
+        }
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
@@ -2697,23 +3092,43 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
     if (RLGL.State.vertexCounter > 0)
     {
-        // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+        RLGL.State.stats.vertices += RLGL.State.vertexCounter;
+        RLGL.State.stats.batchFlushes++;
+        batch->frameVertices += RLGL.State.vertexCounter;
+    }
 
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
+    // Draws in a frame being timed get a timestamp pair, its end query is reserved along with the frame end
+    bool gpuTimed = (RLGL.State.vertexCounter > 0) && rlGpuTimestamp(2);
 
-        // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
+    // NOTE: Persistently mapped buffers already hold the vertex data, it was written directly into GPU-visible memory
+    if ((RLGL.State.vertexCounter > 0) && !batch->vertexBuffer[batch->currentBuffer].mapped)
+    {
+        // Activate elements VAO
+        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
 
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+        if (batch->vertexBuffer[batch->currentBuffer].compact != NULL)
+        {
+            // Interleaved vertex buffer, one upload for all the vertex data
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*sizeof(rlCompactVertex), batch->vertexBuffer[batch->currentBuffer].compact);
+        }
+        else
+        {
+            // Vertex positions buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
+
+            // Texture coordinates buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
+
+            // Colors buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+        }
 
         // NOTE: glMapBuffer() causes sync issue.
         // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
@@ -2735,6 +3150,78 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     }
     //------------------------------------------------------------------------------------------------------------
 
+    // Order draw calls, sorted by layer, texture and mode if enabled
+    // NOTE: Sorted quads get an index list in draw order, so quads sharing a texture are drawn
+    // in one call even when their vertex data is not contiguous. Vertex data itself is not moved
+    //------------------------------------------------------------------------------------------------------------
+    int drawOffsets[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };    // First vertex of every draw call
+    int drawOrder[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };      // Draw calls in the order they are drawn
+    int drawIndices[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };    // First sorted index of every quads draw call
+    int sortIndexCount = 0;
+    bool sorted = RLGL.State.drawSorting && (batch->drawCounter > 1) && (RLGL.State.vertexCounter > 0);
+
+    for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+    {
+        drawOffsets[i] = vertexOffset;
+        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+
+        // Stable insertion sort, equal keys keep submission order
+        int j = i;
+        if (sorted)
+        {
+            while ((j > 0) && (rlCompareDrawCalls(&batch->draws[drawOrder[j - 1]], &batch->draws[i]) > 0))
+            {
+                drawOrder[j] = drawOrder[j - 1];
+                j--;
+            }
+        }
+        drawOrder[j] = i;
+    }
+
+    if (sorted)
+    {
+        int required = RLGL.State.vertexCounter/4*6;
+        if (required > RLGL.State.sortIndexCapacity)
+        {
+            // NOTE: Allocated for the largest index type, also valid on ES2
+            void *indices = RL_REALLOC(RLGL.State.sortIndices, required*sizeof(unsigned int));
+            if (indices != NULL)
+            {
+                RLGL.State.sortIndices = indices;
+                RLGL.State.sortIndexCapacity = required;
+            }
+            else sorted = false;
+        }
+    }
+
+    if (sorted)
+    {
+        for (int n = 0; n < batch->drawCounter; n++)
+        {
+            int i = drawOrder[n];
+            drawIndices[i] = sortIndexCount;
+            if (batch->draws[i].mode != RL_QUADS) continue;
+
+            for (int k = drawOffsets[i]; k < (drawOffsets[i] + batch->draws[i].vertexCount); k += 4)
+            {
+#if defined(GRAPHICS_API_OPENGL_33)
+                unsigned int *indices = (unsigned int *)RLGL.State.sortIndices + sortIndexCount;
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+                unsigned short *indices = (unsigned short *)RLGL.State.sortIndices + sortIndexCount;
+#endif
+                indices[0] = k;
+                indices[1] = k + 1;
+                indices[2] = k + 2;
+                indices[3] = k;
+                indices[4] = k + 2;
+                indices[5] = k + 3;
+                sortIndexCount += 6;
+            }
+        }
+    }
+    //------------------------------------------------------------------------------------------------------------
+
     // Draw batch vertex buffers (considering VR stereo if required)
     //------------------------------------------------------------------------------------------------------------
     Matrix matProjection = RLGL.State.projection;
@@ -2770,9 +3257,24 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 matMVP.m8, matMVP.m9, matMVP.m10, matMVP.m11,
                 matMVP.m12, matMVP.m13, matMVP.m14, matMVP.m15
             };
+
+            // Compact positions are in 1/8 pixel units, scaling the x and y columns converts them back
+            if (batch->vertexBuffer[batch->currentBuffer].compact != NULL)
+            {
+                for (int i = 0; i < 8; i++) matMVPfloat[i] *= 1.0f/8.0f;
+            }
+
             glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
 
             if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+            else if (batch->vertexBuffer[batch->currentBuffer].compact != NULL)
+            {
+                // Bind vertex attribs: position, texcoord and color from the interleaved buffer
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+                rlSetCompactVertexAttribs();
+
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+            }
             else
             {
                 // Bind vertex attrib: position (shader-location = 0)
@@ -2812,28 +3314,88 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
             glActiveTexture(GL_TEXTURE0);
 
-            for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+            // NOTE: Draws with the default (white) texture through the default shader only output the vertex color,
+            // they go through the untextured shader instead, skipping the texture fetch and the texcoords
+            bool flatAllowed = (RLGL.State.flatShaderId > 0) && (RLGL.State.currentShaderId == RLGL.State.defaultShaderId);
+            bool flatActive = false;
+            bool flatUniforms = false;
+
+            unsigned int boundTexture = 0;
+
+            // Sorted quads are drawn through the rebuilt index buffer
+            if (sorted)
+            {
+                if (batch->vertexBuffer[batch->currentBuffer].sortVboId == 0) glGenBuffers(1, &batch->vertexBuffer[batch->currentBuffer].sortVboId);
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].sortVboId);
+#if defined(GRAPHICS_API_OPENGL_33)
+                glBufferData(GL_ELEMENT_ARRAY_BUFFER, sortIndexCount*sizeof(GLuint), RLGL.State.sortIndices, GL_STREAM_DRAW);
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+                glBufferData(GL_ELEMENT_ARRAY_BUFFER, sortIndexCount*sizeof(GLushort), RLGL.State.sortIndices, GL_STREAM_DRAW);
+#endif
+            }
+
+            for (int n = 0; n < batch->drawCounter; n++)
             {
+                int i = drawOrder[n];
+                bool flat = flatAllowed && (batch->draws[i].textureId == RLGL.State.defaultTextureId);
+
+                if (flat != flatActive)
+                {
+                    glUseProgram(flat? RLGL.State.flatShaderId : RLGL.State.currentShaderId);
+
+                    if (flat && !flatUniforms)
+                    {
+                        glUniformMatrix4fv(RLGL.State.flatShaderLocs[0], 1, false, matMVPfloat);
+                        glUniform4f(RLGL.State.flatShaderLocs[1], 1.0f, 1.0f, 1.0f, 1.0f);
+                        flatUniforms = true;
+                    }
+
+                    flatActive = flat;
+                }
+
                 // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                if (!flat && (batch->draws[i].textureId != boundTexture))
+                {
+                    glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                    boundTexture = batch->draws[i].textureId;
+                }
 
-                if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
+                if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES))
+                {
+                    if (batch->draws[i].vertexCount > 0) RLGL.State.stats.drawCalls++;
+                    glDrawArrays(batch->draws[i].mode, drawOffsets[i], batch->draws[i].vertexCount);
+                }
                 else
                 {
+                    // Following quads with the same texture are merged, their indices are contiguous
+                    // NOTE: Unsorted quads are contiguous too (no alignment), they are only split by layer changes
+                    int indexStart = sorted? drawIndices[i] : drawOffsets[i]/4*6;
+                    int indexCount = batch->draws[i].vertexCount/4*6;
+
+                    while ((n + 1 < batch->drawCounter) && (batch->draws[drawOrder[n + 1]].mode == RL_QUADS) &&
+                           (batch->draws[drawOrder[n + 1]].textureId == batch->draws[i].textureId))
+                    {
+                        n++;
+                        indexCount += batch->draws[drawOrder[n]].vertexCount/4*6;
+                    }
+
+                    if (indexCount > 0) RLGL.State.stats.drawCalls++;
 #if defined(GRAPHICS_API_OPENGL_33)
                     // We need to define the number of indices to be processed: elementCount*6
                     // NOTE: The final parameter tells the GPU the offset in bytes from the
                     // start of the index buffer to the location of the first index to process
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
+                    glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, (GLvoid *)(indexStart*sizeof(GLuint)));
 #endif
 #if defined(GRAPHICS_API_OPENGL_ES2)
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
+                    glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_SHORT, (GLvoid *)(indexStart*sizeof(GLushort)));
 #endif
                 }
-
-                vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
             }
 
+            // Restore the batch static index buffer (element array binding is part of the VAO state)
+            if (sorted) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+
             if (!RLGL.ExtSupported.vao)
             {
                 glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -2852,6 +3414,17 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
     //------------------------------------------------------------------------------------------------------------
 
+    if (gpuTimed) rlGpuTimestamp(1);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Fence the mapped buffer, it can't be written again until the GPU is done reading it
+    if ((RLGL.State.vertexCounter > 0) && batch->vertexBuffer[batch->currentBuffer].mapped)
+    {
+        if (batch->vertexBuffer[batch->currentBuffer].fence != NULL) glDeleteSync((GLsync)batch->vertexBuffer[batch->currentBuffer].fence);
+        batch->vertexBuffer[batch->currentBuffer].fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
+
     // Reset batch buffers
     //------------------------------------------------------------------------------------------------------------
     // Reset vertex counter for next frame
@@ -2870,6 +3443,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].layer = RLGL.State.drawLayer;
     }
 
     // Reset active texture units for next batch
@@ -2882,69 +3456,352 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Wait for the GPU to release the next mapped buffer before vertices are written into it
+    // NOTE: With enough buffers in flight the fence is already signaled and this does not block
+    if (batch->vertexBuffer[batch->currentBuffer].fence != NULL)
+    {
+        GLsync fence = (GLsync)batch->vertexBuffer[batch->currentBuffer].fence;
+        GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+        while (result == GL_TIMEOUT_EXPIRED) result = glClientWaitSync(fence, 0, 1000000000);
+
+        glDeleteSync(fence);
+        batch->vertexBuffer[batch->currentBuffer].fence = NULL;
+    }
+#endif
 #endif
 }
 
-// Set the active render batch for rlgl
-void rlSetRenderBatchActive(rlRenderBatch *batch)
+// Get render statistics accumulated since last reset
+rlRenderStats rlGetRenderStats(void)
 {
+    rlRenderStats stats = { 0 };
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    rlDrawRenderBatch(RLGL.currentBatch);
-
-    if (batch != NULL) RLGL.currentBatch = batch;
-    else RLGL.currentBatch = &RLGL.defaultBatch;
+    stats = RLGL.State.stats;
 #endif
+    return stats;
 }
 
-// Update and draw internal render batch
-void rlDrawRenderBatchActive(void)
+// Reset render statistics
+void rlResetRenderStats(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
+    RLGL.State.stats = (rlRenderStats){ 0 };
 #endif
 }
 
-// Check internal buffer overflow for a given number of vertex
-// and force a rlRenderBatch draw call if required
-bool rlCheckRenderBatchLimit(int vCount)
+// Begin timing a frame on the GPU
+// NOTE: Timestamps rather than GL_TIME_ELAPSED queries, elapsed queries can't nest the batch draws inside the frame.
+// With RL_GPU_TIMER_FRAMES already in flight the GPU is that far behind, the frame is not timed instead of waiting
+void rlBeginGpuFrame(void)
 {
-    bool overflow = false;
+#if defined(RLGL_GPU_TIMER)
+    if (!RLGL.ExtSupported.timerQuery) return;
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((RLGL.State.vertexCounter + vCount) >=
-        (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4))
+    if (RLGL.State.gpuQueries[0][0] == 0) glGenQueries(RL_GPU_TIMER_FRAMES*(2*RL_GPU_TIMER_BATCHES + 2), &RLGL.State.gpuQueries[0][0]);
+
+    RLGL.State.gpuFrameOpen = false;
+    if ((RLGL.State.gpuFrameHead - RLGL.State.gpuFrameTail) >= RL_GPU_TIMER_FRAMES) return;
+
+    RLGL.State.gpuQueryCount[RLGL.State.gpuFrameHead%RL_GPU_TIMER_FRAMES] = 0;
+    RLGL.State.gpuFrameOpen = true;
+    rlGpuTimestamp(1);
+#endif
+}
+
+// End timing a frame on the GPU
+// NOTE: Frames are collected oldest first as soon as their last timestamp is available, usually a couple of frames later
+void rlEndGpuFrame(void)
+{
+#if defined(RLGL_GPU_TIMER)
+    if (!RLGL.ExtSupported.timerQuery) return;
+
+    if (RLGL.State.gpuFrameOpen)
     {
-        overflow = true;
+        rlGpuTimestamp(0);
+        RLGL.State.gpuFrameOpen = false;
+        RLGL.State.gpuFrameHead++;
+    }
 
-        // Store current primitive drawing mode and texture id
-        int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
-        int currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
+    while (RLGL.State.gpuFrameTail != RLGL.State.gpuFrameHead)
+    {
+        int frame = RLGL.State.gpuFrameTail%RL_GPU_TIMER_FRAMES;
+        unsigned int *queries = RLGL.State.gpuQueries[frame];
+        int count = RLGL.State.gpuQueryCount[frame];
 
-        rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
+        GLint available = 0;
+        glGetQueryObjectiv(queries[count - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) break;
 
-        // Restore state of last batch so we can continue adding vertices
-        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentMode;
-        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentTexture;
+        GLuint64 times[2*RL_GPU_TIMER_BATCHES + 2] = { 0 };
+        for (int i = 0; i < count; i++) glGetQueryObjectui64v(queries[i], GL_QUERY_RESULT, &times[i]);
+
+        RLGL.State.gpuFrameTail++;
+
+    #if defined(GRAPHICS_API_OPENGL_ES2)
+        // A disjoint operation (power state change, context switch) makes the timestamps in flight meaningless
+        GLint disjoint = 0;
+        glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+        if (disjoint) continue;
+    #endif
+
+        rlGpuTimings timings = { 0 };
+        timings.frame = (double)(times[count - 1] - times[0])*1e-9;
+        timings.batchCount = (count - 2)/2;
+        for (int i = 0; i < timings.batchCount; i++) timings.batches += (double)(times[2 + 2*i] - times[1 + 2*i])*1e-9;
+        timings.latency = (int)(RLGL.State.gpuFrameHead - RLGL.State.gpuFrameTail);
+
+        RLGL.State.gpuTimings = timings;
     }
 #endif
+}
 
-    return overflow;
+// Get GPU timings of the latest frame collected
+rlGpuTimings rlGetGpuTimings(void)
+{
+    rlGpuTimings timings = { 0 };
+#if defined(RLGL_GPU_TIMER)
+    timings = RLGL.State.gpuTimings;
+#endif
+    return timings;
 }
 
-// Textures data management
-//-----------------------------------------------------------------------------------------
-// Convert image data to OpenGL texture (returns OpenGL valid Id)
-unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount)
+// Check if a rectangle is outside the current viewport and scissor rectangle
+// NOTE: Rectangle corners go through the same transform, modelview and projection as rlVertex3f()
+// vertices would, returns true (and counts a culled primitive) when the draw can be skipped.
+// Perspective projections are never culled, a corner behind the eye keeps the draw
+bool rlCheckCullRect(float x, float y, float width, float height)
 {
-    unsigned int id = 0;
+    bool culled = false;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    Matrix mat = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+    if (RLGL.State.transformRequired) mat = rlMatrixMultiply(RLGL.State.transform, mat);
 
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+    if ((mat.m3 != 0.0f) || (mat.m7 != 0.0f) || (mat.m11 != 0.0f) || (mat.m15 != 1.0f)) return false;
 
-    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
-#if defined(GRAPHICS_API_OPENGL_11)
-    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    // Window area that gets rasterized, viewport clipped by scissor
+    float minX = (float)RLGL.State.viewport[0];
+    float minY = (float)RLGL.State.viewport[1];
+    float maxX = minX + (float)RLGL.State.viewport[2];
+    float maxY = minY + (float)RLGL.State.viewport[3];
+
+    if (RLGL.State.scissorTest)
     {
-        TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
+        if (minX < (float)RLGL.State.scissor[0]) minX = (float)RLGL.State.scissor[0];
+        if (minY < (float)RLGL.State.scissor[1]) minY = (float)RLGL.State.scissor[1];
+        if (maxX > (float)(RLGL.State.scissor[0] + RLGL.State.scissor[2])) maxX = (float)(RLGL.State.scissor[0] + RLGL.State.scissor[2]);
+        if (maxY > (float)(RLGL.State.scissor[1] + RLGL.State.scissor[3])) maxY = (float)(RLGL.State.scissor[1] + RLGL.State.scissor[3]);
+    }
+
+    // Rectangle bounds in window coordinates, projection is affine so w is 1 for every corner
+    float z = RLGL.currentBatch->currentDepth;
+    float cornerX[4] = { x, x + width, x + width, x };
+    float cornerY[4] = { y, y, y + height, y + height };
+    float rectMinX = 0.0f, rectMinY = 0.0f, rectMaxX = 0.0f, rectMaxY = 0.0f;
+
+    for (int i = 0; i < 4; i++)
+    {
+        float ndcX = mat.m0*cornerX[i] + mat.m4*cornerY[i] + mat.m8*z + mat.m12;
+        float ndcY = mat.m1*cornerX[i] + mat.m5*cornerY[i] + mat.m9*z + mat.m13;
+        float winX = (float)RLGL.State.viewport[0] + (ndcX + 1.0f)*0.5f*(float)RLGL.State.viewport[2];
+        float winY = (float)RLGL.State.viewport[1] + (ndcY + 1.0f)*0.5f*(float)RLGL.State.viewport[3];
+
+        if ((i == 0) || (winX < rectMinX)) rectMinX = winX;
+        if ((i == 0) || (winX > rectMaxX)) rectMaxX = winX;
+        if ((i == 0) || (winY < rectMinY)) rectMinY = winY;
+        if ((i == 0) || (winY > rectMaxY)) rectMaxY = winY;
+    }
+
+    culled = (rectMaxX < minX) || (rectMinX > maxX) || (rectMaxY < minY) || (rectMinY > maxY);
+    if (culled) RLGL.State.stats.culled++;
+#endif
+    return culled;
+}
+
+// Draw flat colored rectangles in one instanced draw call
+// NOTE: Only one compact record per rectangle is uploaded, instead of 4 full vertices through the batch.
+// The active batch is flushed first to keep draw order, returns false if instancing is not supported
+bool rlDrawRectanglesInstanced(const rlRectInstance *rects, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.ExtSupported.instancing || !RLGL.ExtSupported.vao) return false;
+    if ((RLGL.State.rectShaderId == 0) && !rlLoadRectInstancing()) return false;
+    if (count <= 0) return true;
+
+    rlDrawRenderBatch(RLGL.currentBatch);
+
+    glUseProgram(RLGL.State.rectShaderId);
+
+    // Vertices are not transformed on CPU here, so the accumulated transform goes into the MVP
+    Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+    if (RLGL.State.transformRequired) matMVP = rlMatrixMultiply(RLGL.State.transform, matMVP);
+    float matMVPfloat[16] = {
+        matMVP.m0, matMVP.m1, matMVP.m2, matMVP.m3,
+        matMVP.m4, matMVP.m5, matMVP.m6, matMVP.m7,
+        matMVP.m8, matMVP.m9, matMVP.m10, matMVP.m11,
+        matMVP.m12, matMVP.m13, matMVP.m14, matMVP.m15
+    };
+    glUniformMatrix4fv(RLGL.State.rectShaderLocs[3], 1, false, matMVPfloat);
+
+    glBindVertexArray(RLGL.State.rectVaoId);
+
+    // Orphan the instance buffer every call, so the driver does not stall on the previous draw
+    glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.rectVboId[1]);
+    glBufferData(GL_ARRAY_BUFFER, count*sizeof(rlRectInstance), rects, GL_STREAM_DRAW);
+
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 6, count);
+
+    RLGL.State.stats.drawCalls++;
+    RLGL.State.stats.vertices += 4*count;
+
+    glBindVertexArray(0);
+    glUseProgram(0);
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Set the active render batch for rlgl
+void rlSetRenderBatchActive(rlRenderBatch *batch)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDrawRenderBatch(RLGL.currentBatch);
+
+    if (batch != NULL) RLGL.currentBatch = batch;
+    else RLGL.currentBatch = &RLGL.defaultBatch;
+#endif
+}
+
+// Update and draw internal render batch
+void rlDrawRenderBatchActive(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
+#endif
+}
+
+// Check internal buffer overflow for a given number of vertex
+// and force a rlRenderBatch draw call if required
+bool rlCheckRenderBatchLimit(int vCount)
+{
+    bool overflow = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((RLGL.State.vertexCounter + vCount) >=
+        (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4))
+    {
+        overflow = true;
+        RLGL.State.stats.batchOverflows++;
+        RLGL.currentBatch->frameOverflows++;
+
+        // Store current primitive drawing mode and texture id
+        int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
+        int currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
+
+        rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
+
+        // Restore state of last batch so we can continue adding vertices
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentMode;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentTexture;
+    }
+#endif
+
+    return overflow;
+}
+
+// Set elements (quads) a render batch may grow to between frames
+// NOTE: Clamped to what the index type can address, 0 or the current size keeps the batch fixed
+void rlSetRenderBatchGrowth(rlRenderBatch *batch, int maxElements)
+{
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    if (maxElements > 65536/4) maxElements = 65536/4;   // 16 bit indices
+#endif
+    batch->maxElementCount = maxElements;
+}
+
+// Grow the active render batch if it overflowed since last call
+// NOTE: Meant to be called once per frame with the batch already drawn, the new size holds the
+// vertices of the whole frame so in steady state it is only flushed for state changes and at frame end
+void rlUpdateRenderBatchSize(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlRenderBatch *batch = RLGL.currentBatch;
+    int elementCount = batch->vertexBuffer[0].elementCount;
+
+    if ((batch->frameOverflows > 0) && (RLGL.State.vertexCounter == 0) && (batch->maxElementCount > elementCount))
+    {
+        // NOTE: One element spare, rlCheckRenderBatchLimit() flushes one vertex before the buffer is full
+        int required = batch->frameVertices/4 + 1;
+        int newCount = elementCount;
+        while (newCount < required) newCount *= 2;
+        if (newCount > batch->maxElementCount) newCount = batch->maxElementCount;
+
+        TRACELOG(RL_LOG_INFO, "RLGL: Render batch grown to %i elements [%i vertices in frame]", newCount, batch->frameVertices);
+
+        int maxElementCount = batch->maxElementCount;
+        bool compact = (batch->vertexBuffer[0].compact != NULL);
+
+        rlUnloadRenderBatch(*batch);
+        *batch = rlLoadRenderBatchFormat(batch->bufferCount, newCount, compact);
+        batch->maxElementCount = maxElementCount;
+    }
+
+    batch->frameVertices = 0;
+    batch->frameOverflows = 0;
+#endif
+}
+
+// Textures data management
+//-----------------------------------------------------------------------------------------
+// Check if a pixel format can be loaded in GPU
+// NOTE: Same checks rlLoadTexture() does, so callers can pick between differently compressed copies of a texture
+bool rlIsTextureFormatSupported(int format)
+{
+    bool supported = (format >= RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (format <= RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA);
+
+    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+#if defined(GRAPHICS_API_OPENGL_11)
+        supported = false;
+#else
+        switch (format)
+        {
+            case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB:
+            case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+            case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+            case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: supported = RLGL.ExtSupported.texCompDXT; break;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+            case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: supported = RLGL.ExtSupported.texCompETC1; break;
+            case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB:
+            case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: supported = RLGL.ExtSupported.texCompETC2; break;
+            case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB:
+            case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: supported = RLGL.ExtSupported.texCompPVRT; break;
+            case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA:
+            case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: supported = RLGL.ExtSupported.texCompASTC; break;
+#endif
+            default: break;
+        }
+#endif
+    }
+
+    return supported;
+}
+
+// Convert image data to OpenGL texture (returns OpenGL valid Id)
+unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount)
+{
+    unsigned int id = 0;
+
+    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+
+    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
         return id;
     }
 #else
@@ -3423,6 +4280,109 @@ unsigned char *rlReadScreenPixels(int width, int height)
     return imgData;     // NOTE: image data should be freed
 }
 
+// Load pixel pack buffer for asynchronous readback
+unsigned int rlLoadPixelBuffer(int size)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return id;
+}
+
+// Unload pixel pack buffer
+void rlUnloadPixelBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    glDeleteBuffers(1, &id);
+#endif
+}
+
+// Start screen pixels readback into pixel buffer
+// NOTE: glReadPixels() returns as soon as the copy is queued, the fence tells when it has landed,
+// so the caller maps the buffer a frame or two later without ever stalling the pipeline
+void *rlReadScreenPixelsAsync(unsigned int id, int width, int height)
+{
+    void *fence = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();      // Make sure the fence reaches the GPU, otherwise waiting on it could never return
+#endif
+
+    return fence;
+}
+
+// Map pixel buffer for reading
+void *rlMapPixelBuffer(unsigned int id, int size)
+{
+    void *data = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return data;
+}
+
+// Unmap pixel buffer
+void rlUnmapPixelBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+}
+
+// Load fence after the commands submitted so far
+void *rlLoadFence(void)
+{
+    void *fence = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();      // Make sure the fence reaches the GPU, otherwise waiting on it could never return
+#endif
+
+    return fence;
+}
+
+// Check if GPU passed fence, waiting up to timeout seconds
+bool rlIsFenceSignaled(void *fence, double timeout)
+{
+    bool signaled = true;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    if (fence != NULL)
+    {
+        GLenum result = glClientWaitSync((GLsync)fence, 0, (GLuint64)(timeout*1e9));
+        signaled = (result == GL_ALREADY_SIGNALED) || (result == GL_CONDITION_SATISFIED);
+    }
+#endif
+
+    return signaled;
+}
+
+// Unload fence
+void rlUnloadFence(void *fence)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    if (fence != NULL) glDeleteSync((GLsync)fence);
+#endif
+}
+
 // Framebuffer management (fbo)
 //-----------------------------------------------------------------------------------------
 // Load a framebuffer to be used for rendering
@@ -3773,15 +4733,29 @@ unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
     unsigned int vertexShaderId = 0;
     unsigned int fragmentShaderId = 0;
 
+    // Try the program binary cache first, a missing shader stands for the default one
+    const char *vsSource = (vsCode != NULL)? vsCode : RLGL.State.defaultVShaderCode;
+    const char *fsSource = (fsCode != NULL)? fsCode : RLGL.State.defaultFShaderCode;
+    if ((vsCode != NULL) || (fsCode != NULL)) id = rlLoadShaderBinary(vsSource, fsSource);
+    if (id > 0) return id;
+
     // Compile vertex shader (if provided)
     if (vsCode != NULL) vertexShaderId = rlCompileShader(vsCode, GL_VERTEX_SHADER);
     // In case no vertex shader was provided or compilation failed, we use default vertex shader
-    if (vertexShaderId == 0) vertexShaderId = RLGL.State.defaultVShaderId;
+    if (vertexShaderId == 0)
+    {
+        rlCompileShaderDefault();
+        vertexShaderId = RLGL.State.defaultVShaderId;
+    }
 
     // Compile fragment shader (if provided)
     if (fsCode != NULL) fragmentShaderId = rlCompileShader(fsCode, GL_FRAGMENT_SHADER);
     // In case no fragment shader was provided or compilation failed, we use default fragment shader
-    if (fragmentShaderId == 0) fragmentShaderId = RLGL.State.defaultFShaderId;
+    if (fragmentShaderId == 0)
+    {
+        rlCompileShaderDefault();
+        fragmentShaderId = RLGL.State.defaultFShaderId;
+    }
 
     // In case vertex and fragment shader are the default ones, no need to recompile, we can just assign the default shader program id
     if ((vertexShaderId == RLGL.State.defaultVShaderId) && (fragmentShaderId == RLGL.State.defaultFShaderId)) id = RLGL.State.defaultShaderId;
@@ -3790,6 +4764,11 @@ unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
         // One of or both shader are new, we need to compile a new shader program
         id = rlLoadShaderProgram(vertexShaderId, fragmentShaderId);
 
+        // Only cache what was actually requested, not a program patched with a default shader after a compile error
+        bool vsFallback = (vsCode != NULL) && (vertexShaderId == RLGL.State.defaultVShaderId);
+        bool fsFallback = (fsCode != NULL) && (fragmentShaderId == RLGL.State.defaultFShaderId);
+        if ((id > 0) && !vsFallback && !fsFallback) rlSaveShaderBinary(id, vsSource, fsSource);
+
         // We can detach and delete vertex/fragment shaders (if not default ones)
         // NOTE: We detach shader before deletion to make sure memory is freed
         if (vertexShaderId != RLGL.State.defaultVShaderId)
@@ -3919,6 +4898,11 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
 
     // NOTE: If some attrib name is no found on the shader, it locations becomes -1
 
+#if defined(GRAPHICS_API_OPENGL_33)
+    // NOTE: Some drivers only keep a retrievable binary when requested before linking
+    if (RLGL.ExtSupported.programBinary && (RLGL.State.shaderCacheDir[0] != '\0')) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+
     glLinkProgram(program);
 
     // NOTE: All uniform variables are intitialised to 0 when a program links
@@ -4077,6 +5061,17 @@ void rlSetShader(unsigned int id, int *locs)
 #endif
 }
 
+// Set shader program binary cache directory
+// NOTE: Linked programs are saved there and loaded back on next run, skipping compilation,
+// the directory must exist. Binaries from a different driver or source are replaced automatically
+void rlSetShaderCacheDirectory(const char *path)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((path == NULL) || (strlen(path) >= sizeof(RLGL.State.shaderCacheDir))) RLGL.State.shaderCacheDir[0] = '\0';
+    else strcpy(RLGL.State.shaderCacheDir, path);
+#endif
+}
+
 // Load compute shader program
 unsigned int rlLoadComputeShaderProgram(unsigned int shaderId)
 {
@@ -4582,12 +5577,25 @@ static void rlLoadShaderDefault(void)
     "}                                  \n";
 #endif
 
-    // NOTE: Compiled vertex/fragment shaders are not deleted,
-    // they are kept for re-use as default shaders in case some shader loading fails
-    RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
-    RLGL.State.defaultFShaderId = rlCompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+    RLGL.State.defaultVShaderCode = defaultVShaderCode;
+    RLGL.State.defaultFShaderCode = defaultFShaderCode;
 
-    RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+    RLGL.State.defaultShaderId = rlLoadShaderBinary(defaultVShaderCode, defaultFShaderCode);
+
+    if (RLGL.State.defaultShaderId == 0)
+    {
+        rlCompileShaderDefault();
+        RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+
+        if (RLGL.State.defaultShaderId > 0)
+        {
+            rlSaveShaderBinary(RLGL.State.defaultShaderId, defaultVShaderCode, defaultFShaderCode);
+
+            // NOTE: Program keeps working once linked, shaders stay alive for rlLoadShaderCode() fallbacks
+            glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
+            glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
+        }
+    }
 
     if (RLGL.State.defaultShaderId > 0)
     {
@@ -4612,10 +5620,11 @@ static void rlUnloadShaderDefault(void)
 {
     glUseProgram(0);
 
-    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
-    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
-    glDeleteShader(RLGL.State.defaultVShaderId);
-    glDeleteShader(RLGL.State.defaultFShaderId);
+    // NOTE: Default shaders are not compiled at all when the program came from the binary cache
+    if (RLGL.State.defaultVShaderId > 0) glDeleteShader(RLGL.State.defaultVShaderId);
+    if (RLGL.State.defaultFShaderId > 0) glDeleteShader(RLGL.State.defaultFShaderId);
+    RLGL.State.defaultVShaderId = 0;
+    RLGL.State.defaultFShaderId = 0;
 
     glDeleteProgram(RLGL.State.defaultShaderId);
 
@@ -4624,6 +5633,496 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Load untextured color-only shader
+// NOTE: Attributes are bound to the default locations by rlLoadShaderProgram(), same as the default shader,
+// so the batch vertex buffers feed both. Fails quietly, default texture draws then use the default shader
+static void rlLoadShaderFlat(void)
+{
+    const char *flatVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec4 vertexColor;               \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    const char *flatFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec4 fragColor;            \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = colDiffuse*fragColor; \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = colDiffuse*fragColor; \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec4 fragColor;            \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = colDiffuse*fragColor; \n"
+    "}                                  \n";
+#endif
+
+    RLGL.State.flatShaderId = rlLoadShaderSource(flatVShaderCode, flatFShaderCode);
+
+    if (RLGL.State.flatShaderId > 0)
+    {
+        RLGL.State.flatShaderLocs[0] = glGetUniformLocation(RLGL.State.flatShaderId, "mvp");
+        RLGL.State.flatShaderLocs[1] = glGetUniformLocation(RLGL.State.flatShaderId, "colDiffuse");
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Untextured shader loaded successfully", RLGL.State.flatShaderId);
+    }
+    else TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load untextured shader, using default shader");
+}
+
+// Unload untextured color-only shader
+static void rlUnloadShaderFlat(void)
+{
+    if (RLGL.State.flatShaderId > 0) glDeleteProgram(RLGL.State.flatShaderId);
+    RLGL.State.flatShaderId = 0;
+}
+
+// Compile default vertex/fragment shaders if not compiled yet
+// NOTE: Compiled shaders are not deleted until rlUnloadShaderDefault(),
+// they are kept for re-use as default shaders in case some shader loading fails
+static void rlCompileShaderDefault(void)
+{
+    if (RLGL.State.defaultVShaderId == 0) RLGL.State.defaultVShaderId = rlCompileShader(RLGL.State.defaultVShaderCode, GL_VERTEX_SHADER);
+    if (RLGL.State.defaultFShaderId == 0) RLGL.State.defaultFShaderId = rlCompileShader(RLGL.State.defaultFShaderCode, GL_FRAGMENT_SHADER);
+}
+
+// Load shader program from binary cache or compile it from code, 0 on failure
+static unsigned int rlLoadShaderSource(const char *vsCode, const char *fsCode)
+{
+    unsigned int id = rlLoadShaderBinary(vsCode, fsCode);
+    if (id > 0) return id;
+
+    unsigned int vShaderId = rlCompileShader(vsCode, GL_VERTEX_SHADER);
+    unsigned int fShaderId = rlCompileShader(fsCode, GL_FRAGMENT_SHADER);
+
+    id = rlLoadShaderProgram(vShaderId, fShaderId);
+    if (id > 0) rlSaveShaderBinary(id, vsCode, fsCode);
+
+    glDeleteShader(vShaderId);
+    glDeleteShader(fShaderId);
+
+    return id;
+}
+
+// Shader program binary cache file header
+// NOTE: File name comes from the source hash, the driver hash inside tells whether the binary is still valid
+typedef struct rlShaderBinaryHeader {
+    unsigned int magic;                 // File identifier: RL_SHADER_BINARY_MAGIC
+    unsigned int format;                // Binary format returned by the driver
+    unsigned long long sourceHash;      // Shader code and attribute bindings hash
+    unsigned long long driverHash;      // GL vendor, renderer and version strings hash
+    int length;                         // Binary data length in bytes, following the header
+} rlShaderBinaryHeader;
+
+#define RL_SHADER_BINARY_MAGIC      0x42534c52      // "RLSB"
+
+// Hash string into a FNV-1a 64 bit hash
+static unsigned long long rlHashShaderString(unsigned long long hash, const char *text)
+{
+    if (text != NULL) for (const unsigned char *c = (const unsigned char *)text; *c != '\0'; c++) hash = (hash ^ *c)*0x100000001b3ULL;
+
+    return (hash ^ 0xff)*0x100000001b3ULL;      // Separator, so text moving from one string to the next changes the hash
+}
+
+// Get shader program binary cache file path and hashes
+static bool rlGetShaderBinaryPath(const char *vsCode, const char *fsCode, unsigned long long *sourceHash, unsigned long long *driverHash, char *path, int size)
+{
+    if (!RLGL.ExtSupported.programBinary || (RLGL.State.shaderCacheDir[0] == '\0') || (vsCode == NULL) || (fsCode == NULL)) return false;
+
+    // NOTE: Attribute locations are bound before linking, they are part of the program
+    unsigned long long hash = 0xcbf29ce484222325ULL;
+    hash = rlHashShaderString(hash, vsCode);
+    hash = rlHashShaderString(hash, fsCode);
+    hash = rlHashShaderString(hash, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    hash = rlHashShaderString(hash, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    hash = rlHashShaderString(hash, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    hash = rlHashShaderString(hash, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    hash = rlHashShaderString(hash, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    hash = rlHashShaderString(hash, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    *sourceHash = hash;
+
+    hash = 0xcbf29ce484222325ULL;
+    hash = rlHashShaderString(hash, (const char *)glGetString(GL_VENDOR));
+    hash = rlHashShaderString(hash, (const char *)glGetString(GL_RENDERER));
+    hash = rlHashShaderString(hash, (const char *)glGetString(GL_VERSION));
+    *driverHash = hash;
+
+    int length = snprintf(path, size, "%s/shader_%016llx.bin", RLGL.State.shaderCacheDir, *sourceHash);
+
+    return (length > 0) && (length < size);
+}
+
+// Load shader program from binary cache
+// NOTE: Returns 0 when there is no binary for this code or it was saved by another driver,
+// the caller then compiles the program from code as usual
+static unsigned int rlLoadShaderBinary(const char *vsCode, const char *fsCode)
+{
+    unsigned int program = 0;
+    unsigned long long sourceHash = 0;
+    unsigned long long driverHash = 0;
+    char path[600] = { 0 };
+
+    if (!rlGetShaderBinaryPath(vsCode, fsCode, &sourceHash, &driverHash, path, sizeof(path))) return 0;
+
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) return 0;
+
+    rlShaderBinaryHeader header = { 0 };
+    void *binary = NULL;
+
+    if ((fread(&header, sizeof(header), 1, file) == 1) && (header.magic == RL_SHADER_BINARY_MAGIC) &&
+        (header.sourceHash == sourceHash) && (header.driverHash == driverHash) && (header.length > 0))
+    {
+        binary = RL_MALLOC(header.length);
+        if ((binary != NULL) && (fread(binary, header.length, 1, file) != 1))
+        {
+            RL_FREE(binary);
+            binary = NULL;
+        }
+    }
+
+    fclose(file);
+
+    if (binary != NULL)
+    {
+        GLint success = 0;
+        program = glCreateProgram();
+        glProgramBinary(program, header.format, binary, header.length);
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+        // NOTE: Drivers may still reject a binary, i.e. after an update that kept the version string
+        if (success == GL_FALSE)
+        {
+            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load program binary, compiling from code", program);
+            glDeleteProgram(program);
+            program = 0;
+        }
+        else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully from binary cache", program);
+
+        RL_FREE(binary);
+    }
+
+    return program;
+}
+
+// Save linked shader program to binary cache
+static void rlSaveShaderBinary(unsigned int id, const char *vsCode, const char *fsCode)
+{
+    rlShaderBinaryHeader header = { 0 };
+    char path[600] = { 0 };
+
+    if (!rlGetShaderBinaryPath(vsCode, fsCode, &header.sourceHash, &header.driverHash, path, sizeof(path))) return;
+
+    GLint length = 0;
+    glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    void *binary = RL_MALLOC(length);
+    if (binary == NULL) return;
+
+    GLenum format = 0;
+    glGetProgramBinary(id, length, &header.length, &format, binary);
+    header.magic = RL_SHADER_BINARY_MAGIC;
+    header.format = format;
+
+    FILE *file = (header.length > 0)? fopen(path, "wb") : NULL;
+
+    if (file != NULL)
+    {
+        bool saved = (fwrite(&header, sizeof(header), 1, file) == 1) && (fwrite(binary, header.length, 1, file) == 1);
+
+        // NOTE: A torn file fails the length check on load, then the program is compiled and saved again
+        if ((fclose(file) != 0) || !saved) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to write program binary: %s", id, path);
+    }
+    else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to open program binary file: %s", id, path);
+
+    RL_FREE(binary);
+}
+
+// Issue a timestamp query for the frame being timed
+// NOTE: False outside a timed frame or when only the reserved queries are left
+static bool rlGpuTimestamp(int reserve)
+{
+    bool issued = false;
+
+#if defined(RLGL_GPU_TIMER)
+    int frame = RLGL.State.gpuFrameHead%RL_GPU_TIMER_FRAMES;
+    int count = RLGL.State.gpuQueryCount[frame];
+
+    if (RLGL.State.gpuFrameOpen && ((count + 1 + reserve) <= (2*RL_GPU_TIMER_BATCHES + 2)))
+    {
+        glQueryCounter(RLGL.State.gpuQueries[frame][count], GL_TIMESTAMP);
+        RLGL.State.gpuQueryCount[frame]++;
+        issued = true;
+    }
+#endif
+
+    return issued;
+}
+
+// Load instanced rectangles shader and buffers
+// NOTE: Loaded: RLGL.State.rectShaderId, RLGL.State.rectShaderLocs, RLGL.State.rectVaoId, RLGL.State.rectVboId
+static bool rlLoadRectInstancing(void)
+{
+    const char *rectVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec4 instanceRect;       \n"
+    "attribute vec4 instanceColor;      \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 vertexPosition;            \n"
+    "in vec4 instanceRect;              \n"
+    "in vec4 instanceColor;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec4 instanceRect;       \n"
+    "attribute vec4 instanceColor;      \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragColor = instanceColor;     \n"
+    "    gl_Position = mvp*vec4(instanceRect.xy + vertexPosition*instanceRect.zw, 0.0, 1.0); \n"
+    "}                                  \n";
+
+    const char *rectFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec4 fragColor;            \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = fragColor;      \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = fragColor;        \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec4 fragColor;            \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = fragColor;      \n"
+    "}                                  \n";
+#endif
+
+    RLGL.State.rectShaderId = rlLoadShaderSource(rectVShaderCode, rectFShaderCode);
+
+    if (RLGL.State.rectShaderId == 0)
+    {
+        TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load instanced rectangles shader");
+        return false;
+    }
+
+    RLGL.State.rectShaderLocs[0] = glGetAttribLocation(RLGL.State.rectShaderId, "vertexPosition");
+    RLGL.State.rectShaderLocs[1] = glGetAttribLocation(RLGL.State.rectShaderId, "instanceRect");
+    RLGL.State.rectShaderLocs[2] = glGetAttribLocation(RLGL.State.rectShaderId, "instanceColor");
+    RLGL.State.rectShaderLocs[3] = glGetUniformLocation(RLGL.State.rectShaderId, "mvp");
+
+    // Unit quad corners, scaled and offset by every instance rectangle
+    const float corners[12] = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f };
+
+    glGenVertexArrays(1, &RLGL.State.rectVaoId);
+    glBindVertexArray(RLGL.State.rectVaoId);
+
+    glGenBuffers(2, RLGL.State.rectVboId);
+
+    glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.rectVboId[0]);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+    glVertexAttribPointer(RLGL.State.rectShaderLocs[0], 2, GL_FLOAT, 0, 0, 0);
+    glEnableVertexAttribArray(RLGL.State.rectShaderLocs[0]);
+
+    glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.rectVboId[1]);
+    glVertexAttribPointer(RLGL.State.rectShaderLocs[1], 4, GL_FLOAT, 0, sizeof(rlRectInstance), (void *)0);
+    glEnableVertexAttribArray(RLGL.State.rectShaderLocs[1]);
+    glVertexAttribDivisor(RLGL.State.rectShaderLocs[1], 1);
+    glVertexAttribPointer(RLGL.State.rectShaderLocs[2], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlRectInstance), (void *)(4*sizeof(float)));
+    glEnableVertexAttribArray(RLGL.State.rectShaderLocs[2]);
+    glVertexAttribDivisor(RLGL.State.rectShaderLocs[2], 1);
+
+    glBindVertexArray(0);
+
+    TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Instanced rectangles shader loaded successfully", RLGL.State.rectShaderId);
+
+    return true;
+}
+
+// Unload instanced rectangles shader and buffers
+static void rlUnloadRectInstancing(void)
+{
+    if (RLGL.State.rectShaderId == 0) return;
+
+    glDeleteBuffers(2, RLGL.State.rectVboId);
+    glDeleteVertexArrays(1, &RLGL.State.rectVaoId);
+    glDeleteProgram(RLGL.State.rectShaderId);
+
+    RLGL.State.rectShaderId = 0;
+}
+
+// Load data into the currently bound batch vertex buffer
+// NOTE: Persistent storage is immutable, so it can be mapped once and kept mapped
+static void rlLoadBatchBufferStorage(const void *data, int size, bool persistent)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (persistent)
+    {
+        // NOTE: GL_DYNAMIC_STORAGE_BIT keeps glBufferSubData() available in case mapping fails
+        glBufferStorage(GL_ARRAY_BUFFER, size, data, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT | GL_DYNAMIC_STORAGE_BIT);
+        return;
+    }
+#endif
+    glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+}
+
+// Map batch vertex buffer VBOs persistently and point its vertex data arrays into them
+// NOTE: CPU arrays are freed on success, vertices are then written directly into GPU-visible memory
+static bool rlMapBatchVertexBuffer(rlVertexBuffer *buffer)
+{
+    bool result = false;
+#if defined(GRAPHICS_API_OPENGL_33)
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    // Compact batches keep all the vertex data in a single buffer
+    if (buffer->compact != NULL)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+        void *mapped = glMapBufferRange(GL_ARRAY_BUFFER, 0, buffer->elementCount*4*sizeof(rlCompactVertex), flags);
+
+        if (mapped != NULL)
+        {
+            RL_FREE(buffer->compact);
+            buffer->compact = (rlCompactVertex *)mapped;
+            result = true;
+        }
+        else TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map render batch vertex buffer, using buffer uploads");
+
+        return result;
+    }
+
+    int sizes[3] = { buffer->elementCount*3*4*sizeof(float), buffer->elementCount*2*4*sizeof(float), buffer->elementCount*4*4*sizeof(unsigned char) };
+    void *mapped[3] = { 0 };
+
+    for (int i = 0; i < 3; i++)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[i]);
+        mapped[i] = glMapBufferRange(GL_ARRAY_BUFFER, 0, sizes[i], flags);
+    }
+
+    if ((mapped[0] != NULL) && (mapped[1] != NULL) && (mapped[2] != NULL))
+    {
+        RL_FREE(buffer->vertices);
+        RL_FREE(buffer->texcoords);
+        RL_FREE(buffer->colors);
+
+        buffer->vertices = (float *)mapped[0];
+        buffer->texcoords = (float *)mapped[1];
+        buffer->colors = (unsigned char *)mapped[2];
+        result = true;
+    }
+    else
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            if (mapped[i] == NULL) continue;
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[i]);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+        }
+
+        TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map render batch vertex buffer, using buffer uploads");
+    }
+#endif
+    return result;
+}
+
+// Set compact vertex attributes for the currently bound batch VBO
+// NOTE: Positions stay integer 1/8 pixel units, rlDrawRenderBatch() scales the MVP matrix to match
+static void rlSetCompactVertexAttribs(void)
+{
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 2, GL_SHORT, GL_FALSE, sizeof(rlCompactVertex), (void *)offsetof(rlCompactVertex, x));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(rlCompactVertex), (void *)offsetof(rlCompactVertex, u));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlCompactVertex), (void *)offsetof(rlCompactVertex, r));
+}
+
+// Convert position to 13.3 fixed point, rounded to nearest and clamped to the int16 range
+static short rlPackCompactPosition(float value)
+{
+    float fixed = value*8.0f + ((value >= 0.0f)? 0.5f : -0.5f);
+
+    if (fixed < -32768.0f) fixed = -32768.0f;
+    else if (fixed > 32767.0f) fixed = 32767.0f;
+
+    return (short)fixed;
+}
+
+// Convert texcoord to normalized 16 bit, clamped to [0..1]
+static unsigned short rlPackCompactTexcoord(float value)
+{
+    if (value < 0.0f) value = 0.0f;
+    else if (value > 1.0f) value = 1.0f;
+
+    return (unsigned short)(value*65535.0f + 0.5f);
+}
+
+// Compare draw calls sort keys: layer, texture, mode
+static int rlCompareDrawCalls(const rlDrawCall *a, const rlDrawCall *b)
+{
+    if (a->layer != b->layer) return (a->layer < b->layer)? -1 : 1;
+    if (a->textureId != b->textureId) return (a->textureId < b->textureId)? -1 : 1;
+    if (a->mode != b->mode) return (a->mode < b->mode)? -1 : 1;
+    return 0;
+}
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static char *rlGetCompressedFormatName(int format)
@@ -4745,6 +6244,16 @@ static int rlGetPixelDataSize(int width, int height, int format)
         else if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
     }
 
+    // Block compressed formats are stored as whole blocks, sizes that are not a multiple of the block round up
+    // NOTE: PVRT keeps the minimum above, its block layout is not a fixed grid
+    if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format != RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) && (format != RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA))
+    {
+        int blockSize = (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)? 8 : 4;
+        int blockBytes = ((format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
+                          (format == RL_PIXELFORMAT_COMPRESSED_ETC1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_ETC2_RGB))? 8 : 16;
+        dataSize = ((width + blockSize - 1)/blockSize)*((height + blockSize - 1)/blockSize)*blockBytes;
+    }
+
     return dataSize;
 }
 
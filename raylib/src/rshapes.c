@@ -55,10 +55,22 @@
 
 #include "rlgl.h"       // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 
-#include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf()
+#include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf(), fminf(), fmaxf()
 #include <float.h>      // Required for: FLT_EPSILON
 #include <stdlib.h>     // Required for: RL_FREE
 
+// NOTE: SSE2 is part of every x86-64 target, so no runtime check is needed for it
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>  // Required for: CheckCollisionRecsMask() SSE2 path
+    #define RSHAPES_SUPPORT_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>   // Required for: CheckCollisionRecsMask() NEON path
+    #define RSHAPES_SUPPORT_NEON
+#elif defined(__wasm_simd128__)
+    #include <wasm_simd128.h>   // Required for: CheckCollisionRecsMask() WebAssembly SIMD path
+    #define RSHAPES_SUPPORT_WASM_SIMD
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -70,12 +82,25 @@
 #ifndef BEZIER_LINE_DIVISIONS
     #define BEZIER_LINE_DIVISIONS       24      // Bezier line divisions
 #endif
+#ifndef MAX_CIRCLE_CACHE_ENTRIES
+    #define MAX_CIRCLE_CACHE_ENTRIES     8      // Maximum number of unit circle vertex tables cached by DrawCircleSector()
+#endif
+#ifndef MAX_CIRCLE_CACHE_SEGMENTS
+    #define MAX_CIRCLE_CACHE_SEGMENTS  128      // Maximum number of segments of a cached unit circle table
+#endif
 
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// Not here...
+// Unit circle vertex table for one sector configuration
+// NOTE: Points are stored as (sin, cos) pairs, matching the vertex order used by DrawCircleSector()
+typedef struct CircleCacheEntry {
+    float startAngle;
+    float endAngle;
+    int segments;
+    Vector2 points[MAX_CIRCLE_CACHE_SEGMENTS + 1];
+} CircleCacheEntry;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -83,10 +108,25 @@
 Texture2D texShapes = { 1, 1, 1, 1, 7 };                // Texture used on shapes drawing (usually a white pixel)
 Rectangle texShapesRec = { 0.0f, 0.0f, 1.0f, 1.0f };    // Texture source rectangle used on shapes drawing
 
+static CircleCacheEntry circleCache[MAX_CIRCLE_CACHE_ENTRIES] = { 0 };  // Unit circle tables, replaced round-robin
+static int circleCacheCount = 0;                        // Number of valid entries in circleCache
+static int circleCacheNext = 0;                         // Next entry to be replaced when cache is full
+
+static float circleErrorRate = SMOOTH_CIRCLE_ERROR_RATE; // Error rate used for segment counts, set by SetShapesCircleErrorRate()
+static float circleSegmentsRadius = 0.0f;               // Radius of last smooth segments computation
+static float circleSegmentsPerTurn = 0.0f;              // Segments per full turn required for circleSegmentsRadius
+
+static Shader shaderSDF = { 0 };                        // Signed distance shapes shader, loaded on first use
+static int shaderSDFState = 0;                          // Shader state: 0 - not loaded, 1 - loaded, -1 - not supported
+static bool shapesSDFMode = false;                      // Between BeginShapesSDF() and EndShapesSDF()
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
+static const Vector2 *GetCirclePoints(float startAngle, float endAngle, int segments);     // Get cached unit circle points for a sector
+static bool LoadShaderSDF(void);                                    // Load signed distance shapes shader, false if not supported
+static void DrawQuadSDF(float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1);   // Add one quad with distance coordinates
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -94,13 +134,36 @@ static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic eas
 
 // Set texture and rectangle to be used on shapes drawing
 // NOTE: It can be useful when using basic shapes and one single font,
-// defining a font char white rectangle would allow drawing everything in a single draw call
+// defining a font char white rectangle would allow drawing everything in a single draw call.
+// With the default texture, solid shapes are drawn by rlgl's untextured shader and sample nothing
 void SetShapesTexture(Texture2D texture, Rectangle source)
 {
     texShapes = texture;
     texShapesRec = source;
 }
 
+// Get texture that is used for shapes drawing
+Texture2D GetShapesTexture(void)
+{
+    return texShapes;
+}
+
+// Get texture source rectangle that is used for shapes drawing
+Rectangle GetShapesTextureRectangle(void)
+{
+    return texShapesRec;
+}
+
+// Set error rate to calculate how many segments we need to draw a smooth circle
+// NOTE: Only used when no segment count is requested, larger rates draw fewer segments
+void SetShapesCircleErrorRate(float rate)
+{
+    if (rate <= 0.0f) rate = SMOOTH_CIRCLE_ERROR_RATE;
+
+    circleErrorRate = rate;
+    circleSegmentsRadius = 0.0f;    // Segments per turn for the cached radius are recomputed
+}
+
 // Draw a pixel
 void DrawPixel(int posX, int posY, Color color)
 {
@@ -176,6 +239,8 @@ void DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color)
     Vector2 delta = { endPos.x - startPos.x, endPos.y - startPos.y };
     float length = sqrtf(delta.x*delta.x + delta.y*delta.y);
 
+    if (rlCheckCullRect(fminf(startPos.x, endPos.x) - thick, fminf(startPos.y, endPos.y) - thick, fabsf(delta.x) + thick*2, fabsf(delta.y) + thick*2)) return;
+
     if ((length > 0) && (thick > 0))
     {
         float scale = thick/(2*length);
@@ -346,6 +411,7 @@ void DrawCircle(int centerX, int centerY, float radius, Color color)
 void DrawCircleSector(Vector2 center, float radius, float startAngle, float endAngle, int segments, Color color)
 {
     if (radius <= 0.0f) radius = 0.1f;  // Avoid div by zero
+    if (rlCheckCullRect(center.x - radius, center.y - radius, radius*2, radius*2)) return;
 
     // Function expects (endAngle > startAngle)
     if (endAngle < startAngle)
@@ -361,52 +427,90 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        // NOTE: Result only depends on radius and error rate, so it's reused while the same radius is requested
+        if (radius != circleSegmentsRadius)
+        {
+            float th = acosf(2*powf(1 - fminf(circleErrorRate, radius)/radius, 2) - 1);
+            circleSegmentsPerTurn = ceilf(2*PI/th);
+            circleSegmentsRadius = radius;
+        }
+
+        segments = (int)((endAngle - startAngle)*circleSegmentsPerTurn/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+
+    // Unit circle points are scaled and translated, trigonometry only runs when the table is built
+    // NOTE: points is NULL if segments count is too big to be cached, then every point is computed
+    const Vector2 *points = GetCirclePoints(startAngle, endAngle, segments);
+    Vector2 p0 = { 0 };
+    Vector2 p1 = { 0 };
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
+    Vector2 p2 = { 0 };
+
     rlSetTexture(texShapes.id);
 
     rlBegin(RL_QUADS);
         // NOTE: Every QUAD actually represents two segments
         for (int i = 0; i < segments/2; i++)
         {
+            if (points != NULL)
+            {
+                p0 = points[i*2];
+                p1 = points[i*2 + 1];
+                p2 = points[i*2 + 2];
+            }
+            else
+            {
+                float angle = startAngle + stepLength*i*2;
+                p0 = (Vector2){ sinf(DEG2RAD*angle), cosf(DEG2RAD*angle) };
+                p1 = (Vector2){ sinf(DEG2RAD*(angle + stepLength)), cosf(DEG2RAD*(angle + stepLength)) };
+                p2 = (Vector2){ sinf(DEG2RAD*(angle + stepLength*2)), cosf(DEG2RAD*(angle + stepLength*2)) };
+            }
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + p0.x*radius, center.y + p0.y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + p1.x*radius, center.y + p1.y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength*2))*radius, center.y + cosf(DEG2RAD*(angle + stepLength*2))*radius);
-
-            angle += (stepLength*2);
+            rlVertex2f(center.x + p2.x*radius, center.y + p2.y*radius);
         }
 
         // NOTE: In case number of segments is odd, we add one last piece to the cake
         if (segments%2)
         {
+            if (points != NULL)
+            {
+                p0 = points[segments - 1];
+                p1 = points[segments];
+            }
+            else
+            {
+                float angle = startAngle + stepLength*(segments - 1);
+                p0 = (Vector2){ sinf(DEG2RAD*angle), cosf(DEG2RAD*angle) };
+                p1 = (Vector2){ sinf(DEG2RAD*(angle + stepLength)), cosf(DEG2RAD*(angle + stepLength)) };
+            }
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + p0.x*radius, center.y + p0.y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + p1.x*radius, center.y + p1.y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
             rlVertex2f(center.x, center.y);
@@ -418,13 +522,23 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < segments; i++)
         {
+            if (points != NULL)
+            {
+                p0 = points[i];
+                p1 = points[i + 1];
+            }
+            else
+            {
+                float angle = startAngle + stepLength*i;
+                p0 = (Vector2){ sinf(DEG2RAD*angle), cosf(DEG2RAD*angle) };
+                p1 = (Vector2){ sinf(DEG2RAD*(angle + stepLength)), cosf(DEG2RAD*(angle + stepLength)) };
+            }
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + p0.x*radius, center.y + p0.y*radius);
+            rlVertex2f(center.x + p1.x*radius, center.y + p1.y*radius);
         }
     rlEnd();
 #endif
@@ -449,7 +563,7 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+        float th = acosf(2*powf(1 - fminf(circleErrorRate, radius)/radius, 2) - 1);
         segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
 
         if (segments <= 0) segments = minSegments;
@@ -490,6 +604,8 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 // NOTE: Gradient goes from center (color1) to border (color2)
 void DrawCircleGradient(int centerX, int centerY, float radius, Color color1, Color color2)
 {
+    if (rlCheckCullRect(centerX - radius, centerY - radius, radius*2, radius*2)) return;
+
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < 360; i += 10)
         {
@@ -528,6 +644,8 @@ void DrawCircleLines(int centerX, int centerY, float radius, Color color)
 // Draw ellipse
 void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
+    if (rlCheckCullRect(centerX - radiusH, centerY - radiusV, radiusH*2, radiusV*2)) return;
+
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < 360; i += 10)
         {
@@ -567,6 +685,8 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
         if (outerRadius <= 0.0f) outerRadius = 0.1f;
     }
 
+    if (rlCheckCullRect(center.x - outerRadius, center.y - outerRadius, outerRadius*2, outerRadius*2)) return;
+
     // Function expects (endAngle > startAngle)
     if (endAngle < startAngle)
     {
@@ -581,7 +701,7 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
+        float th = acosf(2*powf(1 - fminf(circleErrorRate, outerRadius)/outerRadius, 2) - 1);
         segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
 
         if (segments <= 0) segments = minSegments;
@@ -657,6 +777,8 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
         if (outerRadius <= 0.0f) outerRadius = 0.1f;
     }
 
+    if (rlCheckCullRect(center.x - outerRadius, center.y - outerRadius, outerRadius*2, outerRadius*2)) return;
+
     // Function expects (endAngle > startAngle)
     if (endAngle < startAngle)
     {
@@ -671,7 +793,7 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
+        float th = acosf(2*powf(1 - fminf(circleErrorRate, outerRadius)/outerRadius, 2) - 1);
         segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
 
         if (segments <= 0) segments = minSegments;
@@ -776,6 +898,12 @@ void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color
         bottomRight.y = y + (dx + rec.width)*sinRotation + (dy + rec.height)*cosRotation;
     }
 
+    float minX = fminf(fminf(topLeft.x, topRight.x), fminf(bottomLeft.x, bottomRight.x));
+    float minY = fminf(fminf(topLeft.y, topRight.y), fminf(bottomLeft.y, bottomRight.y));
+    float maxX = fmaxf(fmaxf(topLeft.x, topRight.x), fmaxf(bottomLeft.x, bottomRight.x));
+    float maxY = fmaxf(fmaxf(topLeft.y, topRight.y), fmaxf(bottomLeft.y, bottomRight.y));
+    if (rlCheckCullRect(minX, minY, maxX - minX, maxY - minY)) return;
+
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
 
@@ -834,6 +962,8 @@ void DrawRectangleGradientH(int posX, int posY, int width, int height, Color col
 // NOTE: Colors refer to corners, starting at top-lef corner and counter-clockwise
 void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4)
 {
+    if (rlCheckCullRect(rec.x, rec.y, rec.width, rec.height)) return;
+
     rlSetTexture(texShapes.id);
 
     rlBegin(RL_QUADS);
@@ -928,6 +1058,8 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
         return;
     }
 
+    if (rlCheckCullRect(rec.x, rec.y, rec.width, rec.height)) return;
+
     if (roundness >= 1.0f) roundness = 1.0f;
 
     // Calculate corner radius
@@ -938,7 +1070,7 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     if (segments < 4)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+        float th = acosf(2*powf(1 - fminf(circleErrorRate, radius)/radius, 2) - 1);
         segments = (int)(ceilf(2*PI/th)/4.0f);
         if (segments <= 0) segments = 4;
     }
@@ -1158,7 +1290,7 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
     if (segments < 4)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+        float th = acosf(2*powf(1 - fminf(circleErrorRate, radius)/radius, 2) - 1);
         segments = (int)(ceilf(2*PI/th)/2.0f);
         if (segments <= 0) segments = 4;
     }
@@ -1368,10 +1500,126 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
     }
 }
 
+// Begin signed distance shapes mode
+// NOTE: Circles and rounded rectangles are drawn as quads shaded by their analytic distance, so the edge
+// is antialiased at any size and costs no tessellation. The shader switch flushes the batch, consecutive
+// shapes between Begin/End share one draw call
+void BeginShapesSDF(void)
+{
+    if (!LoadShaderSDF()) return;
+
+    BeginShaderMode(shaderSDF);
+    shapesSDFMode = true;
+}
+
+// End signed distance shapes mode (returns to default shader)
+void EndShapesSDF(void)
+{
+    if (!shapesSDFMode) return;
+
+    EndShaderMode();
+    shapesSDFMode = false;
+}
+
+// Unload signed distance shapes shader
+// NOTE: Called on CloseWindow(), the shader is loaded again on next use
+void UnloadShapesSDF(void)
+{
+    if (shaderSDFState > 0) UnloadShader(shaderSDF);
+
+    shaderSDF = (Shader){ 0 };
+    shaderSDFState = 0;
+    shapesSDFMode = false;
+}
+
+// Draw a color-filled circle as a single antialiased quad
+// NOTE: Falls back to DrawCircleV() where shaders are not available
+void DrawCircleSDF(Vector2 center, float radius, Color color)
+{
+    if (radius <= 0.0f) return;
+    if (rlCheckCullRect(center.x - radius, center.y - radius, radius*2, radius*2)) return;
+    if (!LoadShaderSDF())
+    {
+        DrawCircleV(center, radius, color);
+        return;
+    }
+
+    bool wrap = !shapesSDFMode;
+    if (wrap) BeginShapesSDF();
+
+    // Quad grown by one pixel so the antialiased edge is not clipped, coordinates are in radius units
+    float extent = radius + 1.0f;
+    float uv = extent/radius;
+
+    rlCheckRenderBatchLimit(4);
+    rlSetTexture(texShapes.id);
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        DrawQuadSDF(center.x - extent, center.y - extent, center.x + extent, center.y + extent, -uv, -uv, uv, uv);
+
+    rlEnd();
+    rlSetTexture(0);
+
+    if (wrap) EndShapesSDF();
+}
+
+// Draw rectangle with rounded corners of the given radius, antialiased
+// NOTE: Drawn as a 3x3 grid of quads, corners carry the distance to the inner rectangle and the
+// rest interpolates it exactly. Falls back to DrawRectangleRounded() where shaders are not available
+void DrawRectangleRoundedSDF(Rectangle rec, float radius, Color color)
+{
+    if ((rec.width <= 0.0f) || (rec.height <= 0.0f)) return;
+    if (rlCheckCullRect(rec.x, rec.y, rec.width, rec.height)) return;
+
+    float maxRadius = ((rec.width < rec.height)? rec.width : rec.height)/2.0f;
+    if (radius > maxRadius) radius = maxRadius;
+    if (radius < 1.0f) radius = 1.0f;
+
+    if (!LoadShaderSDF())
+    {
+        DrawRectangleRounded(rec, radius/maxRadius, 0, color);
+        return;
+    }
+
+    bool wrap = !shapesSDFMode;
+    if (wrap) BeginShapesSDF();
+
+    float uv = (radius + 1.0f)/radius;
+    float xs[4] = { rec.x - 1.0f, rec.x + radius, rec.x + rec.width - radius, rec.x + rec.width + 1.0f };
+    float ys[4] = { rec.y - 1.0f, rec.y + radius, rec.y + rec.height - radius, rec.y + rec.height + 1.0f };
+    float us[4] = { -uv, 0.0f, 0.0f, uv };
+
+    rlCheckRenderBatchLimit(4*9);
+    rlSetTexture(texShapes.id);
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        for (int j = 0; j < 3; j++)
+        {
+            if (ys[j + 1] <= ys[j]) continue;   // Middle row is empty when the sides are fully round
+            for (int i = 0; i < 3; i++)
+            {
+                if (xs[i + 1] <= xs[i]) continue;
+                DrawQuadSDF(xs[i], ys[j], xs[i + 1], ys[j + 1], us[i], us[j], us[i + 1], us[j + 1]);
+            }
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+
+    if (wrap) EndShapesSDF();
+}
+
 // Draw a triangle
 // NOTE: Vertex must be provided in counter-clockwise order
 void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 {
+    float minX = fminf(v1.x, fminf(v2.x, v3.x));
+    float minY = fminf(v1.y, fminf(v2.y, v3.y));
+    if (rlCheckCullRect(minX, minY, fmaxf(v1.x, fmaxf(v2.x, v3.x)) - minX, fmaxf(v1.y, fmaxf(v2.y, v3.y)) - minY)) return;
+
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
 
@@ -1481,6 +1729,7 @@ void DrawTriangleStrip(Vector2 *points, int pointCount, Color color)
 void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color color)
 {
     if (sides < 3) sides = 3;
+    if (rlCheckCullRect(center.x - radius, center.y - radius, radius*2, radius*2)) return;
     float centralAngle = rotation;
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
@@ -1665,6 +1914,80 @@ bool CheckCollisionRecs(Rectangle rec1, Rectangle rec2)
     return collision;
 }
 
+// Check collision between a rectangle and up to 64 rectangles stored as separate arrays
+// NOTE: Bit i of the result is set if rectangle i collides, with the same comparisons as CheckCollisionRecs()
+unsigned long long CheckCollisionRecsMask(Rectangle rec, const float *x, const float *y, const float *width, const float *height, int count)
+{
+    unsigned long long mask = 0;
+    float right = rec.x + rec.width;
+    float bottom = rec.y + rec.height;
+    int i = 0;
+
+    if (count > 64) count = 64;
+
+#if defined(RSHAPES_SUPPORT_SSE2)
+    const __m128 recLeft = _mm_set1_ps(rec.x);
+    const __m128 recTop = _mm_set1_ps(rec.y);
+    const __m128 recRight = _mm_set1_ps(right);
+    const __m128 recBottom = _mm_set1_ps(bottom);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128 left = _mm_loadu_ps(x + i);
+        __m128 top = _mm_loadu_ps(y + i);
+        __m128 overlapX = _mm_and_ps(_mm_cmplt_ps(recLeft, _mm_add_ps(left, _mm_loadu_ps(width + i))), _mm_cmpgt_ps(recRight, left));
+        __m128 overlapY = _mm_and_ps(_mm_cmplt_ps(recTop, _mm_add_ps(top, _mm_loadu_ps(height + i))), _mm_cmpgt_ps(recBottom, top));
+
+        mask |= (unsigned long long)_mm_movemask_ps(_mm_and_ps(overlapX, overlapY)) << i;
+    }
+#elif defined(RSHAPES_SUPPORT_NEON)
+    const float32x4_t recLeft = vdupq_n_f32(rec.x);
+    const float32x4_t recTop = vdupq_n_f32(rec.y);
+    const float32x4_t recRight = vdupq_n_f32(right);
+    const float32x4_t recBottom = vdupq_n_f32(bottom);
+    const unsigned int laneBits[4] = { 1, 2, 4, 8 };
+    const uint32x4_t bits = vld1q_u32(laneBits);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        float32x4_t left = vld1q_f32(x + i);
+        float32x4_t top = vld1q_f32(y + i);
+        uint32x4_t overlapX = vandq_u32(vcltq_f32(recLeft, vaddq_f32(left, vld1q_f32(width + i))), vcgtq_f32(recRight, left));
+        uint32x4_t overlapY = vandq_u32(vcltq_f32(recTop, vaddq_f32(top, vld1q_f32(height + i))), vcgtq_f32(recBottom, top));
+
+        // Lane masks to one bit each, then a horizontal add (vaddvq_u32() is AArch64 only)
+        uint32x4_t laneMask = vandq_u32(vandq_u32(overlapX, overlapY), bits);
+        uint32x2_t sum = vadd_u32(vget_low_u32(laneMask), vget_high_u32(laneMask));
+        sum = vpadd_u32(sum, sum);
+
+        mask |= (unsigned long long)vget_lane_u32(sum, 0) << i;
+    }
+#elif defined(RSHAPES_SUPPORT_WASM_SIMD)
+    const v128_t recLeft = wasm_f32x4_splat(rec.x);
+    const v128_t recTop = wasm_f32x4_splat(rec.y);
+    const v128_t recRight = wasm_f32x4_splat(right);
+    const v128_t recBottom = wasm_f32x4_splat(bottom);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        v128_t left = wasm_v128_load(x + i);
+        v128_t top = wasm_v128_load(y + i);
+        v128_t overlapX = wasm_v128_and(wasm_f32x4_lt(recLeft, wasm_f32x4_add(left, wasm_v128_load(width + i))), wasm_f32x4_gt(recRight, left));
+        v128_t overlapY = wasm_v128_and(wasm_f32x4_lt(recTop, wasm_f32x4_add(top, wasm_v128_load(height + i))), wasm_f32x4_gt(recBottom, top));
+
+        mask |= (unsigned long long)wasm_i32x4_bitmask(wasm_v128_and(overlapX, overlapY)) << i;
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        if ((rec.x < (x[i] + width[i]) && right > x[i]) &&
+            (rec.y < (y[i] + height[i]) && bottom > y[i])) mask |= 1ULL << i;
+    }
+
+    return mask;
+}
+
 // Check collision between two circles
 bool CheckCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2)
 {
@@ -1780,10 +2103,205 @@ Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2)
     return overlap;
 }
 
+// Get the contact between two rectangles: the normal to move rec1 along to separate them and the distance to move it
+// NOTE: Collides exactly when CheckCollisionRecs() does, the normal is along the axis of least penetration.
+// Outputs are left untouched when there is no collision
+bool GetCollisionRecsContact(Rectangle rec1, Rectangle rec2, Vector2 *normal, float *depth)
+{
+    bool collision = false;
+
+    float left = (rec1.x + rec1.width) - rec2.x;    // Distance rec1 has to move left to separate
+    float right = (rec2.x + rec2.width) - rec1.x;   // Distance rec1 has to move right to separate
+    float up = (rec1.y + rec1.height) - rec2.y;     // Distance rec1 has to move up to separate
+    float down = (rec2.y + rec2.height) - rec1.y;   // Distance rec1 has to move down to separate
+
+    if ((left > 0.0f) && (right > 0.0f) && (up > 0.0f) && (down > 0.0f))
+    {
+        float depthX = (left < right)? left : right;
+        float depthY = (up < down)? up : down;
+
+        if (depthX < depthY)
+        {
+            *normal = (Vector2){ (left < right)? -1.0f : 1.0f, 0.0f };
+            *depth = depthX;
+        }
+        else
+        {
+            *normal = (Vector2){ 0.0f, (up < down)? -1.0f : 1.0f };
+            *depth = depthY;
+        }
+
+        collision = true;
+    }
+
+    return collision;
+}
+
+// Get the contact between a circle and a rectangle: the normal to move the circle along to separate them and the distance to move it
+// NOTE: A circle with its center inside the rectangle is pushed out through the nearest side.
+// Outputs are left untouched when there is no collision
+bool GetCollisionCircleRecContact(Vector2 center, float radius, Rectangle rec, Vector2 *normal, float *depth)
+{
+    bool collision = false;
+
+    // Closest point of the rectangle to the circle center
+    float closestX = (center.x < rec.x)? rec.x : ((center.x > (rec.x + rec.width))? (rec.x + rec.width) : center.x);
+    float closestY = (center.y < rec.y)? rec.y : ((center.y > (rec.y + rec.height))? (rec.y + rec.height) : center.y);
+
+    float dx = center.x - closestX;
+    float dy = center.y - closestY;
+    float distanceSq = dx*dx + dy*dy;
+
+    if ((dx == 0.0f) && (dy == 0.0f))
+    {
+        // Center inside the rectangle, leave through the nearest side
+        float left = center.x - rec.x;
+        float right = (rec.x + rec.width) - center.x;
+        float up = center.y - rec.y;
+        float down = (rec.y + rec.height) - center.y;
+
+        float depthX = (left < right)? left : right;
+        float depthY = (up < down)? up : down;
+
+        if (depthX < depthY)
+        {
+            *normal = (Vector2){ (left < right)? -1.0f : 1.0f, 0.0f };
+            *depth = depthX + radius;
+        }
+        else
+        {
+            *normal = (Vector2){ 0.0f, (up < down)? -1.0f : 1.0f };
+            *depth = depthY + radius;
+        }
+
+        collision = true;
+    }
+    else if (distanceSq < (radius*radius))
+    {
+        float distance = sqrtf(distanceSq);
+
+        *normal = (Vector2){ dx/distance, dy/distance };
+        *depth = radius - distance;
+
+        collision = true;
+    }
+
+    return collision;
+}
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
 
+// Get cached unit circle points for a sector, building the table on first use
+// NOTE: Returns NULL if segments count exceeds MAX_CIRCLE_CACHE_SEGMENTS
+static const Vector2 *GetCirclePoints(float startAngle, float endAngle, int segments)
+{
+    if ((segments <= 0) || (segments > MAX_CIRCLE_CACHE_SEGMENTS)) return NULL;
+
+    for (int i = 0; i < circleCacheCount; i++)
+    {
+        if ((circleCache[i].segments == segments) && (circleCache[i].startAngle == startAngle) && (circleCache[i].endAngle == endAngle)) return circleCache[i].points;
+    }
+
+    CircleCacheEntry *entry = &circleCache[circleCacheNext];
+    circleCacheNext = (circleCacheNext + 1)%MAX_CIRCLE_CACHE_ENTRIES;
+    if (circleCacheCount < MAX_CIRCLE_CACHE_ENTRIES) circleCacheCount++;
+
+    float stepLength = (endAngle - startAngle)/(float)segments;
+
+    entry->startAngle = startAngle;
+    entry->endAngle = endAngle;
+    entry->segments = segments;
+
+    for (int i = 0; i <= segments; i++)
+    {
+        float angle = DEG2RAD*(startAngle + stepLength*i);
+        entry->points[i] = (Vector2){ sinf(angle), cosf(angle) };
+    }
+
+    return entry->points;
+}
+
+// Load signed distance shapes shader
+// NOTE: Distance is taken from the texcoords, in units of the shape radius, so one shader draws circles
+// and rounded rectangles alike. Coverage is the distance over its screen derivative.
+// Texcoords arrive remapped from [-2..2] to [0..1] so compact render batches keep them
+static bool LoadShaderSDF(void)
+{
+    if (shaderSDFState != 0) return (shaderSDFState > 0);
+
+#if defined(GRAPHICS_API_OPENGL_21)
+    const char *fsCode =
+        "#version 120                                                   \n"
+        "varying vec2 fragTexCoord;                                     \n"
+        "varying vec4 fragColor;                                        \n"
+        "uniform vec4 colDiffuse;                                       \n"
+        "void main()                                                    \n"
+        "{                                                              \n"
+        "    float d = length(fragTexCoord*4.0 - 2.0) - 1.0;            \n"
+        "    float alpha = clamp(0.5 - d/max(fwidth(d), 1e-4), 0.0, 1.0);   \n"
+        "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;  \n"
+        "}                                                              \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    const char *fsCode =
+        "#version 330                                                   \n"
+        "in vec2 fragTexCoord;                                          \n"
+        "in vec4 fragColor;                                             \n"
+        "out vec4 finalColor;                                           \n"
+        "uniform vec4 colDiffuse;                                       \n"
+        "void main()                                                    \n"
+        "{                                                              \n"
+        "    float d = length(fragTexCoord*4.0 - 2.0) - 1.0;            \n"
+        "    float alpha = clamp(0.5 - d/max(fwidth(d), 1e-4), 0.0, 1.0);   \n"
+        "    finalColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;    \n"
+        "}                                                              \n";
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    const char *fsCode =
+        "#version 100                                                   \n"
+        "#extension GL_OES_standard_derivatives : enable                \n"
+        "precision mediump float;                                       \n"
+        "varying vec2 fragTexCoord;                                     \n"
+        "varying vec4 fragColor;                                        \n"
+        "uniform vec4 colDiffuse;                                       \n"
+        "void main()                                                    \n"
+        "{                                                              \n"
+        "    float d = length(fragTexCoord*4.0 - 2.0) - 1.0;            \n"
+        "    float alpha = clamp(0.5 - d/max(fwidth(d), 1e-4), 0.0, 1.0);   \n"
+        "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;  \n"
+        "}                                                              \n";
+#else
+    const char *fsCode = NULL;      // OpenGL 1.1 has no shaders, tessellated shapes are used instead
+#endif
+
+    if (fsCode != NULL) shaderSDF = LoadShaderFromMemory(NULL, fsCode);
+
+    // NOTE: On failure raylib hands back the default shader, not an error
+    shaderSDFState = ((shaderSDF.id > 0) && (shaderSDF.id != rlGetShaderIdDefault()))? 1 : -1;
+    if (shaderSDFState < 0) TraceLog(LOG_WARNING, "SHAPES: SDF shader not available, using tessellated shapes");
+
+    return (shaderSDFState > 0);
+}
+
+// Add one quad with distance coordinates, must be inside rlBegin(RL_QUADS)
+// NOTE: Distance coordinates are within [-2..2] (radius is at least 1 pixel), they are remapped to [0..1]
+static void DrawQuadSDF(float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1)
+{
+    u0 = (u0 + 2.0f)*0.25f;
+    v0 = (v0 + 2.0f)*0.25f;
+    u1 = (u1 + 2.0f)*0.25f;
+    v1 = (v1 + 2.0f)*0.25f;
+
+    rlTexCoord2f(u0, v0);
+    rlVertex2f(x0, y0);
+    rlTexCoord2f(u0, v1);
+    rlVertex2f(x0, y1);
+    rlTexCoord2f(u1, v1);
+    rlVertex2f(x1, y1);
+    rlTexCoord2f(u1, v0);
+    rlVertex2f(x1, y0);
+}
+
 // Cubic easing in-out
 // NOTE: Used by DrawLineBezier() only
 static float EaseCubicInOut(float t, float b, float c, float d)
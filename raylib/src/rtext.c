@@ -47,6 +47,7 @@
 *
 **********************************************************************************************/
 
+#define RL_MEMORY_TAG MEMORY_TAG_TEXT    // Font and layout data allocated here is accounted to text
 #include "raylib.h"         // Declares module functions
 
 // Check if config flags have been externally provided on compilation line
@@ -57,18 +58,22 @@
 #if defined(SUPPORT_MODULE_RTEXT)
 
 #include "utils.h"          // Required for: LoadFile*()
-#include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2 -> Only DrawTextPro()
+#include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2 -> DrawTextPro(), default font setup
 
 #include <stdlib.h>         // Required for: malloc(), free()
 #include <stdio.h>          // Required for: vsprintf()
 #include <string.h>         // Required for: strcmp(), strstr(), strcpy(), strncpy() [Used in TextReplace()], sscanf() [Used in LoadBMFont()]
 #include <stdarg.h>         // Required for: va_list, va_start(), vsprintf(), va_end() [Used in TextFormat()]
 #include <ctype.h>          // Required for: toupper(), tolower() [Used in TextToUpper(), TextToLower()]
+#include <math.h>           // Required for: fminf(), fmaxf(), floorf(), sqrtf() [Used in LoadTextLayout(), LoadFontSDF()]
 
 #if defined(SUPPORT_FILEFORMAT_TTF)
     #define STB_RECT_PACK_IMPLEMENTATION
     #include "external/stb_rect_pack.h"     // Required for: ttf font rectangles packaging
 
+    #define STBTT_malloc(x,u)  ((void)(u), RL_MALLOC(x))
+    #define STBTT_free(x,u)    ((void)(u), RL_FREE(x))
+
     #define STBTT_STATIC
     #define STB_TRUETYPE_IMPLEMENTATION
     #include "external/stb_truetype.h"      // Required for: ttf font data reading
@@ -87,21 +92,36 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef GLYPH_LOOKUP_DIRECT_SIZE
+    #define GLYPH_LOOKUP_DIRECT_SIZE          0x0250        // Codepoints mapped directly to glyph index: ASCII, Latin-1, Latin Extended-A/B
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Glyph index lookup table, makes GetGlyphIndex() constant-time
+// NOTE: Codepoints out of the direct range go to an open addressing hash table (linear probing)
+struct rGlyphLookup {
+    int fallback;                           // Glyph index returned for codepoints not in font ('?' if available)
+    int direct[GLYPH_LOOKUP_DIRECT_SIZE];   // Glyph index by codepoint, -1 if not available
+    unsigned int hashMask;                  // Hash table size minus one (size is a power of two)
+    int *hashCodepoints;                    // Hash table codepoints, -1 for empty slots
+    int *hashIndices;                       // Hash table glyph indices
+};
 
 //----------------------------------------------------------------------------------
 // Global variables
 //----------------------------------------------------------------------------------
 #if defined(SUPPORT_DEFAULT_FONT)
 // Default font provided by raylib
-// NOTE: Default font is loaded on InitWindow() and disposed on CloseWindow() [module: core]
+// NOTE: Default font is loaded on first GetFontDefault() and disposed on CloseWindow() [module: core],
+// programs that never draw with it don't pay for unpacking and uploading it
 static Font defaultFont = { 0 };
 #endif
 
+static Shader shaderTextSDF = { 0 };                    // Signed distance field text shader, loaded on first use
+static int shaderTextSDFState = 0;                      // Shader state: 0 - not loaded, 1 - loaded, -1 - not supported
+
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
@@ -113,6 +133,9 @@ static Font defaultFont = { 0 };
 #if defined(SUPPORT_FILEFORMAT_FNT)
 static Font LoadBMFont(const char *fileName);     // Load a BMFont file (AngelCode font file)
 #endif
+static rGlyphLookup *LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount);  // Load glyph index lookup table
+static void UnloadGlyphLookup(rGlyphLookup *lookup);                            // Unload glyph index lookup table
+static bool LoadShaderTextSDF(void);                                            // Load signed distance field text shader, false if not supported
 
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
@@ -125,10 +148,13 @@ extern void UnloadFontDefault(void);
 #if defined(SUPPORT_DEFAULT_FONT)
 
 // Load raylib default font
+// NOTE: Called by GetFontDefault() the first time it is needed, requires the window (GL context)
 extern void LoadFontDefault(void)
 {
     #define BIT_CHECK(a,b) ((a) & (1u << (b)))
 
+    unsigned int previousTextureId = defaultFont.texture.id;    // Context re-creation loads it again
+
     // NOTE: Using UTF-8 encoding table for Unicode U+0000..U+00FF Basic Latin + Latin-1 Supplement
     // Ref: http://www.utf8-chartable.de/unicode-utf8-table.pl
 
@@ -269,17 +295,43 @@ extern void LoadFontDefault(void)
     UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.lookup = LoadGlyphLookup(defaultFont.glyphs, defaultFont.glyphCount);
+
+    if (IsWindowState(FLAG_WINDOW_HIGHDPI))
+    {
+        // Set default font texture filter for HighDPI (blurry)
+        // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+        rlTextureParameters(defaultFont.texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+        rlTextureParameters(defaultFont.texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+    }
+
+#if defined(SUPPORT_MODULE_RSHAPES)
+    // Shapes move from the rlgl default texture to the font's solid glyph, so shapes and text batch
+    // together, unless a shapes texture has been set by the user
+    // NOTE: We set up a 1px padding on char rectangle to avoid pixel bleeding on MSAA filtering
+    unsigned int shapesTextureId = GetShapesTexture().id;
+    if ((shapesTextureId == rlGetTextureIdDefault()) || (shapesTextureId == previousTextureId))
+    {
+        Rectangle rec = defaultFont.recs[95];
+        SetShapesTexture(defaultFont.texture, (Rectangle){ rec.x + 1, rec.y + 1, rec.width - 2, rec.height - 2 });
+    }
+#endif
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
+    TraceStartupPhase("default font");
 }
 
 // Unload raylib default font
 extern void UnloadFontDefault(void)
 {
+    if (defaultFont.glyphs == NULL) return;     // Never loaded
+
     for (int i = 0; i < defaultFont.glyphCount; i++) UnloadImage(defaultFont.glyphs[i].image);
     UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    UnloadGlyphLookup(defaultFont.lookup);
+    defaultFont = (Font){ 0 };
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
@@ -287,6 +339,7 @@ extern void UnloadFontDefault(void)
 Font GetFontDefault()
 {
 #if defined(SUPPORT_DEFAULT_FONT)
+    if ((defaultFont.glyphs == NULL) && IsWindowReady()) LoadFontDefault();
     return defaultFont;
 #else
     Font font = { 0 };
@@ -348,16 +401,14 @@ Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int glyphCou
 {
     Font font = { 0 };
 
-    // Loading file to memory
-    unsigned int fileSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &fileSize);
+    // Loading font from the file view, glyphs are rasterized before it is unloaded
+    FileView view = LoadFileView(fileName);
 
-    if (fileData != NULL)
+    if (view.data != NULL)
     {
-        // Loading font from memory data
-        font = LoadFontFromMemory(GetFileExtension(fileName), fileData, fileSize, fontSize, fontChars, glyphCount);
+        font = LoadFontFromMemory(GetFileExtension(fileName), view.data, view.size, fontSize, fontChars, glyphCount);
 
-        UnloadFileData(fileData);
+        UnloadFileView(view);
     }
     else font = GetFontDefault();
 
@@ -485,6 +536,7 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
     UnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.lookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
 
     return font;
 }
@@ -522,6 +574,8 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 
             UnloadImage(atlas);
 
+            font.lookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
             TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
         }
         else font = GetFontDefault();
@@ -546,6 +600,136 @@ bool IsFontReady(Font font)
     // match glyphCount and to verify that data contained is valid (glyphs values, metrics...)
 }
 
+// Load signed distance field font from a bitmap font
+// NOTE: Glyphs are upscaled by scale and padded by spread pixels, distances are measured to the edges
+// of the bitmap pixels, so one atlas draws sharp between BeginTextSDF()/EndTextSDF() at any size.
+// Requires glyph images, like the default font and fonts loaded from images keep
+Font LoadFontSDF(Font font, int scale, int spread)
+{
+    Font sdf = { 0 };
+
+    if ((font.glyphs == NULL) || (font.glyphCount <= 0) || (scale < 1) || (spread < 1))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Provided font not valid for SDF generation");
+        return sdf;
+    }
+
+    sdf.baseSize = font.baseSize*scale;
+    sdf.glyphCount = font.glyphCount;
+    sdf.glyphPadding = 0;           // NOTE: Spread is part of every glyph, offsets account for it
+    sdf.glyphs = (GlyphInfo *)RL_CALLOC(sdf.glyphCount, sizeof(GlyphInfo));
+    sdf.recs = (Rectangle *)RL_CALLOC(sdf.glyphCount, sizeof(Rectangle));
+
+    // Pack glyphs in rows, growing the power-of-two atlas until all of them fit
+    int atlasWidth = 64;
+    int atlasHeight = 64;
+
+    for (bool packed = false; !packed;)
+    {
+        int offsetX = 0;
+        int offsetY = 0;
+        int rowHeight = 0;
+        packed = true;
+
+        for (int i = 0; i < sdf.glyphCount; i++)
+        {
+            int width = font.glyphs[i].image.width*scale + 2*spread;
+            int height = font.glyphs[i].image.height*scale + 2*spread;
+
+            if (offsetX + width > atlasWidth)
+            {
+                offsetX = 0;
+                offsetY += rowHeight;
+                rowHeight = 0;
+            }
+
+            if ((width > atlasWidth) || (offsetY + height > atlasHeight))
+            {
+                if (atlasWidth <= atlasHeight) atlasWidth *= 2;
+                else atlasHeight *= 2;
+
+                packed = false;
+                break;
+            }
+
+            sdf.recs[i] = (Rectangle){ (float)offsetX, (float)offsetY, (float)width, (float)height };
+            offsetX += width;
+            if (height > rowHeight) rowHeight = height;
+        }
+    }
+
+    // NOTE: Single channel, the shader reads distance from red on every OpenGL version
+    Image atlas = {
+        .data = RL_CALLOC(atlasWidth*atlasHeight, 1),
+        .width = atlasWidth,
+        .height = atlasHeight,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+    };
+
+    int radius = spread/scale + 1;      // Bitmap pixels around a texel that can be within spread
+
+    for (int i = 0; i < sdf.glyphCount; i++)
+    {
+        Image image = font.glyphs[i].image;
+        Color *pixels = LoadImageColors(image);
+        Rectangle rec = sdf.recs[i];
+
+        for (int y = 0; y < (int)rec.height; y++)
+        {
+            for (int x = 0; x < (int)rec.width; x++)
+            {
+                // Texel center in bitmap pixels
+                float px = (x + 0.5f - spread)/scale;
+                float py = (y + 0.5f - spread)/scale;
+                int cx = (int)floorf(px);
+                int cy = (int)floorf(py);
+                bool inside = (pixels != NULL) && (cx >= 0) && (cy >= 0) && (cx < image.width) && (cy < image.height) && (pixels[cy*image.width + cx].a >= 128);
+
+                float nearest = (float)spread;
+
+                for (int sy = cy - radius; sy <= cy + radius; sy++)
+                {
+                    for (int sx = cx - radius; sx <= cx + radius; sx++)
+                    {
+                        bool set = (pixels != NULL) && (sx >= 0) && (sy >= 0) && (sx < image.width) && (sy < image.height) && (pixels[sy*image.width + sx].a >= 128);
+                        if (set == inside) continue;
+
+                        // Distance to the pixel square, in atlas texels
+                        float dx = fmaxf(fmaxf(sx - px, px - (sx + 1)), 0.0f);
+                        float dy = fmaxf(fmaxf(sy - py, py - (sy + 1)), 0.0f);
+                        float distance = sqrtf(dx*dx + dy*dy)*scale;
+                        if (distance < nearest) nearest = distance;
+                    }
+                }
+
+                // Edge maps to 128, spread texels inside to 255, spread texels outside to 0
+                float value = 128.0f + (inside? nearest : -nearest)*127.0f/spread;
+                ((unsigned char *)atlas.data)[((int)rec.y + y)*atlasWidth + (int)rec.x + x] = (unsigned char)fminf(fmaxf(value, 0.0f), 255.0f);
+            }
+        }
+
+        UnloadImageColors(pixels);
+
+        sdf.glyphs[i].value = font.glyphs[i].value;
+        sdf.glyphs[i].offsetX = font.glyphs[i].offsetX*scale - spread;
+        sdf.glyphs[i].offsetY = font.glyphs[i].offsetY*scale - spread;
+        // NOTE: Advance falls back to glyph width when zero, the padded width would space glyphs apart
+        sdf.glyphs[i].advanceX = ((font.glyphs[i].advanceX != 0)? font.glyphs[i].advanceX : image.width)*scale;
+        sdf.glyphs[i].image = ImageFromImage(atlas, rec);
+    }
+
+    sdf.texture = LoadTextureFromImage(atlas);
+    SetTextureFilter(sdf.texture, TEXTURE_FILTER_BILINEAR);     // Distance is interpolated between texels
+    UnloadImage(atlas);
+
+    sdf.lookup = LoadGlyphLookup(sdf.glyphs, sdf.glyphCount);
+
+    TRACELOG(LOG_INFO, "FONT: SDF font generated successfully (%i pixel size | %i glyphs | %ix%i atlas)", sdf.baseSize, sdf.glyphCount, atlasWidth, atlasHeight);
+
+    return sdf;
+}
+
 // Load font data for further use
 // NOTE: Requires TTF font memory data and can generate SDF data
 GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount, int type)
@@ -858,6 +1042,7 @@ void UnloadFont(Font font)
         UnloadFontData(font.glyphs, font.glyphCount);
         UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        UnloadGlyphLookup(font.lookup);
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
@@ -970,6 +1155,8 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
     Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
                          font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
 
+    if (rlCheckCullRect(dstRec.x, dstRec.y, dstRec.width, dstRec.height)) return;
+
     // Draw the character texture on the screen
     DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
 }
@@ -1006,6 +1193,133 @@ void DrawTextCodepoints(Font font, const int *codepoints, int count, Vector2 pos
     }
 }
 
+// Load text layout, glyph quads built once for repeated drawing
+// NOTE: Same placement as DrawTextEx(), the font must outlive the layout
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing)
+{
+    TextLayout layout = { 0 };
+
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+    if ((font.texture.id == 0) || (text == NULL)) return layout;
+
+    int size = TextLength(text);
+    int codepointCount = GetCodepointCount(text);
+
+    layout.textureId = font.texture.id;
+    layout.quads = (Rectangle *)RL_CALLOC(codepointCount, sizeof(Rectangle));
+    layout.texcoords = (Rectangle *)RL_CALLOC(codepointCount, sizeof(Rectangle));
+
+    int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
+
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+
+    for (int i = 0; i < size;)
+    {
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
+
+        if (codepoint == '\n')
+        {
+            textOffsetY += (int)((font.baseSize + font.baseSize/2.0f)*scaleFactor);
+            textOffsetX = 0.0f;
+        }
+        else
+        {
+            if ((codepoint != ' ') && (codepoint != '\t'))
+            {
+                // NOTE: We consider glyphPadding, like DrawTextCodepoint()
+                Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
+                                     font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
+
+                layout.quads[layout.quadCount] = (Rectangle){ textOffsetX + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                                                              textOffsetY + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                                                              srcRec.width*scaleFactor, srcRec.height*scaleFactor };
+                layout.texcoords[layout.quadCount] = (Rectangle){ srcRec.x/font.texture.width, srcRec.y/font.texture.height,
+                                                                  srcRec.width/font.texture.width, srcRec.height/font.texture.height };
+
+                Rectangle quad = layout.quads[layout.quadCount];
+                if (layout.quadCount == 0) layout.bounds = quad;
+                else
+                {
+                    float maxX = fmaxf(layout.bounds.x + layout.bounds.width, quad.x + quad.width);
+                    float maxY = fmaxf(layout.bounds.y + layout.bounds.height, quad.y + quad.height);
+                    layout.bounds.x = fminf(layout.bounds.x, quad.x);
+                    layout.bounds.y = fminf(layout.bounds.y, quad.y);
+                    layout.bounds.width = maxX - layout.bounds.x;
+                    layout.bounds.height = maxY - layout.bounds.y;
+                }
+
+                layout.quadCount++;
+            }
+
+            if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+            else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+        }
+
+        i += codepointByteCount;   // Move text bytes counter to next codepoint
+    }
+
+    return layout;
+}
+
+// Unload text layout data
+void UnloadTextLayout(TextLayout layout)
+{
+    RL_FREE(layout.quads);
+    RL_FREE(layout.texcoords);
+}
+
+// Draw text layout, no codepoint decoding or glyph lookup
+void DrawTextLayout(TextLayout layout, Vector2 position, Color tint)
+{
+    if (layout.quadCount == 0) return;
+    if (rlCheckCullRect(position.x + layout.bounds.x, position.y + layout.bounds.y, layout.bounds.width, layout.bounds.height)) return;
+
+    rlSetTexture(layout.textureId);
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+        for (int i = 0; i < layout.quadCount; i++)
+        {
+            Rectangle quad = layout.quads[i];
+            Rectangle uv = layout.texcoords[i];
+            float x = position.x + quad.x;
+            float y = position.y + quad.y;
+
+            // NOTE: Batch limits are checked on every vertex, quads are never split
+            rlTexCoord2f(uv.x, uv.y);
+            rlVertex2f(x, y);
+            rlTexCoord2f(uv.x, uv.y + uv.height);
+            rlVertex2f(x, y + quad.height);
+            rlTexCoord2f(uv.x + uv.width, uv.y + uv.height);
+            rlVertex2f(x + quad.width, y + quad.height);
+            rlTexCoord2f(uv.x + uv.width, uv.y);
+            rlVertex2f(x + quad.width, y);
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
+// Begin signed distance field text mode
+// NOTE: Text drawn with a font from LoadFontSDF() is thresholded at the glyph edge with antialiasing
+// taken from the screen derivative. The shader switch flushes the batch, consecutive text between
+// Begin/End shares one draw call
+void BeginTextSDF(void)
+{
+    if (LoadShaderTextSDF()) BeginShaderMode(shaderTextSDF);
+}
+
+// End signed distance field text mode (returns to default shader)
+void EndTextSDF(void)
+{
+    if (shaderTextSDFState > 0) EndShaderMode();
+}
+
 // Measure string width for default font
 int MeasureText(const char *text, int fontSize)
 {
@@ -1084,6 +1398,32 @@ int GetGlyphIndex(Font font, int codepoint)
 {
     int index = 0;
 
+    // Fonts loaded by raylib come with a lookup table, no search required
+    if (font.lookup != NULL)
+    {
+        const rGlyphLookup *lookup = font.lookup;
+
+        index = lookup->fallback;
+
+        if ((codepoint >= 0) && (codepoint < GLYPH_LOOKUP_DIRECT_SIZE))
+        {
+            if (lookup->direct[codepoint] >= 0) index = lookup->direct[codepoint];
+        }
+        else if (lookup->hashCodepoints != NULL)
+        {
+            for (unsigned int slot = ((unsigned int)codepoint*2654435761u >> 15) & lookup->hashMask; lookup->hashCodepoints[slot] != -1; slot = (slot + 1) & lookup->hashMask)
+            {
+                if (lookup->hashCodepoints[slot] == codepoint)
+                {
+                    index = lookup->hashIndices[slot];
+                    break;
+                }
+            }
+        }
+
+        return index;
+    }
+
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
     int fallbackIndex = 0;      // Get index of fallback glyph '?'
@@ -1158,6 +1498,28 @@ const char *TextFormat(const char *text, ...)
     static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
     static int index = 0;
 
+    // NOTE: While drawing, strings come from the frame arena sized to fit, so any number of them
+    // stay valid until the next BeginDrawing() instead of only the last MAX_TEXTFORMAT_BUFFERS
+    if (IsFrameMemoryOpen())
+    {
+        va_list args;
+        va_start(args, text);
+        int length = vsnprintf(NULL, 0, text, args);
+        va_end(args);
+
+        if (length > MAX_TEXT_BUFFER_LENGTH - 1) length = MAX_TEXT_BUFFER_LENGTH - 1;
+
+        char *frameBuffer = (length >= 0)? (char *)MemAllocFrame(length + 1) : NULL;
+        if (frameBuffer != NULL)
+        {
+            va_start(args, text);
+            vsnprintf(frameBuffer, length + 1, text, args);
+            va_end(args);
+
+            return frameBuffer;
+        }
+    }
+
     char *currentBuffer = buffers[index];
     memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
 
@@ -1933,6 +2295,8 @@ static Font LoadBMFont(const char *fileName)
     UnloadImage(imFont);
     UnloadFileText(fileText);
 
+    font.lookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
     if (font.texture.id == 0)
     {
         UnloadFont(font);
@@ -1945,4 +2309,136 @@ static Font LoadBMFont(const char *fileName)
 }
 #endif
 
+// Load glyph index lookup table
+// NOTE: On duplicated codepoints the first glyph is kept, like the linear search does
+static rGlyphLookup *LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount)
+{
+    if ((glyphs == NULL) || (glyphCount <= 0)) return NULL;
+
+    rGlyphLookup *lookup = (rGlyphLookup *)RL_CALLOC(1, sizeof(rGlyphLookup));
+
+    for (int i = 0; i < GLYPH_LOOKUP_DIRECT_SIZE; i++) lookup->direct[i] = -1;
+
+    int hashCount = 0;
+    for (int i = 0; i < glyphCount; i++)
+    {
+        if ((glyphs[i].value < 0) || (glyphs[i].value >= GLYPH_LOOKUP_DIRECT_SIZE)) hashCount++;
+        else if (lookup->direct[glyphs[i].value] == -1) lookup->direct[glyphs[i].value] = i;
+    }
+
+    if (lookup->direct[63] != -1) lookup->fallback = lookup->direct[63];     // Fallback glyph '?'
+
+    if (hashCount > 0)
+    {
+        // Keep the table at most half full so probe sequences stay short
+        unsigned int size = 16;
+        while (size < 2*(unsigned int)hashCount) size *= 2;
+
+        lookup->hashMask = size - 1;
+        lookup->hashCodepoints = (int *)RL_MALLOC(size*sizeof(int));
+        lookup->hashIndices = (int *)RL_MALLOC(size*sizeof(int));
+
+        for (unsigned int i = 0; i < size; i++) lookup->hashCodepoints[i] = -1;
+
+        for (int i = 0; i < glyphCount; i++)
+        {
+            int codepoint = glyphs[i].value;
+            if ((codepoint >= 0) && (codepoint < GLYPH_LOOKUP_DIRECT_SIZE)) continue;
+
+            unsigned int slot = ((unsigned int)codepoint*2654435761u >> 15) & lookup->hashMask;
+            while ((lookup->hashCodepoints[slot] != -1) && (lookup->hashCodepoints[slot] != codepoint)) slot = (slot + 1) & lookup->hashMask;
+
+            if (lookup->hashCodepoints[slot] == -1)
+            {
+                lookup->hashCodepoints[slot] = codepoint;
+                lookup->hashIndices[slot] = i;
+            }
+        }
+    }
+
+    return lookup;
+}
+
+// Unload glyph index lookup table
+static void UnloadGlyphLookup(rGlyphLookup *lookup)
+{
+    if (lookup == NULL) return;
+
+    RL_FREE(lookup->hashCodepoints);
+    RL_FREE(lookup->hashIndices);
+    RL_FREE(lookup);
+}
+
+// Load signed distance field text shader
+// NOTE: Distance is read from the red channel, 0.5 on the glyph edge. Coverage is the distance over
+// its screen derivative, so edges stay one pixel wide whether glyphs are magnified or minified
+static bool LoadShaderTextSDF(void)
+{
+    if (shaderTextSDFState != 0) return (shaderTextSDFState > 0);
+
+#if defined(GRAPHICS_API_OPENGL_21)
+    const char *fsCode =
+        "#version 120                                                   \n"
+        "varying vec2 fragTexCoord;                                     \n"
+        "varying vec4 fragColor;                                        \n"
+        "uniform sampler2D texture0;                                    \n"
+        "uniform vec4 colDiffuse;                                       \n"
+        "void main()                                                    \n"
+        "{                                                              \n"
+        "    float d = texture2D(texture0, fragTexCoord).r - 0.5;       \n"
+        "    float alpha = clamp(0.5 + d/max(fwidth(d), 1e-4), 0.0, 1.0);  \n"
+        "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;  \n"
+        "}                                                              \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    const char *fsCode =
+        "#version 330                                                   \n"
+        "in vec2 fragTexCoord;                                          \n"
+        "in vec4 fragColor;                                             \n"
+        "out vec4 finalColor;                                           \n"
+        "uniform sampler2D texture0;                                    \n"
+        "uniform vec4 colDiffuse;                                       \n"
+        "void main()                                                    \n"
+        "{                                                              \n"
+        "    float d = texture(texture0, fragTexCoord).r - 0.5;         \n"
+        "    float alpha = clamp(0.5 + d/max(fwidth(d), 1e-4), 0.0, 1.0);  \n"
+        "    finalColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;    \n"
+        "}                                                              \n";
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    const char *fsCode =
+        "#version 100                                                   \n"
+        "#extension GL_OES_standard_derivatives : enable                \n"
+        "precision mediump float;                                       \n"
+        "varying vec2 fragTexCoord;                                     \n"
+        "varying vec4 fragColor;                                        \n"
+        "uniform sampler2D texture0;                                    \n"
+        "uniform vec4 colDiffuse;                                       \n"
+        "void main()                                                    \n"
+        "{                                                              \n"
+        "    float d = texture2D(texture0, fragTexCoord).r - 0.5;       \n"
+        "    float alpha = clamp(0.5 + d/max(fwidth(d), 1e-4), 0.0, 1.0);  \n"
+        "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;  \n"
+        "}                                                              \n";
+#else
+    const char *fsCode = NULL;      // OpenGL 1.1 has no shaders, SDF text is drawn as is
+#endif
+
+    if (fsCode != NULL) shaderTextSDF = LoadShaderFromMemory(NULL, fsCode);
+
+    // NOTE: On failure raylib hands back the default shader, not an error
+    shaderTextSDFState = ((shaderTextSDF.id > 0) && (shaderTextSDF.id != rlGetShaderIdDefault()))? 1 : -1;
+    if (shaderTextSDFState < 0) TRACELOG(LOG_WARNING, "FONT: SDF text shader not available");
+
+    return (shaderTextSDFState > 0);
+}
+
+// Unload signed distance field text shader
+// NOTE: Called on CloseWindow(), the shader is loaded again on next use
+void UnloadTextSDF(void)
+{
+    if (shaderTextSDFState > 0) UnloadShader(shaderTextSDF);
+
+    shaderTextSDF = (Shader){ 0 };
+    shaderTextSDFState = 0;
+}
+
 #endif      // SUPPORT_MODULE_RTEXT
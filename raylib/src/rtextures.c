@@ -38,6 +38,7 @@
 *
 **********************************************************************************************/
 
+#define RL_MEMORY_TAG MEMORY_TAG_TEXTURES    // Image data allocated here is accounted to textures
 #include "raylib.h"             // Declares module functions
 
 // Check if config flags have been externally provided on compilation line
@@ -55,6 +56,15 @@
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
 
+// NOTE: SSE2 is part of every x86-64 target, so no runtime check is needed for it
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>      // Required for: ImageDraw() and image fills SSE2 path
+    #define RTEXTURES_SUPPORT_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>       // Required for: ImageDraw() and image fills NEON path
+    #define RTEXTURES_SUPPORT_NEON
+#endif
+
 // Support only desired texture formats on stb_image
 #define STBI_NO_BMP
 #if !defined(SUPPORT_FILEFORMAT_PNG)
@@ -121,6 +131,9 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static void FillPixelsFromFirst(unsigned char *pixels, int count, int bytesPerPixel);   // Repeat the first pixel over count pixels
+static void FillPixelsR8G8B8A8(unsigned char *pixels, int count, Color color);  // Fill count RGBA8 pixels with a color
+static void BlendPixelsR8G8B8A8(unsigned char *dst, const unsigned char *src, int count, Color tint);   // ColorAlphaBlend() count RGBA8 pixels over RGBA8 pixels
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -137,14 +150,12 @@ Image LoadImage(const char *fileName)
     #define STBI_REQUIRED
 #endif
 
-    // Loading file to memory
-    unsigned int fileSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &fileSize);
+    // Decoding straight from the file view, no copy of the encoded data
+    FileView view = LoadFileView(fileName);
 
-    // Loading image from memory data
-    if (fileData != NULL) image = LoadImageFromMemory(GetFileExtension(fileName), fileData, fileSize);
+    if (view.data != NULL) image = LoadImageFromMemory(GetFileExtension(fileName), view.data, view.size);
 
-    RL_FREE(fileData);
+    UnloadFileView(view);
 
     return image;
 }
@@ -154,24 +165,28 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
 {
     Image image = { 0 };
 
-    unsigned int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    FileView view = LoadFileView(fileName);
 
-    if (fileData != NULL)
+    if (view.data != NULL)
     {
-        unsigned char *dataPtr = fileData;
+        const unsigned char *dataPtr = view.data;
         unsigned int size = GetPixelDataSize(width, height, format);
 
         if (headerSize > 0) dataPtr += headerSize;
 
-        image.data = RL_MALLOC(size);      // Allocate required memory in bytes
-        memcpy(image.data, dataPtr, size); // Copy required data to image
-        image.width = width;
-        image.height = height;
-        image.mipmaps = 1;
-        image.format = format;
+        // NOTE: Reading past a mapped file faults, so short files are rejected
+        if ((headerSize >= 0) && ((unsigned int)headerSize + size <= view.size))
+        {
+            image.data = RL_MALLOC(size);      // Allocate required memory in bytes
+            memcpy(image.data, dataPtr, size); // Copy required data to image
+            image.width = width;
+            image.height = height;
+            image.mipmaps = 1;
+            image.format = format;
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: [%s] RAW file is smaller than the image", fileName);
 
-        RL_FREE(fileData);
+        UnloadFileView(view);
     }
 
     return image;
@@ -1208,23 +1223,182 @@ Color GetImageColor(Image image, int x, int y)
 //------------------------------------------------------------------------------------
 // Image drawing functions
 //------------------------------------------------------------------------------------
+// Repeat the first pixel over count pixels
+// NOTE: Each copy doubles the filled part, a fill is a few memcpy() calls instead of one per pixel
+static void FillPixelsFromFirst(unsigned char *pixels, int count, int bytesPerPixel)
+{
+    int filled = 1;
+
+    while (filled < count)
+    {
+        int copy = (filled < (count - filled))? filled : (count - filled);
+        memcpy(pixels + filled*bytesPerPixel, pixels, copy*bytesPerPixel);
+        filled += copy;
+    }
+}
+
+// Fill RGBA8 pixels with a color, 16 bytes per store where vectorized
+static void FillPixelsR8G8B8A8(unsigned char *pixels, int count, Color color)
+{
+    unsigned int value = 0;
+    memcpy(&value, &color, 4);      // Color is laid out as RGBA8 pixels are
+    int i = 0;
+
+#if defined(RTEXTURES_SUPPORT_SSE2)
+    __m128i fill = _mm_set1_epi32((int)value);
+    for (; (i + 4) <= count; i += 4) _mm_storeu_si128((__m128i *)(pixels + i*4), fill);
+#elif defined(RTEXTURES_SUPPORT_NEON)
+    uint32x4_t fill = vdupq_n_u32(value);
+    for (; (i + 4) <= count; i += 4) vst1q_u8(pixels + i*4, vreinterpretq_u8_u32(fill));
+#endif
+
+    for (; i < count; i++) memcpy(pixels + i*4, &value, 4);
+}
+
+// Blend RGBA8 pixels over RGBA8 pixels, same results as ColorAlphaBlend() on every pixel
+// NOTE: Vectorized groups of 4 pixels need an opaque destination, ColorAlphaBlend() then reduces to
+// floor((src*alpha*256 + dst*255*(256 - alpha))/65280) with alpha = src.a + 1, which is computed exactly as
+// M = src*alpha + P - ceil(P/256) with P = dst*(256 - alpha), then floor(M/255) with shifts and adds (M < 2^17).
+// Groups with any translucent destination pixel, and the pixels left over, go through ColorAlphaBlend()
+static void BlendPixelsR8G8B8A8(unsigned char *dst, const unsigned char *src, int count, Color tint)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_SUPPORT_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i channelMax = _mm_set1_epi16(255);
+    const __m128i alphaMask = _mm_set1_epi32((int)0xff000000);
+    const __m128i tint16 = _mm_setr_epi16(tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1, tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i*4));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(d, alphaMask), alphaMask)) != 0xffff)
+        {
+            for (int k = i; k < (i + 4); k++) *(Color *)(dst + k*4) = ColorAlphaBlend(*(Color *)(dst + k*4), *(const Color *)(src + k*4), tint);
+            continue;
+        }
+
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i*4));
+        __m128i out[2];
+        __m128i tinted[2];
+
+        for (int half = 0; half < 2; half++)
+        {
+            __m128i s16 = half? _mm_unpackhi_epi8(s, zero) : _mm_unpacklo_epi8(s, zero);
+            __m128i d16 = half? _mm_unpackhi_epi8(d, zero) : _mm_unpacklo_epi8(d, zero);
+
+            // Tint, then the alpha of each pixel across its four channels
+            s16 = _mm_srli_epi16(_mm_mullo_epi16(s16, tint16), 8);
+            tinted[half] = s16;
+            __m128i alpha = _mm_add_epi16(_mm_shufflehi_epi16(_mm_shufflelo_epi16(s16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3)), one);
+
+            // src*alpha and P fit 16 bits, M needs 17
+            __m128i sa = _mm_mullo_epi16(s16, alpha);
+            __m128i p = _mm_mullo_epi16(d16, _mm_sub_epi16(_mm_add_epi16(channelMax, one), alpha));
+            p = _mm_sub_epi16(p, _mm_srli_epi16(_mm_add_epi16(p, channelMax), 8));
+
+            __m128i q[2];
+            for (int part = 0; part < 2; part++)
+            {
+                __m128i m = _mm_add_epi32(part? _mm_unpackhi_epi16(sa, zero) : _mm_unpacklo_epi16(sa, zero),
+                                          part? _mm_unpackhi_epi16(p, zero) : _mm_unpacklo_epi16(p, zero));
+                __m128i m1 = _mm_add_epi32(m, _mm_set1_epi32(1));
+                q[part] = _mm_srli_epi32(_mm_add_epi32(m1, _mm_srli_epi32(_mm_add_epi32(m1, _mm_srli_epi32(m, 8)), 8)), 8);
+            }
+
+            out[half] = _mm_packs_epi32(q[0], q[1]);
+        }
+
+        __m128i blend = _mm_or_si128(_mm_packus_epi16(out[0], out[1]), alphaMask);
+        __m128i srcTinted = _mm_packus_epi16(tinted[0], tinted[1]);
+
+        // Opaque sources replace the destination, transparent ones leave it
+        __m128i srcAlpha = _mm_and_si128(srcTinted, alphaMask);
+        __m128i opaque = _mm_cmpeq_epi32(srcAlpha, alphaMask);
+        __m128i clear = _mm_cmpeq_epi32(srcAlpha, zero);
+        blend = _mm_or_si128(_mm_and_si128(opaque, srcTinted), _mm_andnot_si128(opaque, blend));
+        blend = _mm_or_si128(_mm_and_si128(clear, d), _mm_andnot_si128(clear, blend));
+
+        _mm_storeu_si128((__m128i *)(dst + i*4), blend);
+    }
+#elif defined(RTEXTURES_SUPPORT_NEON)
+    const uint32x4_t alphaMask = vdupq_n_u32(0xff000000);
+    const uint16_t tintValues[8] = { tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1, tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1 };
+    const uint16x8_t tint16 = vld1q_u16(tintValues);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        uint8x16_t d = vld1q_u8(dst + i*4);
+        uint32x4_t dstAlpha = vandq_u32(vreinterpretq_u32_u8(d), alphaMask);
+        uint16x4_t opaque = vmovn_u32(vceqq_u32(dstAlpha, alphaMask));
+        if (vget_lane_u64(vreinterpret_u64_u16(opaque), 0) != 0xffffffffffffffffULL)
+        {
+            for (int k = i; k < (i + 4); k++) *(Color *)(dst + k*4) = ColorAlphaBlend(*(Color *)(dst + k*4), *(const Color *)(src + k*4), tint);
+            continue;
+        }
+
+        uint8x16_t s = vld1q_u8(src + i*4);
+
+        // Tint, then the alpha of each pixel across its four channels
+        uint8x16_t srcTinted = vcombine_u8(vshrn_n_u16(vmulq_u16(vmovl_u8(vget_low_u8(s)), tint16), 8),
+                                           vshrn_n_u16(vmulq_u16(vmovl_u8(vget_high_u8(s)), tint16), 8));
+        uint8x16_t alpha8 = vreinterpretq_u8_u32(vmulq_n_u32(vshrq_n_u32(vreinterpretq_u32_u8(srcTinted), 24), 0x01010101));
+
+        uint8x8_t blendHalves[2];
+        for (int half = 0; half < 2; half++)
+        {
+            uint8x8_t s8 = half? vget_high_u8(srcTinted) : vget_low_u8(srcTinted);
+            uint8x8_t d8 = half? vget_high_u8(d) : vget_low_u8(d);
+            uint16x8_t alpha = vaddw_u8(vdupq_n_u16(1), half? vget_high_u8(alpha8) : vget_low_u8(alpha8));
+
+            // src*alpha and P fit 16 bits, M needs 17
+            uint16x8_t sa = vmulq_u16(vmovl_u8(s8), alpha);
+            uint16x8_t p = vmulq_u16(vmovl_u8(d8), vsubq_u16(vdupq_n_u16(256), alpha));
+            p = vsubq_u16(p, vshrq_n_u16(vaddq_u16(p, vdupq_n_u16(255)), 8));
+
+            uint32x4_t m0 = vaddl_u16(vget_low_u16(sa), vget_low_u16(p));
+            uint32x4_t m1 = vaddl_u16(vget_high_u16(sa), vget_high_u16(p));
+            uint32x4_t n0 = vaddq_u32(m0, vdupq_n_u32(1));
+            uint32x4_t n1 = vaddq_u32(m1, vdupq_n_u32(1));
+            uint32x4_t q0 = vshrq_n_u32(vaddq_u32(n0, vshrq_n_u32(vaddq_u32(n0, vshrq_n_u32(m0, 8)), 8)), 8);
+            uint32x4_t q1 = vshrq_n_u32(vaddq_u32(n1, vshrq_n_u32(vaddq_u32(n1, vshrq_n_u32(m1, 8)), 8)), 8);
+
+            blendHalves[half] = vqmovn_u16(vcombine_u16(vmovn_u32(q0), vmovn_u32(q1)));
+        }
+
+        uint32x4_t blend = vorrq_u32(vreinterpretq_u32_u8(vcombine_u8(blendHalves[0], blendHalves[1])), alphaMask);
+
+        // Opaque sources replace the destination, transparent ones leave it
+        uint32x4_t srcAlpha = vandq_u32(vreinterpretq_u32_u8(srcTinted), alphaMask);
+        blend = vbslq_u32(vceqq_u32(srcAlpha, alphaMask), vreinterpretq_u32_u8(srcTinted), blend);
+        blend = vbslq_u32(vceqq_u32(srcAlpha, vdupq_n_u32(0)), vreinterpretq_u32_u8(d), blend);
+
+        vst1q_u8(dst + i*4, vreinterpretq_u8_u32(blend));
+    }
+#endif
+
+    for (; i < count; i++) *(Color *)(dst + i*4) = ColorAlphaBlend(*(Color *)(dst + i*4), *(const Color *)(src + i*4), tint);
+}
+
 // Clear image background with given color
 void ImageClearBackground(Image *dst, Color color)
 {
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
 
+    if (dst->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        FillPixelsR8G8B8A8((unsigned char *)dst->data, dst->width*dst->height, color);
+        return;
+    }
+
     // Fill in first pixel based on image format
     ImageDrawPixel(dst, 0, 0, color);
 
-    unsigned char *pSrcPixel = (unsigned char *)dst->data;
-    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
-
     // Repeat the first pixel data throughout the image
-    for (int i = 1; i < dst->width*dst->height; i++)
-    {
-        memcpy(pSrcPixel + i*bytesPerPixel, pSrcPixel, bytesPerPixel);
-    }
+    FillPixelsFromFirst((unsigned char *)dst->data, dst->width*dst->height, GetPixelDataSize(1, 1, dst->format));
 }
 
 // Draw pixel within an image
@@ -1525,33 +1699,31 @@ void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
 
-    // Security check to avoid drawing out of bounds in case of bad user data
-    if (rec.x < 0) { rec.width -= rec.x; rec.x = 0; }
-    if (rec.y < 0) { rec.height -= rec.y; rec.y = 0; }
-    if (rec.width < 0) rec.width = 0;
-    if (rec.height < 0) rec.height = 0;
-
+    int sx = (int)rec.x;
     int sy = (int)rec.y;
-    int ey = sy + (int)rec.height;
+    int width = (int)rec.width;
+    int height = (int)rec.height;
 
-    int sx = (int)rec.x;
+    // Security check to avoid drawing out of bounds in case of bad user data
+    if (sx < 0) { width += sx; sx = 0; }
+    if (sy < 0) { height += sy; sy = 0; }
+    if ((sx + width) > dst->width) width = dst->width - sx;
+    if ((sy + height) > dst->height) height = dst->height - sy;
+    if ((width <= 0) || (height <= 0)) return;
 
     int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    int rowSize = width*bytesPerPixel;
+    unsigned char *pFirstRow = (unsigned char *)dst->data + ((sy*dst->width) + sx)*bytesPerPixel;
 
-    for (int y = sy; y < ey; y++)
+    // Fill in the first pixel based on image format, repeat it throughout the first row and the row over the rest
+    if (dst->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) FillPixelsR8G8B8A8(pFirstRow, width, color);
+    else
     {
-        // Fill in the first pixel of the row based on image format
-        ImageDrawPixel(dst, sx, y, color);
-
-        int bytesOffset = ((y*dst->width) + sx)*bytesPerPixel;
-        unsigned char *pSrcPixel = (unsigned char *)dst->data + bytesOffset;
-
-        // Repeat the first pixel data throughout the row
-        for (int x = 1; x < (int)rec.width; x++)
-        {
-            memcpy(pSrcPixel + x*bytesPerPixel, pSrcPixel, bytesPerPixel);
-        }
+        ImageDrawPixel(dst, sx, sy, color);
+        FillPixelsFromFirst(pFirstRow, width, bytesPerPixel);
     }
+
+    for (int y = 1; y < height; y++) memcpy(pFirstRow + y*dst->width*bytesPerPixel, pFirstRow, rowSize);
 }
 
 // Draw rectangle lines within an image
@@ -1653,6 +1825,11 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
 
             // Fast path: Avoid moving pixel by pixel if no blend required and same format
             if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
+            else if ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (dst->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+            {
+                // Fast path: RGBA8 over RGBA8 needs no format conversions and blends several pixels at once
+                BlendPixelsR8G8B8A8(pDst, pSrc, (int)srcRec.width, tint);
+            }
             else
             {
                 for (int x = 0; x < (int)srcRec.width; x++)
@@ -1882,6 +2059,12 @@ bool IsTextureReady(Texture2D texture)
             (texture.mipmaps > 0));     // Validate texture mipmaps (at least 1 for basic mipmap level)
 }
 
+// Check if a pixel format can be loaded in GPU
+bool IsTextureFormatSupported(int format)
+{
+    return rlIsTextureFormatSupported(format);
+}
+
 // Unload texture from GPU memory (VRAM)
 void UnloadTexture(Texture2D texture)
 {
@@ -2887,6 +3070,16 @@ int GetPixelDataSize(int width, int height, int format)
         else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
     }
 
+    // Block compressed formats are stored as whole blocks, sizes that are not a multiple of the block round up
+    // NOTE: PVRT keeps the minimum above, its block layout is not a fixed grid
+    if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format != PIXELFORMAT_COMPRESSED_PVRT_RGB) && (format != PIXELFORMAT_COMPRESSED_PVRT_RGBA))
+    {
+        int blockSize = (format == PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)? 8 : 4;
+        int blockBytes = ((format == PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
+                          (format == PIXELFORMAT_COMPRESSED_ETC1_RGB) || (format == PIXELFORMAT_COMPRESSED_ETC2_RGB))? 8 : 16;
+        dataSize = ((width + blockSize - 1)/blockSize)*((height + blockSize - 1)/blockSize)*blockBytes;
+    }
+
     return dataSize;
 }
 
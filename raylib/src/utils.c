@@ -7,6 +7,9 @@
 *           Show TraceLog() output messages
 *           NOTE: By default LOG_DEBUG traces not shown
 *
+*       #define SUPPORT_TRACE_ZONES
+*           Record BeginTraceZone()/EndTraceZone() zones for ExportTraceZones()
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -49,12 +52,177 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if defined(_MSC_VER)
+    #include <intrin.h>                 // Required for: _InterlockedExchangeAdd(), _InterlockedCompareExchange()
+#endif
+
+#if defined(SUPPORT_TRACELOG_ASYNC) && (defined(_MSC_VER) || defined(PLATFORM_WEB))
+    #undef SUPPORT_TRACELOG_ASYNC       // No pthreads to write the log on
+#endif
+
+#if defined(SUPPORT_TRACELOG) && defined(SUPPORT_TRACELOG_ASYNC)
+    #include <pthread.h>                // Required for: pthread_create(), pthread_join() [Used in SetTraceLogAsync()]
+    #if defined(_WIN32)
+        void __stdcall Sleep(unsigned long msTimeout);      // Declared here, windows.h symbols collide with raylib ones
+    #else
+        #include <time.h>               // Required for: nanosleep()
+    #endif
+#endif
+
+#if defined(SUPPORT_TRACE_ZONES)
+    #if defined(_WIN32)
+        int __stdcall QueryPerformanceCounter(unsigned long long int *lpPerformanceCount);   // Used in GetTraceClock()
+        int __stdcall QueryPerformanceFrequency(unsigned long long int *lpFrequency);        // Used in GetTraceClock()
+    #else
+        #include <time.h>               // Required for: clock_gettime() [Used in GetTraceClock()]
+    #endif
+#endif
+
+// File views are memory-mapped where the platform allows it, Android assets and the web filesystem
+// go through LoadFileData() instead
+#if defined(SUPPORT_STANDARD_FILEIO) && !defined(PLATFORM_ANDROID) && !defined(PLATFORM_WEB)
+    #define FILE_VIEW_MAPPED
+#endif
+
+#if defined(FILE_VIEW_MAPPED)
+    #if defined(_WIN32)
+        // Declared here, windows.h symbols collide with raylib ones
+        __declspec(dllimport) void *__stdcall CreateFileA(const char *lpFileName, unsigned long dwDesiredAccess, unsigned long dwShareMode, void *lpSecurityAttributes, unsigned long dwCreationDisposition, unsigned long dwFlagsAndAttributes, void *hTemplateFile);
+        __declspec(dllimport) int __stdcall GetFileSizeEx(void *hFile, long long *lpFileSize);
+        __declspec(dllimport) void *__stdcall CreateFileMappingA(void *hFile, void *lpFileMappingAttributes, unsigned long flProtect, unsigned long dwMaximumSizeHigh, unsigned long dwMaximumSizeLow, const char *lpName);
+        __declspec(dllimport) void *__stdcall MapViewOfFile(void *hFileMappingObject, unsigned long dwDesiredAccess, unsigned long dwFileOffsetHigh, unsigned long dwFileOffsetLow, size_t dwNumberOfBytesToMap);
+        __declspec(dllimport) int __stdcall UnmapViewOfFile(const void *lpBaseAddress);
+        __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+    #else
+        #include <fcntl.h>              // Required for: open()
+        #include <sys/mman.h>           // Required for: mmap(), munmap()
+        #include <sys/stat.h>           // Required for: fstat()
+        #include <unistd.h>             // Required for: close()
+    #endif
+#endif
+
+// File watches wait on the directory where the platform can, so a file saved by renaming a new one
+// over it is still seen, everywhere else the modification time is polled
+#if defined(__linux__) && !defined(PLATFORM_ANDROID)
+    #define FILE_WATCH_INOTIFY
+    #include <sys/inotify.h>            // Required for: inotify_init1(), inotify_add_watch()
+    #include <unistd.h>                 // Required for: read(), close()
+#elif defined(_WIN32)
+    #define FILE_WATCH_WIN32
+    // Declared here, windows.h symbols collide with raylib ones
+    __declspec(dllimport) void *__stdcall FindFirstChangeNotificationA(const char *lpPathName, int bWatchSubtree, unsigned long dwNotifyFilter);
+    __declspec(dllimport) int __stdcall FindNextChangeNotification(void *hChangeHandle);
+    __declspec(dllimport) int __stdcall FindCloseChangeNotification(void *hChangeHandle);
+    __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef FRAME_MEMORY_SIZE
+    #define FRAME_MEMORY_SIZE     (256*1024)        // Per-frame arena size in bytes
+#endif
+
+#define FRAME_MEMORY_ALIGN              16          // Frame memory allocations alignment, enough for any vector type
+#define MEMORY_HEADER_SIZE              16          // Header in front of every tagged allocation, keeps the data as aligned as malloc()
+
+// Memory counters and the trace log ring are updated from any thread, the audio thread allocates and logs too
+// NOTE: Both are full barriers, ATOMIC_ADD(var, 0) is also how a value published by another thread is read
+#if defined(_MSC_VER)
+    #define ATOMIC_ADD(var, value)              _InterlockedExchangeAdd(&(var), (value))
+    #define ATOMIC_CAS(var, from, to)           (_InterlockedCompareExchange(&(var), (to), (from)) == (from))
+#else
+    #define ATOMIC_ADD(var, value)              __sync_fetch_and_add(&(var), (value))
+    #define ATOMIC_CAS(var, from, to)           __sync_bool_compare_and_swap(&(var), (from), (to))
+#endif
+
+#ifndef TRACELOG_ASYNC_SLOTS
+    #define TRACELOG_ASYNC_SLOTS          256       // Messages the async trace log ring holds, power of two
+#endif
+#define TRACELOG_ASYNC_WAIT_MS           10         // Background log writer sleep between drains
+
+#ifndef TRACE_ZONE_EVENTS
+    #define TRACE_ZONE_EVENTS           8192        // Zones kept per thread, power of two, the oldest are overwritten
+#endif
+#define TRACE_ZONE_THREADS              16          // Threads that can record zones, zones on any later thread are ignored
+#define TRACE_ZONE_DEPTH                32          // Zones open at once on one thread, deeper ones are not recorded
+
+#if defined(_MSC_VER)
+    #define THREAD_LOCAL __declspec(thread)
+#else
+    #define THREAD_LOCAL __thread
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Heap block for a frame allocation that did not fit in the arena
+typedef struct FrameMemoryOverflow {
+    struct FrameMemoryOverflow *next;
+    unsigned char pad[FRAME_MEMORY_ALIGN - sizeof(void *)];     // Keeps the data after the header aligned
+} FrameMemoryOverflow;
+
+// Header of a tagged allocation, the block handed out starts MEMORY_HEADER_SIZE bytes after it
+typedef struct MemoryHeader {
+    unsigned int size;                  // Bytes requested, what the stats count
+    int tag;                            // Tag the block is accounted to until it is freed
+} MemoryHeader;
+
+typedef struct MemoryCounters {
+    volatile long liveBytes;
+    volatile long peakBytes;
+    volatile long liveCount;
+    volatile long totalCount;
+    volatile long failures;
+    volatile long operations;
+} MemoryCounters;
+
+// Trace log message waiting for the background writer
+// NOTE: sequence is the ring position the slot is free for, one more once the message is in it
+typedef struct TraceLogSlot {
+    volatile long sequence;
+    int logType;
+    char text[MAX_TRACELOG_MSG_LENGTH];
+} TraceLogSlot;
+
+// Finished zone, a complete event with its duration so the ring never holds half a pair
+typedef struct TraceZoneEvent {
+    const char *name;
+    double start;                       // Seconds, trace clock
+    double duration;
+} TraceZoneEvent;
+
+// Zones of one thread. Only that thread writes, the exporter reads behind the published head
+typedef struct TraceZoneBuffer {
+    volatile long head;                 // Zones finished so far, the last TRACE_ZONE_EVENTS - 1 are exported
+    int depth;                          // Zones open, the first TRACE_ZONE_DEPTH are tracked
+    const char *open[TRACE_ZONE_DEPTH];
+    double openStart[TRACE_ZONE_DEPTH];
+    TraceZoneEvent events[TRACE_ZONE_EVENTS];
+} TraceZoneBuffer;
+
+// State behind a FileWatch
+typedef struct FileWatchState {
+#if defined(FILE_WATCH_INOTIFY)
+    int fd;                             // Non-blocking inotify instance watching the file's directory
+#elif defined(FILE_WATCH_WIN32)
+    void *handle;                       // Change notification on the file's directory
+#endif
+    long modTime;                       // Modification time last reported, where changes are found by it
+    char fileName[MAX_FILEPATH_LENGTH];
+} FileWatchState;
+
+typedef struct FrameMemory {
+    unsigned char *base;                // Arena block, allocated on first use
+    unsigned int used;                  // Arena bytes allocated this frame
+    unsigned int overflowBytes;         // Heap bytes allocated this frame past the arena
+    FrameMemoryOverflow *overflow;      // Heap blocks to free on the next frame
+    bool open;                          // Between BeginDrawing() and EndDrawing()
+    FrameMemoryStats stats;
+} FrameMemory;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -67,6 +235,59 @@ static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback fun
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
 
+static FrameMemory frameMemory = { 0 };             // Per-frame linear arena
+
+#if defined(SUPPORT_TRACE_ZONES)
+static TraceZoneBuffer traceZoneBuffers[TRACE_ZONE_THREADS] = { 0 };  // Zone rings, one claimed by each recording thread
+static volatile long traceZoneThreads = 0;          // Rings claimed, may count past TRACE_ZONE_THREADS
+static THREAD_LOCAL int traceZoneThread = 0;        // Calling thread's ring plus one, 0 before its first zone, -1 if none was left
+#endif
+
+#if defined(RL_MEMORY_HOOKS)
+static void *HeapAllocate(unsigned int size, int tag, void *user) { return malloc(size); }
+static void *HeapReallocate(void *ptr, unsigned int size, int tag, void *user) { return realloc(ptr, size); }
+static void HeapDeallocate(void *ptr, int tag, void *user) { free(ptr); }
+
+static MemoryAllocator memoryAllocator = { HeapAllocate, HeapReallocate, HeapDeallocate, NULL };    // Memory allocator backend
+static MemoryCounters memoryCounters[MEMORY_TAG_COUNT + 1] = { 0 };    // Memory counters per tag, the last one for all tags
+
+// Account a change of live bytes and blocks to a tag and to the totals, one heap operation each
+static void CountMemory(int tag, long bytes, long count)
+{
+    MemoryCounters *counters[2] = { &memoryCounters[tag], &memoryCounters[MEMORY_TAG_COUNT] };
+
+    for (int i = 0; i < 2; i++)
+    {
+        long live = ATOMIC_ADD(counters[i]->liveBytes, bytes) + bytes;
+        ATOMIC_ADD(counters[i]->liveCount, count);
+        if (count > 0) ATOMIC_ADD(counters[i]->totalCount, count);
+        ATOMIC_ADD(counters[i]->operations, 1);
+
+        long peak = counters[i]->peakBytes;
+        while ((live > peak) && !ATOMIC_CAS(counters[i]->peakBytes, peak, live)) peak = counters[i]->peakBytes;
+    }
+}
+
+// Count an allocation the backend refused
+static void CountMemoryFailure(int tag)
+{
+    ATOMIC_ADD(memoryCounters[tag].failures, 1);
+    ATOMIC_ADD(memoryCounters[MEMORY_TAG_COUNT].failures, 1);
+}
+#endif
+
+#if defined(SUPPORT_TRACELOG) && defined(SUPPORT_TRACELOG_ASYNC)
+// Bounded multi-producer ring, TraceLog() claims a slot with a CAS and never waits: a full ring drops the message
+static struct {
+    TraceLogSlot slots[TRACELOG_ASYNC_SLOTS];
+    volatile long head;                 // Next position a producer claims
+    long tail;                          // Next position the writer reads, writer thread only
+    volatile long dropped;              // Messages lost to a full ring
+    volatile long running;              // Writer thread started and not asked to stop
+    pthread_t thread;
+} traceLogAsync = { 0 };
+#endif
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -102,6 +323,182 @@ static int android_close(void *cookie);
 // Set the current threshold (minimum) log level
 void SetTraceLogLevel(int logType) { logTypeLevel = logType; }
 
+#if defined(SUPPORT_TRACELOG) && defined(SUPPORT_TRACELOG_ASYNC)
+// Pass an already formatted message to the custom callback
+static void CallTraceLogCallback(int logType, const char *text, ...)
+{
+    va_list args;
+    va_start(args, text);
+    traceLog(logType, text, args);
+    va_end(args);
+}
+
+// Write one formatted message, the same output TraceLog() has
+static void WriteTraceLog(int logType, const char *text)
+{
+    if (traceLog)
+    {
+        CallTraceLogCallback(logType, "%s", text);
+        return;
+    }
+
+#if defined(PLATFORM_ANDROID)
+    int priority = ANDROID_LOG_DEFAULT;
+    switch (logType)
+    {
+        case LOG_TRACE: priority = ANDROID_LOG_VERBOSE; break;
+        case LOG_DEBUG: priority = ANDROID_LOG_DEBUG; break;
+        case LOG_INFO: priority = ANDROID_LOG_INFO; break;
+        case LOG_WARNING: priority = ANDROID_LOG_WARN; break;
+        case LOG_ERROR: priority = ANDROID_LOG_ERROR; break;
+        case LOG_FATAL: priority = ANDROID_LOG_FATAL; break;
+        default: break;
+    }
+    __android_log_write(priority, "raylib", text);
+#else
+    const char *prefix = "";
+    switch (logType)
+    {
+        case LOG_TRACE: prefix = "TRACE: "; break;
+        case LOG_DEBUG: prefix = "DEBUG: "; break;
+        case LOG_INFO: prefix = "INFO: "; break;
+        case LOG_WARNING: prefix = "WARNING: "; break;
+        case LOG_ERROR: prefix = "ERROR: "; break;
+        case LOG_FATAL: prefix = "FATAL: "; break;
+        default: break;
+    }
+    printf("%s%s\n", prefix, text);
+#endif
+}
+
+// Format a message into the ring, false if it was full
+// NOTE: Lock-free, producers only race on the CAS that claims a position
+static bool PushTraceLog(int logType, const char *text, va_list args)
+{
+    long position = ATOMIC_ADD(traceLogAsync.head, 0);
+    TraceLogSlot *slot = NULL;
+
+    while (true)
+    {
+        slot = &traceLogAsync.slots[position & (TRACELOG_ASYNC_SLOTS - 1)];
+        long lap = ATOMIC_ADD(slot->sequence, 0) - position;
+
+        if (lap == 0)
+        {
+            if (ATOMIC_CAS(traceLogAsync.head, position, position + 1)) break;
+        }
+        else if (lap < 0)
+        {
+            // The writer has not freed this slot since the last lap: full
+            ATOMIC_ADD(traceLogAsync.dropped, 1);
+            return false;
+        }
+
+        position = ATOMIC_ADD(traceLogAsync.head, 0);
+    }
+
+    slot->logType = logType;
+    vsnprintf(slot->text, MAX_TRACELOG_MSG_LENGTH, text, args);
+    ATOMIC_ADD(slot->sequence, 1);      // Published
+
+    return true;
+}
+
+// Write every published message in order
+// NOTE: Writer thread only, or once it has been joined
+static void DrainTraceLog(void)
+{
+    while (true)
+    {
+        TraceLogSlot *slot = &traceLogAsync.slots[traceLogAsync.tail & (TRACELOG_ASYNC_SLOTS - 1)];
+        if (ATOMIC_ADD(slot->sequence, 0) != traceLogAsync.tail + 1) break;
+
+        WriteTraceLog(slot->logType, slot->text);
+        ATOMIC_ADD(slot->sequence, TRACELOG_ASYNC_SLOTS - 1);    // Free for the same position one lap later
+        traceLogAsync.tail++;
+    }
+
+    long dropped = ATOMIC_ADD(traceLogAsync.dropped, 0);
+    if (dropped > 0)
+    {
+        char text[64] = { 0 };
+        ATOMIC_ADD(traceLogAsync.dropped, -dropped);
+        snprintf(text, sizeof(text), "TRACELOG: %li messages dropped, async ring full", dropped);
+        WriteTraceLog(LOG_WARNING, text);
+    }
+
+    fflush(stdout);
+}
+
+// Background log writer, drains the ring until asked to stop
+static void *TraceLogWriter(void *arg)
+{
+    while (ATOMIC_ADD(traceLogAsync.running, 0))
+    {
+        DrainTraceLog();
+
+    #if defined(_WIN32)
+        Sleep(TRACELOG_ASYNC_WAIT_MS);
+    #else
+        struct timespec wait = { 0, TRACELOG_ASYNC_WAIT_MS*1000000L };
+        nanosleep(&wait, NULL);
+    #endif
+    }
+
+    return NULL;
+}
+
+// Stop the writer on exit so nothing queued is lost
+static void StopTraceLogAsync(void)
+{
+    SetTraceLogAsync(false);
+}
+#endif
+
+// Set trace log messages to be written by a background thread
+// NOTE: TraceLog() then only formats into a ring and returns, it never blocks on the terminal or the log file.
+// Messages keep their order, LOG_FATAL ones are written right away after everything queued before them
+void SetTraceLogAsync(bool enabled)
+{
+#if defined(SUPPORT_TRACELOG) && defined(SUPPORT_TRACELOG_ASYNC)
+    static bool ringReady = false;
+    static bool exitHooked = false;
+
+    if (enabled == (ATOMIC_ADD(traceLogAsync.running, 0) != 0)) return;
+
+    if (enabled)
+    {
+        if (!ringReady)
+        {
+            for (int i = 0; i < TRACELOG_ASYNC_SLOTS; i++) traceLogAsync.slots[i].sequence = i;
+            ringReady = true;
+        }
+
+        traceLogAsync.running = 1;
+        if (pthread_create(&traceLogAsync.thread, NULL, TraceLogWriter, NULL) != 0)
+        {
+            traceLogAsync.running = 0;
+            TRACELOG(LOG_WARNING, "SYSTEM: Failed to start the trace log writer thread");
+            return;
+        }
+
+        if (!exitHooked) exitHooked = (atexit(StopTraceLogAsync) == 0);
+    }
+    else
+    {
+        ATOMIC_CAS(traceLogAsync.running, 1, 0);
+
+        // NOTE: A callback that stops it from the writer itself only ends the loop
+        if (pthread_equal(pthread_self(), traceLogAsync.thread)) return;
+
+        pthread_join(traceLogAsync.thread, NULL);
+        DrainTraceLog();
+    }
+#else
+    if (enabled) TRACELOG(LOG_WARNING, "SYSTEM: Async trace log not supported on this platform");
+#endif
+}
+
 // Show trace log messages (LOG_INFO, LOG_WARNING, LOG_ERROR, LOG_DEBUG)
 void TraceLog(int logType, const char *text, ...)
 {
@@ -109,6 +506,21 @@ void TraceLog(int logType, const char *text, ...)
     // Message has level below current threshold, don't emit
     if (logType < logTypeLevel) return;
 
+#if defined(SUPPORT_TRACELOG_ASYNC)
+    if (ATOMIC_ADD(traceLogAsync.running, 0))
+    {
+        if (logType == LOG_FATAL) SetTraceLogAsync(false);
+        else
+        {
+            va_list args;
+            va_start(args, text);
+            PushTraceLog(logType, text, args);
+            va_end(args);
+            return;
+        }
+    }
+#endif
+
     va_list args;
     va_start(args, text);
 
@@ -158,6 +570,141 @@ void TraceLog(int logType, const char *text, ...)
 #endif  // SUPPORT_TRACELOG
 }
 
+#if defined(SUPPORT_TRACE_ZONES)
+// Get trace clock, seconds from an arbitrary monotonic point
+static double GetTraceClock(void)
+{
+#if defined(_WIN32)
+    unsigned long long int counter = 0;
+    unsigned long long int frequency = 1;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+
+    return (double)counter/(double)frequency;
+#else
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + (double)now.tv_nsec*1e-9;
+#endif
+}
+
+// Get the calling thread's zone ring, claimed on its first zone
+static TraceZoneBuffer *GetTraceZoneBuffer(void)
+{
+    if (traceZoneThread == 0)
+    {
+        long index = ATOMIC_ADD(traceZoneThreads, 1);
+        traceZoneThread = (index < TRACE_ZONE_THREADS)? (int)index + 1 : -1;
+    }
+
+    return (traceZoneThread > 0)? &traceZoneBuffers[traceZoneThread - 1] : NULL;
+}
+#endif
+
+// Begin a timeline zone on the calling thread
+// NOTE: No locks and no allocations, safe on the audio thread. Name is kept as a pointer
+void BeginTraceZone(const char *name)
+{
+#if defined(SUPPORT_TRACE_ZONES)
+    TraceZoneBuffer *buffer = GetTraceZoneBuffer();
+    if (buffer == NULL) return;
+
+    if (buffer->depth < TRACE_ZONE_DEPTH)
+    {
+        buffer->open[buffer->depth] = name;
+        buffer->openStart[buffer->depth] = GetTraceClock();
+    }
+    buffer->depth++;
+#endif
+}
+
+// End the innermost zone open on the calling thread
+void EndTraceZone(void)
+{
+#if defined(SUPPORT_TRACE_ZONES)
+    TraceZoneBuffer *buffer = GetTraceZoneBuffer();
+    if ((buffer == NULL) || (buffer->depth == 0)) return;
+
+    buffer->depth--;
+    if (buffer->depth >= TRACE_ZONE_DEPTH) return;
+
+    TraceZoneEvent *event = &buffer->events[buffer->head & (TRACE_ZONE_EVENTS - 1)];
+    event->name = buffer->open[buffer->depth];
+    event->start = buffer->openStart[buffer->depth];
+    event->duration = GetTraceClock() - event->start;
+
+    ATOMIC_ADD(buffer->head, 1);        // Published
+#endif
+}
+
+// Export recent zones of every thread as Chrome trace event JSON
+// NOTE: Threads may keep recording meanwhile, a zone overwritten while it was being read is left out.
+// Thread ids are the order threads recorded their first zone in, the main thread is usually 0
+bool ExportTraceZones(const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_TRACE_ZONES)
+    FILE *file = fopen(fileName, "wt");
+
+    if (file != NULL)
+    {
+        long threads = ATOMIC_ADD(traceZoneThreads, 0);
+        if (threads > TRACE_ZONE_THREADS) threads = TRACE_ZONE_THREADS;
+
+        // Timestamps are relative to the oldest zone kept. The slot after the head may be the one
+        // being written, the oldest zone in it is never read
+        double origin = 0.0;
+        bool started = false;
+        for (int t = 0; t < threads; t++)
+        {
+            TraceZoneBuffer *buffer = &traceZoneBuffers[t];
+            long head = ATOMIC_ADD(buffer->head, 0);
+            long first = (head >= TRACE_ZONE_EVENTS)? head - TRACE_ZONE_EVENTS + 1 : 0;
+
+            for (long i = first; i < head; i++)
+            {
+                double start = buffer->events[i & (TRACE_ZONE_EVENTS - 1)].start;
+                if (!started || (start < origin)) origin = start;
+                started = true;
+            }
+        }
+
+        fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+        int count = 0;
+        for (int t = 0; t < threads; t++)
+        {
+            TraceZoneBuffer *buffer = &traceZoneBuffers[t];
+            long head = ATOMIC_ADD(buffer->head, 0);
+            long first = (head >= TRACE_ZONE_EVENTS)? head - TRACE_ZONE_EVENTS + 1 : 0;
+
+            for (long i = first; i < head; i++)
+            {
+                TraceZoneEvent event = buffer->events[i & (TRACE_ZONE_EVENTS - 1)];
+                if ((ATOMIC_ADD(buffer->head, 0) - i) >= TRACE_ZONE_EVENTS) continue;   // Overwritten while read
+
+                fprintf(file, "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%i,\"ts\":%.3f,\"dur\":%.3f}", (count > 0)? "," : "",
+                    event.name, t, (event.start - origin)*1e6, event.duration*1e6);
+                count++;
+            }
+        }
+
+        fprintf(file, "\n]}\n");
+        success = (fclose(file) == 0);
+
+        if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Trace zones exported successfully (%i zones)", fileName, count);
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export trace zones", fileName);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+#else
+    TRACELOG(LOG_WARNING, "SYSTEM: Trace zones not supported, build with SUPPORT_TRACE_ZONES");
+#endif
+
+    return success;
+}
+
 // Internal memory allocator
 // NOTE: Initializes to zero by default
 void *MemAlloc(unsigned int size)
@@ -174,9 +721,239 @@ void *MemRealloc(void *ptr, unsigned int size)
 }
 
 // Internal memory free
+// NOTE: Frees blocks from any of the allocators above
 void MemFree(void *ptr)
 {
+#if defined(RL_MEMORY_HOOKS)
+    if (ptr == NULL) return;
+
+    MemoryHeader *header = (MemoryHeader *)((unsigned char *)ptr - MEMORY_HEADER_SIZE);
+    int tag = header->tag;
+
+    CountMemory(tag, -(long)header->size, -1);
+    memoryAllocator.deallocate(header, tag, memoryAllocator.user);
+#else
     RL_FREE(ptr);
+#endif
+}
+
+// Memory allocator accounted to a tag
+// NOTE: Not zeroed, MemFree() releases it like any other block
+void *MemAllocTagged(unsigned int size, int tag)
+{
+#if defined(RL_MEMORY_HOOKS)
+    if ((tag < 0) || (tag >= MEMORY_TAG_COUNT)) tag = MEMORY_TAG_GENERAL;
+
+    MemoryHeader *header = NULL;
+    if (size + MEMORY_HEADER_SIZE > size) header = (MemoryHeader *)memoryAllocator.allocate(size + MEMORY_HEADER_SIZE, tag, memoryAllocator.user);
+
+    if (header == NULL)
+    {
+        CountMemoryFailure(tag);
+        return NULL;
+    }
+
+    header->size = size;
+    header->tag = tag;
+    CountMemory(tag, (long)size, 1);
+
+    return (unsigned char *)header + MEMORY_HEADER_SIZE;
+#else
+    return RL_MALLOC(size);
+#endif
+}
+
+// Memory allocator accounted to a tag, zeroed
+void *MemCallocTagged(unsigned int count, unsigned int size, int tag)
+{
+#if defined(RL_MEMORY_HOOKS)
+    if ((size != 0) && (count > (unsigned int)-1/size))
+    {
+        CountMemoryFailure(((tag < 0) || (tag >= MEMORY_TAG_COUNT))? MEMORY_TAG_GENERAL : tag);
+        return NULL;
+    }
+
+    void *ptr = MemAllocTagged(count*size, tag);
+    if (ptr != NULL) memset(ptr, 0, count*size);
+
+    return ptr;
+#else
+    return RL_CALLOC(count, size);
+#endif
+}
+
+// Memory reallocator
+// NOTE: The block stays with the tag it was allocated with, tag only applies when ptr is NULL.
+// On failure NULL is returned and the old block is still valid
+void *MemReallocTagged(void *ptr, unsigned int size, int tag)
+{
+#if defined(RL_MEMORY_HOOKS)
+    if (ptr == NULL) return MemAllocTagged(size, tag);
+
+    MemoryHeader *header = (MemoryHeader *)((unsigned char *)ptr - MEMORY_HEADER_SIZE);
+    unsigned int oldSize = header->size;
+    tag = header->tag;
+
+    MemoryHeader *moved = NULL;
+    if (size + MEMORY_HEADER_SIZE > size)
+    {
+        if (memoryAllocator.reallocate != NULL) moved = (MemoryHeader *)memoryAllocator.reallocate(header, size + MEMORY_HEADER_SIZE, tag, memoryAllocator.user);
+        else
+        {
+            // Backends without reallocate, arenas usually, get a new block and the old one back
+            moved = (MemoryHeader *)memoryAllocator.allocate(size + MEMORY_HEADER_SIZE, tag, memoryAllocator.user);
+            if (moved != NULL)
+            {
+                memcpy(moved, header, MEMORY_HEADER_SIZE + ((size < oldSize)? size : oldSize));
+                memoryAllocator.deallocate(header, tag, memoryAllocator.user);
+            }
+        }
+    }
+
+    if (moved == NULL)
+    {
+        CountMemoryFailure(tag);
+        return NULL;
+    }
+
+    moved->size = size;
+    CountMemory(tag, (long)size - (long)oldSize, 0);
+
+    return (unsigned char *)moved + MEMORY_HEADER_SIZE;
+#else
+    return RL_REALLOC(ptr, size);
+#endif
+}
+
+// Set memory allocator backend
+// NOTE: Blocks are freed by the backend that allocated them, so it can only change while none are live.
+// Passing a backend without allocate or deallocate goes back to the C heap
+void SetMemoryAllocator(MemoryAllocator allocator)
+{
+#if defined(RL_MEMORY_HOOKS)
+    if (memoryCounters[MEMORY_TAG_COUNT].liveCount > 0)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Memory allocator not changed, %i blocks are still allocated", (int)memoryCounters[MEMORY_TAG_COUNT].liveCount);
+        return;
+    }
+
+    if ((allocator.allocate == NULL) || (allocator.deallocate == NULL)) allocator = (MemoryAllocator){ HeapAllocate, HeapReallocate, HeapDeallocate, NULL };
+    memoryAllocator = allocator;
+#else
+    TRACELOG(LOG_WARNING, "SYSTEM: Memory allocator is fixed at compile time by RL_MALLOC()");
+#endif
+}
+
+// Get live and peak bytes and allocation counts for a tag
+// NOTE: All zero when RL_MALLOC() was overridden at compile time
+MemoryTagStats GetMemoryTagStats(int tag)
+{
+    MemoryTagStats stats = { 0 };
+
+#if defined(RL_MEMORY_HOOKS)
+    if ((tag >= 0) && (tag <= MEMORY_TAG_COUNT))
+    {
+        const MemoryCounters *counters = &memoryCounters[tag];
+        stats.liveBytes = (unsigned int)counters->liveBytes;
+        stats.peakBytes = (unsigned int)counters->peakBytes;
+        stats.liveCount = (unsigned int)counters->liveCount;
+        stats.totalCount = (unsigned int)counters->totalCount;
+        stats.failures = (unsigned int)counters->failures;
+        stats.operations = (unsigned int)counters->operations;
+    }
+#endif
+
+    return stats;
+}
+
+// Get live and peak bytes and allocation counts for all tags together
+// NOTE: The peak is of the total, not the sum of the tag peaks
+MemoryTagStats GetMemoryStats(void)
+{
+    return GetMemoryTagStats(MEMORY_TAG_COUNT);
+}
+
+// Frame memory allocator
+// NOTE: A bump allocator over one block, everything is released at once on the next BeginDrawing().
+// Memory is not zeroed, and it is only meant for the thread that draws
+void *MemAllocFrame(unsigned int size)
+{
+    unsigned int alignedSize = (size + FRAME_MEMORY_ALIGN - 1) & ~(FRAME_MEMORY_ALIGN - 1);
+    void *ptr = NULL;
+
+    if (frameMemory.base == NULL) frameMemory.base = (unsigned char *)RL_MALLOC(FRAME_MEMORY_SIZE);
+
+    if ((frameMemory.base != NULL) && (alignedSize <= FRAME_MEMORY_SIZE - frameMemory.used))
+    {
+        ptr = frameMemory.base + frameMemory.used;
+        frameMemory.used += alignedSize;
+    }
+    else
+    {
+        // Past the arena the allocation comes from the heap and is chained to be freed with the arena,
+        // so a full arena costs speed, never correctness. The high-water mark tells how far over it went
+        FrameMemoryOverflow *block = (FrameMemoryOverflow *)RL_MALLOC(sizeof(FrameMemoryOverflow) + alignedSize);
+        if (block == NULL) return NULL;
+
+        block->next = frameMemory.overflow;
+        frameMemory.overflow = block;
+        frameMemory.overflowBytes += alignedSize;
+        frameMemory.stats.overflows++;
+        ptr = (unsigned char *)block + sizeof(FrameMemoryOverflow);
+    }
+
+    unsigned int total = frameMemory.used + frameMemory.overflowBytes;
+    if (total > frameMemory.stats.highWater) frameMemory.stats.highWater = total;
+
+    return ptr;
+}
+
+// Get frame memory arena usage and high-water mark
+FrameMemoryStats GetFrameMemoryStats(void)
+{
+    FrameMemoryStats stats = frameMemory.stats;
+    stats.capacity = FRAME_MEMORY_SIZE;
+
+    return stats;
+}
+
+// Release last frame's allocations and open the arena for the new frame
+void BeginFrameMemory(void)
+{
+    frameMemory.stats.used = frameMemory.used + frameMemory.overflowBytes;
+
+    while (frameMemory.overflow != NULL)
+    {
+        FrameMemoryOverflow *next = frameMemory.overflow->next;
+        RL_FREE(frameMemory.overflow);
+        frameMemory.overflow = next;
+    }
+
+    frameMemory.used = 0;
+    frameMemory.overflowBytes = 0;
+    frameMemory.open = true;
+}
+
+// Close the arena, allocations stay valid until the next BeginFrameMemory()
+void EndFrameMemory(void)
+{
+    frameMemory.open = false;
+}
+
+// Check if the current frame is between BeginDrawing() and EndDrawing()
+bool IsFrameMemoryOpen(void)
+{
+    return frameMemory.open;
+}
+
+// Free the arena
+void UnloadFrameMemory(void)
+{
+    BeginFrameMemory();
+    frameMemory.open = false;
+
+    RL_FREE(frameMemory.base);
+    frameMemory.base = NULL;
 }
 
 // Load data from file into a buffer
@@ -238,6 +1015,179 @@ void UnloadFileData(unsigned char *data)
     RL_FREE(data);
 }
 
+// Load a read-only view of a whole file
+// NOTE: Memory-mapped where supported, so nothing is copied and pages are only read when touched.
+// With a custom LoadFileData callback, or where mapping is not available, the view holds a copy loaded
+// by LoadFileData(). Either way the data stays valid until UnloadFileView()
+FileView LoadFileView(const char *fileName)
+{
+    FileView view = { 0 };
+
+#if defined(FILE_VIEW_MAPPED)
+    if ((fileName != NULL) && (loadFileData == NULL))
+    {
+    #if defined(_WIN32)
+        void *file = CreateFileA(fileName, 0x80000000, 0x00000001, NULL, 3, 0x00000080, NULL);     // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+        if (file != (void *)(size_t)-1)                     // INVALID_HANDLE_VALUE
+        {
+            long long size = 0;
+            if (GetFileSizeEx(file, &size) && (size > 0) && (size <= 0xffffffff))
+            {
+                // NOTE: The view keeps the mapping alive, both handles can be closed right away
+                void *mapping = CreateFileMappingA(file, NULL, 0x02, 0, 0, NULL);                   // PAGE_READONLY
+                if (mapping != NULL)
+                {
+                    view.data = (const unsigned char *)MapViewOfFile(mapping, 0x0004, 0, 0, 0);     // FILE_MAP_READ
+                    CloseHandle(mapping);
+                }
+                if (view.data != NULL) view.size = (unsigned int)size;
+            }
+            CloseHandle(file);
+        }
+    #else
+        int file = open(fileName, O_RDONLY);
+        if (file >= 0)
+        {
+            struct stat info = { 0 };
+            if ((fstat(file, &info) == 0) && (info.st_size > 0) && ((unsigned long long)info.st_size <= 0xffffffff))
+            {
+                void *data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+                if (data != MAP_FAILED)
+                {
+                    view.data = (const unsigned char *)data;
+                    view.size = (unsigned int)info.st_size;
+                }
+            }
+            close(file);
+        }
+    #endif
+
+        if (view.data != NULL)
+        {
+            view.mapped = true;
+            TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully", fileName);
+            return view;
+        }
+    }
+#endif
+
+    // Fallback: the view owns a copy
+    view.data = LoadFileData(fileName, &view.size);
+
+    return view;
+}
+
+// Unload file view loaded by LoadFileView()
+void UnloadFileView(FileView view)
+{
+    if (view.data == NULL) return;
+
+#if defined(FILE_VIEW_MAPPED)
+    if (view.mapped)
+    {
+    #if defined(_WIN32)
+        UnmapViewOfFile(view.data);
+    #else
+        munmap((void *)view.data, view.size);
+    #endif
+        return;
+    }
+#endif
+
+    UnloadFileData((unsigned char *)view.data);
+}
+
+// Load a watch on a file, IsFileWatchChanged() reports writes to it
+// NOTE: The file does not need to exist yet, only its directory
+FileWatch LoadFileWatch(const char *fileName)
+{
+    FileWatch watch = { 0 };
+    if ((fileName == NULL) || (strlen(fileName) >= MAX_FILEPATH_LENGTH)) return watch;
+
+    FileWatchState *state = (FileWatchState *)RL_CALLOC(1, sizeof(FileWatchState));
+    if (state == NULL) return watch;
+
+    strcpy(state->fileName, fileName);
+    state->modTime = GetFileModTime(fileName);
+
+#if defined(FILE_WATCH_INOTIFY)
+    state->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if ((state->fd < 0) || (inotify_add_watch(state->fd, GetDirectoryPath(fileName), IN_CLOSE_WRITE | IN_MOVED_TO) < 0))
+    {
+        if (state->fd >= 0) close(state->fd);
+        RL_FREE(state);
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to watch file", fileName);
+        return watch;
+    }
+#elif defined(FILE_WATCH_WIN32)
+    state->handle = FindFirstChangeNotificationA(GetDirectoryPath(fileName), 0, 0x00000011);     // FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE
+    if (state->handle == (void *)(size_t)-1)                // INVALID_HANDLE_VALUE
+    {
+        RL_FREE(state);
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to watch file", fileName);
+        return watch;
+    }
+#endif
+
+    watch.state = state;
+    return watch;
+}
+
+// Check if the watched file was written since the last check, never blocks
+bool IsFileWatchChanged(FileWatch watch)
+{
+    FileWatchState *state = (FileWatchState *)watch.state;
+    if (state == NULL) return false;
+
+    bool changed = false;
+
+#if defined(FILE_WATCH_INOTIFY)
+    // NOTE: Events name files in the directory, the buffer is aligned for the event records
+    const char *name = GetFileName(state->fileName);
+    char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    ssize_t length = 0;
+
+    while ((length = read(state->fd, buffer, sizeof(buffer))) > 0)
+    {
+        for (char *p = buffer; p < buffer + length; p += sizeof(struct inotify_event) + ((struct inotify_event *)p)->len)
+        {
+            const struct inotify_event *event = (const struct inotify_event *)p;
+            if ((event->len > 0) && (strcmp(event->name, name) == 0)) changed = true;
+        }
+    }
+#else
+    #if defined(FILE_WATCH_WIN32)
+    // NOTE: The notification is for the whole directory, the modification time says if it was this file
+    if (WaitForSingleObject(state->handle, 0) != 0) return false;       // WAIT_OBJECT_0
+    FindNextChangeNotification(state->handle);
+    #endif
+
+    long modTime = GetFileModTime(state->fileName);
+    if (modTime != state->modTime)
+    {
+        state->modTime = modTime;
+        changed = true;
+    }
+#endif
+
+    return changed;
+}
+
+// Unload file watch loaded by LoadFileWatch()
+void UnloadFileWatch(FileWatch watch)
+{
+    FileWatchState *state = (FileWatchState *)watch.state;
+    if (state == NULL) return;
+
+#if defined(FILE_WATCH_INOTIFY)
+    close(state->fd);
+#elif defined(FILE_WATCH_WIN32)
+    FindCloseChangeNotification(state->handle);
+#endif
+
+    RL_FREE(state);
+}
+
 // Save data to file from buffer
 bool SaveFileData(const char *fileName, void *data, unsigned int bytesToWrite)
 {
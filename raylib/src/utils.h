@@ -33,10 +33,15 @@
 #endif
 
 #if defined(SUPPORT_TRACELOG)
-    #define TRACELOG(level, ...) TraceLog(level, __VA_ARGS__)
+    #ifndef TRACELOG_LEVEL_MIN
+        #define TRACELOG_LEVEL_MIN 0
+    #endif
+
+    // NOTE: Levels below TRACELOG_LEVEL_MIN fold away at compile time, their arguments are never evaluated
+    #define TRACELOG(level, ...) (((level) >= TRACELOG_LEVEL_MIN)? TraceLog(level, __VA_ARGS__) : (void)0)
 
     #if defined(SUPPORT_TRACELOG_DEBUG)
-        #define TRACELOGD(...) TraceLog(LOG_DEBUG, __VA_ARGS__)
+        #define TRACELOGD(...) TRACELOG(LOG_DEBUG, __VA_ARGS__)
     #else
         #define TRACELOGD(...) (void)0
     #endif
@@ -45,6 +50,14 @@
     #define TRACELOGD(...) (void)0
 #endif
 
+#if defined(SUPPORT_TRACE_ZONES)
+    #define TRACE_ZONE_BEGIN(name) BeginTraceZone(name)
+    #define TRACE_ZONE_END() EndTraceZone()
+#else
+    #define TRACE_ZONE_BEGIN(name) (void)0
+    #define TRACE_ZONE_END() (void)0
+#endif
+
 //----------------------------------------------------------------------------------
 // Some basic Defines
 //----------------------------------------------------------------------------------
@@ -69,6 +82,11 @@
 extern "C" {            // Prevents name mangling of functions
 #endif
 
+void BeginFrameMemory(void);            // Release last frame's allocations and open the arena for the new frame, on BeginDrawing()
+void EndFrameMemory(void);              // Close the arena, allocations stay valid until the next BeginFrameMemory()
+bool IsFrameMemoryOpen(void);           // Check if the current frame is between BeginDrawing() and EndDrawing()
+void UnloadFrameMemory(void);           // Free the arena, on CloseWindow()
+
 #if defined(PLATFORM_ANDROID)
 void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initialize asset manager from android app
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!
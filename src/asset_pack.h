@@ -0,0 +1,8 @@
+#ifndef _asset_pack_h_
+#define _asset_pack_h_
+
+// The game's asset pack, built into the executable by tools/assetpack.c. Aligned to PACK_ALIGN
+extern const unsigned char asset_pack[];
+extern const unsigned int asset_pack_size;
+
+#endif //_asset_pack_h_
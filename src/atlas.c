@@ -0,0 +1,110 @@
+#include "atlas.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "rlgl.h"
+
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "external/stb_rect_pack.h"
+
+// Empty texels around every image so point sampling at its edge never picks up a neighbour
+#define ATLAS_PADDING 1
+#define WHITE_SIZE 4
+
+bool atlasAdd(Atlas *atlas, Image image, Rectangle *source) {
+	if (atlas->imageCount >= ATLAS_MAX_IMAGES || image.data == NULL) {
+		UnloadImage(image);
+		return false;
+	}
+
+	atlas->images[atlas->imageCount] = image;
+	atlas->sources[atlas->imageCount] = source;
+	atlas->imageCount++;
+	return true;
+}
+
+static void freeImages(Atlas *atlas) {
+	for (int i = 0; i < atlas->imageCount; i++) {
+		UnloadImage(atlas->images[i]);
+	}
+	atlas->imageCount = 0;
+}
+
+bool atlasBuild(Atlas *atlas) {
+	Font font = GetFontDefault();
+
+	// The font image only exists on the GPU once raylib has loaded it
+	Image fontImage = LoadImageFromTexture(font.texture);
+	Image white = GenImageColor(WHITE_SIZE, WHITE_SIZE, WHITE);
+
+	// Queued images first, then the font and the white patch
+	int count = atlas->imageCount + 2;
+	Image images[ATLAS_MAX_IMAGES + 2];
+	memcpy(images, atlas->images, atlas->imageCount*sizeof(Image));
+	images[count-2] = fontImage;
+	images[count-1] = white;
+
+	stbrp_rect rects[ATLAS_MAX_IMAGES + 2];
+	for (int i = 0; i < count; i++) {
+		rects[i] = (stbrp_rect){ .id = i, .w = images[i].width + 2*ATLAS_PADDING, .h = images[i].height + 2*ATLAS_PADDING };
+	}
+
+	static stbrp_node nodes[ATLAS_SIZE];
+	stbrp_context context;
+	stbrp_init_target(&context, ATLAS_SIZE, ATLAS_SIZE, nodes, ATLAS_SIZE);
+	stbrp_setup_heuristic(&context, STBRP_HEURISTIC_Skyline_BL_sortHeight);
+	bool packed = stbrp_pack_rects(&context, rects, count) && fontImage.data != NULL;
+
+	if (packed) {
+		Image image = GenImageColor(ATLAS_SIZE, ATLAS_SIZE, BLANK);
+		Rectangle placed[ATLAS_MAX_IMAGES + 2];
+		for (int i = 0; i < count; i++) {
+			placed[i] = (Rectangle){ rects[i].x + ATLAS_PADDING, rects[i].y + ATLAS_PADDING, images[i].width, images[i].height };
+			ImageDraw(&image, images[i], (Rectangle){ 0, 0, images[i].width, images[i].height }, placed[i], WHITE);
+		}
+
+		atlas->texture = LoadTextureFromImage(image);
+		UnloadImage(image);
+
+		for (int i = 0; i < atlas->imageCount; i++) {
+			*atlas->sources[i] = placed[i];
+		}
+
+		Rectangle fontRect = placed[count-2];
+		atlas->font = font;
+		atlas->font.texture = atlas->texture;
+		atlas->font.recs = MemAllocTagged(font.glyphCount*sizeof(Rectangle), MEMORY_TAG_GAME);
+		for (int i = 0; i < font.glyphCount; i++) {
+			atlas->font.recs[i] = font.recs[i];
+			atlas->font.recs[i].x += fontRect.x;
+			atlas->font.recs[i].y += fontRect.y;
+		}
+
+		// Inner texels only, so shapes stay solid even if the atlas is ever filtered
+		Rectangle whiteRect = placed[count-1];
+		atlas->white = (Rectangle){ whiteRect.x + 1, whiteRect.y + 1, whiteRect.width - 2, whiteRect.height - 2 };
+		SetShapesTexture(atlas->texture, atlas->white);
+	} else {
+		TraceLog(LOG_WARNING, "ATLAS: Images don't fit in %dx%d", ATLAS_SIZE, ATLAS_SIZE);
+	}
+
+	UnloadImage(fontImage);
+	UnloadImage(white);
+	freeImages(atlas);
+	return packed;
+}
+
+void atlasUnload(Atlas *atlas) {
+	freeImages(atlas);
+	if (atlas->texture.id == 0)
+		return;
+
+	// Shapes go back to raylib's own texture so nothing samples the freed one
+	if (GetShapesTexture().id == atlas->texture.id)
+		SetShapesTexture((Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 }, (Rectangle){ 0, 0, 1, 1 });
+	MemFree(atlas->font.recs);
+	UnloadTexture(atlas->texture);
+	*atlas = (Atlas){ 0 };
+}
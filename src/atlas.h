@@ -0,0 +1,31 @@
+#ifndef _atlas_h_
+#define _atlas_h_
+
+#include "raylib.h"
+
+#define ATLAS_SIZE 256
+#define ATLAS_MAX_IMAGES 8
+
+// HUD, menu and sprite graphics packed into one texture. With it set as the shapes texture, text,
+// shapes and sprites all sample the same texture and the batch never has to flush between them
+typedef struct Atlas {
+	Texture2D texture;
+	// The default font with its glyphs moved into the atlas, glyph data is shared with it
+	Font font;
+	// Solid patch used for shapes
+	Rectangle white;
+
+	// Queued by atlasAdd(), placed by atlasBuild()
+	Image images[ATLAS_MAX_IMAGES];
+	Rectangle *sources[ATLAS_MAX_IMAGES];
+	int imageCount;
+} Atlas;
+
+// The atlas takes the image. Its place in the atlas is written to source when the atlas is built
+bool atlasAdd(Atlas *atlas, Image image, Rectangle *source);
+// Packs the queued images, the default font and the white patch, then sets the atlas as the shapes
+// texture. Needs the GL context
+bool atlasBuild(Atlas *atlas);
+void atlasUnload(Atlas *atlas);
+
+#endif //_atlas_h_
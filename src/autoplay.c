@@ -0,0 +1,73 @@
+#include "autoplay.h"
+
+#include <math.h>
+
+void autoplayInit(Autoplayer *autoplayer, unsigned int seed) {
+	SetRandomStreamSeed(&autoplayer->random, seed, RANDOM_POLICY);
+	autoplayReset(autoplayer);
+}
+
+void autoplayReset(Autoplayer *autoplayer) {
+	autoplayer->ball = -1;
+	autoplayer->ballCount = 0;
+	autoplayer->offset = 0.0f;
+}
+
+// Seconds until ball b reaches the line the ball's bottom meets the paddle at, a rising ball by way
+// of the top wall. Negative for a ball already past the line
+static float timeToLine(const BallPool *balls, int b, float line) {
+	float vy = balls->vy[b];
+	if (vy > 0.0f)
+		return (line - balls->y[b])/vy;
+	if (vy < 0.0f)
+		return (balls->y[b] + line)/-vy;
+	return -1.0f;
+}
+
+// x after moving dx from x between walls lo and hi, each wall reflecting it
+static float foldX(float x, float dx, float lo, float hi) {
+	float width = hi - lo;
+	float u = fmodf(x + dx - lo, 2.0f*width);
+	if (u < 0.0f)
+		u += 2.0f*width;
+	if (u > width)
+		u = 2.0f*width - u;
+	return lo + u;
+}
+
+// Picks the ball that reaches the paddle line first and traces it there
+static void predict(Autoplayer *autoplayer, const Game *game, float line) {
+	const BallPool *balls = &game->balls;
+	int target = -1;
+	float soonest = 0.0f;
+	for (int b = 0; b < balls->count; b++) {
+		float t = timeToLine(balls, b, line);
+		if (t >= 0.0f && (target < 0 || t < soonest)) {
+			target = b;
+			soonest = t;
+		}
+	}
+
+	autoplayer->ball = target;
+	autoplayer->ballCount = balls->count;
+	if (target < 0)
+		return;
+
+	autoplayer->velocity = (Vector2){ balls->vx[target], balls->vy[target] };
+	autoplayer->interceptX = foldX(balls->x[target], balls->vx[target]*soonest, 0.0f, SCREEN_WIDTH - BALL_SIZE);
+	autoplayer->offset = (GetRandomStreamFloat(&autoplayer->random) - 0.5f)*(game->paddle.width + 2*BALL_SIZE);
+}
+
+GameInput autoplayInput(Autoplayer *autoplayer, const Game *game) {
+	const BallPool *balls = &game->balls;
+	int b = autoplayer->ball;
+	if (b < 0 || b >= balls->count || balls->count != autoplayer->ballCount ||
+		balls->vx[b] != autoplayer->velocity.x || balls->vy[b] != autoplayer->velocity.y)
+		predict(autoplayer, game, game->paddle.y - BALL_SIZE);
+
+	// Nothing on its way to the line, the paddle stays put
+	float x = game->paddle.x + game->paddle.width/2.0f;
+	if (autoplayer->ball >= 0)
+		x = autoplayer->interceptX + BALL_SIZE/2.0f + autoplayer->offset;
+	return (GameInput){ { x, 0 }, false };
+}
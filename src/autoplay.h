@@ -0,0 +1,28 @@
+#ifndef _autoplay_h_
+#define _autoplay_h_
+
+#include "raylib.h"
+#include "game.h"
+
+// A paddle that plays itself, for attract mode and tools/balance. The ball it follows is traced to
+// the paddle line analytically, folded off the side walls and the top, and that intercept holds
+// until the ball's velocity changes. A tick between bounces costs one comparison
+typedef struct Autoplayer {
+	// Ball followed and the velocity the intercept was traced with, -1 for none
+	int ball;
+	Vector2 velocity;
+	int ballCount;
+	float interceptX;
+	// Where on the paddle the ball is met, redrawn for every intercept. Bounces are mirror images,
+	// so it reaches a ball past the ends. A ball let by comes back off the bottom wall into the
+	// paddle's side and turns back, so games with the same start play out differently
+	float offset;
+	RandomStream random;
+} Autoplayer;
+
+void autoplayInit(Autoplayer *autoplayer, unsigned int seed);
+// Call at the start of every game, a new ball can set off with the velocity the last one had
+void autoplayReset(Autoplayer *autoplayer);
+GameInput autoplayInput(Autoplayer *autoplayer, const Game *game);
+
+#endif //_autoplay_h_
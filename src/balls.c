@@ -0,0 +1,32 @@
+#include "balls.h"
+
+void ballClear(BallPool *pool) {
+	pool->count = 0;
+}
+
+int ballSpawn(BallPool *pool, Vector2 position, Vector2 velocity) {
+	if (pool->count >= MAX_BALLS)
+		return -1;
+
+	int i = pool->count++;
+	pool->x[i] = pool->prevX[i] = position.x;
+	pool->y[i] = pool->prevY[i] = position.y;
+	pool->vx[i] = velocity.x;
+	pool->vy[i] = velocity.y;
+
+	return i;
+}
+
+int ballSpawnFixed(BallPool *pool, FixedBalls *fixed, FixedVec position, FixedVec velocity) {
+	int i = ballSpawn(pool, (Vector2){ fixedToFloat(position.x), fixedToFloat(position.y) },
+		(Vector2){ fixedToFloat(velocity.x), fixedToFloat(velocity.y) });
+	if (i < 0)
+		return -1;
+
+	fixed->x[i] = position.x;
+	fixed->y[i] = position.y;
+	fixed->vx[i] = velocity.x;
+	fixed->vy[i] = velocity.y;
+
+	return i;
+}
@@ -0,0 +1,57 @@
+#ifndef _balls_h_
+#define _balls_h_
+
+#include "raylib.h"
+#include "defs.h"
+#include "fixed.h"
+
+// Structure-of-arrays like the brick store, every ball is BALL_SIZE square
+typedef struct BallPool {
+	float x[MAX_BALLS];
+	float y[MAX_BALLS];
+	float vx[MAX_BALLS];
+	float vy[MAX_BALLS];
+	// Positions at the start of the current tick, blended with the latest ones when drawing
+	float prevX[MAX_BALLS];
+	float prevY[MAX_BALLS];
+	int count;
+} BallPool;
+
+// Q16.16 motion state for fixed-point physics, ball i is the same ball as in the BallPool. While it
+// is in use the pool's floats are only a copy for drawing and the frontend
+typedef struct FixedBalls {
+	Fixed x[MAX_BALLS];
+	Fixed y[MAX_BALLS];
+	Fixed vx[MAX_BALLS];
+	Fixed vy[MAX_BALLS];
+} FixedBalls;
+
+void ballClear(BallPool *pool);
+// Returns the new ball's index, or -1 when the pool is full
+int ballSpawn(BallPool *pool, Vector2 position, Vector2 velocity);
+// Spawns into both, the pool gets the float copy
+int ballSpawnFixed(BallPool *pool, FixedBalls *fixed, FixedVec position, FixedVec velocity);
+
+static inline Rectangle ballRect(const BallPool *pool, int i) {
+	return (Rectangle){ pool->x[i], pool->y[i], BALL_SIZE, BALL_SIZE };
+}
+
+static inline FixedRect ballRectFixed(const FixedBalls *fixed, int i) {
+	return (FixedRect){ fixed->x[i], fixed->y[i], BALL_SIZE*FIXED_ONE, BALL_SIZE*FIXED_ONE };
+}
+
+// Refreshes ball i's float copy after a fixed-point tick
+static inline void ballSyncFixed(BallPool *pool, const FixedBalls *fixed, int i) {
+	pool->x[i] = fixedToFloat(fixed->x[i]);
+	pool->y[i] = fixedToFloat(fixed->y[i]);
+	pool->vx[i] = fixedToFloat(fixed->vx[i]);
+	pool->vy[i] = fixedToFloat(fixed->vy[i]);
+}
+
+// Where ball i is drawn, blended between the last two ticks
+static inline Rectangle ballDrawRect(const BallPool *pool, int i, float alpha) {
+	return (Rectangle){ pool->prevX[i] + (pool->x[i] - pool->prevX[i])*alpha, pool->prevY[i] + (pool->y[i] - pool->prevY[i])*alpha,
+		BALL_SIZE, BALL_SIZE };
+}
+
+#endif //_balls_h_
@@ -0,0 +1,229 @@
+#include "brick_layer.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "rlgl.h"
+
+#include "defs.h"
+
+void brickLayerLoad(BrickLayer *layer) {
+	layer->target = LoadRenderTexture(SCREEN_WIDTH, SCREEN_HEIGHT);
+	layer->valid = false;
+}
+
+void brickLayerUnload(BrickLayer *layer) {
+	UnloadRenderTexture(layer->target);
+}
+
+// Where a brick's y is in the texture
+static float layerY(const BrickLayer *layer, float y) {
+	if (!layer->ring)
+		return y;
+	float offset = fmodf(y - GRID_ORIGIN_Y, FIELD_RING_HEIGHT);
+	return GRID_ORIGIN_Y + (offset < 0 ? offset + FIELD_RING_HEIGHT : offset);
+}
+
+// Whether the texture has brick i drawn
+static bool layerLive(const BrickLayer *layer, int i) {
+	return (layer->live[i >> 6] >> (i & 63)) & 1;
+}
+
+static void redraw(BrickLayer *layer, const BrickStore *store) {
+	static rlRectInstance instances[MAX_BRICKS];
+
+	int count = 0;
+	FOR_EACH_BRICK(store, i) {
+		Color colour = brickColour(store, i);
+		instances[count++] = (rlRectInstance){ (int)store->x[i], (int)layerY(layer, store->y[i]), (int)store->w[i], (int)store->h[i],
+			colour.r, colour.g, colour.b, colour.a };
+	}
+
+	// Black rather than clear, the layer is the background and is drawn without blending
+	BeginTextureMode(layer->target);
+	ClearBackground(BLACK);
+	// One record per brick and a single draw call, unless the GL version can't instance
+	if (!rlDrawRectanglesInstanced(instances, count)) {
+		FOR_EACH_BRICK(store, i) {
+			DrawRectangle(store->x[i], layerY(layer, store->y[i]), store->w[i], store->h[i], brickColour(store, i));
+		}
+	}
+	EndTextureMode();
+
+	for (int i = 0; i < BRICK_WORDS; i++) {
+		layer->live[i] = store->live[i];
+	}
+	memcpy(layer->damage, store->damage, store->used);
+	layer->used = store->used;
+	layer->valid = true;
+}
+
+void brickLayerUpdate(BrickLayer *layer, const BrickStore *store, DirtyRegion *dirty) {
+	int words = (store->used+63)/64;
+	bool full = !layer->valid || store->used != layer->used;
+
+	// A brick that appeared needs a full redraw, ones that broke are just cut out
+	for (int w = 0; w < words && !full; w++) {
+		if (store->live[w] & ~layer->live[w])
+			full = true;
+	}
+
+	if (full) {
+		redraw(layer, store);
+		if (dirty)
+			dirtyAll(dirty);
+		return;
+	}
+
+	bool textureMode = false;
+	for (int w = 0; w < words; w++) {
+		uint64_t broken = layer->live[w] & ~store->live[w];
+
+		for (int b = 0; broken; b++, broken >>= 1) {
+			if (!(broken & 1))
+				continue;
+
+			if (!textureMode) {
+				BeginTextureMode(layer->target);
+				textureMode = true;
+			}
+
+			int i = w*64 + b;
+			BeginScissorMode(store->x[i], layerY(layer, store->y[i]), store->w[i], store->h[i]);
+			ClearBackground(BLACK);
+			EndScissorMode();
+
+			if (dirty)
+				dirtyAdd(dirty, brickRect(store, i));
+		}
+
+		layer->live[w] = store->live[w];
+	}
+
+	// Bricks that took a hit without breaking change colour in place
+	if (memcmp(layer->damage, store->damage, store->used) != 0) {
+		FOR_EACH_BRICK(store, i) {
+			if (layer->damage[i] == store->damage[i])
+				continue;
+
+			if (!textureMode) {
+				BeginTextureMode(layer->target);
+				textureMode = true;
+			}
+
+			DrawRectangle(store->x[i], layerY(layer, store->y[i]), store->w[i], store->h[i], brickColour(store, i));
+			if (dirty)
+				dirtyAdd(dirty, brickRect(store, i));
+		}
+		memcpy(layer->damage, store->damage, store->used);
+	}
+
+	if (textureMode)
+		EndTextureMode();
+}
+
+#define MASK_WORDS ((SCREEN_WIDTH+63)/64)
+
+// Texture pixels a patch redraws, one bit each
+static uint64_t patchMask[SCREEN_HEIGHT][MASK_WORDS];
+
+// Fills the bits of the pixels a brick drawn at rect covers, or only tests them. Rects are truncated
+// the way DrawRectangle takes them
+static bool maskRect(Rectangle rect, bool fill) {
+	int x0 = (int)rect.x, y0 = (int)rect.y;
+	int x1 = x0 + (int)rect.width, y1 = y0 + (int)rect.height;
+	if (x0 < 0) x0 = 0;
+	if (y0 < 0) y0 = 0;
+	if (x1 > SCREEN_WIDTH) x1 = SCREEN_WIDTH;
+	if (y1 > SCREEN_HEIGHT) y1 = SCREEN_HEIGHT;
+	if (x0 >= x1 || y0 >= y1)
+		return false;
+
+	int w0 = x0/64, w1 = (x1-1)/64;
+	for (int y = y0; y < y1; y++) {
+		for (int w = w0; w <= w1; w++) {
+			uint64_t bits = ~(uint64_t)0;
+			if (w == w0)
+				bits &= ~(uint64_t)0 << (x0 & 63);
+			if (w == w1 && (x1 & 63))
+				bits &= ~(~(uint64_t)0 << (x1 & 63));
+			if (fill)
+				patchMask[y][w] |= bits;
+			else if (patchMask[y][w] & bits)
+				return true;
+		}
+	}
+	return false;
+}
+
+void brickLayerPatch(BrickLayer *layer, const BrickStore *store, const int *changed, const Rectangle *before, int count, DirtyRegion *dirty) {
+	if (!layer->valid || layer->ring) {
+		brickLayerInvalidate(layer);
+		return;
+	}
+
+	// Where the bricks were goes black, then every live brick over that or over where they are
+	// now is drawn again in index order, as a redraw would. Bricks are visited in that order too,
+	// so one that a redrawn brick covers is also found. One batch either way
+	memset(patchMask, 0, sizeof(patchMask));
+	BeginTextureMode(layer->target);
+	for (int c = 0; c < count; c++) {
+		int i = changed[c];
+		if (i < layer->used && layerLive(layer, i)) {
+			DrawRectangle(before[c].x, before[c].y, before[c].width, before[c].height, BLACK);
+			maskRect(before[c], true);
+			if (dirty)
+				dirtyAdd(dirty, before[c]);
+		}
+		if (i < store->used && brickLive(store, i)) {
+			maskRect(brickRect(store, i), true);
+			if (dirty)
+				dirtyAdd(dirty, brickRect(store, i));
+		}
+	}
+	FOR_EACH_BRICK(store, i) {
+		Rectangle rect = brickRect(store, i);
+		if (maskRect(rect, false)) {
+			maskRect(rect, true);
+			DrawRectangle(store->x[i], store->y[i], store->w[i], store->h[i], brickColour(store, i));
+		}
+	}
+	EndTextureMode();
+
+	for (int c = 0; c < count; c++) {
+		int i = changed[c];
+		uint64_t bit = (uint64_t)1 << (i & 63);
+		if (i < store->used && brickLive(store, i))
+			layer->live[i >> 6] |= bit;
+		else
+			layer->live[i >> 6] &= ~bit;
+		layer->damage[i] = store->damage[i];
+	}
+	layer->used = store->used;
+}
+
+void brickLayerDraw(const BrickLayer *layer) {
+	// Render textures are stored upside down
+	Rectangle source = { 0, 0, layer->target.texture.width, -layer->target.texture.height };
+	DrawTextureRec(layer->target.texture, source, (Vector2){ 0, 0 }, WHITE);
+}
+
+void brickLayerDrawRing(const BrickLayer *layer, float scroll, float newestY) {
+	// The band from the newest row down to the bottom of the texture's ring, then the rest of it
+	// from the top of the ring. Render textures are stored upside down
+	float top = layerY(layer, newestY);
+	float height = layer->target.texture.height;
+	float first = GRID_ORIGIN_Y + FIELD_RING_HEIGHT - top;
+	Vector2 position = { 0, newestY + scroll };
+
+	Rectangle source = { 0, height - (top + first), layer->target.texture.width, -first };
+	DrawTextureRec(layer->target.texture, source, position, WHITE);
+
+	source = (Rectangle){ 0, height - top, layer->target.texture.width, -(top - GRID_ORIGIN_Y) };
+	position.y += first;
+	DrawTextureRec(layer->target.texture, source, position, WHITE);
+}
+
+void brickLayerInvalidate(BrickLayer *layer) {
+	layer->valid = false;
+}
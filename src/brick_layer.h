@@ -0,0 +1,36 @@
+#ifndef _brick_layer_h_
+#define _brick_layer_h_
+
+#include "raylib.h"
+#include "bricks.h"
+#include "dirty.h"
+#include "field.h"
+
+// The brick field rendered once into a texture and only patched when bricks change. The texture
+// is opaque, black between the bricks, so it can be drawn with BLEND_OPAQUE
+typedef struct BrickLayer {
+	RenderTexture2D target;
+	uint64_t live[BRICK_WORDS];
+	unsigned char damage[MAX_BRICKS];
+	int used;
+	bool valid;
+	// For attack mode's field, set by the frontend. Store y then wraps around a FIELD_RING_HEIGHT
+	// band of the texture, which brickLayerDrawRing draws scrolled
+	bool ring;
+} BrickLayer;
+
+void brickLayerLoad(BrickLayer *layer);
+void brickLayerUnload(BrickLayer *layer);
+
+// Must be called outside texture or scissor modes, changed areas are added to dirty when given
+void brickLayerUpdate(BrickLayer *layer, const BrickStore *store, DirtyRegion *dirty);
+void brickLayerDraw(const BrickLayer *layer);
+// The ring band with the newest row, its y in store coordinates, at scroll pixels lower
+void brickLayerDrawRing(const BrickLayer *layer, float scroll, float newestY);
+// Redraws only the bricks levelApply changed, erasing where they were and redrawing the bricks that
+// overlap either place. Falls back to a redraw on the next update when the texture isn't up to date
+void brickLayerPatch(BrickLayer *layer, const BrickStore *store, const int *changed, const Rectangle *before, int count, DirtyRegion *dirty);
+// Redraws everything on the next update, for when bricks may have changed colour in place
+void brickLayerInvalidate(BrickLayer *layer);
+
+#endif //_brick_layer_h_
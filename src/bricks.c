@@ -0,0 +1,102 @@
+#include "bricks.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+	#define popcount64(x) __builtin_popcountll(x)
+	#define ctz64(x) __builtin_ctzll(x)
+#else
+static int popcount64(uint64_t x) {
+	int n = 0;
+	for (; x; x &= x - 1) n++;
+	return n;
+}
+
+static int ctz64(uint64_t x) {
+	int n = 0;
+	for (; !(x & 1); x >>= 1) n++;
+	return n;
+}
+#endif
+
+const BrickType brickTypes[BRICK_TYPE_COUNT] = {
+	// Not written by levelc, it breaks like a normal brick
+	[BRICK_NONE] = { 1, BRICK_EFFECT_NONE, BRICK_SOUND_HIT, { { 0 } } },
+	[BRICK_NORMAL] = { 1, BRICK_EFFECT_NONE, BRICK_SOUND_HIT, { { 0 } } },
+	[BRICK_TOUGH] = { 3, BRICK_EFFECT_NONE, BRICK_SOUND_HIT, { SKYBLUE, BLUE, DARKBLUE } },
+	[BRICK_SOLID] = { 0, BRICK_EFFECT_NONE, BRICK_SOUND_CLICK, { DARKGRAY } },
+	[BRICK_EXPLOSIVE] = { 1, BRICK_EFFECT_EXPLODE, BRICK_SOUND_HIT, { MAROON } },
+	[BRICK_MULTIBALL] = { 1, BRICK_EFFECT_MULTIBALL, BRICK_SOUND_HIT, { GOLD } },
+};
+
+void brickClear(BrickStore *store) {
+	for (int i = 0; i < BRICK_WORDS; i++) {
+		store->live[i] = 0;
+		store->solid[i] = 0;
+	}
+	store->used = 0;
+}
+
+int brickAdd(BrickStore *store, Rectangle rect, char type, Color colour) {
+	if (store->used >= MAX_BRICKS)
+		return -1;
+
+	int i = store->used++;
+	brickSet(store, i, rect, type, colour);
+	store->damage[i] = 0;
+	brickRevive(store, i);
+
+	return i;
+}
+
+void brickSet(BrickStore *store, int i, Rectangle rect, char type, Color colour) {
+	store->x[i] = rect.x;
+	store->y[i] = rect.y;
+	store->w[i] = rect.width;
+	store->h[i] = rect.height;
+	store->type[i] = type;
+	store->colour[i] = colour;
+
+	uint64_t bit = (uint64_t)1 << (i & 63);
+	if (brickTypes[(unsigned char)type].hitPoints == 0)
+		store->solid[i >> 6] |= bit;
+	else
+		store->solid[i >> 6] &= ~bit;
+}
+
+int brickCount(const BrickStore *store) {
+	int words = (store->used+63)/64;
+	int n = 0;
+	for (int i = 0; i < words; i++) {
+		n += popcount64(store->live[i]);
+	}
+	return n;
+}
+
+int brickNext(const BrickStore *store, int from) {
+	if (from >= store->used)
+		return -1;
+
+	int word = from >> 6;
+	uint64_t bits = store->live[word] & (~(uint64_t)0 << (from & 63));
+	int words = (store->used+63)/64;
+
+	while (!bits) {
+		if (++word >= words)
+			return -1;
+		bits = store->live[word];
+	}
+
+	return (word << 6) + ctz64(bits);
+}
+
+int brickRemaining(const BrickStore *store) {
+	int words = (store->used+63)/64;
+	int n = 0;
+	for (int i = 0; i < words; i++) {
+		n += popcount64(store->live[i] & ~store->solid[i]);
+	}
+	return n;
+}
+
+bool brickCleared(const BrickStore *store) {
+	return brickRemaining(store) == 0;
+}
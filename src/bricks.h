@@ -0,0 +1,107 @@
+#ifndef _bricks_h_
+#define _bricks_h_
+
+#include <stdint.h>
+
+#include "raylib.h"
+#include "defs.h"
+
+#define BRICK_WORDS ((MAX_BRICKS+63)/64)
+// Most hits any type takes to break, the length of a colour ramp
+#define BRICK_MAX_HITS 4
+
+// Values of BrickStore.type, an index into brickTypes. Level files store them, so add to the end
+enum {
+	BRICK_NONE,
+	BRICK_NORMAL,
+	BRICK_TOUGH,
+	BRICK_SOLID,
+	BRICK_EXPLOSIVE,
+	BRICK_MULTIBALL,
+	BRICK_TYPE_COUNT
+};
+
+// What a brick does as it breaks
+enum {
+	BRICK_EFFECT_NONE,
+	BRICK_EFFECT_EXPLODE,
+	BRICK_EFFECT_MULTIBALL,
+	BRICK_EFFECT_COUNT
+};
+
+// Event a hit on the brick counts toward, and so the sound it makes
+enum {
+	BRICK_SOUND_HIT,
+	BRICK_SOUND_CLICK
+};
+
+// One record per type, small enough that the whole table stays in a cache line or two
+typedef struct BrickType {
+	// Hits to break, 0 for a brick that never breaks
+	unsigned char hitPoints;
+	unsigned char effect;
+	unsigned char sound;
+	// Colour after each number of hits taken, a zero alpha keeps the brick's own colour
+	Color ramp[BRICK_MAX_HITS];
+} BrickType;
+
+extern const BrickType brickTypes[BRICK_TYPE_COUNT];
+
+// Structure-of-arrays so the collision and draw loops only touch the fields they need
+typedef struct BrickStore {
+	// First, so a game snapshot can end right after damage and leave the level geometry out
+	uint64_t live[BRICK_WORDS];
+	// Hits taken, the brick breaks when this reaches its type's hitPoints
+	unsigned char damage[MAX_BRICKS];
+	float x[MAX_BRICKS];
+	float y[MAX_BRICKS];
+	float w[MAX_BRICKS];
+	float h[MAX_BRICKS];
+	Color colour[MAX_BRICKS];
+	char type[MAX_BRICKS];
+	// Bricks of a type that never breaks, they don't count toward clearing the level
+	uint64_t solid[BRICK_WORDS];
+	int used;
+} BrickStore;
+
+void brickClear(BrickStore *store);
+int brickAdd(BrickStore *store, Rectangle rect, char type, Color colour);
+// Rewrites brick i below used, leaving its live bit and damage alone
+void brickSet(BrickStore *store, int i, Rectangle rect, char type, Color colour);
+int brickCount(const BrickStore *store);
+int brickNext(const BrickStore *store, int from);
+// Live bricks that can still break, indestructible ones left out
+int brickRemaining(const BrickStore *store);
+// True once every brick that can break has
+bool brickCleared(const BrickStore *store);
+
+// Visits live bricks only, in index order
+#define FOR_EACH_BRICK(store, i) for (int i = brickNext(store, 0); i >= 0; i = brickNext(store, i+1))
+
+static inline bool brickLive(const BrickStore *store, int i) {
+	return (store->live[i >> 6] >> (i & 63)) & 1;
+}
+
+static inline void brickBreak(BrickStore *store, int i) {
+	store->live[i >> 6] &= ~((uint64_t)1 << (i & 63));
+}
+
+static inline void brickRevive(BrickStore *store, int i) {
+	store->live[i >> 6] |= (uint64_t)1 << (i & 63);
+}
+
+static inline Rectangle brickRect(const BrickStore *store, int i) {
+	return (Rectangle){ store->x[i], store->y[i], store->w[i], store->h[i] };
+}
+
+static inline const BrickType *brickTypeOf(const BrickStore *store, int i) {
+	return &brickTypes[(unsigned char)store->type[i]];
+}
+
+// Colour brick i is drawn in, its type's ramp for the hits it has taken
+static inline Color brickColour(const BrickStore *store, int i) {
+	Color colour = brickTypeOf(store, i)->ramp[store->damage[i]];
+	return colour.a ? colour : store->colour[i];
+}
+
+#endif //_bricks_h_
@@ -0,0 +1,72 @@
+#ifndef _defs_h_
+#define _defs_h_
+
+#define SCREEN_WIDTH (854)
+#define SCREEN_HEIGHT (480)
+
+#define BLOCK_WIDTH 40
+#define BLOCK_HEIGHT 20
+#define BLOCK_SPACING 5
+
+// Bricks a store holds. The grid has room for this many only when they are spread out, a level
+// also has to keep within GRID_CELL_CAPACITY bricks in any one grid cell (grid.h)
+#define MAX_BRICKS 10240
+// Score for each brick broken
+#define BRICK_POINTS 10
+// Pixels around an explosive brick that its blast reaches, enough for the bricks next to it
+#define EXPLOSION_REACH (BLOCK_SPACING+1)
+// Explosions set off per tick, a bigger cascade carries on over the next ticks. One waiting when
+// the queue is full holds its brick together until there's room
+#define BLASTS_PER_TICK 8
+#define MAX_PENDING_BLASTS 256
+// Balls a multiball brick adds as it breaks
+#define MULTIBALL_BALLS 2
+
+// Simulation tick rate, independent of the render frame rate
+#define TICK_RATE 60
+#define TICK_TIME (1.0f/TICK_RATE)
+// Ticks run in one frame before the simulation falls behind instead of catching up
+#define MAX_FRAME_TICKS 8
+
+// Main thread time per frame spent finishing loaded assets, the rest keeps the loading screen drawing
+#define LOAD_SLICE_TIME 0.004
+
+// Pixels per second the ball travels
+#define BALL_SPEED 480
+#define BALL_SIZE 25
+// Upper bound for multiball, the pool is preallocated
+#define MAX_BALLS 512
+// Contacts resolved per frame before the rest of the motion is dropped
+#define MAX_SWEEP_ITERATIONS 8
+// Bricks broken in one tick reported to the frontend, the rest still break but aren't listed
+#define MAX_EVENT_BREAKS 64
+
+// Draw batch for --compact-batch, several buffers so they can stay mapped like the default batch's
+#define COMPACT_BATCH_BUFFERS 3
+#define COMPACT_BATCH_ELEMENTS 8192
+// Quads it grows to between frames when a frame overflows it
+#define COMPACT_BATCH_MAX_ELEMENTS 32768
+
+// Audio device period requested, smaller periods get a hit heard sooner for more mixing callbacks
+#define AUDIO_PERIOD_FRAMES 256
+#define AUDIO_PERIODS 2
+// Hit and click voices mixed at once, a multiball chain plays more and the quietest go on unmixed
+#define MIXED_VOICES 8
+// Hit and click sounds vary in pitch by up to this either way, and pan across this much of the stereo field
+#define SOUND_PITCH_JITTER 0.06f
+#define SOUND_PAN_SPREAD 0.8f
+// Music decoded ahead of the mixer, enough to ride out a long frame hitch
+#define MUSIC_BUFFER_MS 500
+
+// Random stream ids, one per subsystem so drawing numbers in one never shifts another's sequence
+enum {
+	RANDOM_PHYSICS,
+	RANDOM_VISUALS,
+	RANDOM_LEVEL,
+	// Autoplayer paddle offsets
+	RANDOM_POLICY,
+	// Hit and click pitch jitter
+	RANDOM_SOUND
+};
+
+#endif //_defs_h_
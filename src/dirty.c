@@ -0,0 +1,43 @@
+#include "dirty.h"
+
+#include <math.h>
+
+static Rectangle merge(Rectangle a, Rectangle b) {
+	float x0 = fminf(a.x, b.x), y0 = fminf(a.y, b.y);
+	float x1 = fmaxf(a.x+a.width, b.x+b.width), y1 = fmaxf(a.y+a.height, b.y+b.height);
+	return (Rectangle){ x0, y0, x1-x0, y1-y0 };
+}
+
+void dirtyReset(DirtyRegion *dirty) {
+	dirty->count = 0;
+	dirty->full = false;
+}
+
+void dirtyAdd(DirtyRegion *dirty, Rectangle rect) {
+	if (dirty->full || rect.width <= 0 || rect.height <= 0)
+		return;
+
+	// Snap outwards to whole pixels so scissoring never leaves a stale edge
+	float x0 = floorf(rect.x), y0 = floorf(rect.y);
+	rect = (Rectangle){ x0, y0, ceilf(rect.x+rect.width) - x0, ceilf(rect.y+rect.height) - y0 };
+
+	// Overlapping areas are redrawn once as their union
+	for (int i = 0; i < dirty->count; i++) {
+		if (CheckCollisionRecs(dirty->rects[i], rect)) {
+			rect = merge(dirty->rects[i], rect);
+			dirty->rects[i] = dirty->rects[--dirty->count];
+			i = -1;
+		}
+	}
+
+	if (dirty->count == MAX_DIRTY_RECTS) {
+		dirty->full = true;
+		return;
+	}
+
+	dirty->rects[dirty->count++] = rect;
+}
+
+void dirtyAll(DirtyRegion *dirty) {
+	dirty->full = true;
+}
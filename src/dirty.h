@@ -0,0 +1,19 @@
+#ifndef _dirty_h_
+#define _dirty_h_
+
+#include "raylib.h"
+
+#define MAX_DIRTY_RECTS 16
+
+// Screen areas that changed since the retained frame was last drawn
+typedef struct DirtyRegion {
+	Rectangle rects[MAX_DIRTY_RECTS];
+	int count;
+	bool full;
+} DirtyRegion;
+
+void dirtyReset(DirtyRegion *dirty);
+void dirtyAdd(DirtyRegion *dirty, Rectangle rect);
+void dirtyAll(DirtyRegion *dirty);
+
+#endif //_dirty_h_
@@ -0,0 +1,107 @@
+#include "field.h"
+
+static const Color palette[] = { YELLOW, RED, ORANGE, BLUE, LIME, DARKPURPLE };
+
+void fieldGenerateRow(unsigned int seed, int row, FieldRow *out) {
+	RandomStream random;
+	SetRandomStreamSeed(&random, seed, RANDOM_FIELD_ROWS + row);
+
+	// Fuller rows as the game goes on, and now and then a row of one colour with a gap to aim for
+	float density = 0.5f + row*0.01f;
+	if (density > 0.9f)
+		density = 0.9f;
+	bool solid = GetRandomStreamValue(&random, 0, 7) == 0;
+	int gap = GetRandomStreamValue(&random, 0, FIELD_COLUMNS-1);
+	Color colour = palette[GetRandomStreamValue(&random, 0, 5)];
+
+	out->mask = 0;
+	for (int c = 0; c < FIELD_COLUMNS; c++) {
+		bool present = solid ? c != gap : GetRandomStreamFloat(&random) < density;
+		if (present)
+			out->mask |= 1u << c;
+		out->colour[c] = solid ? colour : palette[GetRandomStreamValue(&random, 0, 5)];
+	}
+}
+
+static void *fieldRowsMain(void *arg) {
+	FieldRows *rows = arg;
+
+	pthread_mutex_lock(&rows->lock);
+	for (;;) {
+		while (!rows->quit && rows->end >= rows->wanted)
+			pthread_cond_wait(&rows->wake, &rows->lock);
+		if (rows->quit)
+			break;
+
+		int row = rows->end;
+		pthread_mutex_unlock(&rows->lock);
+
+		FieldRow generated;
+		fieldGenerateRow(rows->seed, row, &generated);
+
+		pthread_mutex_lock(&rows->lock);
+		// The game may have taken rows past it meanwhile
+		if (row == rows->end) {
+			rows->rows[row % FIELD_AHEAD] = generated;
+			rows->end++;
+		}
+	}
+	pthread_mutex_unlock(&rows->lock);
+
+	return NULL;
+}
+
+bool fieldRowsStart(FieldRows *rows, unsigned int seed) {
+	rows->seed = seed;
+	rows->first = 0;
+	rows->end = 0;
+	rows->wanted = FIELD_AHEAD;
+	rows->quit = false;
+
+	pthread_mutex_init(&rows->lock, NULL);
+	pthread_cond_init(&rows->wake, NULL);
+	rows->running = pthread_create(&rows->thread, NULL, fieldRowsMain, rows) == 0;
+	if (!rows->running) {
+		pthread_cond_destroy(&rows->wake);
+		pthread_mutex_destroy(&rows->lock);
+	}
+	return rows->running;
+}
+
+void fieldRowsStop(FieldRows *rows) {
+	if (!rows->running)
+		return;
+
+	pthread_mutex_lock(&rows->lock);
+	rows->quit = true;
+	pthread_cond_signal(&rows->wake);
+	pthread_mutex_unlock(&rows->lock);
+
+	pthread_join(rows->thread, NULL);
+	pthread_cond_destroy(&rows->wake);
+	pthread_mutex_destroy(&rows->lock);
+	rows->running = false;
+}
+
+void fieldRowsGet(FieldRows *rows, unsigned int seed, int row, FieldRow *out) {
+	bool ready = false;
+	if (rows && rows->running && rows->seed == seed) {
+		pthread_mutex_lock(&rows->lock);
+		if (row >= rows->first && row < rows->end) {
+			*out = rows->rows[row % FIELD_AHEAD];
+			ready = true;
+		}
+		// Rows are taken in order, older ones are only asked for again after a rewind
+		if (row >= rows->first) {
+			rows->first = row + 1;
+			if (rows->end < rows->first)
+				rows->end = rows->first;
+			rows->wanted = row + FIELD_AHEAD;
+			pthread_cond_signal(&rows->wake);
+		}
+		pthread_mutex_unlock(&rows->lock);
+	}
+
+	if (!ready)
+		fieldGenerateRow(seed, row, out);
+}
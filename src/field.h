@@ -0,0 +1,69 @@
+#ifndef _field_h_
+#define _field_h_
+
+#include <stdint.h>
+#include <pthread.h>
+
+#include "raylib.h"
+#include "defs.h"
+#include "grid.h"
+
+// Attack mode's brick field: a ring of FIELD_ROWS rows in the brick store, brick slot*FIELD_COLUMNS
+// + column. Bricks keep the field coordinates they spawned with, row r at fieldRowY(r), and the
+// whole field is drawn and collided scroll pixels lower. Row r spawns once scroll reaches
+// r*FIELD_ROW_PITCH, so advancing is a counter and a new row, nothing already placed moves
+#define FIELD_COLUMNS 17
+#define FIELD_ROWS 16
+#define FIELD_ROW_PITCH (BLOCK_HEIGHT+BLOCK_SPACING)
+#define FIELD_RING_HEIGHT (FIELD_ROWS*FIELD_ROW_PITCH)
+#define FIELD_START_ROWS 6
+// Rows sit on the grid's pitch and the wrapped grid is taller than the ring, so a cell never holds
+// more than one field brick. Fails to compile if that stops being true
+typedef char FieldFitsGrid[FIELD_ROWS <= GRID_ROWS && FIELD_ROW_PITCH == GRID_CELL_HEIGHT ? 1 : -1];
+// Pixels per second the field comes down
+#define FIELD_SPEED 8
+// The game is lost when a live brick's bottom edge reaches this far down the screen. It is
+// above the point where the ring would have to reuse a row that still has bricks
+#define FIELD_DANGER_Y 400
+// Rows the generator thread keeps ready
+#define FIELD_AHEAD 32
+
+// Random stream ids from here up are one per field row
+#define RANDOM_FIELD_ROWS 16
+
+typedef struct FieldRow {
+	uint32_t mask;
+	Color colour[FIELD_COLUMNS];
+} FieldRow;
+
+static inline float fieldRowY(int row) {
+	return GRID_ORIGIN_Y - row*FIELD_ROW_PITCH;
+}
+
+// Bricks a row holds, the same for a given seed and row however often and on whichever thread it runs
+void fieldGenerateRow(unsigned int seed, int row, FieldRow *out);
+
+// Generates rows ahead of the game on a background thread
+typedef struct FieldRows {
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	bool running;
+	bool quit;
+
+	unsigned int seed;
+	// Rows [first, end) are ready, row r in rows[r % FIELD_AHEAD]. The thread works up to wanted
+	FieldRow rows[FIELD_AHEAD];
+	int first;
+	int end;
+	int wanted;
+} FieldRows;
+
+bool fieldRowsStart(FieldRows *rows, unsigned int seed);
+void fieldRowsStop(FieldRows *rows);
+
+// Takes a row for the game, from the ones ready when it is there and generated on the spot
+// otherwise, as after a rewind. rows may be NULL
+void fieldRowsGet(FieldRows *rows, unsigned int seed, int row, FieldRow *out);
+
+#endif //_field_h_
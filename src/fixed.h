@@ -0,0 +1,53 @@
+#ifndef _fixed_h_
+#define _fixed_h_
+
+#include <stdint.h>
+
+// Q16.16 fixed point. Only integer arithmetic, so every platform computes the same bits.
+// Arena coordinates stay far below the 32767 integer limit
+typedef int32_t Fixed;
+
+#define FIXED_SHIFT 16
+#define FIXED_ONE (1 << FIXED_SHIFT)
+// Angles are in binary units, FIXED_TURN is a full turn
+#define FIXED_TURN 1024
+
+typedef struct FixedVec {
+	Fixed x, y;
+} FixedVec;
+
+typedef struct FixedRect {
+	Fixed x, y, width, height;
+} FixedRect;
+
+static inline Fixed fixedFromInt(int v) {
+	return v*FIXED_ONE;
+}
+
+// Truncates toward zero. Exact for any float already on the Q16.16 grid
+static inline Fixed fixedFromFloat(float v) {
+	return (Fixed)(v*FIXED_ONE);
+}
+
+static inline float fixedToFloat(Fixed v) {
+	return (float)v*(1.0f/FIXED_ONE);
+}
+
+static inline Fixed fixedMul(Fixed a, Fixed b) {
+	return (Fixed)(((int64_t)a*b) / FIXED_ONE);
+}
+
+static inline Fixed fixedDiv(Fixed a, Fixed b) {
+	return (Fixed)(((int64_t)a*FIXED_ONE) / b);
+}
+
+static inline FixedRect fixedRect(float x, float y, float width, float height) {
+	return (FixedRect){ fixedFromFloat(x), fixedFromFloat(y), fixedFromFloat(width), fixedFromFloat(height) };
+}
+
+// Table lookups, no libm
+Fixed fixedSin(int angle);
+Fixed fixedCos(int angle);
+FixedVec fixedRotate(FixedVec v, int angle);
+
+#endif //_fixed_h_
@@ -0,0 +1,816 @@
+#include "game.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "raymath.h"
+#include "sweep.h"
+
+static const Rectangle top		= { 0,-10, SCREEN_WIDTH,10 };
+static const Rectangle bottom	= { 0,SCREEN_HEIGHT, SCREEN_WIDTH,10 };
+static const Rectangle left		= { -10,0, 10,SCREEN_HEIGHT };
+static const Rectangle right	= { SCREEN_WIDTH,0, 10,SCREEN_HEIGHT };
+
+static const FixedRect fixedWalls[4] = {
+	{ 0, -10*FIXED_ONE, SCREEN_WIDTH*FIXED_ONE, 10*FIXED_ONE },
+	{ 0, SCREEN_HEIGHT*FIXED_ONE, SCREEN_WIDTH*FIXED_ONE, 10*FIXED_ONE },
+	{ -10*FIXED_ONE, 0, 10*FIXED_ONE, SCREEN_HEIGHT*FIXED_ONE },
+	{ SCREEN_WIDTH*FIXED_ONE, 0, 10*FIXED_ONE, SCREEN_HEIGHT*FIXED_ONE }
+};
+
+static Color randomColour(Game *game) {
+	int i = GetRandomStreamValue(&game->levelRandom, 0, 5);
+	switch (i) {
+		case 0: return YELLOW;
+		case 1: return RED;
+		case 2: return ORANGE;
+		case 3: return BLUE;
+		case 4: return LIME;
+		default: return DARKPURPLE;
+	}
+}
+
+// Mirrors the velocity off the face with the given normal, then turns it by jitter radians
+static Vector2 bounce(Vector2 velocity, Vector2 normal, float jitter) {
+	if (normal.x != 0)
+		velocity.x = -velocity.x;
+	if (normal.y != 0)
+		velocity.y = -velocity.y;
+
+	// Only randomized bounces need the heading as an angle
+	if (jitter != 0)
+		velocity = Vector2Rotate(velocity, jitter);
+
+	return velocity;
+}
+
+static void resetPlay(Game *game) {
+	game->state = STATE_TITLE;
+
+	ballClear(&game->balls);
+	game->paddle = (Rectangle){ 50, 460, 100, 20 };
+	if (game->fixedPhysics) {
+		// A sixth of a turn is the PI/3 heading of the float path
+		FixedVec velocity = { fixedCos(FIXED_TURN/6)*BALL_SPEED, fixedSin(FIXED_TURN/6)*BALL_SPEED };
+		ballSpawnFixed(&game->balls, &game->fixedBalls, (FixedVec){ 300*FIXED_ONE, 300*FIXED_ONE }, velocity);
+		game->fixedPaddleX = fixedFromFloat(game->paddle.x);
+	} else {
+		ballSpawn(&game->balls, (Vector2){ 300,300 }, (Vector2){ cosf(PI/3)*BALL_SPEED, sinf(PI/3)*BALL_SPEED });
+	}
+
+	game->prevPaddleX = game->paddle.x;
+
+	game->rivalPaddle = (Rectangle){ SCREEN_WIDTH - 150, 0, 100, 20 };
+	game->fixedRivalPaddleX = fixedFromFloat(game->rivalPaddle.x);
+	game->prevRivalPaddleX = game->rivalPaddle.x;
+	game->rivalScore = 0;
+	memset(game->ballOwner, 0, sizeof(game->ballOwner));
+
+	game->hoveringPlayButton = false;
+	game->score = 0;
+
+	game->blastHead = 0;
+	game->blastCount = 0;
+}
+
+void gameSeed(Game *game, unsigned int seed) {
+	SetRandomStreamSeed(&game->physicsRandom, seed, RANDOM_PHYSICS);
+	SetRandomStreamSeed(&game->levelRandom, seed, RANDOM_LEVEL);
+	game->fieldSeed = seed;
+}
+
+static int fieldSlot(int row) {
+	return (row % FIELD_ROWS)*FIELD_COLUMNS;
+}
+
+static Rectangle fieldRect(int row, int column) {
+	return (Rectangle){ GRID_ORIGIN_X + column*(BLOCK_WIDTH+BLOCK_SPACING), fieldRowY(row), BLOCK_WIDTH, BLOCK_HEIGHT };
+}
+
+static bool rowEmpty(const Game *game, int row) {
+	int slot = fieldSlot(row);
+	for (int c = 0; c < FIELD_COLUMNS; c++) {
+		if (brickLive(&game->bricks, slot + c))
+			return false;
+	}
+	return true;
+}
+
+// Indexes a live brick. Layouts on the grid's own pitch put one brick in a cell, and the field's
+// ring is no taller than the grid, so this only fails for a broken layout. The brick is broken
+// then rather than left where nothing can hit it
+static bool placeBrick(Game *game, int i, Rectangle rect) {
+	if (gridInsert(&game->grid, i, rect))
+		return true;
+	gridRemove(&game->grid, i, rect);
+	brickBreak(&game->bricks, i);
+	TraceLog(LOG_WARNING, "GAME: No room in the grid for brick %d", i);
+	return false;
+}
+
+// Places a new row in the slot of the one FIELD_ROWS before it. Bricks that would appear on top
+// of a ball are left out
+static void spawnRow(Game *game, int row) {
+	BrickStore *store = &game->bricks;
+	FieldRow generated;
+	fieldRowsGet(game->fieldRows, game->fieldSeed, row, &generated);
+
+	int slot = fieldSlot(row);
+	for (int c = 0; c < FIELD_COLUMNS; c++) {
+		int i = slot + c;
+		if (brickLive(store, i)) {
+			brickBreak(store, i);
+			gridRemove(&game->grid, i, brickRect(store, i));
+		}
+
+		Rectangle rect = fieldRect(row, c);
+		brickSet(store, i, rect, BRICK_NORMAL, generated.colour[c]);
+		store->damage[i] = 0;
+		if (!(generated.mask & (1u << c)))
+			continue;
+
+		Rectangle onScreen = gameBrickRect(game, i);
+		bool blocked = false;
+		for (int b = 0; b < game->balls.count && !blocked; b++) {
+			blocked = CheckCollisionRecs(onScreen, ballRect(&game->balls, b));
+		}
+		if (!blocked) {
+			brickRevive(store, i);
+			placeBrick(game, i, rect);
+		}
+	}
+	game->fieldHead = row;
+}
+
+static void initField(Game *game) {
+	brickClear(&game->bricks);
+	game->bricks.used = FIELD_ROWS*FIELD_COLUMNS;
+	gridClear(&game->grid);
+	game->grid.wrapRows = true;
+
+	game->fieldHead = -1;
+	game->fieldTail = 0;
+	game->scroll = (FIELD_START_ROWS-1)*FIELD_ROW_PITCH;
+	game->fixedScroll = fixedFromInt((FIELD_START_ROWS-1)*FIELD_ROW_PITCH);
+	for (int row = 0; row < FIELD_START_ROWS; row++) {
+		spawnRow(game, row);
+	}
+}
+
+// Moves the field down a tick's worth, spawning rows as room opens at the top, and ends the
+// game once the lowest live row reaches the danger line
+static void advanceField(Game *game) {
+	int scrolledRows;
+	if (game->fixedPhysics) {
+		game->fixedScroll += FIELD_SPEED*FIXED_ONE/TICK_RATE;
+		game->scroll = fixedToFloat(game->fixedScroll);
+		scrolledRows = game->fixedScroll / (FIELD_ROW_PITCH*FIXED_ONE);
+	} else {
+		game->scroll += FIELD_SPEED*TICK_TIME;
+		scrolledRows = (int)(game->scroll / FIELD_ROW_PITCH);
+	}
+
+	while (game->fieldTail < game->fieldHead && rowEmpty(game, game->fieldTail))
+		game->fieldTail++;
+	while (game->fieldHead < scrolledRows && game->fieldHead+1 - game->fieldTail < FIELD_ROWS)
+		spawnRow(game, game->fieldHead + 1);
+
+	if (!rowEmpty(game, game->fieldTail) && fieldRowY(game->fieldTail) + game->scroll + BLOCK_HEIGHT >= FIELD_DANGER_Y)
+		game->state = STATE_LOST;
+}
+
+void gameInit(Game *game) {
+	resetPlay(game);
+
+	if (game->attack) {
+		initField(game);
+		return;
+	}
+
+	brickClear(&game->bricks);
+	gridClear(&game->grid);
+
+	for (int x = 0; x < 17; x++) {
+		for (int y = 0; y < 6; y++) {
+			Rectangle rect = {
+				40+(x*(BLOCK_WIDTH+BLOCK_SPACING)),
+				50+(y*(BLOCK_HEIGHT+BLOCK_SPACING)),
+				BLOCK_WIDTH, BLOCK_HEIGHT };
+
+			int n = brickAdd(&game->bricks, rect, BRICK_NORMAL, randomColour(game));
+			if (n < 0)
+				break;
+
+			placeBrick(game, n, rect);
+		}
+	}
+}
+
+bool gameInitLevel(Game *game, const Level *level) {
+	resetPlay(game);
+	return levelBuild(level, &game->bricks, &game->grid);
+}
+
+static void tickTitle(Game *game, GameInput input) {
+	Vector2 mouse = input.mouse;
+
+	game->hoveringPlayButton = (mouse.x > 330 && mouse.x < 330+165 && mouse.y > 190 && mouse.y < 190+60);
+	if (game->hoveringPlayButton && input.mouseDown) {
+		game->state = STATE_PLAYING;
+	}
+}
+
+// Below this many balls waking the workers costs more than moving the balls
+#define PARALLEL_MIN_BALLS 64
+
+// Bricks near a screen rect, the field's scroll taken off to query in store coordinates
+static int queryBricks(const Game *game, Rectangle rect, int *out) {
+	rect.y -= game->scroll;
+	return gridQuery(&game->grid, rect, out, GRID_MAX_QUERY);
+}
+
+static bool hitThisTick(const Game *game, int b, int brick) {
+	for (int i = 0; i < game->ballHitCount[b]; i++) {
+		if (game->ballHits[b][i] == brick)
+			return true;
+	}
+	return false;
+}
+
+// A paddle moves by teleporting to the cursor, so it can land on a ball. The ball is pushed out
+// the shortest way and bounces if it was heading in, rather than sweeping on from inside. True for a bounce
+static bool pushOut(Rectangle *ball, Vector2 *velocity, Rectangle solid) {
+	Vector2 normal;
+	float depth;
+	if (!GetCollisionRecsContact(*ball, solid, &normal, &depth))
+		return false;
+
+	ball->x += normal.x*depth;
+	ball->y += normal.y*depth;
+	if (Vector2DotProduct(*velocity, normal) >= 0.0f)
+		return false;
+
+	*velocity = bounce(*velocity, normal, 0);
+	return true;
+}
+
+// Sweeps one ball to each time of impact until its tick's motion is used up. Bricks are only
+// read, the ones hit are recorded for the merge and count as gone for this ball's later contacts
+static void solveBall(Game *game, int b) {
+	BallPool *balls = &game->balls;
+	Rectangle ball = ballRect(balls, b);
+	Vector2 velocity = { balls->vx[b], balls->vy[b] };
+	const Rectangle *paddle = &game->paddle;
+	int solidCount = game->versus ? 6 : 5;
+
+	for (int p = 0; p < solidCount-4; p++) {
+		if (pushOut(&ball, &velocity, p ? game->rivalPaddle : *paddle)) {
+			game->ballClicks[b]++;
+			game->ballOwner[b] = p;
+		}
+	}
+
+	float remaining = 1.0f;
+	for (int iter = 0; iter < MAX_SWEEP_ITERATIONS && remaining > 0.0f; iter++) {
+		Vector2 delta = Vector2Scale(velocity, TICK_TIME*remaining);
+
+		float hitTime = 1.0f;
+		Vector2 hitNormal = { 0 };
+		int hitSolid = -1;
+		int hitBrick = -1;
+
+		Rectangle solids[] = { top, bottom, left, right, *paddle, game->rivalPaddle };
+		for (int i = 0; i < solidCount; i++) {
+			float t;
+			Vector2 normal;
+			if (sweepRect(ball, delta, solids[i], &t, &normal) && t < hitTime) {
+				hitTime = t;
+				hitNormal = normal;
+				hitSolid = i;
+			}
+		}
+
+		Rectangle swept = {
+			fminf(ball.x, ball.x+delta.x), fminf(ball.y, ball.y+delta.y),
+			ball.width+fabsf(delta.x), ball.height+fabsf(delta.y) };
+
+		int nearby[GRID_MAX_QUERY];
+		int nearbyCount = queryBricks(game, swept, nearby);
+
+		for (int c = 0; c < nearbyCount; c++) {
+			int i = nearby[c];
+			float t;
+			Vector2 normal;
+			if (brickLive(&game->bricks, i) && !hitThisTick(game, b, i) &&
+				sweepRect(ball, delta, gameBrickRect(game, i), &t, &normal) && t < hitTime) {
+				hitTime = t;
+				hitNormal = normal;
+				hitBrick = i;
+				hitSolid = -1;
+			}
+		}
+
+		ball.x += delta.x*hitTime;
+		ball.y += delta.y*hitTime;
+		remaining *= 1.0f - hitTime;
+
+		if (hitBrick >= 0) {
+			game->ballHits[b][game->ballHitCount[b]++] = hitBrick;
+			velocity = bounce(velocity, hitNormal, 0);
+		} else if (hitSolid >= 0) {
+			velocity = bounce(velocity, hitNormal, 0);
+			game->ballClicks[b]++;
+			if (hitSolid >= 4)
+				game->ballOwner[b] = hitSolid - 4;
+		} else {
+			break;
+		}
+	}
+
+	balls->x[b] = ball.x;
+	balls->y[b] = ball.y;
+	balls->vx[b] = velocity.x;
+	balls->vy[b] = velocity.y;
+}
+
+// True if the box touches nothing solid: arena walls, the paddle or a live brick
+static bool boxClear(const Game *game, Rectangle box) {
+	if (box.x <= 0 || box.y <= 0 || box.x+box.width >= SCREEN_WIDTH || box.y+box.height >= SCREEN_HEIGHT)
+		return false;
+	if (CheckCollisionRecs(box, game->paddle))
+		return false;
+	if (game->versus && CheckCollisionRecs(box, game->rivalPaddle))
+		return false;
+
+	// The live ones among the nearby bricks are gathered into arrays and tested in one batch
+	int nearby[GRID_MAX_QUERY];
+	int nearbyCount = queryBricks(game, box, nearby);
+	float x[GRID_MAX_QUERY], y[GRID_MAX_QUERY], w[GRID_MAX_QUERY], h[GRID_MAX_QUERY];
+	int count = 0;
+	for (int c = 0; c < nearbyCount; c++) {
+		int i = nearby[c];
+		if (brickLive(&game->bricks, i)) {
+			x[count] = game->bricks.x[i];
+			y[count] = game->bricks.y[i] + game->scroll;
+			w[count] = game->bricks.w[i];
+			h[count] = game->bricks.h[i];
+			count++;
+		}
+	}
+	return CheckCollisionRecsMask(box, x, y, w, h, count) == 0;
+}
+
+// Moves balls [begin, end). Only writes those balls' own state, so ranges can run on any thread in any order
+static void moveBalls(void *context, int begin, int end) {
+	Game *game = context;
+	BallPool *balls = &game->balls;
+
+	for (int i = begin; i < end; i++) {
+		balls->prevX[i] = balls->x[i];
+		balls->prevY[i] = balls->y[i];
+		game->ballHitCount[i] = 0;
+		game->ballClicks[i] = 0;
+
+		// Most balls are in open space on any given tick. One whose whole motion, grown by a pixel,
+		// clears every solid can't hit anything and only needs integrating
+		float dx = balls->vx[i]*TICK_TIME, dy = balls->vy[i]*TICK_TIME;
+		Rectangle swept = {
+			fminf(balls->x[i], balls->x[i]+dx) - 1, fminf(balls->y[i], balls->y[i]+dy) - 1,
+			BALL_SIZE+fabsf(dx) + 2, BALL_SIZE+fabsf(dy) + 2 };
+
+		if (boxClear(game, swept)) {
+			balls->x[i] += dx;
+			balls->y[i] += dy;
+		} else {
+			solveBall(game, i);
+		}
+	}
+}
+
+static FixedRect brickRectFixed(const Game *game, int i) {
+	const BrickStore *store = &game->bricks;
+	FixedRect rect = fixedRect(store->x[i], store->y[i], store->w[i], store->h[i]);
+	rect.y += game->fixedScroll;
+	return rect;
+}
+
+static FixedRect paddleRectFixed(const Rectangle *paddle, Fixed x) {
+	return (FixedRect){ x, fixedFromFloat(paddle->y), fixedFromFloat(paddle->width), fixedFromFloat(paddle->height) };
+}
+
+static bool overlapsFixed(FixedRect a, FixedRect b) {
+	return a.x < b.x+b.width && a.x+a.width > b.x && a.y < b.y+b.height && a.y+a.height > b.y;
+}
+
+// Widens a fixed box to whole pixels in store coordinates for the grid, so the float query can
+// only return more bricks
+static int queryBricksFixed(const Game *game, FixedRect box, int *out) {
+	box.y -= game->fixedScroll;
+	Rectangle rect = { (float)(box.x >> FIXED_SHIFT), (float)(box.y >> FIXED_SHIFT),
+		(float)(box.width >> FIXED_SHIFT) + 2, (float)(box.height >> FIXED_SHIFT) + 2 };
+	return gridQuery(&game->grid, rect, out, GRID_MAX_QUERY);
+}
+
+// solveBall in Q16.16. Remaining motion and contact times are fractions of the tick
+static void solveBallFixed(Game *game, int b) {
+	FixedBalls *balls = &game->fixedBalls;
+	FixedRect ball = ballRectFixed(balls, b);
+	FixedVec velocity = { balls->vx[b], balls->vy[b] };
+
+	FixedRect solids[6] = { fixedWalls[0], fixedWalls[1], fixedWalls[2], fixedWalls[3],
+		paddleRectFixed(&game->paddle, game->fixedPaddleX), paddleRectFixed(&game->rivalPaddle, game->fixedRivalPaddleX) };
+	int solidCount = game->versus ? 6 : 5;
+
+	for (int p = 4; p < solidCount; p++) {
+		FixedVec normal;
+		Fixed depth;
+		if (contactRectFixed(ball, solids[p], &normal, &depth)) {
+			ball.x += fixedMul(normal.x, depth);
+			ball.y += fixedMul(normal.y, depth);
+			if ((int64_t)velocity.x*normal.x + (int64_t)velocity.y*normal.y < 0) {
+				if (normal.x != 0)
+					velocity.x = -velocity.x;
+				if (normal.y != 0)
+					velocity.y = -velocity.y;
+				game->ballClicks[b]++;
+				game->ballOwner[b] = p - 4;
+			}
+		}
+	}
+
+	Fixed remaining = FIXED_ONE;
+	for (int iter = 0; iter < MAX_SWEEP_ITERATIONS && remaining > 0; iter++) {
+		FixedVec delta = { fixedMul(velocity.x, remaining)/TICK_RATE, fixedMul(velocity.y, remaining)/TICK_RATE };
+
+		Fixed hitTime = FIXED_ONE;
+		FixedVec hitNormal = { 0 };
+		int hitSolid = -1;
+		int hitBrick = -1;
+
+		for (int i = 0; i < solidCount; i++) {
+			Fixed t;
+			FixedVec normal;
+			if (sweepRectFixed(ball, delta, solids[i], &t, &normal) && t < hitTime) {
+				hitTime = t;
+				hitNormal = normal;
+				hitSolid = i;
+			}
+		}
+
+		FixedRect swept = {
+			delta.x < 0 ? ball.x+delta.x : ball.x, delta.y < 0 ? ball.y+delta.y : ball.y,
+			ball.width + (delta.x < 0 ? -delta.x : delta.x), ball.height + (delta.y < 0 ? -delta.y : delta.y) };
+
+		int nearby[GRID_MAX_QUERY];
+		int nearbyCount = queryBricksFixed(game, swept, nearby);
+
+		for (int c = 0; c < nearbyCount; c++) {
+			int i = nearby[c];
+			Fixed t;
+			FixedVec normal;
+			if (brickLive(&game->bricks, i) && !hitThisTick(game, b, i) &&
+				sweepRectFixed(ball, delta, brickRectFixed(game, i), &t, &normal) && t < hitTime) {
+				hitTime = t;
+				hitNormal = normal;
+				hitBrick = i;
+				hitSolid = -1;
+			}
+		}
+
+		ball.x += fixedMul(delta.x, hitTime);
+		ball.y += fixedMul(delta.y, hitTime);
+		remaining = fixedMul(remaining, FIXED_ONE - hitTime);
+
+		if (hitBrick < 0 && hitSolid < 0)
+			break;
+
+		if (hitNormal.x != 0)
+			velocity.x = -velocity.x;
+		if (hitNormal.y != 0)
+			velocity.y = -velocity.y;
+
+		if (hitBrick >= 0) {
+			game->ballHits[b][game->ballHitCount[b]++] = hitBrick;
+		} else {
+			game->ballClicks[b]++;
+			if (hitSolid >= 4)
+				game->ballOwner[b] = hitSolid - 4;
+		}
+	}
+
+	balls->x[b] = ball.x;
+	balls->y[b] = ball.y;
+	balls->vx[b] = velocity.x;
+	balls->vy[b] = velocity.y;
+}
+
+static bool boxClearFixed(const Game *game, FixedRect box) {
+	if (box.x <= 0 || box.y <= 0 || box.x+box.width >= SCREEN_WIDTH*FIXED_ONE || box.y+box.height >= SCREEN_HEIGHT*FIXED_ONE)
+		return false;
+	if (overlapsFixed(box, paddleRectFixed(&game->paddle, game->fixedPaddleX)))
+		return false;
+	if (game->versus && overlapsFixed(box, paddleRectFixed(&game->rivalPaddle, game->fixedRivalPaddleX)))
+		return false;
+
+	int nearby[GRID_MAX_QUERY];
+	int nearbyCount = queryBricksFixed(game, box, nearby);
+	for (int c = 0; c < nearbyCount; c++) {
+		if (brickLive(&game->bricks, nearby[c]) && overlapsFixed(box, brickRectFixed(game, nearby[c])))
+			return false;
+	}
+	return true;
+}
+
+// moveBalls for fixed-point physics, the float copies are refreshed for drawing as each ball finishes
+static void moveBallsFixed(void *context, int begin, int end) {
+	Game *game = context;
+	BallPool *balls = &game->balls;
+	FixedBalls *fixed = &game->fixedBalls;
+
+	for (int i = begin; i < end; i++) {
+		balls->prevX[i] = balls->x[i];
+		balls->prevY[i] = balls->y[i];
+		game->ballHitCount[i] = 0;
+		game->ballClicks[i] = 0;
+
+		Fixed dx = fixed->vx[i]/TICK_RATE, dy = fixed->vy[i]/TICK_RATE;
+		FixedRect swept = {
+			(dx < 0 ? fixed->x[i]+dx : fixed->x[i]) - FIXED_ONE, (dy < 0 ? fixed->y[i]+dy : fixed->y[i]) - FIXED_ONE,
+			BALL_SIZE*FIXED_ONE + (dx < 0 ? -dx : dx) + 2*FIXED_ONE, BALL_SIZE*FIXED_ONE + (dy < 0 ? -dy : dy) + 2*FIXED_ONE };
+
+		if (boxClearFixed(game, swept)) {
+			fixed->x[i] += dx;
+			fixed->y[i] += dy;
+		} else {
+			solveBallFixed(game, i);
+		}
+
+		ballSyncFixed(balls, fixed, i);
+	}
+}
+
+// Centres a paddle on the input's cursor x
+static void movePaddle(const Game *game, Rectangle *paddle, Fixed *fixedX, float *prevX, GameInput input) {
+	*prevX = paddle->x;
+	if (game->fixedPhysics) {
+		*fixedX = fixedFromFloat(input.mouse.x) - fixedFromFloat(paddle->width)/2;
+		paddle->x = fixedToFloat(*fixedX);
+	} else {
+		paddle->x = input.mouse.x - paddle->width/2;
+	}
+}
+
+// Runs as a brick breaks. False leaves the brick standing, for an explosion with no room to queue
+typedef bool (*BreakEffect)(Game *game, int brick, int owner);
+
+static bool noEffect(Game *game, int brick, int owner) {
+	(void)game;
+	(void)brick;
+	(void)owner;
+	return true;
+}
+
+// Explosions go off in resolveBlasts, a few a tick, never inside the merge
+static bool queueBlast(Game *game, int brick, int owner) {
+	if (game->blastCount >= MAX_PENDING_BLASTS)
+		return false;
+
+	int slot = (game->blastHead + game->blastCount++) % MAX_PENDING_BLASTS;
+	game->blasts[slot] = brick;
+	game->blastOwners[slot] = owner;
+	return true;
+}
+
+static bool multiball(Game *game, int brick, int owner) {
+	(void)brick;
+	int first = game->balls.count;
+	int added = gameAddBalls(game, MULTIBALL_BALLS);
+	for (int b = first; b < first + added; b++) {
+		game->ballOwner[b] = owner;
+	}
+	return true;
+}
+
+static const BreakEffect breakEffects[BRICK_EFFECT_COUNT] = {
+	[BRICK_EFFECT_NONE] = noEffect,
+	[BRICK_EFFECT_EXPLODE] = queueBlast,
+	[BRICK_EFFECT_MULTIBALL] = multiball,
+};
+
+// Runs a live brick's effect, then takes it out and scores it for owner
+static void breakBrick(Game *game, int brick, int owner, GameEvents *events) {
+	if (!breakEffects[brickTypeOf(&game->bricks, brick)->effect](game, brick, owner))
+		return;
+
+	brickBreak(&game->bricks, brick);
+	gridRemove(&game->grid, brick, brickRect(&game->bricks, brick));
+	if (owner)
+		game->rivalScore += BRICK_POINTS;
+	else
+		game->score += BRICK_POINTS;
+	if (events->brokenCount < MAX_EVENT_BREAKS)
+		events->broken[events->brokenCount++] = brick;
+}
+
+// One contact of a ball with a brick. Every hit makes its type's sound, the brick breaks once its
+// hit points are used up
+static void hitBrick(Game *game, int brick, int owner, GameEvents *events) {
+	BrickStore *store = &game->bricks;
+	const BrickType *type = brickTypeOf(store, brick);
+	events->hits += type->sound == BRICK_SOUND_HIT;
+	events->clicks += type->sound == BRICK_SOUND_CLICK;
+
+	if (!brickLive(store, brick) || !type->hitPoints)
+		return;
+	// Damage stops one short of the hit points, so a broken brick keeps the colour it had
+	if (store->damage[brick] + 1 < type->hitPoints) {
+		store->damage[brick]++;
+		return;
+	}
+
+	breakBrick(game, brick, owner, events);
+}
+
+// Sets off up to BLASTS_PER_TICK queued explosions, oldest first. Each breaks the breakable bricks
+// within EXPLOSION_REACH, and the explosive ones among them queue behind it, so a cascade spreads
+// a ring at a time over as many ticks as it needs instead of all in the tick it started
+static void resolveBlasts(Game *game, GameEvents *events) {
+	const BrickStore *store = &game->bricks;
+
+	for (int n = 0; n < BLASTS_PER_TICK && game->blastCount > 0; n++) {
+		int brick = game->blasts[game->blastHead];
+		int owner = game->blastOwners[game->blastHead];
+		game->blastHead = (game->blastHead + 1) % MAX_PENDING_BLASTS;
+		game->blastCount--;
+
+		Rectangle blast = brickRect(store, brick);
+		blast.x -= EXPLOSION_REACH;
+		blast.y -= EXPLOSION_REACH;
+		blast.width += 2*EXPLOSION_REACH;
+		blast.height += 2*EXPLOSION_REACH;
+
+		int nearby[GRID_MAX_QUERY];
+		int nearbyCount = gridQuery(&game->grid, blast, nearby, GRID_MAX_QUERY);
+		for (int c = 0; c < nearbyCount; c++) {
+			int i = nearby[c];
+			if (brickLive(store, i) && brickTypeOf(store, i)->hitPoints && CheckCollisionRecs(blast, brickRect(store, i)))
+				breakBrick(game, i, owner, events);
+		}
+	}
+}
+
+static void tickPlaying(Game *game, const GameInput *inputs, GameEvents *events) {
+	BallPool *balls = &game->balls;
+
+	movePaddle(game, &game->paddle, &game->fixedPaddleX, &game->prevPaddleX, inputs[0]);
+	if (game->versus)
+		movePaddle(game, &game->rivalPaddle, &game->fixedRivalPaddleX, &game->prevRivalPaddleX, inputs[1]);
+
+	// Every ball moves against the bricks as they were at the start of the tick, so the result
+	// doesn't depend on how the balls are split across threads
+	JobFunc move = game->fixedPhysics ? moveBallsFixed : moveBalls;
+	if (game->jobs && balls->count >= PARALLEL_MIN_BALLS)
+		jobsRun(game->jobs, move, game, balls->count);
+	else
+		move(game, 0, balls->count);
+
+	// Serial merge in ball order. Two balls hitting the same brick in one tick both bounce off it.
+	// Balls a multiball brick adds go after count and don't hit anything until the next tick
+	int ballCount = balls->count;
+	for (int b = 0; b < ballCount; b++) {
+		int hits = events->hits, clicks = events->clicks;
+		for (int h = 0; h < game->ballHitCount[b]; h++) {
+			hitBrick(game, game->ballHits[b][h], game->ballOwner[b], events);
+		}
+		events->clicks += game->ballClicks[b];
+
+		if (events->hits != hits)
+			events->hitX = balls->x[b] + BALL_SIZE/2.0f;
+		if (events->clicks != clicks)
+			events->clickX = balls->x[b] + BALL_SIZE/2.0f;
+	}
+	resolveBlasts(game, events);
+
+	if (game->attack) {
+		advanceField(game);
+	} else if (brickCleared(&game->bricks)) {
+		game->state = STATE_WON;
+	}
+}
+
+void gameTick(Game *game, GameInput input, GameEvents *events) {
+	gameTickPlayers(game, &input, events);
+}
+
+void gameTickPlayers(Game *game, const GameInput *inputs, GameEvents *events) {
+	if (game->state == STATE_TITLE) {
+		tickTitle(game, inputs[0]);
+	} else if (game->state == STATE_PLAYING) {
+		tickPlaying(game, inputs, events);
+	}
+}
+
+Rectangle gameBrickRect(const Game *game, int i) {
+	Rectangle rect = brickRect(&game->bricks, i);
+	rect.y += game->scroll;
+	return rect;
+}
+
+int gameAddBalls(Game *game, int count) {
+	BallPool *balls = &game->balls;
+	if (game->fixedPhysics) {
+		FixedBalls *fixed = &game->fixedBalls;
+		FixedVec position = { fixed->x[0], fixed->y[0] };
+		FixedVec velocity = { fixed->vx[0], fixed->vy[0] };
+
+		int added = 0;
+		for (int i = 1; i <= count; i++) {
+			if (ballSpawnFixed(balls, fixed, position, fixedRotate(velocity, i*FIXED_TURN/(count+1))) < 0)
+				break;
+			added++;
+		}
+		return added;
+	}
+
+	Vector2 position = { balls->x[0], balls->y[0] };
+	Vector2 velocity = { balls->vx[0], balls->vy[0] };
+
+	int added = 0;
+	for (int i = 1; i <= count; i++) {
+		if (ballSpawn(balls, position, Vector2Rotate(velocity, i*2*PI/(count+1))) < 0)
+			break;
+		added++;
+	}
+	return added;
+}
+
+void gameSnapshot(const Game *game, GameSnapshot *snapshot) {
+	memcpy(snapshot->data, game, GAME_SNAPSHOT_SIZE);
+}
+
+void gameRestore(Game *game, const GameSnapshot *snapshot) {
+	memcpy(game, snapshot->data, GAME_SNAPSHOT_SIZE);
+	if (!game->attack)
+		return;
+
+	int oldest = game->fieldHead - FIELD_ROWS + 1;
+	for (int row = oldest > 0 ? oldest : 0; row <= game->fieldHead; row++) {
+		FieldRow generated;
+		fieldRowsGet(game->fieldRows, game->fieldSeed, row, &generated);
+		for (int c = 0; c < FIELD_COLUMNS; c++) {
+			brickSet(&game->bricks, fieldSlot(row) + c, fieldRect(row, c), BRICK_NORMAL, generated.colour[c]);
+		}
+	}
+}
+
+static unsigned int hashBytes(unsigned int hash, const void *data, int size) {
+	const unsigned char *p = data;
+	for (int i = 0; i < size; i++) {
+		hash = (hash ^ p[i]) * 16777619u;
+	}
+	return hash;
+}
+
+unsigned int gameChecksum(const Game *game) {
+	unsigned int hash = 2166136261u;
+	hash = hashBytes(hash, &game->state, sizeof(game->state));
+	if (game->versus) {
+		hash = hashBytes(hash, &game->rivalPaddle, sizeof(game->rivalPaddle));
+		hash = hashBytes(hash, &game->fixedRivalPaddleX, sizeof(game->fixedRivalPaddleX));
+		hash = hashBytes(hash, game->ballOwner, game->balls.count);
+	}
+	if (game->attack) {
+		hash = hashBytes(hash, &game->fixedScroll, sizeof(game->fixedScroll));
+		hash = hashBytes(hash, &game->scroll, sizeof(game->scroll));
+		hash = hashBytes(hash, &game->fieldHead, sizeof(game->fieldHead));
+	}
+
+	for (int n = 0; n < game->blastCount; n++) {
+		hash = hashBytes(hash, &game->blasts[(game->blastHead + n) % MAX_PENDING_BLASTS], sizeof(short));
+	}
+
+	// The float copies are rounded, fixed-point runs compare on the exact state
+	if (game->fixedPhysics) {
+		const FixedBalls *fixed = &game->fixedBalls;
+		for (int i = 0; i < game->balls.count; i++) {
+			Fixed ball[4] = { fixed->x[i], fixed->y[i], fixed->vx[i], fixed->vy[i] };
+			hash = hashBytes(hash, ball, sizeof(ball));
+		}
+		hash = hashBytes(hash, &game->fixedPaddleX, sizeof(game->fixedPaddleX));
+		hash = hashBytes(hash, game->bricks.live, sizeof(game->bricks.live));
+		hash = hashBytes(hash, game->bricks.damage, game->bricks.used);
+		return hash;
+	}
+
+	for (int i = 0; i < game->balls.count; i++) {
+		Rectangle ball = ballRect(&game->balls, i);
+		Vector2 velocity = { game->balls.vx[i], game->balls.vy[i] };
+		hash = hashBytes(hash, &ball, sizeof(ball));
+		hash = hashBytes(hash, &velocity, sizeof(velocity));
+	}
+	hash = hashBytes(hash, &game->paddle, sizeof(game->paddle));
+	hash = hashBytes(hash, game->bricks.live, sizeof(game->bricks.live));
+	hash = hashBytes(hash, game->bricks.damage, game->bricks.used);
+	return hash;
+}
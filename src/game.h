@@ -0,0 +1,136 @@
+#ifndef _game_h_
+#define _game_h_
+
+#include <stddef.h>
+
+#include "raylib.h"
+#include "defs.h"
+#include "balls.h"
+#include "bricks.h"
+#include "field.h"
+#include "grid.h"
+#include "jobs.h"
+#include "level.h"
+
+enum {
+	STATE_TITLE,
+	STATE_PLAYING,
+	STATE_WON,
+	STATE_LOST
+};
+
+typedef struct GameInput {
+	Vector2 mouse;
+	bool mouseDown;
+} GameInput;
+
+// Things that happened during a tick, for the frontend to turn into sound and effects
+typedef struct GameEvents {
+	int hits;
+	int clicks;
+	// Ball centre at the last hit and click, for panning their sounds
+	float hitX;
+	float clickX;
+	short broken[MAX_EVENT_BREAKS];
+	int brokenCount;
+} GameEvents;
+
+// Everything from state down to bricks.damage is plain data that ticks change, in one block that
+// gameSnapshot copies. Pointers, settings and per-tick scratch go after it
+typedef struct Game {
+	int state;
+
+	BallPool balls;
+	Rectangle paddle;
+
+	// Integer-only physics, bit-identical on every platform. Set by the frontend before gameInit,
+	// which spawns into fixedBalls while it is on. paddle.x is then a copy of fixedPaddleX
+	bool fixedPhysics;
+	FixedBalls fixedBalls;
+	Fixed fixedPaddleX;
+
+	// Position at the start of the current tick, blended with the latest one when drawing
+	float prevPaddleX;
+
+	bool hoveringPlayButton;
+
+	int score;
+
+	// Versus mode, a second player's paddle along the top driven by the second input to
+	// gameTickPlayers. Set by the frontend before gameInit like fixedPhysics
+	bool versus;
+	Rectangle rivalPaddle;
+	Fixed fixedRivalPaddleX;
+	float prevRivalPaddleX;
+	int rivalScore;
+	// Player whose paddle each ball touched last, the bricks it breaks score for them
+	unsigned char ballOwner[MAX_BALLS];
+
+	// Attack mode, the field comes down and new rows spawn at the top, see field.h. Set by the
+	// frontend before gameInit like versus. The brick store's rects are field coordinates then,
+	// gameBrickRect is where a brick is on screen
+	bool attack;
+	float scroll;
+	Fixed fixedScroll;
+	// Newest row, and the oldest that may still have live bricks
+	int fieldHead;
+	int fieldTail;
+
+	// Explosions waiting to go off, a ring of blastCount from blastHead. Brick and the player it scores for
+	short blasts[MAX_PENDING_BLASTS];
+	unsigned char blastOwners[MAX_PENDING_BLASTS];
+	int blastHead;
+	int blastCount;
+
+	// Seeded by gameSeed, gameInit leaves them alone so each level built draws new numbers
+	RandomStream physicsRandom;
+	RandomStream levelRandom;
+	unsigned int fieldSeed;
+
+	Grid grid;
+	// Last in the snapshot, only its live bits and damage are in it
+	BrickStore bricks;
+
+	// Bricks each ball hit this tick and wall/paddle bounces, merged in ball order after every ball has moved
+	short ballHits[MAX_BALLS][MAX_SWEEP_ITERATIONS];
+	unsigned char ballHitCount[MAX_BALLS];
+	unsigned char ballClicks[MAX_BALLS];
+
+	// Workers that move the balls, NULL for the calling thread only. Set by the frontend, gameInit leaves it alone
+	JobPool *jobs;
+	// Attack rows generated ahead, NULL to generate each as it spawns. Set by the frontend like jobs
+	FieldRows *fieldRows;
+} Game;
+
+// Neither function touches the window, GL context or audio device
+void gameSeed(Game *game, unsigned int seed);
+void gameInit(Game *game);
+// False when the grid had no room for some of the level's bricks, those are left broken
+bool gameInitLevel(Game *game, const Level *level);
+void gameTick(Game *game, GameInput input, GameEvents *events);
+// One input per player, two in versus mode
+void gameTickPlayers(Game *game, const GameInput *inputs, GameEvents *events);
+
+// Adds balls fanned out from the first one's heading, for multiball. Returns how many fit in the pool
+int gameAddBalls(Game *game, int count);
+
+// Brick i on screen, its store rect moved down by the attack field's scroll
+Rectangle gameBrickRect(const Game *game, int i);
+
+// The tick state of a game, see Game. Brick rects and colours aren't in it, a snapshot only
+// restores into the game it was taken from while the same level is loaded
+#define GAME_SNAPSHOT_SIZE (offsetof(Game, bricks) + offsetof(BrickStore, x))
+
+typedef struct GameSnapshot {
+	unsigned char data[GAME_SNAPSHOT_SIZE];
+} GameSnapshot;
+
+// One memcpy each. An attack field's rows are then rebuilt from the generator, so a restore after
+// its slots were reused still draws the rows it has
+void gameSnapshot(const Game *game, GameSnapshot *snapshot);
+void gameRestore(Game *game, const GameSnapshot *snapshot);
+
+// Hash of the simulation state, equal for two runs that stayed in sync
+unsigned int gameChecksum(const Game *game);
+
+#endif //_game_h_
@@ -0,0 +1,48 @@
+#include "gamepad.h"
+
+#include <string.h>
+
+#include "defs.h"
+
+void gamepadOpen(Gamepad *pad, int gamepad) {
+	memset(pad, 0, sizeof(*pad));
+	pad->gamepad = gamepad;
+	pad->threaded = StartGamepadSampling(gamepad, GAMEPAD_RATE);
+}
+
+void gamepadClose(Gamepad *pad) {
+	StopGamepadSampling();
+	pad->count = pad->first = 0;
+}
+
+void gamepadPoll(Gamepad *pad) {
+	// Ticks that stopped taking samples, while rewinding or waiting on the other player, only need the newest
+	if (pad->count - pad->first > GAMEPAD_SAMPLES/2) {
+		pad->current = pad->pending[pad->count-1];
+		pad->first = pad->count;
+	}
+	memmove(pad->pending, pad->pending + pad->first, (pad->count - pad->first)*sizeof(GamepadSample));
+	pad->count -= pad->first;
+	pad->first = 0;
+
+	pad->count += GetGamepadSamples(pad->pending + pad->count, GAMEPAD_SAMPLES - pad->count);
+}
+
+GameInput gamepadAt(Gamepad *pad, GameInput input, double time) {
+	unsigned int buttons = 0;
+	int taken = 0;
+	for (; pad->first < pad->count && pad->pending[pad->first].time <= time; taken++) {
+		pad->current = pad->pending[pad->first++];
+		buttons |= pad->current.buttons;
+	}
+	if (taken)
+		pad->seen = true;
+	else
+		buttons = pad->current.buttons;
+	if (!pad->seen)
+		return input;
+
+	input.mouse.x = SCREEN_WIDTH/2.0f*(1.0f + pad->current.axes[GAMEPAD_AXIS_LEFT_X]);
+	input.mouseDown = input.mouseDown || buttons != 0;
+	return input;
+}
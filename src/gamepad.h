@@ -0,0 +1,36 @@
+#ifndef _gamepad_h_
+#define _gamepad_h_
+
+#include "raylib.h"
+#include "game.h"
+
+// Polls a second, what analog paddles and spinner boxes report at
+#define GAMEPAD_RATE 1000
+#define GAMEPAD_SAMPLES 1024
+
+// An analog controller steering the paddle, its left stick X axis from one end of the field to the
+// other. raylib samples it on its own thread where it can, and each tick takes the samples up to the
+// time it stands for, so the paddle follows the controller between frames whatever the frame rate
+typedef struct Gamepad {
+	int gamepad;
+	// Samples no tick has reached yet, [first, count)
+	GamepadSample pending[GAMEPAD_SAMPLES];
+	int first;
+	int count;
+	// Newest sample a tick has taken
+	GamepadSample current;
+	bool seen;
+	// Sampled on a thread, otherwise once a frame
+	bool threaded;
+} Gamepad;
+
+void gamepadOpen(Gamepad *pad, int gamepad);
+void gamepadClose(Gamepad *pad);
+
+// Takes the samples since the last poll, once a frame
+void gamepadPoll(Gamepad *pad);
+// Input for a tick that ends at time, GetTime() clock. The paddle goes where the last sample up to
+// then put it, a button down in any of them clicks. Input is passed through until a sample arrives
+GameInput gamepadAt(Gamepad *pad, GameInput input, double time);
+
+#endif //_gamepad_h_
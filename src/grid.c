@@ -0,0 +1,136 @@
+#include "grid.h"
+
+#include <math.h>
+
+static int cellColumn(float x) {
+	int c = (int)((x - GRID_ORIGIN_X) / GRID_CELL_WIDTH);
+	if (x < GRID_ORIGIN_X) c = 0;
+	if (c >= GRID_COLUMNS) c = GRID_COLUMNS-1;
+	return c;
+}
+
+static int cellRow(float y) {
+	int r = (int)((y - GRID_ORIGIN_Y) / GRID_CELL_HEIGHT);
+	if (y < GRID_ORIGIN_Y) r = 0;
+	if (r >= GRID_ROWS) r = GRID_ROWS-1;
+	return r;
+}
+
+// Rows a span covers. Unclamped with wrapRows, rowCell maps them to cells then
+static void rowSpan(const Grid *grid, float top, float bottom, int *first, int *last) {
+	if (!grid->wrapRows) {
+		*first = cellRow(top);
+		*last = cellRow(bottom);
+		return;
+	}
+
+	*first = (int)floorf((top - GRID_ORIGIN_Y) / GRID_CELL_HEIGHT);
+	*last = (int)floorf((bottom - GRID_ORIGIN_Y) / GRID_CELL_HEIGHT);
+	if (*last - *first >= GRID_ROWS)
+		*last = *first + GRID_ROWS-1;
+}
+
+static int rowCell(const Grid *grid, int r) {
+	if (!grid->wrapRows)
+		return r;
+	r %= GRID_ROWS;
+	return r < 0 ? r + GRID_ROWS : r;
+}
+
+void gridClear(Grid *grid) {
+	for (int y = 0; y < GRID_ROWS; y++) {
+		for (int x = 0; x < GRID_COLUMNS; x++) {
+			grid->cellCount[y][x] = 0;
+		}
+	}
+	grid->wrapRows = false;
+}
+
+bool gridInsert(Grid *grid, int index, Rectangle rect) {
+	int x0 = cellColumn(rect.x), x1 = cellColumn(rect.x+rect.width-1);
+	int y0, y1;
+	rowSpan(grid, rect.y, rect.y+rect.height-1, &y0, &y1);
+	bool fits = true;
+
+	for (int r = y0; r <= y1; r++) {
+		int y = rowCell(grid, r);
+		for (int x = x0; x <= x1; x++) {
+			if (grid->cellCount[y][x] < GRID_CELL_CAPACITY) {
+				grid->cells[y][x][grid->cellCount[y][x]++] = index;
+			} else {
+				fits = false;
+			}
+		}
+	}
+
+	return fits;
+}
+
+void gridRemove(Grid *grid, int index, Rectangle rect) {
+	int x0 = cellColumn(rect.x), x1 = cellColumn(rect.x+rect.width-1);
+	int y0, y1;
+	rowSpan(grid, rect.y, rect.y+rect.height-1, &y0, &y1);
+
+	for (int r = y0; r <= y1; r++) {
+		int y = rowCell(grid, r);
+		for (int x = x0; x <= x1; x++) {
+			int n = grid->cellCount[y][x];
+			for (int i = 0; i < n; i++) {
+				if (grid->cells[y][x][i] == index) {
+					// Order within a cell doesn't matter, fill the hole with the last entry
+					grid->cells[y][x][i] = grid->cells[y][x][n-1];
+					grid->cellCount[y][x]--;
+					break;
+				}
+			}
+		}
+	}
+}
+
+int gridQuery(const Grid *grid, Rectangle rect, int *out, int maxOut) {
+	int x0 = cellColumn(rect.x), x1 = cellColumn(rect.x+rect.width);
+	int y0, y1;
+	rowSpan(grid, rect.y, rect.y+rect.height, &y0, &y1);
+	int count = 0;
+
+	for (int r = y0; r <= y1; r++) {
+		int y = rowCell(grid, r);
+		for (int x = x0; x <= x1; x++) {
+			for (int i = 0; i < grid->cellCount[y][x]; i++) {
+				int index = grid->cells[y][x][i];
+
+				// Bricks straddling a cell boundary live in several cells
+				bool seen = false;
+				for (int j = 0; j < count; j++) {
+					if (out[j] == index) {
+						seen = true;
+						break;
+					}
+				}
+
+				if (!seen && count < maxOut) {
+					out[count++] = index;
+				}
+			}
+		}
+	}
+
+	return count;
+}
+
+bool gridFits(const float *x, const float *y, const float *w, const float *h, int count) {
+	unsigned short cellCount[GRID_ROWS][GRID_COLUMNS] = { 0 };
+
+	for (int i = 0; i < count; i++) {
+		int x0 = cellColumn(x[i]), x1 = cellColumn(x[i]+w[i]-1);
+		int y0 = cellRow(y[i]), y1 = cellRow(y[i]+h[i]-1);
+		for (int r = y0; r <= y1; r++) {
+			for (int c = x0; c <= x1; c++) {
+				if (++cellCount[r][c] > GRID_CELL_CAPACITY)
+					return false;
+			}
+		}
+	}
+
+	return true;
+}
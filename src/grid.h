@@ -0,0 +1,43 @@
+#ifndef _grid_h_
+#define _grid_h_
+
+#include "raylib.h"
+#include "defs.h"
+
+// Cells share the pitch of the brick layout so a default brick lands in exactly one cell
+#define GRID_ORIGIN_X 40
+#define GRID_ORIGIN_Y 50
+#define GRID_CELL_WIDTH (BLOCK_WIDTH+BLOCK_SPACING)
+#define GRID_CELL_HEIGHT (BLOCK_HEIGHT+BLOCK_SPACING)
+#define GRID_COLUMNS ((SCREEN_WIDTH-GRID_ORIGIN_X)/GRID_CELL_WIDTH+1)
+#define GRID_ROWS ((SCREEN_HEIGHT-GRID_ORIGIN_Y)/GRID_CELL_HEIGHT+1)
+// Room for MAX_BRICKS spread over the whole field. That is the real limit on how tightly a level
+// packs: more than this many bricks touching one 45x25 cell don't fit, and levels that need it are
+// rejected when they load
+#define GRID_CELL_CAPACITY 32
+
+// Upper bound on the number of bricks a single query can return, enough for the 2x3 full cells a
+// ball's swept box reaches
+#define GRID_MAX_QUERY 256
+
+// Fails to compile if the cells can't hold a full brick store
+typedef char GridHoldsMaxBricks[GRID_ROWS*GRID_COLUMNS*GRID_CELL_CAPACITY >= MAX_BRICKS ? 1 : -1];
+
+typedef struct Grid {
+	short cells[GRID_ROWS][GRID_COLUMNS][GRID_CELL_CAPACITY];
+	unsigned char cellCount[GRID_ROWS][GRID_COLUMNS];
+	// Rows repeat every GRID_ROWS instead of clamping, for a field that extends up without bound.
+	// Bricks more than GRID_ROWS rows apart share cells, queries only return more candidates
+	bool wrapRows;
+} Grid;
+
+// Also turns wrapRows off
+void gridClear(Grid *grid);
+bool gridInsert(Grid *grid, int index, Rectangle rect);
+void gridRemove(Grid *grid, int index, Rectangle rect);
+int gridQuery(const Grid *grid, Rectangle rect, int *out, int maxOut);
+// Whether count bricks, given as x, y, width and height arrays, would all find room in an empty
+// grid without wrapRows. Nothing is inserted
+bool gridFits(const float *x, const float *y, const float *w, const float *h, int count);
+
+#endif //_grid_h_
@@ -0,0 +1,67 @@
+#include "heap.h"
+
+#include <assert.h>
+#include <stdio.h>
+
+static const char *tagNames[MEMORY_TAG_COUNT] = { "general", "audio", "textures", "text", "batch", "game" };
+
+void heapGuardArm(HeapGuard *guard, bool armed) {
+#if !defined(HEAP_GUARD)
+	(void)guard;
+	(void)armed;
+#else
+	if (armed == guard->armed)
+		return;
+
+	guard->armed = armed;
+	guard->frames = 0;
+	for (int i = 0; i < MEMORY_TAG_COUNT; i++) {
+		guard->operations[i] = GetMemoryTagStats(i).operations;
+	}
+	TraceLog(LOG_INFO, "HEAP: Steady-state guard %s", armed ? "armed" : "off");
+#endif
+}
+
+void heapGuardFrame(HeapGuard *guard) {
+#if !defined(HEAP_GUARD)
+	(void)guard;
+#else
+	if (!guard->armed)
+		return;
+
+	unsigned int total = 0;
+	char detail[128] = { 0 };
+	int length = 0;
+	for (int i = 0; i < MEMORY_TAG_COUNT; i++) {
+		unsigned int operations = GetMemoryTagStats(i).operations;
+		unsigned int count = operations - guard->operations[i];
+		guard->operations[i] = operations;
+		if (count && length < (int)sizeof(detail))
+			length += snprintf(detail + length, sizeof(detail) - length, " %s %u", tagNames[i], count);
+		total += count;
+	}
+
+	if (++guard->frames <= HEAP_GUARD_WARMUP || total == 0)
+		return;
+
+	guard->dirtyFrames++;
+	TraceLog(LOG_WARNING, "HEAP: %u heap operations in steady-state frame %d:%s", total, guard->frames, detail);
+#if defined(HEAP_GUARD_ASSERT)
+	assert(total == 0);
+#endif
+#endif
+}
+
+// The total's peak is of everything allocated at once, below the sum of the tag peaks
+void heapPrintReport(void) {
+	fprintf(stderr, "memory:      live KB   peak KB   blocks   allocs  failed\n");
+	for (int i = 0; i <= MEMORY_TAG_COUNT; i++) {
+		MemoryTagStats stats = i < MEMORY_TAG_COUNT ? GetMemoryTagStats(i) : GetMemoryStats();
+		fprintf(stderr, "  %-10s %9u %9u %8u %8u %7u\n", i < MEMORY_TAG_COUNT ? tagNames[i] : "total",
+			stats.liveBytes/1024, stats.peakBytes/1024, stats.liveCount, stats.totalCount, stats.failures);
+	}
+
+	MemoryTagStats total = GetMemoryStats();
+	if (total.peakBytes > HEAP_BUDGET)
+		fprintf(stderr, "memory: peak %u KB is over the %d KB budget\n", total.peakBytes/1024, HEAP_BUDGET/1024);
+}
@@ -0,0 +1,31 @@
+#ifndef _heap_h_
+#define _heap_h_
+
+#include "raylib.h"
+
+// Heap the embedded target leaves the game, the report checks the peak against it
+#define HEAP_BUDGET (64*1024*1024)
+// Frames after arming that may still allocate, render batches and sort buffers grow to fit during them
+#define HEAP_GUARD_WARMUP 60
+
+// Steady-state heap check. Built with HEAP_GUARD the heap operations of every frame are counted
+// from raylib's tag stats, and once armed and warmed up any frame with one is logged, an assert
+// with HEAP_GUARD_ASSERT as well. Without HEAP_GUARD the calls do nothing
+typedef struct HeapGuard {
+	bool armed;
+	int frames;
+	// Frames that touched the heap after the warm-up
+	int dirtyFrames;
+	// Operations per tag at the last check
+	unsigned int operations[MEMORY_TAG_COUNT];
+} HeapGuard;
+
+// Arm once loading is finished, disarm for good before anything that allocates on purpose
+void heapGuardArm(HeapGuard *guard, bool armed);
+// Call once per frame after EndDrawing(), operations from any thread count to the frame
+void heapGuardFrame(HeapGuard *guard);
+
+// Live, peak and counts per tag to stderr, anything still live after the unloads is a leak
+void heapPrintReport(void);
+
+#endif //_heap_h_
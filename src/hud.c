@@ -0,0 +1,153 @@
+#include "hud.h"
+
+#include "rlgl.h"
+
+#include "defs.h"
+
+#define HUD_FONT_SIZE 20
+// Distance field glyphs are four times the 10 pixel bitmap font, the size of the play button. The
+// spread covers one bitmap pixel, enough for the 20 pixel hud down to the 64 pixel title
+#define SDF_SCALE 4
+#define SDF_SPREAD 4
+// Enough digits for any int
+#define MAX_NUMBER_DIGITS 10
+
+// Same size and spacing DrawText would use with this font size
+static TextLayout layoutText(Font font, const char *text, int fontSize) {
+	return LoadTextLayout(font, text, fontSize, fontSize/10);
+}
+
+static float textWidth(Font font, const char *text, int fontSize) {
+	return MeasureTextEx(font, text, fontSize, fontSize/10).x + fontSize/10;
+}
+
+static DigitQuads loadDigits(Font font, int fontSize) {
+	DigitQuads digits = { 0 };
+
+	float widths[10];
+	for (int d = 0; d < 10; d++) {
+		char text[2] = { '0' + d, '\0' };
+		TextLayout layout = layoutText(font, text, fontSize);
+		digits.textureId = layout.textureId;
+		digits.quads[d] = layout.quadCount ? layout.quads[0] : (Rectangle){ 0 };
+		digits.texcoords[d] = layout.quadCount ? layout.texcoords[0] : (Rectangle){ 0 };
+		UnloadTextLayout(layout);
+
+		widths[d] = textWidth(font, text, fontSize);
+		if (widths[d] > digits.cell)
+			digits.cell = widths[d];
+	}
+
+	// Narrow digits sit in the middle of their cell
+	for (int d = 0; d < 10; d++) {
+		digits.quads[d].x += (digits.cell - widths[d])/2;
+	}
+
+	return digits;
+}
+
+void hudLoad(Hud *hud, Font font) {
+	hud->sdfFont = (Font){ 0 };
+	hud->sdf = false;
+
+	hud->title = layoutText(font, "Attack Breaker ", 64);
+	hud->play = layoutText(font, "Play", 40);
+	hud->won = layoutText(font, "You win!", 64);
+	hud->lost = layoutText(font, "Game over", 64);
+	hud->bricksLabel = layoutText(font, "Bricks left: ", HUD_FONT_SIZE);
+	hud->scoreLabel = layoutText(font, "Score: ", HUD_FONT_SIZE);
+	hud->fpsLabel = layoutText(font, "FPS ", HUD_FONT_SIZE);
+	hud->digits = loadDigits(font, HUD_FONT_SIZE);
+
+	hud->scoreX = 300 + textWidth(font, "Score: ", HUD_FONT_SIZE);
+	hud->fpsX = SCREEN_WIDTH - 100 + textWidth(font, "FPS ", HUD_FONT_SIZE);
+}
+
+bool hudLoadSDF(Hud *hud, Font bitmap) {
+	Font font = { 0 };
+	if (rlGetVersion() != RL_OPENGL_11)
+		font = LoadFontSDF(bitmap, SDF_SCALE, SDF_SPREAD);
+	if (!IsFontReady(font)) {
+		hudLoad(hud, bitmap);
+		return false;
+	}
+
+	hudLoad(hud, font);
+	hud->sdfFont = font;
+	hud->sdf = true;
+	return true;
+}
+
+void hudUnload(Hud *hud) {
+	UnloadTextLayout(hud->title);
+	UnloadTextLayout(hud->play);
+	UnloadTextLayout(hud->won);
+	UnloadTextLayout(hud->lost);
+	UnloadTextLayout(hud->bricksLabel);
+	UnloadTextLayout(hud->scoreLabel);
+	UnloadTextLayout(hud->fpsLabel);
+	if (hud->sdf)
+		UnloadFont(hud->sdfFont);
+}
+
+void hudBeginText(const Hud *hud) {
+	if (hud->sdf)
+		BeginTextSDF();
+}
+
+void hudEndText(const Hud *hud) {
+	if (hud->sdf)
+		EndTextSDF();
+}
+
+void hudDraw(const Hud *hud, int bricks, int score, int fps) {
+	hudBeginText(hud);
+	DrawTextLayout(hud->bricksLabel, (Vector2){ 10, 10 }, WHITE);
+	hudDrawNumber(hud, bricks, (Vector2){ 135, 10 }, YELLOW);
+
+	DrawTextLayout(hud->scoreLabel, (Vector2){ 300, 10 }, WHITE);
+	hudDrawNumber(hud, score, (Vector2){ hud->scoreX, 10 }, YELLOW);
+
+	DrawTextLayout(hud->fpsLabel, (Vector2){ SCREEN_WIDTH - 100, 10 }, WHITE);
+	hudDrawNumber(hud, fps, (Vector2){ hud->fpsX, 10 }, fps < TICK_RATE ? RED : LIME);
+	hudEndText(hud);
+}
+
+void hudDrawNumber(const Hud *hud, int value, Vector2 position, Color tint) {
+	const DigitQuads *digits = &hud->digits;
+
+	// Digits come out least significant first, so they are stored from the end
+	unsigned char figures[MAX_NUMBER_DIGITS];
+	int count = 0;
+	unsigned int n = value > 0 ? (unsigned int)value : 0;
+	do {
+		figures[MAX_NUMBER_DIGITS - ++count] = n % 10;
+		n /= 10;
+	} while (n > 0);
+
+	rlCheckRenderBatchLimit(4*count);
+	rlSetTexture(digits->textureId);
+	rlBegin(RL_QUADS);
+	rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+	rlNormal3f(0.0f, 0.0f, 1.0f);
+
+	for (int i = 0; i < count; i++) {
+		int d = figures[MAX_NUMBER_DIGITS - count + i];
+		Rectangle quad = digits->quads[d];
+		Rectangle uv = digits->texcoords[d];
+		float x = position.x + i*digits->cell + quad.x;
+		float y = position.y + quad.y;
+
+		rlTexCoord2f(uv.x, uv.y);
+		rlVertex2f(x, y);
+		rlTexCoord2f(uv.x, uv.y + uv.height);
+		rlVertex2f(x, y + quad.height);
+		rlTexCoord2f(uv.x + uv.width, uv.y + uv.height);
+		rlVertex2f(x + quad.width, y + quad.height);
+		rlTexCoord2f(uv.x + uv.width, uv.y);
+		rlVertex2f(x + quad.width, y);
+	}
+
+	rlEnd();
+	rlSetTexture(0);
+}
@@ -0,0 +1,49 @@
+#ifndef _hud_h_
+#define _hud_h_
+
+#include "raylib.h"
+
+// Glyph quads of '0'-'9' at one size, so numbers are drawn without formatting or laying out text.
+// Every digit takes the same cell, so a counter doesn't shift as its value changes
+typedef struct DigitQuads {
+	unsigned int textureId;
+	Rectangle quads[10];
+	Rectangle texcoords[10];
+	float cell;
+} DigitQuads;
+
+// Text drawn every frame, laid out once and only redone when it changes
+typedef struct Hud {
+	TextLayout title;
+	TextLayout play;
+	TextLayout won;
+	TextLayout lost;
+	TextLayout bricksLabel;
+	TextLayout scoreLabel;
+	TextLayout fpsLabel;
+	DigitQuads digits;
+	float scoreX;
+	float fpsX;
+	// Distance field font the text was laid out with, only set by hudLoadSDF()
+	Font sdfFont;
+	bool sdf;
+} Hud;
+
+// Text is laid out with the font's glyphs, which must outlive the hud
+void hudLoad(Hud *hud, Font font);
+// Lays the text out with one distance field font made from the bitmap font, sharp at every size
+// instead of scaled blurrily. Falls back to the bitmap font without shaders
+bool hudLoadSDF(Hud *hud, Font bitmap);
+void hudUnload(Hud *hud);
+
+// Hud text and numbers are drawn between these. They switch to the SDF shader for a distance field
+// hud and do nothing otherwise, so the default hud still shares the batch with shapes
+void hudBeginText(const Hud *hud);
+void hudEndText(const Hud *hud);
+
+// The in-game counters along the top of the screen
+void hudDraw(const Hud *hud, int bricks, int score, int fps);
+// Negative values are drawn as 0
+void hudDrawNumber(const Hud *hud, int value, Vector2 position, Color tint);
+
+#endif //_hud_h_
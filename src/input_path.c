@@ -0,0 +1,34 @@
+#include "input_path.h"
+
+#include "raymath.h"
+
+void inputPathReset(InputPath *path, GameInput current) {
+	path->points[0] = current;
+	path->count = 0;
+}
+
+void inputPathPoll(InputPath *path, GameInput current) {
+	MouseEvent events[MAX_PATH_EVENTS];
+	int count = GetMouseEvents(events, MAX_PATH_EVENTS);
+
+	path->points[0] = path->points[path->count];
+	for (int i = 0; i < count; i++) {
+		path->points[i+1] = (GameInput){ events[i].position, (events[i].buttons & (1 << MOUSE_BUTTON_LEFT)) != 0 };
+	}
+	path->count = count;
+
+	// The last event is the polled state unless the queue overflowed, or the mouse scale changed since
+	path->points[count] = current;
+}
+
+GameInput inputPathAt(const InputPath *path, int tick, int ticks) {
+	if (path->count == 0 || ticks <= 0 || tick >= ticks-1)
+		return path->points[path->count];
+
+	// A button change counts once the tick reaches its event, so a click shorter than a frame is still seen
+	float along = (float)(tick+1)*path->count/ticks;
+	int point = (int)along;
+	GameInput input = path->points[point];
+	input.mouse = Vector2Lerp(path->points[point].mouse, path->points[point+1].mouse, along - point);
+	return input;
+}
@@ -0,0 +1,24 @@
+#ifndef _input_path_h_
+#define _input_path_h_
+
+#include "raylib.h"
+#include "game.h"
+
+#define MAX_PATH_EVENTS 64
+
+// The cursor's path through one input poll, so the ticks of a frame each see where it was along
+// the way instead of all seeing where it ended. GLFW stamps events when the poll handles them
+// rather than when they happened, so points are spread over the ticks by arrival order
+typedef struct InputPath {
+	// points[0] is where the previous frame ended
+	GameInput points[MAX_PATH_EVENTS + 1];
+	int count;
+} InputPath;
+
+void inputPathReset(InputPath *path, GameInput current);
+// Takes the mouse events of the last poll, current is the state they lead to
+void inputPathPoll(InputPath *path, GameInput current);
+// Input for the tick-th of the ticks run this frame, the last one gets current
+GameInput inputPathAt(const InputPath *path, int tick, int ticks);
+
+#endif //_input_path_h_
@@ -0,0 +1,109 @@
+#include "jobs.h"
+
+#include <unistd.h>
+
+// Range i of the pool's current job, the calling thread takes range 0
+static void runRange(JobPool *pool, int i) {
+	int parts = pool->workerCount + 1;
+	int begin = (int)((long)pool->count*i/parts);
+	int end = (int)((long)pool->count*(i+1)/parts);
+	if (begin < end)
+		pool->func(pool->context, begin, end);
+}
+
+static void *workerMain(void *arg) {
+	JobWorker *worker = arg;
+	JobPool *pool = worker->pool;
+	unsigned int seen = 0;
+
+	pthread_mutex_lock(&pool->lock);
+	for (;;) {
+		while (!pool->quit && pool->generation == seen)
+			pthread_cond_wait(&pool->wake, &pool->lock);
+		if (pool->quit)
+			break;
+		seen = pool->generation;
+		pthread_mutex_unlock(&pool->lock);
+
+		runRange(pool, worker->index + 1);
+
+		pthread_mutex_lock(&pool->lock);
+		if (--pool->pending == 0)
+			pthread_cond_signal(&pool->done);
+	}
+	pthread_mutex_unlock(&pool->lock);
+
+	return NULL;
+}
+
+int jobsDefaultWorkers(void) {
+	long cores = sysconf(_SC_NPROCESSORS_ONLN);
+	if (cores < 1)
+		cores = 1;
+	if (cores-1 > MAX_JOB_WORKERS)
+		return MAX_JOB_WORKERS;
+	return (int)(cores-1);
+}
+
+bool jobsInit(JobPool *pool, int count) {
+	if (count > MAX_JOB_WORKERS)
+		count = MAX_JOB_WORKERS;
+
+	pool->workerCount = 0;
+	pool->generation = 0;
+	pool->pending = 0;
+	pool->quit = false;
+
+	if (pthread_mutex_init(&pool->lock, NULL) != 0)
+		return false;
+	pthread_cond_init(&pool->wake, NULL);
+	pthread_cond_init(&pool->done, NULL);
+
+	for (int i = 0; i < count; i++) {
+		pool->workers[i] = (JobWorker){ pool, i };
+		if (pthread_create(&pool->threads[i], NULL, workerMain, &pool->workers[i]) != 0)
+			break;
+		pool->workerCount++;
+	}
+
+	return true;
+}
+
+void jobsShutdown(JobPool *pool) {
+	pthread_mutex_lock(&pool->lock);
+	pool->quit = true;
+	pthread_cond_broadcast(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+
+	for (int i = 0; i < pool->workerCount; i++) {
+		pthread_join(pool->threads[i], NULL);
+	}
+	pool->workerCount = 0;
+
+	pthread_cond_destroy(&pool->wake);
+	pthread_cond_destroy(&pool->done);
+	pthread_mutex_destroy(&pool->lock);
+}
+
+void jobsRun(JobPool *pool, JobFunc func, void *context, int count) {
+	if (pool->workerCount == 0) {
+		func(context, 0, count);
+		return;
+	}
+
+	pthread_mutex_lock(&pool->lock);
+	pool->func = func;
+	pool->context = context;
+	pool->count = count;
+	pool->pending = pool->workerCount;
+	pool->generation++;
+	pthread_cond_broadcast(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+
+	runRange(pool, 0);
+
+	pthread_mutex_lock(&pool->lock);
+	while (pool->pending > 0)
+		pthread_cond_wait(&pool->done, &pool->lock);
+	pthread_mutex_unlock(&pool->lock);
+}
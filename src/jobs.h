@@ -0,0 +1,46 @@
+#ifndef _jobs_h_
+#define _jobs_h_
+
+#include <stdbool.h>
+#include <pthread.h>
+
+#define MAX_JOB_WORKERS 15
+
+// Splits a range of items across worker threads. Work only runs inside jobsRun(), so the pool
+// never touches anything while the caller isn't waiting on it
+typedef void (*JobFunc)(void *context, int begin, int end);
+
+typedef struct JobWorker {
+	struct JobPool *pool;
+	int index;
+} JobWorker;
+
+// Workers point back at the pool, so it must stay put between jobsInit() and jobsShutdown()
+typedef struct JobPool {
+	pthread_t threads[MAX_JOB_WORKERS];
+	JobWorker workers[MAX_JOB_WORKERS];
+	int workerCount;
+
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	pthread_cond_t done;
+	unsigned int generation;
+	int pending;
+	bool quit;
+
+	JobFunc func;
+	void *context;
+	int count;
+} JobPool;
+
+// One worker per core besides the calling thread
+int jobsDefaultWorkers(void);
+
+bool jobsInit(JobPool *pool, int workers);
+void jobsShutdown(JobPool *pool);
+
+// Runs func over [0, count) as one contiguous range per worker plus one on the calling thread,
+// and returns when every range is done
+void jobsRun(JobPool *pool, JobFunc func, void *context, int count);
+
+#endif //_jobs_h_
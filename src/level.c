@@ -0,0 +1,184 @@
+#include "level.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define LEVEL_BYTE_ORDER 0x01020304u
+#define LEVEL_BRICK_SIZE (4*sizeof(float) + sizeof(Color) + sizeof(char))
+
+bool levelLoadMemory(Level *level, const void *data, size_t size) {
+	memset(level, 0, sizeof(*level));
+
+	const LevelHeader *header = data;
+	if (size < sizeof(LevelHeader)
+		|| memcmp(header->magic, LEVEL_MAGIC, 4) != 0
+		|| header->version != LEVEL_VERSION
+		|| header->byteOrder != LEVEL_BYTE_ORDER
+		|| header->count > MAX_BRICKS
+		|| size < sizeof(LevelHeader) + header->count*LEVEL_BRICK_SIZE)
+		return false;
+
+	int count = header->count;
+	const char *p = (const char *)(header + 1);
+
+	level->count = count;
+	level->x = (const float *)p; p += count*sizeof(float);
+	level->y = (const float *)p; p += count*sizeof(float);
+	level->w = (const float *)p; p += count*sizeof(float);
+	level->h = (const float *)p; p += count*sizeof(float);
+	level->colour = (const Color *)p; p += count*sizeof(Color);
+	level->type = p;
+
+	// Types index brickTypes, a file from a newer build may have ones this one doesn't know
+	for (int i = 0; i < count; i++) {
+		if ((unsigned char)level->type[i] >= BRICK_TYPE_COUNT) {
+			memset(level, 0, sizeof(*level));
+			return false;
+		}
+	}
+	if (!gridFits(level->x, level->y, level->w, level->h, count)) {
+		TraceLog(LOG_WARNING, "LEVEL: More than %d bricks in one grid cell", GRID_CELL_CAPACITY);
+		memset(level, 0, sizeof(*level));
+		return false;
+	}
+
+	return true;
+}
+
+bool levelLoad(Level *level, const char *fileName) {
+	MappedFile file;
+	if (!mapFile(&file, fileName))
+		return false;
+
+	if (!levelLoadMemory(level, file.data, file.size)) {
+		unmapFile(&file);
+		return false;
+	}
+	level->file = file;
+	return true;
+}
+
+void levelUnload(Level *level) {
+	unmapFile(&level->file);
+	memset(level, 0, sizeof(*level));
+}
+
+// Indexes every live brick from an empty grid. A brick the grid has no room for is broken rather
+// than left standing where nothing can hit it
+static bool indexBricks(BrickStore *store, Grid *grid) {
+	bool fits = true;
+
+	gridClear(grid);
+	FOR_EACH_BRICK(store, i) {
+		Rectangle rect = brickRect(store, i);
+		if (!gridInsert(grid, i, rect)) {
+			gridRemove(grid, i, rect);
+			brickBreak(store, i);
+			fits = false;
+		}
+	}
+	return fits;
+}
+
+bool levelBuild(const Level *level, BrickStore *store, Grid *grid) {
+	int count = level->count;
+
+	memcpy(store->x, level->x, count*sizeof(float));
+	memcpy(store->y, level->y, count*sizeof(float));
+	memcpy(store->w, level->w, count*sizeof(float));
+	memcpy(store->h, level->h, count*sizeof(float));
+	memcpy(store->colour, level->colour, count*sizeof(Color));
+	memcpy(store->type, level->type, count);
+
+	memset(store->damage, 0, count);
+	memset(store->solid, 0, sizeof(store->solid));
+	for (int i = 0; i < count; i++) {
+		if (brickTypeOf(store, i)->hitPoints == 0)
+			store->solid[i >> 6] |= (uint64_t)1 << (i & 63);
+	}
+
+	memset(store->live, 0, sizeof(store->live));
+	for (int i = 0; i < count/64; i++) {
+		store->live[i] = ~(uint64_t)0;
+	}
+	if (count % 64)
+		store->live[count/64] = ((uint64_t)1 << (count % 64)) - 1;
+	store->used = count;
+
+	return indexBricks(store, grid);
+}
+
+static bool brickMatches(const Level *level, const BrickStore *store, int i) {
+	return store->x[i] == level->x[i] && store->y[i] == level->y[i] && store->w[i] == level->w[i] && store->h[i] == level->h[i]
+		&& memcmp(&store->colour[i], &level->colour[i], sizeof(Color)) == 0 && store->type[i] == level->type[i];
+}
+
+int levelApply(const Level *level, BrickStore *store, Grid *grid, int *changed, Rectangle *before) {
+	int count = 0;
+	// Cells can overflow on the way while bricks that moved still sit where they were
+	bool fits = true;
+
+	for (int i = 0; i < level->count; i++) {
+		if (i < store->used && brickMatches(level, store, i))
+			continue;
+
+		Rectangle rect = { level->x[i], level->y[i], level->w[i], level->h[i] };
+		if (i < store->used) {
+			before[count] = brickRect(store, i);
+			if (brickLive(store, i))
+				gridRemove(grid, i, before[count]);
+		} else {
+			// Nothing was drawn there
+			before[count] = (Rectangle){ 0 };
+		}
+		changed[count++] = i;
+
+		brickSet(store, i, rect, level->type[i], level->colour[i]);
+		store->damage[i] = 0;
+		brickRevive(store, i);
+		if (!gridInsert(grid, i, rect)) {
+			gridRemove(grid, i, rect);
+			fits = false;
+		}
+	}
+
+	// Bricks past the end of the new level go
+	for (int i = level->count; i < store->used; i++) {
+		before[count] = brickRect(store, i);
+		if (brickLive(store, i)) {
+			gridRemove(grid, i, before[count]);
+			brickBreak(store, i);
+		}
+		changed[count++] = i;
+		store->solid[i >> 6] &= ~((uint64_t)1 << (i & 63));
+	}
+	store->used = level->count;
+
+	if (!fits && !indexBricks(store, grid))
+		TraceLog(LOG_WARNING, "LEVEL: Bricks over the grid's %d a cell were left out", GRID_CELL_CAPACITY);
+	return count;
+}
+
+bool levelSave(const BrickStore *store, const char *fileName) {
+	int count = store->used;
+	unsigned int size = sizeof(LevelHeader) + count*LEVEL_BRICK_SIZE;
+	unsigned char *data = MemAllocTagged(size, MEMORY_TAG_GAME);
+	if (!data)
+		return false;
+
+	LevelHeader header = { { 0 }, LEVEL_VERSION, count, LEVEL_BYTE_ORDER };
+	memcpy(header.magic, LEVEL_MAGIC, 4);
+	memcpy(data, &header, sizeof(header));
+
+	unsigned char *p = data + sizeof(header);
+	memcpy(p, store->x, count*sizeof(float)); p += count*sizeof(float);
+	memcpy(p, store->y, count*sizeof(float)); p += count*sizeof(float);
+	memcpy(p, store->w, count*sizeof(float)); p += count*sizeof(float);
+	memcpy(p, store->h, count*sizeof(float)); p += count*sizeof(float);
+	memcpy(p, store->colour, count*sizeof(Color)); p += count*sizeof(Color);
+	memcpy(p, store->type, count);
+
+	bool ok = SaveFileData(fileName, data, size);
+	MemFree(data);
+	return ok;
+}
@@ -0,0 +1,58 @@
+#ifndef _level_h_
+#define _level_h_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "raylib.h"
+#include "bricks.h"
+#include "grid.h"
+#include "mapfile.h"
+
+#define LEVEL_MAGIC "ABLV"
+#define LEVEL_VERSION 1
+
+// File layout: this header, then count of each BrickStore array back to back in field order
+// (x, y, w, h, colour, type). Values are in the native byte order of the machine that built the
+// file, the same as memory, so a loaded level is used straight from the mapping
+typedef struct LevelHeader {
+	char magic[4];
+	uint32_t version;
+	uint32_t count;
+	uint32_t byteOrder;
+} LevelHeader;
+
+// Views into the level's file image, valid until levelUnload() or until the memory handed to
+// levelLoadMemory() goes away
+typedef struct Level {
+	int count;
+	const float *x;
+	const float *y;
+	const float *w;
+	const float *h;
+	const Color *colour;
+	const char *type;
+
+	MappedFile file;
+} Level;
+
+// Levels with more bricks in a grid cell than GRID_CELL_CAPACITY are rejected, those bricks
+// couldn't be hit
+bool levelLoad(Level *level, const char *fileName);
+// Binds a file image already in memory, e.g. from an asset pack. The memory is not copied or freed
+bool levelLoadMemory(Level *level, const void *data, size_t size);
+void levelUnload(Level *level);
+
+// Copies the level's bricks over the store with one copy per field and indexes them in the grid.
+// False when the grid had no room for some, those are left broken. A loaded level always fits
+bool levelBuild(const Level *level, BrickStore *store, Grid *grid);
+// Brings a store built from an earlier version of the level in line with this one, brick by brick
+// index. Bricks that differ are set, revived and re-indexed, the rest keep their damage and live bits.
+// The changed bricks go in changed and, for the layer to erase, their rects before in before, both
+// MAX_BRICKS long. Returns how many there are. Should the grid run out of room on the way, it is
+// indexed again from scratch, and bricks that still don't fit are broken and logged
+int levelApply(const Level *level, BrickStore *store, Grid *grid, int *changed, Rectangle *before);
+
+bool levelSave(const BrickStore *store, const char *fileName);
+
+#endif //_level_h_
@@ -0,0 +1,47 @@
+#include "level_watch.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// Reads the file into a copy the level is bound to, the old copy stays if it isn't a level
+static bool reload(LevelWatch *watch) {
+	unsigned int size = 0;
+	unsigned char *data = LoadFileData(watch->fileName, &size);
+	Level level;
+	if (!data || !levelLoadMemory(&level, data, size)) {
+		UnloadFileData(data);
+		return false;
+	}
+
+	UnloadFileData(watch->data);
+	watch->data = data;
+	watch->level = level;
+	return true;
+}
+
+bool levelWatchOpen(LevelWatch *watch, const char *fileName) {
+	memset(watch, 0, sizeof(*watch));
+	watch->fileName = fileName;
+	if (!reload(watch))
+		return false;
+
+	watch->watch = LoadFileWatch(fileName);
+	return true;
+}
+
+void levelWatchClose(LevelWatch *watch) {
+	UnloadFileWatch(watch->watch);
+	UnloadFileData(watch->data);
+	memset(watch, 0, sizeof(*watch));
+}
+
+bool levelWatchPoll(LevelWatch *watch) {
+	if (!IsFileWatchChanged(watch->watch))
+		return false;
+
+	if (!reload(watch)) {
+		fprintf(stderr, "%s is not a valid level, keeping the last one\n", watch->fileName);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,25 @@
+#ifndef _level_watch_h_
+#define _level_watch_h_
+
+#include "raylib.h"
+#include "level.h"
+
+// A level file followed while the game runs, for editing it with levelc next to the game. The level
+// views a copy of the file rather than a mapping, which would change under it as the file is rewritten
+typedef struct LevelWatch {
+	FileWatch watch;
+	const char *fileName;
+	unsigned char *data;
+	Level level;
+	// For levelApply, the bricks the last reload changed and where they were
+	int changed[MAX_BRICKS];
+	Rectangle before[MAX_BRICKS];
+} LevelWatch;
+
+bool levelWatchOpen(LevelWatch *watch, const char *fileName);
+void levelWatchClose(LevelWatch *watch);
+// True when the file was rewritten with a valid level, which then replaces the one in watch->level.
+// A file that doesn't load keeps the old level
+bool levelWatchPoll(LevelWatch *watch);
+
+#endif //_level_watch_h_
@@ -0,0 +1,104 @@
+#include "loader.h"
+
+#include "raylib.h"
+
+static void *loaderMain(void *arg) {
+	Loader *loader = arg;
+	SetCurrentThreadPriority(PRIORITY_LOW);
+
+	for (int i = 0; i < loader->count; i++) {
+		LoadItem *item = &loader->items[i];
+		bool ok = !item->prepare || item->prepare(item->context);
+
+		pthread_mutex_lock(&loader->lock);
+		item->state = ok ? LOAD_PREPARED : LOAD_FAILED;
+		pthread_cond_signal(&loader->prepared);
+		pthread_mutex_unlock(&loader->lock);
+	}
+
+	return NULL;
+}
+
+void loaderInit(Loader *loader) {
+	loader->count = 0;
+	loader->done = 0;
+	loader->failed = 0;
+	loader->started = false;
+}
+
+bool loaderAdd(Loader *loader, LoadPrepareFunc prepare, LoadFinishFunc finish, void *context) {
+	if (loader->started || loader->count == MAX_LOAD_ITEMS)
+		return false;
+
+	loader->items[loader->count++] = (LoadItem){ prepare, finish, context, LOAD_QUEUED };
+	return true;
+}
+
+void loaderStart(Loader *loader) {
+	pthread_mutex_init(&loader->lock, NULL);
+	pthread_cond_init(&loader->prepared, NULL);
+	loader->started = true;
+
+	// Without a thread, as in a browser, each item is prepared on the calling thread right before it
+	// is finished, so the slices of the frames take turns with the CPU work too
+	if (pthread_create(&loader->thread, NULL, loaderMain, loader) != 0)
+		loader->started = false;
+}
+
+// Takes the next item off the loader thread, waiting for it to be prepared if wait is set
+static LoadItem *nextPrepared(Loader *loader, bool wait) {
+	LoadItem *item = &loader->items[loader->done];
+	if (!loader->started) {
+		if (item->state == LOAD_QUEUED)
+			item->state = !item->prepare || item->prepare(item->context) ? LOAD_PREPARED : LOAD_FAILED;
+		return item;
+	}
+
+	pthread_mutex_lock(&loader->lock);
+	while (wait && item->state == LOAD_QUEUED)
+		pthread_cond_wait(&loader->prepared, &loader->lock);
+	int state = item->state;
+	pthread_mutex_unlock(&loader->lock);
+
+	return state == LOAD_QUEUED ? NULL : item;
+}
+
+static void finishItem(Loader *loader, LoadItem *item) {
+	if (item->state == LOAD_FAILED)
+		loader->failed++;
+	else if (item->finish)
+		item->finish(item->context);
+	item->state = LOAD_FINISHED;
+	loader->done++;
+}
+
+bool loaderUpdate(Loader *loader, double budget) {
+	double start = GetTime();
+
+	while (loader->done < loader->count && GetTime() - start < budget) {
+		LoadItem *item = nextPrepared(loader, false);
+		if (!item)
+			break;
+		finishItem(loader, item);
+	}
+
+	return loader->done == loader->count;
+}
+
+void loaderWait(Loader *loader) {
+	while (loader->done < loader->count) {
+		finishItem(loader, nextPrepared(loader, true));
+	}
+}
+
+void loaderShutdown(Loader *loader) {
+	loaderWait(loader);
+	if (loader->started)
+		pthread_join(loader->thread, NULL);
+	pthread_cond_destroy(&loader->prepared);
+	pthread_mutex_destroy(&loader->lock);
+}
+
+float loaderProgress(const Loader *loader) {
+	return loader->count ? (float)loader->done/loader->count : 1.0f;
+}
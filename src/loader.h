@@ -0,0 +1,54 @@
+#ifndef _loader_h_
+#define _loader_h_
+
+#include <stdbool.h>
+#include <pthread.h>
+
+#define MAX_LOAD_ITEMS 32
+
+// CPU side of an asset, run on the loader thread. Returns false if the asset couldn't be prepared
+typedef bool (*LoadPrepareFunc)(void *context);
+// GPU uploads and anything else tied to the main thread, run from loaderUpdate()
+typedef void (*LoadFinishFunc)(void *context);
+
+enum {
+	LOAD_QUEUED,
+	LOAD_PREPARED,
+	LOAD_FAILED,
+	LOAD_FINISHED
+};
+
+typedef struct LoadItem {
+	LoadPrepareFunc prepare;
+	LoadFinishFunc finish;
+	void *context;
+	int state;
+} LoadItem;
+
+// Items are prepared and finished in the order they were added, so a later item may use an earlier one
+typedef struct Loader {
+	LoadItem items[MAX_LOAD_ITEMS];
+	int count;
+	int done;
+	int failed;
+
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t prepared;
+	bool started;
+} Loader;
+
+void loaderInit(Loader *loader);
+// Either function may be NULL. Only before loaderStart()
+bool loaderAdd(Loader *loader, LoadPrepareFunc prepare, LoadFinishFunc finish, void *context);
+void loaderStart(Loader *loader);
+
+// Finishes prepared items on the calling thread until budget seconds have gone. Returns true when everything is done
+bool loaderUpdate(Loader *loader, double budget);
+// Blocks until every item is done, for when the frontend can't wait any more frames
+void loaderWait(Loader *loader);
+void loaderShutdown(Loader *loader);
+
+float loaderProgress(const Loader *loader);
+
+#endif //_loader_h_
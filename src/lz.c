@@ -0,0 +1,136 @@
+#include "lz.h"
+
+#include <string.h>
+
+#define LZ_MIN_MATCH 4
+#define LZ_MAX_OFFSET 65535
+#define LZ_HASH_BITS 14
+// The last bytes are always literals so the decoder never reads a match past the end
+#define LZ_END_LITERALS 5
+
+static unsigned int hash4(const unsigned char *p) {
+	unsigned int v;
+	memcpy(&v, p, 4);
+	return (v*2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+// Lengths past 15 continue in extra bytes of 255 up to a final smaller byte
+static unsigned char *putLength(unsigned char *op, int length) {
+	for (; length >= 255; length -= 255) {
+		*op++ = 255;
+	}
+	*op++ = (unsigned char)length;
+	return op;
+}
+
+static unsigned char *putSequence(unsigned char *op, const unsigned char *literals, int literalCount, int offset, int matchLength) {
+	unsigned char *token = op++;
+	int matchCode = matchLength - LZ_MIN_MATCH;
+
+	*token = (unsigned char)((literalCount < 15 ? literalCount : 15) << 4);
+	if (literalCount >= 15)
+		op = putLength(op, literalCount - 15);
+	memcpy(op, literals, literalCount);
+	op += literalCount;
+
+	if (matchLength == 0)
+		return op;
+
+	op[0] = (unsigned char)offset;
+	op[1] = (unsigned char)(offset >> 8);
+	op += 2;
+
+	*token |= matchCode < 15 ? matchCode : 15;
+	if (matchCode >= 15)
+		op = putLength(op, matchCode - 15);
+	return op;
+}
+
+int lzCompress(const unsigned char *in, int size, unsigned char *out, int capacity) {
+	if (capacity < LZ_BOUND(size))
+		return -1;
+
+	static int table[1 << LZ_HASH_BITS];
+	for (int i = 0; i < (1 << LZ_HASH_BITS); i++) {
+		table[i] = -1;
+	}
+
+	unsigned char *op = out;
+	int anchor = 0;
+	int limit = size - LZ_END_LITERALS - LZ_MIN_MATCH;
+
+	for (int i = 0; i < limit;) {
+		unsigned int h = hash4(in + i);
+		int candidate = table[h];
+		table[h] = i;
+
+		if (candidate < 0 || i - candidate > LZ_MAX_OFFSET || memcmp(in + candidate, in + i, LZ_MIN_MATCH) != 0) {
+			i++;
+			continue;
+		}
+
+		int length = LZ_MIN_MATCH;
+		while (i + length < size - LZ_END_LITERALS && in[candidate + length] == in[i + length]) {
+			length++;
+		}
+
+		op = putSequence(op, in + anchor, i - anchor, i - candidate, length);
+		i += length;
+		anchor = i;
+	}
+
+	op = putSequence(op, in + anchor, size - anchor, 0, 0);
+	return (int)(op - out);
+}
+
+int lzDecompress(const unsigned char *in, int size, unsigned char *out, int capacity) {
+	const unsigned char *ip = in, *end = in + size;
+	unsigned char *op = out, *outEnd = out + capacity;
+
+	while (ip < end) {
+		int token = *ip++;
+
+		int literalCount = token >> 4;
+		if (literalCount == 15) {
+			for (int b = 255; b == 255 && ip < end; literalCount += b) {
+				b = *ip++;
+			}
+		}
+		if (literalCount > end - ip || literalCount > outEnd - op)
+			return -1;
+		memcpy(op, ip, literalCount);
+		op += literalCount;
+		ip += literalCount;
+
+		// A block ends on a literal run with no match after it
+		if (ip == end)
+			break;
+
+		if (end - ip < 2)
+			return -1;
+		int offset = ip[0] | (ip[1] << 8);
+		ip += 2;
+
+		int matchLength = (token & 15) + LZ_MIN_MATCH;
+		if ((token & 15) == 15) {
+			for (int b = 255; b == 255 && ip < end; matchLength += b) {
+				b = *ip++;
+			}
+		}
+		if (offset == 0 || offset > op - out || matchLength > outEnd - op)
+			return -1;
+
+		// Matches may overlap what they're copying, so byte at a time unless they're far enough back
+		const unsigned char *match = op - offset;
+		if (offset >= matchLength) {
+			memcpy(op, match, matchLength);
+			op += matchLength;
+		} else {
+			for (int i = 0; i < matchLength; i++) {
+				*op++ = match[i];
+			}
+		}
+	}
+
+	return (int)(op - out);
+}
@@ -0,0 +1,14 @@
+#ifndef _lz_h_
+#define _lz_h_
+
+// Byte-oriented LZ77 in the LZ4 block layout. Decoding is a few copies per match with no
+// entropy stage, so an unpacked section costs about as much as reading it
+
+// Worst case size of compressing size bytes
+#define LZ_BOUND(size) ((size) + (size)/255 + 16)
+
+// Both return the number of bytes written, or -1 if the output doesn't fit or the input is corrupt
+int lzCompress(const unsigned char *in, int size, unsigned char *out, int capacity);
+int lzDecompress(const unsigned char *in, int size, unsigned char *out, int capacity);
+
+#endif //_lz_h_
@@ -1,262 +1,1474 @@
 #include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"
 #include <time.h>
 #include <stdlib.h>
-#include <math.h>
+#include <string.h>
 #include <stdio.h>
 
-#include "snd_click.h"
-#include "snd_hit.h"
-
-#define SCREEN_WIDTH (854)
-#define SCREEN_HEIGHT (480)
-
-typedef struct Block {
-	Rectangle rect;
-	char type;
-	Color colour;
-	bool broken;
-} Block;
-
-Color randomColour() {
-	int i = GetRandomValue(0, 5);
-	switch (i) {
-		case 0: return YELLOW;
-		case 1: return RED;
-		case 2: return ORANGE;
-		case 3: return BLUE;
-		case 4: return LIME;
-		case 5: return DARKPURPLE;
+#if defined(_WIN32)
+	#include <direct.h>
+	#define makeDirectory(path) _mkdir(path)
+#else
+	#include <sys/stat.h>
+	#define makeDirectory(path) mkdir(path, 0755)
+#endif
+
+#if defined(__EMSCRIPTEN__)
+	#include <emscripten/emscripten.h>
+#endif
+
+#include "defs.h"
+#include "asset_pack.h"
+#include "atlas.h"
+#include "autoplay.h"
+#include "game.h"
+#include "gamepad.h"
+#include "heap.h"
+#include "brick_layer.h"
+#include "dirty.h"
+#include "hud.h"
+#include "input_path.h"
+#include "level_watch.h"
+#include "loader.h"
+#include "pack.h"
+#include "particles.h"
+#include "persist.h"
+#include "power.h"
+#include "profile.h"
+#include "profiler.h"
+#include "quality.h"
+#include "replay.h"
+#include "scenario.h"
+#include "viewport.h"
+#include "rewind.h"
+#include "sim_thread.h"
+#include "soft_render.h"
+#include "netplay.h"
+#include "spectate.h"
+#include "telemetry.h"
+#include "trace.h"
+#include "trail.h"
+
+// Strip covering the hud counters
+#define HUD_RECT ((Rectangle){ 10, 10, SCREEN_WIDTH - 20, 20 })
+
+// Gameplay clips toggled with F9
+#define CLIP_FPS 30
+
+// --audio-priority names from PRIORITY_LOW up
+static const char *priorityNames[] = { "low", "normal", "high", "realtime" };
+#define PRIORITY_COUNT ((int)(sizeof(priorityNames)/sizeof(priorityNames[0])))
+
+// --present names in PresentMode order, F6 cycles through them
+static const char *presentModeNames[] = { "immediate", "vsync", "adaptive", "vrr" };
+#define PRESENT_MODE_COUNT ((int)(sizeof(presentModeNames)/sizeof(presentModeNames[0])))
+
+// The audio device comes up on the loader thread while the window and GL context are created, its
+// backend probing never touches GL. Pack sounds are already in the device format, so loading one
+// there is a plain copy into an audio buffer
+static bool prepareAudio(void *context) {
+	const int *priority = context;
+	InitAudioDeviceEx((AudioDeviceConfig){ AUDIO_PERIOD_FRAMES, AUDIO_PERIODS, true, *priority });
+	SetSoundVoiceBudget(MIXED_VOICES);
+	// Hits merged in one period play at their summed gain, the limiter keeps a chain of them from clipping
+	SetAudioMixedEffect(AUDIO_EFFECT_LIMITER, true, 1.0f, 0.95f);
+	return IsAudioDeviceReady();
+}
+
+// The game's sound is only set when the load finishes on the main thread. Until then it is empty
+// and playing it does nothing, the same as when there is no audio device
+typedef struct SoundLoad {
+	const AssetPack *pack;
+	const char *name;
+	Sound loaded;
+	Sound *sound;
+} SoundLoad;
+
+static bool prepareSound(void *context) {
+	SoundLoad *load = context;
+	Wave wave = packWave(load->pack, load->name);
+	if (!wave.data || !IsAudioDeviceReady())
+		return false;
+	load->loaded = LoadSoundFromWave(wave);
+	return true;
+}
+
+static void finishSound(void *context) {
+	SoundLoad *load = context;
+	*load->sound = load->loaded;
+	TraceStartupPhase(load->name);
+}
+
+// The atlas has to be built before the hud can lay out text with its font
+typedef struct UiLoad {
+	Atlas *atlas;
+	Hud *hud;
+	bool sdfText;
+} UiLoad;
+
+static void finishAtlas(void *context) {
+	UiLoad *load = context;
+	atlasBuild(load->atlas);
+	TraceStartupPhase("atlas");
+}
+
+static void finishBrickLayer(void *context) {
+	brickLayerLoad(context);
+	TraceStartupPhase("brick layer");
+}
+
+static void finishHud(void *context) {
+	UiLoad *load = context;
+	if (load->sdfText)
+		hudLoadSDF(load->hud, load->atlas->font);
+	else
+		hudLoad(load->hud, load->atlas->font);
+	TraceStartupPhase("hud");
+}
+
+// Loader phases end when their main thread part finishes, so each one includes the loading frames
+// drawn since the one before
+static void printStartupTrace(void) {
+	StartupTrace trace = GetStartupTrace();
+	double last = 0.0;
+	fprintf(stderr, "startup: %.2f ms to the first interactive frame\n", trace.phaseCount ? trace.times[trace.phaseCount-1]*1000.0 : 0.0);
+	for (int i = 0; i < trace.phaseCount; i++) {
+		fprintf(stderr, "  %-20s %8.2f ms  at %8.2f ms\n", trace.phases[i], (trace.times[i] - last)*1000.0, trace.times[i]*1000.0);
+		last = trace.times[i];
 	}
 }
 
-int main(void)
-{
-	SetRandomSeed(time(NULL));
+// FNV-1a of the frame drawn so far, for comparing renders against known good ones
+static unsigned int hashScreen(void) {
+	rlDrawRenderBatchActive();
+	int width = GetRenderWidth(), height = GetRenderHeight();
+	unsigned char *pixels = rlReadScreenPixels(width, height);
+	unsigned int hash = 2166136261u;
+	for (int i = 0; i < width*height*4; i++) {
+		hash = (hash ^ pixels[i])*16777619u;
+	}
+	MemFree(pixels);
+	return hash;
+}
 
-	InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "attack breaker clone thingamajig");
-	SetTargetFPS(60);
+// Linked shader programs are kept in the user's cache directory, so later launches skip compiling
+// them. rlgl checks the driver and source on load and rebuilds anything stale. Without a usable
+// directory every program is compiled as before
+static void setShaderCache(void) {
+	static char dir[512];
+#if defined(_WIN32)
+	const char *base = getenv("LOCALAPPDATA");
+	if (!base || snprintf(dir, sizeof(dir), "%s\\attack_breaker", base) >= (int)sizeof(dir))
+		return;
+#else
+	const char *base = getenv("XDG_CACHE_HOME");
+	if (base && base[0]) {
+		if (snprintf(dir, sizeof(dir), "%s/attack_breaker", base) >= (int)sizeof(dir))
+			return;
+	} else {
+		base = getenv("HOME");
+		if (!base || snprintf(dir, sizeof(dir), "%s/.cache", base) >= (int)sizeof(dir))
+			return;
+		makeDirectory(dir);
+		if (snprintf(dir, sizeof(dir), "%s/.cache/attack_breaker", base) >= (int)sizeof(dir))
+			return;
+	}
+#endif
+	makeDirectory(dir);
+	rlSetShaderCacheDirectory(dir);
+}
 
-	InitAudioDevice();
+static void drawLoading(float progress) {
+	DrawText("loading", 370, 200, 30, WHITE);
+	DrawRectangle(277, 250, 300, 10, DARKGRAY);
+	DrawRectangle(277, 250, 300*progress, 10, YELLOW);
+}
 
-	Vector2 mousePosition = { -100.0f, -100.0f };
+// Where the paddle is drawn, blended between the last two ticks
+static Rectangle paddleDrawRect(const Game *game, float alpha) {
+	Rectangle paddle = game->paddle;
+	paddle.x = Lerp(game->prevPaddleX, paddle.x, alpha);
+	return paddle;
+}
 
-	Rectangle top		= { 0,-10, SCREEN_WIDTH,10 };
-	Rectangle bottom	= { 0,SCREEN_HEIGHT, SCREEN_WIDTH,10 };
-	Rectangle left 		= { -10,0, 10,SCREEN_HEIGHT };
-	Rectangle right		= { SCREEN_WIDTH,0, 10,SCREEN_HEIGHT };
+static Rectangle rivalPaddleDrawRect(const Game *game, float alpha) {
+	Rectangle paddle = game->rivalPaddle;
+	paddle.x = Lerp(game->prevRivalPaddleX, paddle.x, alpha);
+	return paddle;
+}
+
+// Shape distance antialiasing reaches half a pixel past the edge, so shapes are drawn that much
+// inside their rects to stay within the areas the dirty region tracks
+static Rectangle insetRect(Rectangle rect) {
+	return (Rectangle){ rect.x + 0.5f, rect.y + 0.5f, rect.width - 1.0f, rect.height - 1.0f };
+}
+
+static void drawBalls(const BallPool *balls, float alpha) {
+	for (int i = 0; i < balls->count; i++) {
+		Rectangle rect = insetRect(ballDrawRect(balls, i, alpha));
+		DrawCircleSDF((Vector2){ rect.x + rect.width/2, rect.y + rect.height/2 }, rect.width/2, GRAY);
+	}
+}
+
+// trails is NULL with them off
+static void drawScene(const Game *game, const BrickLayer *brickLayer, const ParticleArena *particles, const BallTrails *trails, const Hud *hud, int fps, float alpha, Rectangle paddle) {
+	if (game->state == STATE_TITLE) {
 
-	Rectangle ball = { 300,300, 25,25 };
-	Rectangle ballpoint = { 300,300, 1,1 };
-	float velAngle = PI/3;
+		if (game->hoveringPlayButton)
+			DrawRectangle(330, 190, 165, 60, DARKGRAY);
+		else
+			DrawRectangle(330, 190, 165, 60, GRAY);
 
-	Rectangle paddle = { 50, 460, 100, 20 };
+		hudBeginText(hud);
+		DrawTextLayout(hud->title, (Vector2){ 150, 10 }, YELLOW);
+		DrawTextLayout(hud->play, (Vector2){ 370, 200 }, WHITE);
+		hudEndText(hud);
 
-	Block blocks[256];
-	bool blockSlots[256];
-	int blockCount = 0;
+	} else if (game->state == STATE_PLAYING) {
+		// Opaque first, blending only for what goes over it
+		BeginBlendMode(BLEND_OPAQUE);
+		if (game->attack)
+			brickLayerDrawRing(brickLayer, game->scroll, fieldRowY(game->fieldHead));
+		else
+			brickLayerDraw(brickLayer);
+		EndBlendMode();
 
-	int state = 0;
+		// Under everything that moves, and flat, so before the distance shapes
+		if (trails)
+			trailsDraw(trails, &game->balls, alpha, GRAY);
 
-	for (int i = 0; i < 256; i++) {
-		blockSlots[i] = false;
+		// Paddle, particles and balls are all distance shapes, one shader switch for the lot
+		BeginShapesSDF();
+		Rectangle rounded = insetRect(paddle);
+		DrawRectangleRoundedSDF(rounded, rounded.height/2, GRAY);
+		if (game->versus) {
+			Rectangle rival = insetRect(rivalPaddleDrawRect(game, alpha));
+			DrawRectangleRoundedSDF(rival, rival.height/2, ORANGE);
+		}
+		particlesDraw(particles, alpha);
+		drawBalls(&game->balls, alpha);
+		EndShapesSDF();
+
+		hudDraw(hud, brickRemaining(&game->bricks), game->score, fps);
+		if (game->versus) {
+			hudBeginText(hud);
+			hudDrawNumber(hud, game->rivalScore, (Vector2){ SCREEN_WIDTH - 100, SCREEN_HEIGHT - 30 }, ORANGE);
+			hudEndText(hud);
+		}
+	} else if (game->state == STATE_WON) {
+		hudBeginText(hud);
+		DrawTextLayout(hud->won, (Vector2){ 290, 190 }, YELLOW);
+		hudEndText(hud);
+	} else if (game->state == STATE_LOST) {
+		hudBeginText(hud);
+		DrawTextLayout(hud->lost, (Vector2){ 270, 190 }, RED);
+		hudEndText(hud);
 	}
+}
 
-	Wave clickWav = LoadWaveFromMemory(".ogg", snd_click, snd_click_size);
-	Sound clickSnd = LoadSoundFromWave(clickWav);
-	Wave hitWav = LoadWaveFromMemory(".ogg", snd_hit, snd_hit_size);
-	Sound hitSnd = LoadSoundFromWave(hitWav);
-	//Sound clickSnd = LoadSound("../click.ogg");
-	//Sound hitSnd = LoadSound("../hit.ogg");
+// Keeps the previous frame in a render texture and only repaints the areas that changed
+static void drawRetained(RenderTexture2D *retained, const DirtyRegion *dirty, const Game *game, const BrickLayer *brickLayer, const ParticleArena *particles, const BallTrails *trails, const Hud *hud, int fps, float alpha, Rectangle paddle) {
+	BeginTextureMode(*retained);
 
-	int n = 0;
-	for (int x = 0; x < 17; x++) {
-		for (int y = 0; y < 6; y++) {
-#define BLOCK_WIDTH 40
-#define BLOCK_HEIGHT 20
+	if (dirty->full) {
+		ClearBackground(BLACK);
+		drawScene(game, brickLayer, particles, trails, hud, fps, alpha, paddle);
+	} else {
+		// Everything is still submitted for each area, but the scissor keeps fill to the changed pixels
+		for (int i = 0; i < dirty->count; i++) {
+			Rectangle rect = dirty->rects[i];
+			BeginScissorMode(rect.x, rect.y, rect.width, rect.height);
+			ClearBackground(BLACK);
+			drawScene(game, brickLayer, particles, trails, hud, fps, alpha, paddle);
+			EndScissorMode();
+		}
+	}
 
-			blocks[n].rect.x = 40+(x*(BLOCK_WIDTH+5));
-			blocks[n].rect.y = 50+(y*(BLOCK_HEIGHT+5));
-			blocks[n].rect.width = BLOCK_WIDTH;
-			blocks[n].rect.height = BLOCK_HEIGHT;
-			blocks[n].type = 1;
-			blocks[n].colour = randomColour();
-			blocks[n].broken = false;
+	EndTextureMode();
 
-			blockCount++;
-			blockSlots[n] = true;
+	Rectangle source = { 0, 0, retained->texture.width, -retained->texture.height };
+	BeginBlendMode(BLEND_OPAQUE);
+	DrawTextureRec(retained->texture, source, (Vector2){ 0, 0 }, WHITE);
+	EndBlendMode();
+}
+
+// One tick on the simulation thread with --threaded, the frame loop's steps without rewind
+typedef struct ThreadedTick {
+	Game *game;
+	Replay *replay;
+	bool playback;
+	bool record;
+	Spectate *spectate;
+	int tick;
+} ThreadedTick;
+
+static void threadedTick(void *context, GameInput input, GameEvents *events) {
+	ThreadedTick *run = context;
+	if (run->playback) {
+		if (run->tick < run->replay->tickCount)
+			input = run->replay->inputs[run->tick];
+	} else if (run->record) {
+		replayRecord(run->replay, input);
+	}
+	run->tick++;
 
-			n++;
+	gameTick(run->game, input, events);
+	if (run->spectate)
+		spectateTick(run->spectate, run->game);
+}
+
+// Threaded frames only say which bricks are live, the ones gone since before burst like broken events
+static void burstBroken(ParticleArena *particles, const Game *game, const uint64_t *before) {
+	const BrickStore *store = &game->bricks;
+	for (int w = 0; w < BRICK_WORDS; w++) {
+		uint64_t broken = before[w] & ~store->live[w];
+		for (int bit = 0; broken; bit++, broken >>= 1) {
+			if (broken & 1) {
+				int brick = (w << 6) + bit;
+				particlesBurst(particles, gameBrickRect(game, brick), brickColour(store, brick));
+			}
 		}
 	}
+}
+
+// Starts a run on the loaded level, or the built-in wall without one. False when the grid left
+// some of the level's bricks out
+static bool startGame(Game *game, const Level *level) {
+	if (level)
+		return gameInitLevel(game, level);
+	gameInit(game);
+	return true;
+}
 
-	int cooldownCollision = 0;
+// Steps the simulation as fast as possible with no window, GL context or audio device.
+// With a replay the recorded inputs are fed back instead of the built-in autopilot.
+static int runHeadless(long ticks, const Replay *replay, unsigned int seed, bool fixedPhysics, bool attack, const Level *level, JobPool *jobs) {
+	static Game game;
+	game.fixedPhysics = fixedPhysics;
+	game.attack = attack;
+	gameSeed(&game, seed);
+	startGame(&game, level);
+	game.jobs = jobs;
+	if (!replay)
+		game.state = STATE_PLAYING;
 
-	bool hoveringPlayButton = false;
+	int clears = 0;
+	GameEvents events = { 0 };
 
-	while (!WindowShouldClose()) {
+	clock_t start = clock();
+	for (long i = 0; i < ticks; i++) {
+		GameInput input;
+		if (replay) {
+			input = replay->inputs[i];
+		} else {
+			// Keep the paddle under the ball so a run isn't over after the first miss
+			input = (GameInput){ { game.balls.x[0] + BALL_SIZE/2.0f, 0 }, false };
+		}
+		gameTick(&game, input, &events);
 
-		if (state == 0) {
+		if (!replay && (game.state == STATE_WON || game.state == STATE_LOST)) {
+			if (game.state == STATE_WON)
+				clears++;
+			startGame(&game, level);
+			game.state = STATE_PLAYING;
+		}
+	}
+	double elapsed = (double)(clock() - start)/CLOCKS_PER_SEC;
+
+	printf("%ld ticks in %.3f s (%.0f ticks/s), %d hits, %d clicks, %d clears, checksum %08x\n",
+		ticks, elapsed, elapsed > 0 ? ticks/elapsed : 0.0, events.hits, events.clicks, clears, gameChecksum(&game));
+
+	return 0;
+}
+
+// Everything the frames work on from the loading screen to the end of the run. In the browser each
+// frame is a callback, so the loop's state can't live in main()
+typedef struct Session {
+	const BenchScenario *scenario;
+	const char *recordPath;
+	const char *replayPath;
+	const char *telemetryPath;
+	bool dirtyMode;
+	// With --software frames are drawn on the CPU, GL only shows them
+	bool software;
+	bool lateLatch;
+	bool threaded;
+	bool netplay;
+	bool scaled;
+	bool startupTrace;
+	bool startupExit;
+	bool autopilot;
+	bool particlesOn;
+	bool trailsOn;
+	bool streaming;
+	int frameHashInterval;
+	float thumbnailInterval;
+	// Full frame rate under the power policy, 0 with the policy off
+	int powerFps;
+	// Cores the simulation thread and this one are pinned to, -1 for any
+	int simCore;
+	int renderCore;
+	int audioPriority;
+
+	Loader *loader;
+	Replay *replay;
+	const AssetPack *pack;
+	const Level *level;
+	// With --watch-level, the loaded level follows its file
+	LevelWatch *levelWatch;
+	// Bricks the reload this frame changed, for the brick layer, -1 without one
+	int reloaded;
+	// Settings and high scores, NULL for a run that is replayed or measured and saves nothing
+	const char *profilePath;
+	Profile profile;
+	Persist persist;
+	// State when the scores were last checked, a run that ends adds its score
+	int profileState;
+
+	Game game;
+	Netplay net;
+	Spectate spectate;
+	FieldRows fieldRows;
+	BenchRun benchRun;
+	RewindBuffer history;
+	Profiler profiler;
+	ParticleArena particles;
+	BallTrails trails;
+	InputPath inputPath;
+	// With --gamepad, the controller that steers instead of the mouse
+	Gamepad gamepad;
+	int gamepadIndex;
+	Autoplayer autoplayer;
+	HeapGuard heapGuard;
+	Telemetry telemetry;
+	PowerPolicy power;
+
+	Viewport viewport;
+	// Internal resolution from --resolution, 0 without. The quality governor draws below it, or below
+	// the window's when there was none
+	int renderW, renderH;
+	int renderFilter;
+	QualityGovernor quality;
+	BrickLayer brickLayer;
+	SoftRender soft;
+	Atlas atlas;
+	Hud hud;
+	Sound clickSnd;
+	Sound hitSnd;
+	RandomStream soundRandom;
+	Music music;
+	// Set when the music couldn't get its decoder thread, the frames stream it instead
+	bool musicPolled;
+
+	// With --threaded the game ticks on its own thread and the frames draw view, a copy of it as the
+	// latest tick left it. Brick geometry isn't in the frames, so view starts as a full copy
+	SimThread sim;
+	ThreadedTick threadedContext;
+	Game view;
+	uint64_t shownLive[BRICK_WORDS];
+	int shownTick, shownHits, shownClicks;
+
+	float accumulator;
+	int tick;
+	int benchFrame;
+	int frameNumber;
+	bool playing;
+
+	// Only used with --dirty-rects, for displays where fill rate is the bottleneck
+	RenderTexture2D retained;
+	DirtyRegion dirty;
+	Rectangle lastBalls[MAX_BALLS];
+	int lastBallCount;
+	Rectangle lastPaddle;
+	Rectangle lastParticles;
+	Rectangle lastTrails;
+	int lastState;
+	bool idling;
+
+	// Captures are read back and written without stalling the frame, so they can run during play
+	int screenshots, thumbnails, clips;
+	float thumbnailTimer;
+} Session;
+
+// One frame of the loading screen, true once everything is loaded
+static bool loadingFrame(Session *s) {
+	if (loaderUpdate(s->loader, LOAD_SLICE_TIME))
+		return true;
+
+	BeginDrawing();
+	if (s->scaled)
+		viewportBegin(&s->viewport);
+	ClearBackground(BLACK);
+	drawLoading(loaderProgress(s->loader));
+	if (s->scaled)
+		viewportEnd(&s->viewport);
+	EndDrawing();
+	return false;
+}
+
+// Effects and presentation for the governor's level, nothing the simulation reads
+static void applyQuality(Session *s) {
+	QualitySettings settings = qualitySettings(s->quality.level);
+	particlesSetLimit(&s->particles, settings.particles);
+	trailsSetLength(&s->trails, settings.trailLength);
+	SetShapesCircleErrorRate(settings.circleError);
+	if (IsAudioDeviceReady())
+		SetSoundVoiceBudget(settings.voices);
+
+	// The CPU frame and the retained one are drawn at virtual resolution whatever the level
+	if (s->software || s->dirtyMode)
+		return;
+	bool asked = s->renderW > 0 && s->renderH > 0;
+	int w = (int)((asked ? s->renderW : GetRenderWidth())*settings.resolution);
+	int h = (int)((asked ? s->renderH : GetRenderHeight())*settings.resolution);
+	bool direct = !asked && settings.resolution >= 1.0f;
+	Texture2D current = s->viewport.target.texture;
+	if (s->scaled ? current.width == w && current.height == h : direct)
+		return;
+
+	if (s->scaled)
+		viewportUnload(&s->viewport);
+	s->scaled = !direct && viewportLoad(&s->viewport, w, h, asked ? s->renderFilter : TEXTURE_FILTER_BILINEAR);
+	if (!direct && !s->scaled)
+		fprintf(stderr, "could not create a %dx%d render target\n", w, h);
+}
+
+static void beginPlay(Session *s) {
+	// Closing mid-load still finishes everything so the unloads at the end are safe
+	loaderShutdown(s->loader);
+
+	if (s->dirtyMode)
+		s->retained = LoadRenderTexture(SCREEN_WIDTH, SCREEN_HEIGHT);
+	if (s->software && !softRenderInit(&s->soft, s->atlas.font)) {
+		fprintf(stderr, "could not set up software rendering, drawing with GL\n");
+		softRenderUnload(&s->soft);
+		s->software = false;
+	}
+	s->lastState = -1;
+
+	// Optional, a pack built with a -f music entry has background music. It decodes on its own
+	// thread, so the frames don't call UpdateMusicStream() unless there are no threads
+	s->music = packMusic(s->pack, "music");
+	if (IsMusicReady(s->music)) {
+		s->musicPolled = !StartMusicStreamDecoder(s->music, MUSIC_BUFFER_MS);
+		PlayMusicStream(s->music);
+	}
+	TraceStartupPhase("music");
+
+	if (s->threaded) {
+		s->view = s->game;
+		s->threadedContext = (ThreadedTick){ &s->game, s->replay, s->replayPath != NULL, s->recordPath != NULL, s->streaming ? &s->spectate : NULL, 0 };
+		if (!simThreadStart(&s->sim, &s->game, threadedTick, &s->threadedContext, s->simCore)) {
+			fprintf(stderr, "could not start the simulation thread\n");
+			s->threaded = false;
+		}
+	}
+
+	applyQuality(s);
+	inputPathReset(&s->inputPath, (GameInput){ GetMousePosition(), false });
+	if (s->gamepadIndex >= 0)
+		gamepadOpen(&s->gamepad, s->gamepadIndex);
+
+	if (s->profilePath && !persistOpen(&s->persist, s->profilePath))
+		s->profilePath = NULL;
+	s->profileState = s->game.state;
+
+	// Everything is loaded, from here frames shouldn't touch the heap. Recording grows the replay
+	// and captures allocate their pixel buffers, so those turn the guard off
+	heapGuardArm(&s->heapGuard, !s->recordPath && s->thumbnailInterval <= 0.0f);
+
+	// Event-driven frames would starve a polled music stream and the thumbnail timer
+	if (s->powerFps > 0)
+		powerInit(&s->power, s->powerFps, !s->musicPolled && s->thumbnailInterval <= 0.0f);
+
+	// Field logging, every frame of the session from here to the file
+	if (s->telemetryPath && !telemetryOpen(&s->telemetry, s->telemetryPath))
+		fprintf(stderr, "could not write telemetry to %s\n", s->telemetryPath);
+
+	// Last, threads started from here on Linux would inherit the pin
+	if (s->renderCore >= 0)
+		SetCurrentThreadAffinity(s->renderCore);
+	s->playing = true;
+}
+
+// Handed to the writer thread, the frame only copies the record
+static void saveProfile(Session *s) {
+	unsigned char record[PROFILE_RECORD_SIZE];
+	persistSave(&s->persist, record, profileEncode(&s->profile, record));
+}
+
+// Hits and clicks each get a voice panned to where the ball was and a little off pitch, so a run of
+// them doesn't drone
+static void playVaried(Session *s, Sound sound, float x) {
+	float pitch = 1.0f + (GetRandomStreamFloat(&s->soundRandom)*2.0f - 1.0f)*SOUND_PITCH_JITTER;
+	float pan = 0.5f - (x/SCREEN_WIDTH - 0.5f)*SOUND_PAN_SPREAD;
+	PlaySoundVoiceEx(sound, 1.0f, pan, pitch);
+}
+
+// One frame of the game, false when the run is over
+static bool playFrame(Session *s) {
+	Game *game = &s->game;
+	const Game *scene = s->threaded ? &s->view : game;
+	Profiler *profiler = &s->profiler;
+
+	TRACE_BEGIN("frame");
+
+	if (IsKeyPressed(KEY_F3))
+		profiler->visible = !profiler->visible;
+	if (IsKeyPressed(KEY_F6))
+		SetPresentMode((GetPresentMode() + 1) % PRESENT_MODE_COUNT);
+	// At most one frame queued behind the one being drawn, or as many as the driver buffers
+	if (IsKeyPressed(KEY_F7))
+		SetFrameLatencyLimit(GetFrameLatencyLimit() ? 0 : 1);
+	if ((IsKeyPressed(KEY_F6) || IsKeyPressed(KEY_F7)) && s->profilePath) {
+		s->profile.presentMode = GetPresentMode();
+		s->profile.frameLatency = GetFrameLatencyLimit();
+		saveProfile(s);
+	}
+	// A clip records frames as they come, so recording counts as play
+	powerFrame(&s->power, scene->state == STATE_PLAYING || IsKeyDown(KEY_BACKSPACE) || IsVideoRecording());
+	if (IsKeyPressed(KEY_F12) || IsKeyPressed(KEY_F9))
+		heapGuardArm(&s->heapGuard, false);
+	if (IsKeyPressed(KEY_F12))
+		TakeScreenshotAsync(TextFormat("screenshot%03d.tga", s->screenshots++));
+	if (IsKeyPressed(KEY_F9)) {
+		if (IsVideoRecording())
+			StopVideoRecording();
+		else
+			StartVideoRecording(TextFormat("clip%03d.y4m", s->clips++), CLIP_FPS);
+	}
+
+	// Periodic thumbnails for attract mode, taken at the end of this frame
+	if (s->thumbnailInterval > 0.0f) {
+		s->thumbnailTimer += GetFrameTime();
+		if (s->thumbnailTimer >= s->thumbnailInterval) {
+			s->thumbnailTimer -= s->thumbnailInterval;
+			TakeScreenshotAsync(TextFormat("thumb%03d.tga", s->thumbnails++));
+		}
+	}
+
+	if (s->musicPolled)
+		UpdateMusicStream(s->music);
+
+	profilerBegin(profiler, PROFILE_SIM);
+
+	s->accumulator += s->scenario ? TICK_TIME : GetFrameTime();
+	if (s->accumulator > MAX_FRAME_TICKS*TICK_TIME)
+		s->accumulator = MAX_FRAME_TICKS*TICK_TIME;
+
+	// Holding Backspace steps back one snapshot a frame instead of running ticks. A recording is cut
+	// back with it, so the saved replay is the timeline that was kept
+	bool rewinding = !s->netplay && !s->threaded && IsKeyDown(KEY_BACKSPACE);
+	if (rewinding) {
+		s->accumulator = 0.0f;
+		if (rewindPop(&s->history, game, &s->tick)) {
+			if (s->recordPath)
+				s->replay->tickCount = s->tick;
+			particlesClear(&s->particles);
+			trailsClear(&s->trails);
+			brickLayerInvalidate(&s->brickLayer);
+			s->lastState = -1;
+		}
+	}
+
+	// A rewritten level is applied to the run in play, restarts build all of it. Snapshots don't hold
+	// brick geometry, so the history from before goes
+	s->reloaded = -1;
+	if (s->levelWatch && levelWatchPoll(s->levelWatch) && game->state == STATE_PLAYING) {
+		LevelWatch *watch = s->levelWatch;
+		double start = GetTime();
+		s->reloaded = levelApply(&watch->level, &game->bricks, &game->grid, watch->changed, watch->before);
+		rewindClear(&s->history);
+		printf("level reloaded, %d bricks changed in %.3f ms\n", s->reloaded, (GetTime() - start)*1000.0);
+	}
 
-			mousePosition = GetMousePosition();
+	// Cursor is sampled right before the ticks that use it, not only on the last events poll
+	TRACE_BEGIN("input");
+	Vector2 mouse = s->lateLatch ? GetMousePositionLatest() : GetMousePosition();
+	profiler->inputTime = GetTime();
 
-			hoveringPlayButton = (mousePosition.x > 330 && mousePosition.x < 330+165 && mousePosition.y > 190 && mousePosition.y < 190+60);
-			if (hoveringPlayButton && IsMouseButtonDown(MOUSE_BUTTON_LEFT)) {
-				state = 1;
+	// Without late latch each tick takes its point along the cursor's path since the last frame
+	inputPathPoll(&s->inputPath, (GameInput){ mouse, IsMouseButtonDown(MOUSE_BUTTON_LEFT) });
+	int frameTicks = (int)(s->accumulator/TICK_TIME);
+	int frameTick = 0;
+	int ticksRun = 0;
+	// Ticks this frame stand for the time up to now less what stays in the accumulator, the first
+	// one ends a tick after that starts
+	double ticksStart = GetTime() - s->accumulator;
+	if (s->gamepadIndex >= 0)
+		gamepadPoll(&s->gamepad);
+	TRACE_END();
+
+	if (s->threaded) {
+		GameInput input = { mouse, IsMouseButtonDown(MOUSE_BUTTON_LEFT) };
+		if (s->gamepadIndex >= 0)
+			input = gamepadAt(&s->gamepad, input, GetTime());
+		simThreadInput(&s->sim, input);
+
+		const SimFrame *frame = simThreadFrame(&s->sim);
+		if (frame->tick != s->shownTick) {
+			memcpy(s->shownLive, s->view.bricks.live, sizeof(s->shownLive));
+			gameRestore(&s->view, &frame->game);
+			burstBroken(&s->particles, &s->view, s->shownLive);
+
+			// Frames don't say where the ball was, so these stay centred
+			if (frame->hits != s->shownHits)
+				playVaried(s, s->hitSnd, SCREEN_WIDTH/2.0f);
+			if (frame->clicks != s->shownClicks)
+				playVaried(s, s->clickSnd, SCREEN_WIDTH/2.0f);
+
+			int ticks = frame->tick - s->shownTick;
+			ticksRun = ticks;
+			for (int i = 0; i < ticks && i < MAX_FRAME_TICKS; i++) {
+				particlesTick(&s->particles);
 			}
+			// Only the latest of the ticks is in the frame, so its spacing is the frame's
+			if (s->trailsOn)
+				trailsTick(&s->trails, &s->view.balls);
+			s->shownTick = frame->tick;
+			s->shownHits = frame->hits;
+			s->shownClicks = frame->clicks;
+		}
 
-		} else if (state == 1) {
-			for (int i = 0; i < 16; i++) {
-
-				mousePosition = GetMousePosition();
-				paddle.x = mousePosition.x - paddle.width/2;
-
-				#define SPEED 8/16
-
-				ball.x += cos(velAngle) *SPEED;
-				ball.y += sin(velAngle) *SPEED;
-				ballpoint.x = ball.x;
-				ballpoint.y = ball.y;
-
-				for (int i = 0; i < 256; i++) {
-					if (blockSlots[i] && !blocks[i].broken && CheckCollisionRecs(ball, blocks[i].rect)) {
-						blocks[i].broken = true;
-						blockCount--;
-
-						Rectangle bt = {blocks[i].rect.x,blocks[i].rect.y,blocks[i].rect.width,2};
-						Rectangle bb = {blocks[i].rect.x,blocks[i].rect.y+blocks[i].rect.height-2,blocks[i].rect.width,2};
-						Rectangle bl = {blocks[i].rect.x,blocks[i].rect.y,2,blocks[i].rect.height};
-						Rectangle br = {blocks[i].rect.x+blocks[i].rect.width-2,blocks[i].rect.y,2,blocks[i].rect.height};
-
-						if (CheckCollisionRecs(ball, bb)) {
-							if (cos(velAngle) *SPEED > 0) {
-								velAngle += PI/2;
-							} else {
-								velAngle -= PI/2;
-							}
-							cooldownCollision = 0;
-							PlaySound(hitSnd);
-						}
-						else if (CheckCollisionRecs(ball, bt)) {
-							if (cos(velAngle) *SPEED < 0) {
-								velAngle += PI/2;
-							} else {
-								velAngle -= PI/2;
-							}
-							cooldownCollision = 0;
-							PlaySound(hitSnd);
-						}
-						else if (CheckCollisionRecs(ball, br)) {
-							if (sin(velAngle) *SPEED < 0) {
-								velAngle += PI/2;
-							} else {
-								velAngle -= PI/2;
-							}
-							cooldownCollision = 0;
-							PlaySound(hitSnd);
-						}
-						else if (CheckCollisionRecs(ball, bl)) {
-							if (sin(velAngle) *SPEED > 0) {
-								velAngle += PI/2;
-							} else {
-								velAngle -= PI/2;
-							}
-							cooldownCollision = 0;
-							PlaySound(hitSnd);
-						}
-					}
-				}
+		// The accumulator stands for the time since the tick shown, for blending
+		s->accumulator = Clamp(GetTime() - frame->time, 0.0f, TICK_TIME);
+	} else {
+		// Late remote inputs are applied here, re-simulating the ticks they change
+		if (s->netplay)
+			netplayPoll(&s->net, game);
 
-				if (CheckCollisionRecs(ball, top) && cooldownCollision != 1) {
-					cooldownCollision = 1;
-					if (cos(velAngle) *SPEED > 0) {
-						velAngle += PI/(2+rand()%1);
-					} else {
-						velAngle -= PI/(2+rand()%1);
-					}
-					PlaySound(clickSnd);
-				}
-				if (CheckCollisionRecs(ball, bottom) && cooldownCollision != 2) {
-					cooldownCollision = 2;
-					if (cos(velAngle) *SPEED < 0) {
-						velAngle += PI/(2+rand()%1);
-					} else {
-						velAngle -= PI/(2+rand()%1);
-					}
-					PlaySound(clickSnd);
-				}
-				if (CheckCollisionRecs(ball, left) && cooldownCollision != 3) {
-					cooldownCollision = 3;
-					if (sin(velAngle) *SPEED < 0) {
-						velAngle += PI/(2+rand()%1);
-					} else {
-						velAngle -= PI/(2+rand()%1);
-					}
-					PlaySound(clickSnd);
-				}
-				if (CheckCollisionRecs(ball, right) && cooldownCollision != 4) {
-					cooldownCollision = 4;
-					if (sin(velAngle) *SPEED > 0) {
-						velAngle += PI/(2+rand()%1);
-					} else {
-						velAngle -= PI/(2+rand()%1);
-					}
-					PlaySound(clickSnd);
+		// Simulation advances in fixed ticks no matter how fast frames are rendered
+		TRACE_BEGIN("ticks");
+		while (s->accumulator >= TICK_TIME) {
+			s->accumulator -= TICK_TIME;
+
+			GameInput input = { mouse, IsMouseButtonDown(MOUSE_BUTTON_LEFT) };
+			if (!s->lateLatch)
+				input = inputPathAt(&s->inputPath, frameTick++, frameTicks);
+			if (s->gamepadIndex >= 0)
+				input = gamepadAt(&s->gamepad, input, ticksStart + (ticksRun+1)*TICK_TIME);
+			// Benchmarks keep the paddle under the first ball, so their frames match earlier runs
+			if (s->autopilot && s->scenario)
+				input = (GameInput){ { game->balls.x[0] + BALL_SIZE/2.0f, 0 }, false };
+			else if (s->autopilot)
+				input = autoplayInput(&s->autoplayer, game);
+			GameEvents events = { 0 };
+			if (s->netplay) {
+				// Too far ahead of the other side, wait for it instead of building up time to catch up
+				if (!netplayTick(&s->net, game, input, &events)) {
+					s->accumulator = 0.0f;
+					break;
 				}
-				if (CheckCollisionRecs(ball, paddle) && cooldownCollision != 5) {
-					cooldownCollision = 5;
-					if (cos(velAngle) *SPEED < 0) {
-						velAngle += PI/(2+rand()%1);
-					} else {
-						velAngle -= PI/(2+rand()%1);
-					}
-					PlaySound(clickSnd);
+			} else {
+				if (s->tick % REWIND_INTERVAL == 0)
+					rewindPush(&s->history, game, s->tick);
+
+				if (s->replayPath) {
+					if (s->tick < s->replay->tickCount)
+						input = s->replay->inputs[s->tick];
+				} else if (s->recordPath) {
+					replayRecord(s->replay, input);
 				}
+				s->tick++;
+
+				gameTick(game, input, &events);
+			}
+			ticksRun++;
+			if (s->streaming)
+				spectateTick(&s->spectate, game);
+
+			if (events.hits)
+				playVaried(s, s->hitSnd, events.hitX);
+			if (events.clicks)
+				playVaried(s, s->clickSnd, events.clickX);
 
-				/*if (CheckCollisionRecs(ball, top)
-				|| CheckCollisionRecs(ball, bottom)
-				|| CheckCollisionRecs(ball, left)
-				|| CheckCollisionRecs(ball, right)
-				|| CheckCollisionRecs(ball, paddle)) {
-					velAngle -= PI/(2+rand()%1);
-				}*/
+			// Bricks stay in the store after breaking, so their rect and colour are still there
+			for (int i = 0; i < events.brokenCount && s->particlesOn; i++) {
+				int brick = events.broken[i];
+				particlesBurst(&s->particles, gameBrickRect(game, brick), brickColour(&game->bricks, brick));
+			}
+			particlesTick(&s->particles);
+			if (s->trailsOn)
+				trailsTick(&s->trails, &game->balls);
+
+			if (s->autopilot && (game->state == STATE_WON || game->state == STATE_LOST)) {
+				startGame(game, s->level);
+				if (s->scenario)
+					gameAddBalls(game, s->scenario->balls);
+				autoplayReset(&s->autoplayer);
+				game->state = STATE_PLAYING;
+				brickLayerInvalidate(&s->brickLayer);
+				s->lastState = -1;
+			}
+		}
+		TRACE_END();
+	}
+
+	profilerEnd(profiler, PROFILE_SIM);
+
+	if (s->profilePath) {
+		if (s->profileState == STATE_PLAYING && (scene->state == STATE_WON || scene->state == STATE_LOST) && profileAddScore(&s->profile, scene->score))
+			saveProfile(s);
+		s->profileState = scene->state;
+	}
+
+	float alpha = s->accumulator/TICK_TIME;
+	Rectangle paddle = paddleDrawRect(scene, alpha);
+
+	// Late latch: the paddle is drawn where the cursor is now, the simulation catches up on the next tick.
+	// Replays have to show the recorded paddle.
+	profiler->latchTime = 0.0;
+	if (s->lateLatch && !s->replayPath && scene->state == STATE_PLAYING) {
+		paddle.x = GetMousePositionLatest().x - paddle.width/2;
+		profiler->latchTime = GetTime();
+	}
+
+	if (s->dirtyMode) {
+		DirtyRegion *dirty = &s->dirty;
+		dirtyReset(dirty);
+		// The attack field moves every frame, so all of it is redrawn
+		if (scene->state != STATE_PLAYING || scene->state != s->lastState || scene->attack) {
+			dirtyAll(dirty);
+		} else {
+			for (int i = 0; i < s->lastBallCount; i++) {
+				dirtyAdd(dirty, s->lastBalls[i]);
+			}
+			for (int i = 0; i < scene->balls.count; i++) {
+				dirtyAdd(dirty, ballDrawRect(&scene->balls, i, alpha));
 			}
+			dirtyAdd(dirty, s->lastPaddle);
+			dirtyAdd(dirty, paddle);
+			dirtyAdd(dirty, s->lastParticles);
+			dirtyAdd(dirty, particlesBounds(&s->particles));
+			dirtyAdd(dirty, s->lastTrails);
+			dirtyAdd(dirty, trailsBounds(&s->trails, &scene->balls, alpha));
+			dirtyAdd(dirty, HUD_RECT);
 		}
+		for (int i = 0; i < scene->balls.count; i++) {
+			s->lastBalls[i] = ballDrawRect(&scene->balls, i, alpha);
+		}
+		s->lastBallCount = scene->balls.count;
+		s->lastPaddle = paddle;
+		s->lastParticles = particlesBounds(&s->particles);
+		s->lastTrails = trailsBounds(&s->trails, &scene->balls, alpha);
+		s->lastState = scene->state;
+	}
+
+	if (scene->state == STATE_PLAYING && !s->software) {
+		if (s->reloaded >= 0)
+			brickLayerPatch(&s->brickLayer, &scene->bricks, s->levelWatch->changed, s->levelWatch->before, s->reloaded, s->dirtyMode ? &s->dirty : NULL);
+		brickLayerUpdate(&s->brickLayer, &scene->bricks, s->dirtyMode ? &s->dirty : NULL);
+	}
+
+	// Menus are static, so frames are only drawn when input arrives. A replay has no input
+	// to wake it up, and the profiler graph, thumbnails and clips want every frame, so they keep running at full rate.
+	bool idle = scene->state != STATE_PLAYING && !s->replayPath && !profiler->visible && s->thumbnailInterval <= 0.0f && !IsVideoRecording() && !rewinding && !s->threaded && !s->scenario;
+	if (idle != s->idling) {
+		if (idle)
+			EnableEventWaiting();
+		else
+			DisableEventWaiting();
+		s->idling = idle;
+	}
+
+	// A hashed frame shows a steady frame rate, the real one would differ between otherwise equal frames
+	int fps = s->frameHashInterval > 0 ? TICK_RATE : GetFPS();
+	const BallTrails *trails = s->trailsOn ? &s->trails : NULL;
 
-		BeginDrawing();
+	BeginDrawing();
+	TRACE_BEGIN("draw");
+	profilerBegin(profiler, PROFILE_DRAW);
+	if (s->scaled)
+		viewportBegin(&s->viewport);
 
+	if (s->software) {
+		softRenderFrame(&s->soft, scene, &s->particles, trails, &s->hud, fps, alpha, paddle);
+		softRenderDraw(&s->soft);
+	} else if (s->dirtyMode) {
+		drawRetained(&s->retained, &s->dirty, scene, &s->brickLayer, &s->particles, trails, &s->hud, fps, alpha, paddle);
+	} else {
 		ClearBackground(BLACK);
+		drawScene(scene, &s->brickLayer, &s->particles, trails, &s->hud, fps, alpha, paddle);
+	}
 
-		if (state == 0) {
+	if (s->scaled)
+		viewportEnd(&s->viewport);
+	profilerEnd(profiler, PROFILE_DRAW);
+	// Drawn at window resolution so it stays readable over a low internal resolution
+	profilerDraw(profiler);
+	TRACE_END();
 
-			DrawText("Attack Breaker ", 150, 10, 64, YELLOW);
+	if (s->frameHashInterval > 0 && s->frameNumber % s->frameHashInterval == 0)
+		printf("frame %d hash %08x\n", s->frameNumber, hashScreen());
+	s->frameNumber++;
 
-			if (hoveringPlayButton)
-				DrawRectangle(330, 190, 165, 60, DARKGRAY);
-			else
-				DrawRectangle(330, 190, 165, 60, GRAY);
-			DrawText("Play", 370, 200, 40, WHITE);
+	EndDrawing();
+	profilerFrame(profiler);
+	heapGuardFrame(&s->heapGuard);
+	// Menus wait for events, their frame times say nothing about what play costs
+	if (scene->state == STATE_PLAYING && !s->idling && qualityFrame(&s->quality, profiler))
+		applyQuality(s);
 
-		} else if (state == 1) {
-			DrawRectangle(paddle.x, paddle.y, paddle.width, paddle.height, GRAY);
+	TelemetryFrame telemetryFrame = { 0, GetFrameTime(), ticksRun, profiler->drawCalls, profiler->vertices,
+		profiler->audio.callbackLast, profiler->audio.activeVoices, GetPresentMode(), GetFrameLatencyLimit(),
+		(float)GetFrameTimings().latencyWait, s->quality.level };
+	telemetryRecord(&s->telemetry, &telemetryFrame);
+	TRACE_END();
 
-			for (int i = 0; i < 256; i++) {
-				if (!blocks[i].broken) {
-					DrawRectangle(blocks[i].rect.x, blocks[i].rect.y, blocks[i].rect.width, blocks[i].rect.height, blocks[i].colour);
-				}
+	if (s->startupTrace) {
+		TraceStartupPhase("first interactive frame");
+		printStartupTrace();
+		s->startupTrace = false;
+		if (s->startupExit)
+			return false;
+	}
+
+	// A replay that runs out ends the run early, its later frames would be the paddle standing still
+	return !(s->scenario && (benchRecord(&s->benchRun, profiler, s->benchFrame++) || (s->replayPath && s->tick >= s->replay->tickCount)));
+}
+
+static void endPlay(Session *s) {
+	telemetryClose(&s->telemetry);
+	if (s->gamepadIndex >= 0)
+		gamepadClose(&s->gamepad);
+	if (s->profilePath)
+		persistClose(&s->persist);
+	if (s->threaded)
+		simThreadStop(&s->sim);
+	if (s->game.fieldRows)
+		fieldRowsStop(&s->fieldRows);
+	if (IsMusicReady(s->music))
+		UnloadMusicStream(s->music);
+	if (s->dirtyMode)
+		UnloadRenderTexture(s->retained);
+	if (s->software)
+		softRenderUnload(&s->soft);
+	if (s->scaled)
+		viewportUnload(&s->viewport);
+	brickLayerUnload(&s->brickLayer);
+	hudUnload(&s->hud);
+	atlasUnload(&s->atlas);
+}
+
+#if defined(__EMSCRIPTEN__)
+// The browser calls this once per display refresh. There is no end to the run, closing the page ends it
+static void webFrame(void *context) {
+	Session *s = context;
+	if (s->playing)
+		playFrame(s);
+	else if (loadingFrame(s))
+		beginPlay(s);
+}
+#endif
+
+int main(int argc, char **argv)
+{
+	TraceStartupPhase("launch");
+
+	bool headless = false;
+	long ticks = -1;
+	const char *recordPath = NULL;
+	const char *replayPath = NULL;
+	const char *levelPath = NULL;
+	bool dirtyMode = false;
+	bool lateLatch = false;
+	bool fixedPhysics = false;
+	bool threaded = false;
+	bool attack = false;
+	bool compactBatch = false;
+	bool sortDraws = false;
+	bool startupTrace = false;
+	bool startupExit = false;
+	bool offscreen = false;
+	int frameHashInterval = 0;
+	bool shaderCache = true;
+	bool sdfText = false;
+	bool memoryReport = false;
+	const char *telemetryPath = NULL;
+	const char *tracePath = NULL;
+	const char *benchName = NULL;
+	float budgetMs = 0.0f;
+	int netPlayer = -1, netPort = 0;
+	const char *netPeer = NULL;
+	const char *streamPeer = NULL;
+	int windowW = SCREEN_WIDTH, windowH = SCREEN_HEIGHT;
+	int renderW = 0, renderH = 0;
+	int renderFilter = TEXTURE_FILTER_POINT;
+	// -1 leaves the level to the governor, anything else pins it
+	int qualityLevel = -1;
+	float thumbnailInterval = 0.0f;
+	int presentMode = -1;
+	int frameLatency = -1;
+	int powerFps = 0;
+	bool attract = false;
+	bool software = false;
+	bool watchLevel = false;
+	const char *profilePath = PROFILE_FILE;
+	int gamepadIndex = -1;
+	int simCore = -1, renderCore = -1;
+	int audioPriority = PRIORITY_NORMAL;
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--headless") == 0) {
+			headless = true;
+		} else if (strcmp(argv[i], "--ticks") == 0 && i+1 < argc) {
+			ticks = atol(argv[++i]);
+		} else if (strcmp(argv[i], "--record") == 0 && i+1 < argc) {
+			recordPath = argv[++i];
+		} else if (strcmp(argv[i], "--replay") == 0 && i+1 < argc) {
+			replayPath = argv[++i];
+		} else if (strcmp(argv[i], "--level") == 0 && i+1 < argc) {
+			levelPath = argv[++i];
+		} else if (strcmp(argv[i], "--gamepad") == 0 && i+1 < argc) {
+			gamepadIndex = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--profile") == 0 && i+1 < argc) {
+			profilePath = argv[++i];
+		} else if (strcmp(argv[i], "--watch-level") == 0) {
+			watchLevel = true;
+		} else if (strcmp(argv[i], "--dirty-rects") == 0) {
+			dirtyMode = true;
+		} else if (strcmp(argv[i], "--late-latch") == 0) {
+			lateLatch = true;
+		} else if (strcmp(argv[i], "--fixed-physics") == 0) {
+			fixedPhysics = true;
+		} else if (strcmp(argv[i], "--attack") == 0) {
+			attack = true;
+		} else if (strcmp(argv[i], "--threaded") == 0) {
+			threaded = true;
+		} else if (strcmp(argv[i], "--compact-batch") == 0) {
+			compactBatch = true;
+		} else if (strcmp(argv[i], "--sort-draws") == 0) {
+			sortDraws = true;
+		} else if (strcmp(argv[i], "--startup-trace") == 0) {
+			startupTrace = true;
+		} else if (strcmp(argv[i], "--startup-exit") == 0) {
+			startupTrace = true;
+			startupExit = true;
+		} else if (strcmp(argv[i], "--offscreen") == 0) {
+			offscreen = true;
+		} else if (strcmp(argv[i], "--frame-hash") == 0 && i+1 < argc) {
+			frameHashInterval = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--no-shader-cache") == 0) {
+			shaderCache = false;
+		} else if (strcmp(argv[i], "--sdf-text") == 0) {
+			sdfText = true;
+		} else if (strcmp(argv[i], "--memory-report") == 0) {
+			memoryReport = true;
+		} else if (strcmp(argv[i], "--telemetry") == 0 && i+1 < argc) {
+			telemetryPath = argv[++i];
+		} else if (strcmp(argv[i], "--trace") == 0 && i+1 < argc) {
+			tracePath = argv[++i];
+		} else if (strcmp(argv[i], "--bench") == 0 && i+1 < argc) {
+			benchName = argv[++i];
+		} else if (strcmp(argv[i], "--budget") == 0 && i+1 < argc) {
+			budgetMs = atof(argv[++i]);
+		} else if (strcmp(argv[i], "--netplay") == 0 && i+3 < argc) {
+			netPlayer = atoi(argv[++i]);
+			netPort = atoi(argv[++i]);
+			netPeer = argv[++i];
+		} else if (strcmp(argv[i], "--stream") == 0 && i+1 < argc) {
+			streamPeer = argv[++i];
+		} else if (strcmp(argv[i], "--window") == 0 && i+1 < argc) {
+			sscanf(argv[++i], "%dx%d", &windowW, &windowH);
+		} else if (strcmp(argv[i], "--resolution") == 0 && i+1 < argc) {
+			sscanf(argv[++i], "%dx%d", &renderW, &renderH);
+		} else if (strcmp(argv[i], "--thumbnails") == 0 && i+1 < argc) {
+			thumbnailInterval = atof(argv[++i]);
+		} else if (strcmp(argv[i], "--filter") == 0 && i+1 < argc) {
+			renderFilter = strcmp(argv[++i], "linear") == 0 ? TEXTURE_FILTER_BILINEAR : TEXTURE_FILTER_POINT;
+		} else if (strcmp(argv[i], "--present") == 0 && i+1 < argc) {
+			i++;
+			for (int m = 0; m < PRESENT_MODE_COUNT; m++) {
+				if (strcmp(argv[i], presentModeNames[m]) == 0)
+					presentMode = m;
+			}
+			if (presentMode < 0) {
+				fprintf(stderr, "unknown present mode %s, expected immediate, vsync, adaptive or vrr\n", argv[i]);
+				return 1;
+			}
+		} else if (strcmp(argv[i], "--quality") == 0 && i+1 < argc) {
+			i++;
+			qualityLevel = strcmp(argv[i], "auto") == 0 ? -1 : atoi(argv[i]);
+			if (qualityLevel < -1 || qualityLevel >= QUALITY_LEVELS || (qualityLevel == 0 && strcmp(argv[i], "0") != 0)) {
+				fprintf(stderr, "unknown quality %s, expected auto or 0 to %d\n", argv[i], QUALITY_LEVELS - 1);
+				return 1;
 			}
+		} else if (strcmp(argv[i], "--frame-latency") == 0 && i+1 < argc) {
+			frameLatency = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--power-save") == 0) {
+			if (powerFps == 0)
+				powerFps = 60;
+		} else if (strcmp(argv[i], "--attract") == 0) {
+			attract = true;
+		} else if (strcmp(argv[i], "--battery") == 0) {
+			powerFps = POWER_BATTERY_FPS;
+		} else if (strcmp(argv[i], "--software") == 0) {
+			software = true;
+		} else if (strcmp(argv[i], "--sim-core") == 0 && i+1 < argc) {
+			simCore = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--render-core") == 0 && i+1 < argc) {
+			renderCore = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--audio-priority") == 0 && i+1 < argc) {
+			i++;
+			int found = -1;
+			for (int p = 0; p < PRIORITY_COUNT; p++) {
+				if (strcmp(argv[i], priorityNames[p]) == 0)
+					found = p;
+			}
+			audioPriority = PRIORITY_LOW + found;
+			if (found < 0) {
+				fprintf(stderr, "unknown priority %s, expected low, normal, high or realtime\n", argv[i]);
+				return 1;
+			}
+		}
+	}
+
+#if defined(__EMSCRIPTEN__)
+	if (netPeer || streamPeer) {
+		fprintf(stderr, "--netplay and --stream need UDP sockets, which a browser doesn't have\n");
+		return 1;
+	}
+	// The browser throttles frames of a hidden page itself
+	powerFps = 0;
+#endif
 
-			DrawCircle(ball.x+(ball.width/2), ball.y+(ball.height/2), ball.width/2, GRAY);
+	// Versus over the network needs both sides to compute the same bits, and frontend modes that
+	// only know one paddle or rewrite ticks stay off
+	bool netplay = netPeer != NULL;
+	if (netplay) {
+		if (headless || recordPath || replayPath || attack || attract) {
+			fprintf(stderr, "--netplay can't be combined with --headless, --record, --replay, --attack or --attract\n");
+			return 1;
+		}
+		fixedPhysics = true;
+		dirtyMode = false;
+		lateLatch = false;
+		threaded = false;
+		powerFps = 0;
+	}
+	// The autoplayer reads the game it steers between ticks, so the ticks stay on this thread
+	if (attract)
+		threaded = false;
+
+	// A scenario sets up the level and the game, other options still apply. The frames are measured,
+	// so nothing that changes what a frame does from run to run
+	const BenchScenario *scenario = NULL;
+	if (benchName) {
+		scenario = benchScenario(benchName);
+		if (!scenario) {
+			fprintf(stderr, "unknown bench scenario %s\n", benchName);
+			benchListScenarios();
+			return 1;
+		}
+		if (netplay || headless || recordPath) {
+			fprintf(stderr, "--bench can't be combined with --netplay, --headless or --record\n");
+			return 1;
+		}
+		if (!levelPath)
+			levelPath = scenario->level;
+		attack = scenario->attack;
+		threaded = false;
+		thumbnailInterval = 0.0f;
+		powerFps = 0;
+	}
+
+	// The game is drawn at an internal resolution and scaled to the window, always in virtual coordinates
+	bool scaled = renderW > 0 && renderH > 0;
+	if (scaled && dirtyMode) {
+		fprintf(stderr, "--dirty-rects has no effect with --resolution\n");
+		dirtyMode = false;
+	}
+	// The CPU frame is always drawn whole, it only uploads the rows that changed
+	if (software && dirtyMode) {
+		fprintf(stderr, "--dirty-rects has no effect with --software\n");
+		dirtyMode = false;
+	}
+	// Spectators only get which bricks are live, not the new rows the attack field spawns
+	if (streamPeer && attack) {
+		fprintf(stderr, "--stream has no effect with --attack\n");
+		streamPeer = NULL;
+	}
+
+	Replay replay;
+	replayInit(&replay, scenario ? BENCH_SEED : time(NULL));
+	if (replayPath && !replayLoad(&replay, replayPath)) {
+		fprintf(stderr, "could not load replay %s\n", replayPath);
+		return 1;
+	}
+
+	static AssetPack pack;
+	if (!packOpenMemory(&pack, asset_pack, asset_pack_size)) {
+		fprintf(stderr, "asset pack is corrupt\n");
+		return 1;
+	}
+
+	// Levels built into the pack are found by name, anything else is a path
+	static Level levelData;
+	const Level *level = NULL;
+	if (levelPath && attack) {
+		fprintf(stderr, "--level has no effect with --attack\n");
+		levelPath = NULL;
+	}
+	// Only for a level played live, anything that replays or shares the run needs it to stay put
+	if (watchLevel && (!levelPath || headless || threaded || netplay || recordPath || replayPath || scenario || attract || streamPeer)) {
+		fprintf(stderr, "--watch-level needs --level and has no effect with --headless, --threaded, --netplay, --record, --replay, --bench, --attract or --stream\n");
+		watchLevel = false;
+	}
+	if (gamepadIndex >= 0 && headless) {
+		fprintf(stderr, "--gamepad has no effect with --headless\n");
+		gamepadIndex = -1;
+	}
+	static LevelWatch levelWatch;
+	if (watchLevel) {
+		if (!levelWatchOpen(&levelWatch, levelPath)) {
+			fprintf(stderr, "could not load level file %s\n", levelPath);
+			return 1;
+		}
+		level = &levelWatch.level;
+	} else if (levelPath) {
+		if (!packLevel(&pack, levelPath, &levelData) && !levelLoad(&levelData, levelPath)) {
+			fprintf(stderr, "could not load level %s\n", levelPath);
+			return 1;
+		}
+		level = &levelData;
+	}
+
+	// Ball moves are merged in a fixed order, so the worker count never changes the result
+	static JobPool jobs;
+	jobsInit(&jobs, jobsDefaultWorkers());
+
+	if (headless) {
+		int result;
+		if (replayPath) {
+			if (ticks < 0 || ticks > replay.tickCount)
+				ticks = replay.tickCount;
+			result = runHeadless(ticks, &replay, replay.seed, fixedPhysics, attack, level, &jobs);
+		} else {
+			result = runHeadless(ticks < 0 ? 60*TICK_RATE : ticks, NULL, replay.seed, fixedPhysics, attack, level, &jobs);
+		}
+		jobsShutdown(&jobs);
+		if (level)
+			levelUnload(&levelData);
+		packClose(&pack);
+		if (memoryReport)
+			heapPrintReport();
+		return result;
+	}
+
+	static Session session;
+	Session *s = &session;
+	// Too big for the stack, so no compound literal
+	s->scenario = scenario;
+	s->recordPath = recordPath;
+	s->replayPath = replayPath;
+	s->telemetryPath = telemetryPath;
+	s->dirtyMode = dirtyMode;
+	s->software = software;
+	s->lateLatch = lateLatch;
+	s->threaded = threaded;
+	s->netplay = netplay;
+	s->scaled = scaled;
+	s->startupTrace = startupTrace;
+	s->startupExit = startupExit;
+	s->frameHashInterval = frameHashInterval;
+	s->thumbnailInterval = thumbnailInterval;
+	s->powerFps = powerFps;
+	s->renderW = scaled ? renderW : 0;
+	s->renderH = scaled ? renderH : 0;
+	s->renderFilter = renderFilter;
+	// Measured and hashed runs have to draw the same every time, they stay at full quality unless pinned
+	qualityInit(&s->quality, qualityLevel < 0 ? 0 : qualityLevel, 1.0f/TICK_RATE, qualityLevel < 0 && !scenario && frameHashInterval == 0);
+	s->simCore = simCore;
+	s->renderCore = renderCore;
+	s->audioPriority = audioPriority;
+	s->replay = &replay;
+	s->pack = &pack;
+	s->level = level;
+	s->levelWatch = watchLevel ? &levelWatch : NULL;
+	s->gamepadIndex = gamepadIndex;
+	// Settings picked in an earlier run apply unless given here
+	s->profilePath = scenario || replayPath || netplay || attract ? NULL : profilePath;
+	profileInit(&s->profile);
+	if (s->profilePath) {
+		profileLoad(&s->profile, s->profilePath);
+		if (presentMode < 0)
+			presentMode = s->profile.presentMode;
+		if (frameLatency < 0)
+			frameLatency = s->profile.frameLatency;
+	}
+	s->brickLayer.ring = attack;
 
-			DrawText("Bricks left: ", 10, 10, 20, WHITE);
-			char str[6];
-			sprintf(str, "%d", blockCount);
-			DrawText(str, 135, 10, 20, YELLOW);
+	// Started before the window so audio init overlaps it. The window is then drawn and responsive
+	// while the rest loads: CPU and audio work happens on the loader thread, GL uploads in slices of
+	// each frame. GL items go first, so they aren't finished behind a slow audio device. Without
+	// threads, in the browser, the CPU work is sliced into the frames too
+	static SoundLoad clickLoad, hitLoad;
+	clickLoad = (SoundLoad){ .pack = &pack, .name = "snd_click", .sound = &s->clickSnd };
+	hitLoad = (SoundLoad){ .pack = &pack, .name = "snd_hit", .sound = &s->hitSnd };
+
+	static UiLoad uiLoad;
+	uiLoad = (UiLoad){ &s->atlas, &s->hud, sdfText };
+
+	static Loader loader;
+	s->loader = &loader;
+	loaderInit(&loader);
+	loaderAdd(&loader, NULL, finishAtlas, &uiLoad);
+	loaderAdd(&loader, NULL, finishBrickLayer, &s->brickLayer);
+	loaderAdd(&loader, NULL, finishHud, &uiLoad);
+	loaderAdd(&loader, prepareAudio, NULL, &s->audioPriority);
+	loaderAdd(&loader, prepareSound, finishSound, &clickLoad);
+	loaderAdd(&loader, prepareSound, finishSound, &hitLoad);
+
+	// raylib's log is written on its own thread, so the loader, the audio callback and the frame
+	// never wait on the terminal
+	SetTraceLogAsync(true);
+
+	// Phases are always marked, --startup-trace only prints them
+	TraceStartupPhase("setup");
+	loaderStart(&loader);
+	if (scaled)
+		SetConfigFlags(FLAG_WINDOW_RESIZABLE);
+	// No display needed, the frames go to a pbuffer. Together with --bench the frames are the same
+	// on every run, so --frame-hash gives golden images for CI
+	if (offscreen)
+		SetConfigFlags(FLAG_WINDOW_OFFSCREEN);
+	if (shaderCache)
+		setShaderCache();
+	InitWindow(windowW, windowH, "attack breaker clone thingamajig");
+#if defined(__EMSCRIPTEN__)
+	// The browser paces the frames to the display, a frame that waited on top would block the page
+	SetTargetFPS(0);
+#else
+	// Benchmarks run unthrottled, vsync is only on with FLAG_VSYNC_HINT
+	SetTargetFPS(scenario ? 0 : 60);
+#endif
+	// Unsupported modes fall back with a warning, telemetry records the one in effect
+	if (presentMode >= 0)
+		SetPresentMode(presentMode);
+	if (frameLatency >= 0)
+		SetFrameLatencyLimit(frameLatency);
+
+	// Everything drawn is 2D, half the vertex upload of the default batch
+	static rlRenderBatch batch;
+	if (compactBatch) {
+		batch = rlLoadRenderBatchCompact(COMPACT_BATCH_BUFFERS, COMPACT_BATCH_ELEMENTS);
+		rlSetRenderBatchGrowth(&batch, COMPACT_BATCH_MAX_ELEMENTS);
+		rlSetRenderBatchActive(&batch);
+	}
+	// Draws are grouped by texture within the layers set while drawing, layer 0 unless set
+	if (sortDraws)
+		rlEnableDrawSorting();
+
+	if (scaled && !viewportLoad(&s->viewport, renderW, renderH, renderFilter)) {
+		fprintf(stderr, "could not create a %dx%d render target\n", renderW, renderH);
+		s->scaled = false;
+	}
+
+	// Everything random in the simulation derives from the replay seed
+	Game *game = &s->game;
+	game->fixedPhysics = fixedPhysics;
+	game->versus = netplay;
+	game->attack = attack;
+	unsigned int seed = replay.seed;
+
+	// Both sides start from player 0's seed, which arrives with the first packet
+	if (netplay) {
+		if (!netplayOpen(&s->net, netPlayer, netPort, netPeer, seed)) {
+			fprintf(stderr, "could not open netplay port %d to %s\n", netPort, netPeer);
+			loaderShutdown(&loader);
+			CloseWindow();
+			return 1;
+		}
+		while (!WindowShouldClose() && !netplayPoll(&s->net, game)) {
+			BeginDrawing();
+			ClearBackground(BLACK);
+			DrawText("waiting for the other player", 230, 200, 30, WHITE);
+			EndDrawing();
 		}
+		seed = s->net.seed;
+	}
+
+	gameSeed(game, seed);
+
+	// Attack rows are generated ahead on their own thread, the game makes any it finds missing
+	if (attack && fieldRowsStart(&s->fieldRows, game->fieldSeed))
+		game->fieldRows = &s->fieldRows;
 
-		EndDrawing();
+	// A benchmark timing balls that pass through left-out bricks measures a broken game
+	if (!startGame(game, level) && scenario) {
+		fprintf(stderr, "the %s scenario's level has bricks the grid can't hold\n", scenario->name);
+		loaderShutdown(&loader);
+		CloseWindow();
+		return 1;
 	}
+	game->jobs = &jobs;
+	if (netplay)
+		game->state = STATE_PLAYING;
 
+	// Without a replay the autopilot plays, from the first tick and again after every clear or miss
+	s->autopilot = (scenario || attract) && !replayPath;
+	autoplayInit(&s->autoplayer, seed);
+	SetRandomStreamSeed(&s->soundRandom, seed, RANDOM_SOUND);
+	s->particlesOn = !scenario || scenario->particles;
+	s->trailsOn = !scenario || scenario->trails;
+	if (scenario)
+		gameAddBalls(game, scenario->balls);
+	if (s->autopilot)
+		game->state = STATE_PLAYING;
+	s->benchRun.scenario = scenario;
+
+	// Spectators follow along from any point, the keyframes let them join mid-game
+	s->streaming = streamPeer && spectateOpen(&s->spectate, streamPeer);
+	if (streamPeer && !s->streaming)
+		fprintf(stderr, "could not open a spectator stream to %s\n", streamPeer);
+
+	rewindClear(&s->history);
+	particlesClear(&s->particles);
+	trailsClear(&s->trails);
+
+#if defined(__EMSCRIPTEN__)
+	// Never returns, the page's frames run the loading screen and then the game
+	emscripten_set_main_loop_arg(webFrame, s, 0, 1);
+#endif
+
+	while (!WindowShouldClose() && !loadingFrame(s)) {
+	}
+	beginPlay(s);
+
+	while (!WindowShouldClose() && playFrame(s)) {
+	}
+
+	endPlay(s);
+	if (tracePath)
+		ExportTraceZones(tracePath);
+	if (compactBatch) {
+		rlSetRenderBatchActive(NULL);
+		rlUnloadRenderBatch(batch);
+	}
 	CloseWindow();
+	jobsShutdown(&jobs);
+	if (netplay) {
+		printf("netplay: %d ticks, %d rollbacks, %d ticks re-simulated\n", s->net.tick, s->net.rollbacks, s->net.resimulatedTicks);
+		netplayClose(&s->net);
+	}
+	if (s->streaming) {
+		spectateClose(&s->spectate);
+		printf("spectate: %ld bytes in %d packets\n", s->spectate.bytesSent, s->spectate.packetsSent);
+	}
+	if (watchLevel)
+		levelWatchClose(&levelWatch);
+	else if (level)
+		levelUnload(&levelData);
+	packClose(&pack);
+
+	if (recordPath && !replaySave(&replay, recordPath)) {
+		fprintf(stderr, "could not save replay %s\n", recordPath);
+	}
+	replayFree(&replay);
+	if (memoryReport)
+		heapPrintReport();
 
+	if (scenario && !benchReport(&s->benchRun, budgetMs))
+		return 1;
 	return 0;
 }
@@ -0,0 +1,14 @@
+#include "mapfile.h"
+
+bool mapFile(MappedFile *file, const char *fileName) {
+	file->view = LoadFileView(fileName);
+	file->data = file->view.data;
+	file->size = file->view.size;
+
+	return file->data != NULL;
+}
+
+void unmapFile(MappedFile *file) {
+	UnloadFileView(file->view);
+	*file = (MappedFile){ 0 };
+}
@@ -0,0 +1,19 @@
+#ifndef _mapfile_h_
+#define _mapfile_h_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "raylib.h"
+
+// Read-only view of a whole file. Memory-mapped where the platform has it, read into memory otherwise
+typedef struct MappedFile {
+	const void *data;
+	size_t size;
+	FileView view;
+} MappedFile;
+
+bool mapFile(MappedFile *file, const char *fileName);
+void unmapFile(MappedFile *file);
+
+#endif //_mapfile_h_
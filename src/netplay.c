@@ -0,0 +1,172 @@
+#include "netplay.h"
+
+#include <string.h>
+
+#define NETPLAY_MAGIC "ABNP"
+#define NETPLAY_HEADER_SIZE 17
+#define NETPLAY_INPUT_SIZE 3
+
+static void putU32(unsigned char *p, unsigned int v) {
+	p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+
+static unsigned int getU32(const unsigned char *p) {
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+static NetInput quantize(GameInput input) {
+	float x = input.mouse.x*4;
+	if (x < -32768) x = -32768;
+	if (x > 32767) x = 32767;
+	return (NetInput){ (short)x, input.mouseDown ? 1 : 0 };
+}
+
+static GameInput expand(NetInput input) {
+	return (GameInput){ { input.x/4.0f, 0 }, (input.buttons & 1) != 0 };
+}
+
+static bool sameInput(NetInput a, NetInput b) {
+	return a.x == b.x && a.buttons == b.buttons;
+}
+
+// Remote input for a tick, the real one if it has arrived, otherwise the last one repeated
+static NetInput remoteInput(const Netplay *net, int tick) {
+	int remote = 1 - net->player;
+	if (tick < net->remoteTick)
+		return net->inputs[remote][tick % NETPLAY_INPUT_RING];
+	if (net->remoteTick > 0)
+		return net->inputs[remote][(net->remoteTick-1) % NETPLAY_INPUT_RING];
+	return (NetInput){ 0 };
+}
+
+// Runs one tick from the inputs on record, snapshotting first on the ring's interval unless the
+// game was just restored from that snapshot
+static void simulate(Netplay *net, Game *game, int tick, bool snapshot, GameEvents *events) {
+	if (snapshot && tick % REWIND_INTERVAL == 0)
+		rewindPush(&net->history, game, tick);
+
+	NetInput remote = remoteInput(net, tick);
+	net->predicted[tick % NETPLAY_INPUT_RING] = remote;
+
+	GameInput inputs[2];
+	inputs[net->player] = expand(net->inputs[net->player][tick % NETPLAY_INPUT_RING]);
+	inputs[1 - net->player] = expand(remote);
+	gameTickPlayers(game, inputs, events);
+}
+
+static void sendInputs(Netplay *net) {
+	unsigned char packet[NETPLAY_HEADER_SIZE + NETPLAY_MAX_SEND*NETPLAY_INPUT_SIZE];
+	int start = net->remoteAcked;
+	int count = net->tick - start;
+	if (count > NETPLAY_MAX_SEND)
+		count = NETPLAY_MAX_SEND;
+
+	memcpy(packet, NETPLAY_MAGIC, 4);
+	putU32(packet+4, net->seed);
+	putU32(packet+8, net->remoteTick);
+	putU32(packet+12, start);
+	packet[16] = count;
+
+	unsigned char *p = packet + NETPLAY_HEADER_SIZE;
+	for (int i = 0; i < count; i++, p += NETPLAY_INPUT_SIZE) {
+		NetInput input = net->inputs[net->player][(start + i) % NETPLAY_INPUT_RING];
+		p[0] = (unsigned short)input.x;
+		p[1] = (unsigned short)input.x >> 8;
+		p[2] = input.buttons;
+	}
+
+	udpSend(&net->udp, packet, NETPLAY_HEADER_SIZE + count*NETPLAY_INPUT_SIZE);
+}
+
+static void receive(Netplay *net, const unsigned char *packet, int size) {
+	if (size < NETPLAY_HEADER_SIZE || memcmp(packet, NETPLAY_MAGIC, 4) != 0)
+		return;
+	int count = packet[16];
+	if (size < NETPLAY_HEADER_SIZE + count*NETPLAY_INPUT_SIZE)
+		return;
+
+	if (!net->connected) {
+		net->connected = true;
+		if (net->player == 1)
+			net->seed = getU32(packet+4);
+	}
+
+	int acked = getU32(packet+8);
+	if (acked > net->remoteAcked && acked <= net->tick)
+		net->remoteAcked = acked;
+
+	// Inputs start at the first one the sender hasn't seen acknowledged, so only the ones after
+	// remoteTick are new. Anything past a gap waits for a packet that fills it
+	int remote = 1 - net->player;
+	int start = getU32(packet+12);
+	const unsigned char *p = packet + NETPLAY_HEADER_SIZE;
+	for (int i = 0; i < count; i++, p += NETPLAY_INPUT_SIZE) {
+		int tick = start + i;
+		if (tick != net->remoteTick)
+			continue;
+
+		NetInput input = { (short)(p[0] | (p[1] << 8)), p[2] };
+		net->inputs[remote][tick % NETPLAY_INPUT_RING] = input;
+		net->remoteTick++;
+
+		if (tick < net->tick && !sameInput(input, net->predicted[tick % NETPLAY_INPUT_RING]) &&
+			(net->rollbackFrom < 0 || tick < net->rollbackFrom))
+			net->rollbackFrom = tick;
+	}
+}
+
+bool netplayOpen(Netplay *net, int player, int port, const char *address, unsigned int seed) {
+	memset(net, 0, sizeof(*net));
+	net->player = player ? 1 : 0;
+	net->seed = seed;
+	net->rollbackFrom = -1;
+	rewindClear(&net->history);
+
+	return udpOpen(&net->udp, port, address);
+}
+
+void netplayClose(Netplay *net) {
+	udpClose(&net->udp);
+	net->connected = false;
+}
+
+bool netplayPoll(Netplay *net, Game *game) {
+	unsigned char packet[NETPLAY_HEADER_SIZE + 255*NETPLAY_INPUT_SIZE];
+	int size;
+	while ((size = udpReceive(&net->udp, packet, sizeof(packet))) >= 0) {
+		receive(net, packet, size);
+	}
+
+	// Until connected this is the hello, after that it resends whatever is unacknowledged in case
+	// this frame stalls and sends nothing else
+	sendInputs(net);
+
+	if (net->rollbackFrom >= 0) {
+		int from;
+		if (rewindSeek(&net->history, game, net->rollbackFrom, &from)) {
+			// Sound and effects already went out for these ticks, the re-run ones are dropped
+			GameEvents events = { 0 };
+			for (int tick = from; tick < net->tick; tick++) {
+				simulate(net, game, tick, tick != from, &events);
+			}
+			net->rollbacks++;
+			net->resimulatedTicks += net->tick - from;
+		}
+		net->rollbackFrom = -1;
+	}
+
+	return net->connected;
+}
+
+bool netplayTick(Netplay *net, Game *game, GameInput local, GameEvents *events) {
+	if (!net->connected || net->tick - net->remoteTick >= NETPLAY_MAX_ROLLBACK ||
+		net->tick - net->remoteAcked >= NETPLAY_INPUT_RING-1)
+		return false;
+
+	net->inputs[net->player][net->tick % NETPLAY_INPUT_RING] = quantize(local);
+	simulate(net, game, net->tick, true, events);
+	net->tick++;
+
+	sendInputs(net);
+	return true;
+}
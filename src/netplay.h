@@ -0,0 +1,62 @@
+#ifndef _netplay_h_
+#define _netplay_h_
+
+#include "game.h"
+#include "rewind.h"
+#include "udp.h"
+
+// Ticks the local side may run past the last input it has from the remote side. Further ahead
+// the frame stalls, so a rollback never re-simulates more than this plus a snapshot interval
+#define NETPLAY_MAX_ROLLBACK 8
+// Inputs kept per player, a power of two above every unacknowledged span
+#define NETPLAY_INPUT_RING 64
+// Unacknowledged inputs resent in every packet, so a lost packet is covered by the next one
+#define NETPLAY_MAX_SEND 32
+
+// Paddle input as sent, quarter pixels. Both sides simulate with the quantized value
+typedef struct NetInput {
+	short x;
+	unsigned char buttons;
+} NetInput;
+
+// Two-player versus over UDP with rollback. Only the input for each tick crosses the network:
+// the remote input is predicted to repeat, and when the real one differs the game is restored
+// from the snapshot ring and re-simulated up to the present
+typedef struct Netplay {
+	UdpSocket udp;
+
+	int player;
+	unsigned int seed;
+	bool connected;
+
+	int tick;
+	// Remote inputs are known for ticks before remoteTick, the remote side has ours before remoteAcked
+	int remoteTick;
+	int remoteAcked;
+	// Earliest tick simulated with a prediction that turned out wrong, -1 for none
+	int rollbackFrom;
+
+	NetInput inputs[2][NETPLAY_INPUT_RING];
+	// Remote input each tick was last simulated with
+	NetInput predicted[NETPLAY_INPUT_RING];
+
+	RewindBuffer history;
+
+	int rollbacks;
+	int resimulatedTicks;
+} Netplay;
+
+// player is 0 or 1, the seed is player 0's and reaches player 1 with the first packet.
+// address is host:port of the other side
+bool netplayOpen(Netplay *net, int player, int port, const char *address, unsigned int seed);
+void netplayClose(Netplay *net);
+
+// Reads every waiting packet, then rolls back and re-simulates if a prediction was wrong.
+// Until connected it only says hello, the game starts once this returns true
+bool netplayPoll(Netplay *net, Game *game);
+
+// Runs the next tick with the local input and sends it. False without ticking when the remote
+// side is too far behind, the caller tries again next frame
+bool netplayTick(Netplay *net, Game *game, GameInput local, GameEvents *events);
+
+#endif //_netplay_h_
@@ -0,0 +1,190 @@
+#include "pack.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lz.h"
+
+// The mipmaps have to be the sizes the upload reads
+static bool validTexture(const PackTexture *info, uint32_t size) {
+	if (size < sizeof(PackTexture) || info->format < PIXELFORMAT_COMPRESSED_DXT1_RGB
+		|| info->format > PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA || info->width == 0 || info->height == 0
+		|| info->width > PACK_TEXTURE_MAX_SIZE || info->height > PACK_TEXTURE_MAX_SIZE || info->mipmaps == 0 || info->mipmaps > 16)
+		return false;
+
+	size_t expected = sizeof(PackTexture);
+	int width = info->width, height = info->height;
+	for (uint32_t i = 0; i < info->mipmaps; i++) {
+		expected += GetPixelDataSize(width, height, info->format);
+		width = width > 1 ? width/2 : 1;
+		height = height > 1 ? height/2 : 1;
+	}
+	return expected <= size;
+}
+
+bool packOpenMemory(AssetPack *pack, const void *data, size_t size) {
+	memset(pack, 0, sizeof(*pack));
+
+	const PackHeader *header = data;
+	if (size < sizeof(PackHeader)
+		|| memcmp(header->magic, PACK_MAGIC, 4) != 0
+		|| header->version != PACK_VERSION
+		|| header->byteOrder != PACK_BYTE_ORDER
+		|| size < sizeof(PackHeader) + (size_t)header->entryCount*sizeof(PackEntry)
+		|| size < (size_t)header->compressedOffset + header->compressedSize)
+		return false;
+
+	pack->data = data;
+	pack->size = size;
+	pack->entries = (const PackEntry *)(header + 1);
+	pack->entryCount = header->entryCount;
+
+	if (header->compressedSize) {
+		pack->unpacked = MemAllocTagged(header->unpackedSize, MEMORY_TAG_GAME);
+		if (!pack->unpacked
+			|| lzDecompress(pack->data + header->compressedOffset, header->compressedSize,
+				pack->unpacked, header->unpackedSize) != (int)header->unpackedSize) {
+			MemFree(pack->unpacked);
+			pack->unpacked = NULL;
+			return false;
+		}
+	}
+
+	// Checked once here so views never have to
+	for (int i = 0; i < pack->entryCount; i++) {
+		const PackEntry *entry = &pack->entries[i];
+		size_t limit = (entry->flags & PACK_ENTRY_COMPRESSED) ? header->unpackedSize : size;
+		if ((size_t)entry->offset + entry->size > limit
+			|| (entry->format == PACK_FORMAT_GPU_TEXTURE && !validTexture(packData(pack, entry), entry->size))) {
+			packClose(pack);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool packOpen(AssetPack *pack, const char *fileName) {
+	MappedFile file;
+	if (!mapFile(&file, fileName))
+		return false;
+
+	if (!packOpenMemory(pack, file.data, file.size)) {
+		unmapFile(&file);
+		return false;
+	}
+	pack->file = file;
+	return true;
+}
+
+void packClose(AssetPack *pack) {
+	MemFree(pack->unpacked);
+	unmapFile(&pack->file);
+	memset(pack, 0, sizeof(*pack));
+}
+
+const PackEntry *packFind(const AssetPack *pack, const char *name) {
+	int lo = 0, hi = pack->entryCount - 1;
+	while (lo <= hi) {
+		int mid = (lo + hi)/2;
+		int c = strncmp(name, pack->entries[mid].name, PACK_NAME_SIZE);
+		if (c == 0)
+			return &pack->entries[mid];
+		if (c < 0)
+			hi = mid - 1;
+		else
+			lo = mid + 1;
+	}
+	return NULL;
+}
+
+const void *packData(const AssetPack *pack, const PackEntry *entry) {
+	if (entry->flags & PACK_ENTRY_COMPRESSED)
+		return pack->unpacked + entry->offset;
+	return pack->data + entry->offset;
+}
+
+Wave packWave(const AssetPack *pack, const char *name) {
+	Wave wave = { 0 };
+	const PackEntry *entry = packFind(pack, name);
+	if (!entry || entry->format != PACK_FORMAT_PCM_F32 || entry->param[1] == 0)
+		return wave;
+
+	wave.frameCount = entry->size/(sizeof(float)*entry->param[1]);
+	wave.sampleRate = entry->param[0];
+	wave.sampleSize = 32;
+	wave.channels = entry->param[1];
+	wave.data = (void *)packData(pack, entry);
+	return wave;
+}
+
+bool packLevel(const AssetPack *pack, const char *name, Level *level) {
+	const PackEntry *entry = packFind(pack, name);
+	if (!entry || entry->format != PACK_FORMAT_LEVEL)
+		return false;
+	return levelLoadMemory(level, packData(pack, entry), entry->size);
+}
+
+Music packMusic(const AssetPack *pack, const char *name) {
+	Music music = { 0 };
+	const PackEntry *entry = packFind(pack, name);
+	if (!entry || entry->format != PACK_FORMAT_FILE)
+		return music;
+	return LoadMusicStreamFromMemory(entry->type, packData(pack, entry), entry->size);
+}
+
+// Desktop GPUs decode BC natively, and those with ETC2 often only emulate it
+static const char *textureVariants[] = { "bc", "astc", "etc2" };
+
+static const PackEntry *findTextureVariant(const AssetPack *pack, const char *name) {
+	for (int i = 0; i < (int)(sizeof(textureVariants)/sizeof(textureVariants[0])); i++) {
+		char variant[PACK_NAME_SIZE + 8];
+		snprintf(variant, sizeof(variant), "%s%c%s", name, PACK_TEXTURE_VARIANT, textureVariants[i]);
+		const PackEntry *entry = packFind(pack, variant);
+		if (entry && entry->format == PACK_FORMAT_GPU_TEXTURE
+			&& IsTextureFormatSupported(((const PackTexture *)packData(pack, entry))->format))
+			return entry;
+	}
+	return packFind(pack, name);
+}
+
+Texture2D packTexture(const AssetPack *pack, const char *name) {
+	Texture2D texture = { 0 };
+	const PackEntry *entry = findTextureVariant(pack, name);
+	if (!entry)
+		return texture;
+
+	if (entry->format == PACK_FORMAT_GPU_TEXTURE) {
+		const PackTexture *info = packData(pack, entry);
+		Image image = {
+			.data = (void *)(info + 1),
+			.width = info->width,
+			.height = info->height,
+			.mipmaps = info->mipmaps,
+			.format = info->format,
+		};
+		texture = LoadTextureFromImage(image);
+	} else if (entry->format == PACK_FORMAT_IMAGE) {
+		Image image = {
+			.data = (void *)packData(pack, entry),
+			.width = entry->param[0],
+			.height = entry->param[1],
+			.mipmaps = 1,
+			.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+		};
+		texture = LoadTextureFromImage(image);
+	} else if (entry->format == PACK_FORMAT_FILE) {
+		Image image = LoadImageFromMemory(entry->type, packData(pack, entry), entry->size);
+		texture = LoadTextureFromImage(image);
+		UnloadImage(image);
+	}
+	return texture;
+}
+
+Font packFont(const AssetPack *pack, const char *name, int fontSize) {
+	const PackEntry *entry = packFind(pack, name);
+	if (!entry || entry->format != PACK_FORMAT_FILE)
+		return GetFontDefault();
+	return LoadFontFromMemory(entry->type, packData(pack, entry), entry->size, fontSize, NULL, 0);
+}
@@ -0,0 +1,104 @@
+#ifndef _pack_h_
+#define _pack_h_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "raylib.h"
+#include "level.h"
+#include "mapfile.h"
+
+#define PACK_MAGIC "ABPK"
+#define PACK_VERSION 1
+#define PACK_BYTE_ORDER 0x01020304u
+#define PACK_ALIGN 16
+#define PACK_NAME_SIZE 32
+
+// Sounds are converted when the pack is built to the format the game opens the audio device with,
+// so loading one is a view instead of an ogg decode plus resample
+#define PACK_SOUND_SAMPLE_RATE 48000
+#define PACK_SOUND_CHANNELS 2
+
+enum {
+	PACK_FORMAT_FILE,	// Original file bytes, type holds the extension for the LoadXFromMemory() functions
+	PACK_FORMAT_PCM_F32,	// Interleaved float samples, param is sample rate and channels
+	PACK_FORMAT_IMAGE,	// RGBA8 pixels, param is width and height
+	PACK_FORMAT_LEVEL,	// A .lvl image, see level.h
+	PACK_FORMAT_GPU_TEXTURE	// A PackTexture followed by its GPU-compressed mipmaps, largest first
+};
+
+// Payload lives in the compressed section, offset is into the section once unpacked
+#define PACK_ENTRY_COMPRESSED 1
+
+// File layout: header, entries sorted by name, payloads each aligned to PACK_ALIGN from the
+// start of the pack, then the compressed section if any. Native byte order like level files
+typedef struct PackHeader {
+	char magic[4];
+	uint32_t version;
+	uint32_t byteOrder;
+	uint32_t entryCount;
+	uint32_t compressedOffset;
+	uint32_t compressedSize;	// 0 when nothing is compressed
+	uint32_t unpackedSize;
+	uint32_t reserved;
+} PackHeader;
+
+typedef struct PackEntry {
+	char name[PACK_NAME_SIZE];
+	char type[8];
+	uint32_t format;
+	uint32_t flags;
+	uint32_t offset;
+	uint32_t size;
+	uint32_t param[2];
+} PackEntry;
+
+// Compressed copies of a texture are entries named name@bc, name@astc or name@etc2, taken from .dds
+// and .ktx2 files when the pack is built. The upload is the pack's bytes as they are, no decode
+#define PACK_TEXTURE_VARIANT '@'
+// Keeps every mipmap size within an int
+#define PACK_TEXTURE_MAX_SIZE 16384
+
+typedef struct PackTexture {
+	uint32_t format;	// PixelFormat, one of the compressed ones
+	uint32_t width;
+	uint32_t height;
+	uint32_t mipmaps;
+} PackTexture;
+
+// Everything returned from a pack points into it, so the pack has to outlive its views
+typedef struct AssetPack {
+	const unsigned char *data;
+	size_t size;
+	const PackEntry *entries;
+	int entryCount;
+
+	// Compressed section unpacked once on open
+	unsigned char *unpacked;
+
+	MappedFile file;
+} AssetPack;
+
+// Embedded packs must be PACK_ALIGN aligned and stay valid while the pack is open
+bool packOpenMemory(AssetPack *pack, const void *data, size_t size);
+bool packOpen(AssetPack *pack, const char *fileName);
+void packClose(AssetPack *pack);
+
+const PackEntry *packFind(const AssetPack *pack, const char *name);
+const void *packData(const AssetPack *pack, const PackEntry *entry);
+
+// Zero-copy views: the wave's samples and the level's arrays are the pack's own bytes,
+// never UnloadWave() or levelUnload() them
+Wave packWave(const AssetPack *pack, const char *name);
+bool packLevel(const AssetPack *pack, const char *name, Level *level);
+
+// Streams from the encoded file bytes in the pack, which must be a -f entry
+Music packMusic(const AssetPack *pack, const char *name);
+
+// GPU and glyph resources are created from the pack's bytes in place, unload them as usual.
+// Textures load the first compressed variant the GPU supports, in the order bc, astc, etc2, and
+// the plain name when none is
+Texture2D packTexture(const AssetPack *pack, const char *name);
+Font packFont(const AssetPack *pack, const char *name, int fontSize);
+
+#endif //_pack_h_
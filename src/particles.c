@@ -0,0 +1,111 @@
+#include "particles.h"
+
+#include <math.h>
+
+#include "defs.h"
+
+#define PARTICLE_GRAVITY 900.0f
+#define PARTICLE_SPEED 240.0f
+
+void particlesClear(ParticleArena *arena) {
+	arena->count = 0;
+	arena->next = 0;
+	SetRandomStreamSeed(&arena->random, 0, RANDOM_VISUALS);
+}
+
+void particlesSetLimit(ParticleArena *arena, int limit) {
+	if (limit < PARTICLES_PER_BREAK)
+		limit = PARTICLES_PER_BREAK;
+	else if (limit > MAX_PARTICLES)
+		limit = MAX_PARTICLES;
+
+	// Until the ring is full the next slot is the first free one, it has to stay that way
+	if (arena->count >= limit) {
+		arena->count = limit;
+		if (arena->next >= limit)
+			arena->next = 0;
+	} else {
+		arena->next = arena->count;
+	}
+	arena->limit = limit;
+}
+
+void particlesBurst(ParticleArena *arena, Rectangle brick, Color colour) {
+	float cx = brick.x + brick.width/2, cy = brick.y + brick.height/2;
+
+	// Angle, speed and position for the whole burst in one fill
+	float r[PARTICLES_PER_BREAK*4];
+	FillRandomStreamFloats(&arena->random, r, PARTICLES_PER_BREAK*4);
+
+	for (int n = 0; n < PARTICLES_PER_BREAK; n++) {
+		int i = arena->next;
+		arena->next = (arena->next + 1) % arena->limit;
+		if (arena->count < arena->limit)
+			arena->count++;
+
+		const float *u = &r[n*4];
+		float angle = u[0]*2*PI;
+		float speed = PARTICLE_SPEED*(0.3f + 0.7f*u[1]);
+		arena->x[i] = brick.x + u[2]*brick.width;
+		arena->y[i] = brick.y + u[3]*brick.height;
+		arena->vx[i] = (arena->x[i] - cx)*4 + cosf(angle)*speed;
+		arena->vy[i] = (arena->y[i] - cy)*4 + sinf(angle)*speed;
+		arena->life[i] = PARTICLE_LIFE;
+		arena->colour[i] = colour;
+	}
+}
+
+// Straight-line over every slot in use with no branches, so the compiler can vectorize it.
+// Dead particles keep moving until they're overwritten, which costs less than skipping them
+void particlesTick(ParticleArena *arena) {
+	int count = arena->count;
+	float *restrict x = arena->x, *restrict y = arena->y;
+	float *restrict vx = arena->vx, *restrict vy = arena->vy;
+	float *restrict life = arena->life;
+
+	for (int i = 0; i < count; i++) {
+		x[i] += vx[i]*TICK_TIME;
+		y[i] += vy[i]*TICK_TIME;
+		vy[i] += PARTICLE_GRAVITY*TICK_TIME;
+		life[i] -= TICK_TIME;
+	}
+}
+
+void particlesDraw(const ParticleArena *arena, float alpha) {
+	// Round dots from the shapes distance shader, one quad each. Inside BeginShapesSDF() they all go
+	// into one draw. The radius keeps the antialiased edge inside each particle's square
+	float step = alpha*TICK_TIME;
+	float radius = PARTICLE_SIZE/2.0f - 0.5f;
+
+	for (int i = 0; i < arena->count; i++) {
+		if (arena->life[i] <= 0)
+			continue;
+
+		Vector2 centre = {
+			arena->x[i] + arena->vx[i]*step + PARTICLE_SIZE/2.0f,
+			arena->y[i] + arena->vy[i]*step + PARTICLE_SIZE/2.0f };
+		Color c = arena->colour[i];
+		c.a = (unsigned char)(255*arena->life[i]/PARTICLE_LIFE);
+		DrawCircleSDF(centre, radius, c);
+	}
+}
+
+Rectangle particlesBounds(const ParticleArena *arena) {
+	float minX = INFINITY, minY = INFINITY, maxX = -INFINITY, maxY = -INFINITY;
+
+	for (int i = 0; i < arena->count; i++) {
+		if (arena->life[i] <= 0)
+			continue;
+		minX = fminf(minX, arena->x[i]);
+		minY = fminf(minY, arena->y[i]);
+		maxX = fmaxf(maxX, arena->x[i]);
+		maxY = fmaxf(maxY, arena->y[i]);
+	}
+
+	if (minX > maxX)
+		return (Rectangle){ 0 };
+
+	// Grown by a tick of the fastest possible motion to cover the extrapolated draw
+	float margin = PARTICLE_SIZE + (PARTICLE_SPEED*2 + PARTICLE_GRAVITY)*TICK_TIME;
+	return (Rectangle){ minX - margin, minY - margin, maxX - minX + 2*margin, maxY - minY + 2*margin };
+}
@@ -0,0 +1,44 @@
+#ifndef _particles_h_
+#define _particles_h_
+
+#include "raylib.h"
+
+// Fixed arena, a burst past capacity overwrites the oldest particles, so the cost per tick and
+// per frame never grows past MAX_PARTICLES
+#define MAX_PARTICLES 2048
+#define PARTICLES_PER_BREAK 16
+#define PARTICLE_SIZE 4
+// Seconds a particle lives, every particle lives the same time so the oldest always die first
+#define PARTICLE_LIFE 0.6f
+
+// Structure-of-arrays ring, slots [0, count) are in use and next is the slot written next. The ring
+// wraps at limit, which is below MAX_PARTICLES when the quality governor caps the effects
+typedef struct ParticleArena {
+	float x[MAX_PARTICLES];
+	float y[MAX_PARTICLES];
+	float vx[MAX_PARTICLES];
+	float vy[MAX_PARTICLES];
+	float life[MAX_PARTICLES];
+	Color colour[MAX_PARTICLES];
+	int count;
+	int next;
+	int limit;
+	// Own stream so effects never move the simulation's random sequence
+	RandomStream random;
+} ParticleArena;
+
+// Leaves the limit as it was
+void particlesClear(ParticleArena *arena);
+// Caps the ring at limit particles, live ones past it are dropped
+void particlesSetLimit(ParticleArena *arena, int limit);
+// Throws a burst out of a broken brick
+void particlesBurst(ParticleArena *arena, Rectangle brick, Color colour);
+void particlesTick(ParticleArena *arena);
+
+// alpha is the progress into the next tick, particles are drawn extrapolated by it. Call inside
+// BeginShapesSDF() so they share one draw
+void particlesDraw(const ParticleArena *arena, float alpha);
+// Area covering every live particle, empty when there are none
+Rectangle particlesBounds(const ParticleArena *arena);
+
+#endif //_particles_h_
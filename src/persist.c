@@ -0,0 +1,145 @@
+#include "persist.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32)
+	#include <io.h>
+	// Declared here, windows.h symbols collide with raylib ones
+	__declspec(dllimport) int __stdcall MoveFileExA(const char *lpExistingFileName, const char *lpNewFileName, unsigned long dwFlags);
+#else
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+static bool syncFile(FILE *file) {
+#if defined(_WIN32)
+	return _commit(_fileno(file)) == 0;
+#else
+	return fsync(fileno(file)) == 0;
+#endif
+}
+
+static bool replaceFile(const Persist *persist) {
+#if defined(_WIN32)
+	return MoveFileExA(persist->tempName, persist->fileName, 0x1 | 0x8) != 0;     // MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH
+#else
+	if (rename(persist->tempName, persist->fileName) != 0)
+		return false;
+
+	// The rename itself is only on disk once the directory is
+	int directory = open(persist->directory, O_RDONLY);
+	if (directory >= 0) {
+		fsync(directory);
+		close(directory);
+	}
+	return true;
+#endif
+}
+
+static bool writeRecord(const Persist *persist, const unsigned char *data, int size) {
+	FILE *file = fopen(persist->tempName, "wb");
+	if (!file)
+		return false;
+
+	bool ok = fwrite(data, 1, size, file) == (size_t)size && fflush(file) == 0 && syncFile(file);
+	ok = fclose(file) == 0 && ok;
+	ok = ok && replaceFile(persist);
+	if (!ok)
+		remove(persist->tempName);
+	return ok;
+}
+
+static void *persistMain(void *arg) {
+	Persist *persist = arg;
+	unsigned char record[PERSIST_MAX_SIZE];
+	SetCurrentThreadPriority(PRIORITY_LOW);
+
+	pthread_mutex_lock(&persist->lock);
+	for (;;) {
+		while (!persist->quit && !persist->dirty)
+			pthread_cond_wait(&persist->wake, &persist->lock);
+		if (!persist->dirty)
+			break;
+
+		// Copied out, saves made during the write only replace pending
+		int size = persist->pendingSize;
+		memcpy(record, persist->pending, size);
+		persist->dirty = false;
+		pthread_mutex_unlock(&persist->lock);
+
+		bool ok = writeRecord(persist, record, size);
+
+		pthread_mutex_lock(&persist->lock);
+		persist->writes++;
+		if (!ok)
+			persist->failures++;
+	}
+	pthread_mutex_unlock(&persist->lock);
+
+	return NULL;
+}
+
+bool persistOpen(Persist *persist, const char *fileName) {
+	persist->running = false;
+	persist->quit = false;
+	persist->dirty = false;
+	persist->saves = 0;
+	persist->writes = 0;
+	persist->failures = 0;
+	persist->fileName[0] = '\0';
+
+	if (strlen(fileName) >= PERSIST_MAX_PATH)
+		return false;
+	strcpy(persist->fileName, fileName);
+	snprintf(persist->tempName, sizeof(persist->tempName), "%s.tmp", fileName);
+	// GetDirectoryPath's buffer is shared, so it is only called here
+	snprintf(persist->directory, sizeof(persist->directory), "%s", GetDirectoryPath(fileName));
+
+	pthread_mutex_init(&persist->lock, NULL);
+	pthread_cond_init(&persist->wake, NULL);
+	persist->running = pthread_create(&persist->thread, NULL, persistMain, persist) == 0;
+	if (!persist->running) {
+		pthread_cond_destroy(&persist->wake);
+		pthread_mutex_destroy(&persist->lock);
+	}
+	return true;
+}
+
+void persistClose(Persist *persist) {
+	if (persist->running) {
+		pthread_mutex_lock(&persist->lock);
+		persist->quit = true;
+		pthread_cond_signal(&persist->wake);
+		pthread_mutex_unlock(&persist->lock);
+
+		pthread_join(persist->thread, NULL);
+		pthread_cond_destroy(&persist->wake);
+		pthread_mutex_destroy(&persist->lock);
+		persist->running = false;
+	}
+	persist->fileName[0] = '\0';
+}
+
+bool persistSave(Persist *persist, const void *data, int size) {
+	if (!persist->fileName[0] || size > PERSIST_MAX_SIZE)
+		return false;
+
+	if (!persist->running) {
+		persist->saves++;
+		persist->writes++;
+		bool ok = writeRecord(persist, data, size);
+		if (!ok)
+			persist->failures++;
+		return ok;
+	}
+
+	pthread_mutex_lock(&persist->lock);
+	memcpy(persist->pending, data, size);
+	persist->pendingSize = size;
+	persist->dirty = true;
+	persist->saves++;
+	pthread_cond_signal(&persist->wake);
+	pthread_mutex_unlock(&persist->lock);
+	return true;
+}
@@ -0,0 +1,44 @@
+#ifndef _persist_h_
+#define _persist_h_
+
+#include <pthread.h>
+
+#include "raylib.h"
+
+// Largest record persistSave() takes
+#define PERSIST_MAX_SIZE 1024
+#define PERSIST_MAX_PATH 512
+
+// A small record kept on disk and written on a background thread, so the game never waits on
+// storage, which on an SD card can take tens of milliseconds. Each write goes to a temporary file that
+// is synced and renamed over the record, so a crash leaves either the old record or the new one.
+// Saves made while a write is under way coalesce into one write of the latest. Without threads, in
+// the browser, saves are written when they are made, that filesystem is memory
+typedef struct Persist {
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	bool running;
+	bool quit;
+
+	char fileName[PERSIST_MAX_PATH];
+	char tempName[PERSIST_MAX_PATH + 4];
+	char directory[PERSIST_MAX_PATH];
+	// Latest record handed over that the writer hasn't taken yet
+	unsigned char pending[PERSIST_MAX_SIZE];
+	int pendingSize;
+	bool dirty;
+
+	long saves;
+	long writes;
+	long failures;
+} Persist;
+
+bool persistOpen(Persist *persist, const char *fileName);
+// Writes a save still pending, then stops the writer
+void persistClose(Persist *persist);
+
+// Copies the record and returns, false if it is too big or the store isn't open
+bool persistSave(Persist *persist, const void *data, int size);
+
+#endif //_persist_h_
@@ -0,0 +1,50 @@
+#include "power.h"
+
+void powerInit(PowerPolicy *power, int fps, bool canWait) {
+	power->enabled = true;
+	power->canWait = canWait;
+	power->fullFps = fps;
+	power->lastInput = GetTime();
+	power->fps = fps;
+	power->waiting = false;
+	SetTargetFPS(fps);
+}
+
+static bool gameplayInput(void) {
+	Vector2 delta = GetMouseDelta();
+	return delta.x != 0.0f || delta.y != 0.0f || GetMouseWheelMove() != 0.0f ||
+		IsMouseButtonDown(MOUSE_BUTTON_LEFT) || IsMouseButtonDown(MOUSE_BUTTON_RIGHT);
+}
+
+void powerFrame(PowerPolicy *power, bool playing) {
+	if (!power->enabled)
+		return;
+
+	double now = GetTime();
+	if (gameplayInput())
+		power->lastInput = now;
+
+	bool background = !IsWindowFocused() || IsWindowMinimized();
+	bool idle = !playing && now - power->lastInput >= POWER_IDLE_DELAY;
+
+	// Nothing moves when idle, so with nothing else needing frames the next one can wait for an
+	// event. In the background a game still in play keeps going at the low rate
+	int fps = power->fullFps;
+	bool waiting = false;
+	if (idle || background) {
+		fps = POWER_IDLE_FPS;
+		waiting = power->canWait && !playing;
+	}
+
+	if (fps != power->fps) {
+		SetTargetFPS(fps);
+		power->fps = fps;
+	}
+	if (waiting != power->waiting) {
+		if (waiting)
+			EnableEventWaiting();
+		else
+			DisableEventWaiting();
+		power->waiting = waiting;
+	}
+}
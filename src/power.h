@@ -0,0 +1,33 @@
+#ifndef _power_h_
+#define _power_h_
+
+#include "raylib.h"
+
+// Frame rate held with --battery, the simulation still ticks at TICK_RATE
+#define POWER_BATTERY_FPS 30
+// Frame rate when idle or in the background but something still needs frames
+#define POWER_IDLE_FPS 10
+// Seconds without gameplay input outside play before the frame rate drops
+#define POWER_IDLE_DELAY 2.0
+
+// Frame rate policy for battery powered devices. Frames drop to POWER_IDLE_FPS while nothing is in
+// play and the mouse is left alone, or the window is in the background, and the next gameplay input
+// brings the full rate back. Frames stop altogether until an event with canWait, off whenever
+// something needs frames without input (polled music, thumbnails)
+typedef struct PowerPolicy {
+	bool enabled;
+	bool canWait;
+	int fullFps;
+	double lastInput;
+	// The rate and waiting set, only changed when the policy changes its mind
+	int fps;
+	bool waiting;
+} PowerPolicy;
+
+// fps is the rate while playing, POWER_BATTERY_FPS for battery mode
+void powerInit(PowerPolicy *power, int fps, bool canWait);
+// Call once a frame after the input poll, before EndDrawing(). playing is whether anything moves
+// without input, a ball in play or a rewind held
+void powerFrame(PowerPolicy *power, bool playing);
+
+#endif //_power_h_
@@ -0,0 +1,96 @@
+#include "profile.h"
+
+#include <string.h>
+
+#define PROFILE_MAGIC "ABPF"
+#define PROFILE_VERSION 1
+#define PROFILE_HEADER_SIZE 20
+
+static void putU32(unsigned char *p, unsigned int v) {
+	p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+
+static unsigned int getU32(const unsigned char *p) {
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+// FNV-1a, the last word of the record. A file that was only partly written never matches it
+static unsigned int hashRecord(const unsigned char *data, int size) {
+	unsigned int hash = 2166136261u;
+	for (int i = 0; i < size; i++) {
+		hash = (hash ^ data[i])*16777619u;
+	}
+	return hash;
+}
+
+void profileInit(Profile *profile) {
+	memset(profile, 0, sizeof(*profile));
+	profile->presentMode = -1;
+	profile->frameLatency = -1;
+}
+
+// Layout: magic, version, present mode, frame latency, score count, the scores, then the hash of all
+// of that, little-endian
+int profileEncode(const Profile *profile, unsigned char *data) {
+	memcpy(data, PROFILE_MAGIC, 4);
+	putU32(data+4, PROFILE_VERSION);
+	putU32(data+8, profile->presentMode);
+	putU32(data+12, profile->frameLatency);
+	putU32(data+16, profile->scoreCount);
+
+	unsigned char *p = data + PROFILE_HEADER_SIZE;
+	for (int i = 0; i < profile->scoreCount; i++, p += 4) {
+		putU32(p, profile->scores[i]);
+	}
+	int size = p - data;
+	putU32(p, hashRecord(data, size));
+	return size + 4;
+}
+
+bool profileLoad(Profile *profile, const char *fileName) {
+	profileInit(profile);
+	if (!FileExists(fileName))
+		return false;
+
+	unsigned int size = 0;
+	unsigned char *data = LoadFileData(fileName, &size);
+	if (!data)
+		return false;
+
+	unsigned int count = size >= PROFILE_HEADER_SIZE ? getU32(data+16) : 0;
+	bool ok = size >= PROFILE_HEADER_SIZE + 4
+		&& memcmp(data, PROFILE_MAGIC, 4) == 0
+		&& getU32(data+4) == PROFILE_VERSION
+		&& count <= PROFILE_SCORES
+		&& size == PROFILE_HEADER_SIZE + count*4 + 4
+		&& getU32(data + size - 4) == hashRecord(data, size - 4);
+
+	if (ok) {
+		profile->presentMode = (int)getU32(data+8);
+		profile->frameLatency = (int)getU32(data+12);
+		profile->scoreCount = count;
+		for (unsigned int i = 0; i < count; i++) {
+			profile->scores[i] = (int)getU32(data + PROFILE_HEADER_SIZE + i*4);
+		}
+	}
+
+	UnloadFileData(data);
+	return ok;
+}
+
+bool profileAddScore(Profile *profile, int score) {
+	if (score <= 0)
+		return false;
+
+	int at = profile->scoreCount;
+	while (at > 0 && profile->scores[at-1] < score)
+		at--;
+	if (at >= PROFILE_SCORES)
+		return false;
+
+	int count = profile->scoreCount < PROFILE_SCORES ? profile->scoreCount + 1 : PROFILE_SCORES;
+	memmove(&profile->scores[at+1], &profile->scores[at], (count - at - 1)*sizeof(int));
+	profile->scores[at] = score;
+	profile->scoreCount = count;
+	return true;
+}
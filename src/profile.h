@@ -0,0 +1,30 @@
+#ifndef _profile_h_
+#define _profile_h_
+
+#include "raylib.h"
+
+#define PROFILE_FILE "profile.sav"
+#define PROFILE_SCORES 10
+// Largest encoded record
+#define PROFILE_RECORD_SIZE (24 + PROFILE_SCORES*4)
+
+// Settings and high scores kept between runs
+typedef struct Profile {
+	// PresentMode and frame latency limit last picked with F6 and F7, -1 for the defaults
+	int presentMode;
+	int frameLatency;
+	// Best first
+	int scores[PROFILE_SCORES];
+	int scoreCount;
+} Profile;
+
+void profileInit(Profile *profile);
+// Leaves the defaults when the file is missing or isn't a valid record
+bool profileLoad(Profile *profile, const char *fileName);
+// Writes the record into data, at least PROFILE_RECORD_SIZE bytes, and returns its size
+int profileEncode(const Profile *profile, unsigned char *data);
+
+// True when the score made the table
+bool profileAddScore(Profile *profile, int score);
+
+#endif //_profile_h_
@@ -0,0 +1,115 @@
+#include "profiler.h"
+#include "rlgl.h"
+
+#include <stdlib.h>
+
+static const char *sectionNames[PROFILE_SECTION_COUNT] = { "sim", "draw", "batch", "swap", "wait" };
+
+void profilerBegin(Profiler *profiler, int section) {
+	profiler->start[section] = GetTime();
+}
+
+void profilerEnd(Profiler *profiler, int section) {
+	profiler->sections[section] = GetTime() - profiler->start[section];
+}
+
+void profilerFrame(Profiler *profiler) {
+	FrameTimings timings = GetFrameTimings();
+	profiler->sections[PROFILE_BATCH] = timings.batch;
+	profiler->sections[PROFILE_SWAP] = timings.swap;
+	profiler->sections[PROFILE_WAIT] = timings.wait;
+	profiler->drawCalls = timings.drawCalls;
+	profiler->vertices = timings.vertices;
+	profiler->batchOverflows = timings.batchOverflows;
+	profiler->culled = timings.culled;
+	profiler->gpuFrame = timings.gpuFrame;
+	profiler->gpuBatch = timings.gpuBatch;
+	profiler->gpuLatency = timings.gpuLatency;
+	profiler->audio = GetAudioMixerStats();
+	profiler->frameMemory = GetFrameMemoryStats();
+	for (int i = 0; i < MEMORY_TAG_COUNT; i++) {
+		profiler->memory[i] = GetMemoryTagStats(i);
+	}
+	profiler->memory[MEMORY_TAG_COUNT] = GetMemoryStats();
+
+	profiler->inputLatency = timings.swapEnd - profiler->inputTime;
+	profiler->latchLatency = profiler->latchTime > 0.0 ? timings.swapEnd - profiler->latchTime : 0.0f;
+
+	profiler->history[profiler->historyHead] = GetFrameTime();
+	profiler->historyHead = (profiler->historyHead + 1) % PROFILER_HISTORY;
+	if (profiler->historyCount < PROFILER_HISTORY)
+		profiler->historyCount++;
+}
+
+static int compareFloat(const void *a, const void *b) {
+	float x = *(const float *)a, y = *(const float *)b;
+	return (x > y) - (x < y);
+}
+
+void profilerDraw(const Profiler *profiler) {
+	if (!profiler->visible)
+		return;
+
+	// Panel below, text and graph above it. With --sort-draws the text and the graph, which don't
+	// overlap, are grouped by texture instead of alternating
+	int x = GetScreenWidth() - 250, y = 40;
+	rlSetDrawLayer(0);
+	DrawRectangle(x, y, 240, 300, Fade(BLACK, 0.75f));
+	rlSetDrawLayer(1);
+
+	for (int i = 0; i < PROFILE_SECTION_COUNT; i++) {
+		DrawText(TextFormat("%-6s %6.2f ms", sectionNames[i], profiler->sections[i]*1000.0f), x+8, y+8+i*12, 10, WHITE);
+	}
+	// Overflows are batches flushed for being full, the batch grows so they should stop after a frame
+	DrawText(TextFormat("%d draw calls, %d vertices, %d overflows", profiler->drawCalls, profiler->vertices, profiler->batchOverflows), x+8, y+72, 10, profiler->batchOverflows ? RED : WHITE);
+
+	// Audio callback against the time it has to fill its period
+	const AudioMixerStats *audio = &profiler->audio;
+	DrawText(TextFormat("audio %.2f avg %.2f max %.2f ms", audio->callbackLast*1000.0f, audio->callbackAvg*1000.0f, audio->callbackMax*1000.0f), x+8, y+198, 10, WHITE);
+	DrawText(TextFormat("budget %.2f ms, lock %.3f ms", audio->callbackBudget*1000.0f, audio->lockWait*1000.0f), x+8, y+210, 10, WHITE);
+	DrawText(TextFormat("%d+%d voices, %u merged, %d buffers, %u underruns, %u starved", audio->activeVoices, audio->virtualVoices,
+		audio->mergedVoices, audio->activeBuffers, audio->underruns, audio->musicStarved), x+8, y+222, 10, audio->underruns || audio->musicStarved ? RED : WHITE);
+	DrawText(TextFormat("frames %u converted, %u direct", audio->framesConverted, audio->framesPassthrough), x+8, y+234, 10, WHITE);
+	DrawText(TextFormat("input to swap %.2f ms, latch %.2f ms", profiler->inputLatency*1000.0f, profiler->latchLatency*1000.0f), x+8, y+246, 10, WHITE);
+
+	// Size FRAME_MEMORY_SIZE from the peak, overflows mean it is too small
+	const FrameMemoryStats *memory = &profiler->frameMemory;
+	DrawText(TextFormat("frame mem %u/%u KB, peak %u KB, %u over", memory->used/1024, memory->capacity/1024, memory->highWater/1024, memory->overflows), x+8, y+258, 10, memory->overflows ? RED : WHITE);
+
+	const MemoryTagStats *heap = profiler->memory;
+	const MemoryTagStats *total = &heap[MEMORY_TAG_COUNT];
+	DrawText(TextFormat("heap %.1f MB, peak %.1f MB, %u blocks", total->liveBytes/1048576.0f, total->peakBytes/1048576.0f, total->liveCount), x+8, y+270, 10, total->failures ? RED : WHITE);
+	DrawText(TextFormat("aud %.1f tex %.1f txt %.1f gl %.1f game %.1f",
+		heap[MEMORY_TAG_AUDIO].liveBytes/1048576.0f, heap[MEMORY_TAG_TEXTURES].liveBytes/1048576.0f, heap[MEMORY_TAG_TEXT].liveBytes/1048576.0f,
+		heap[MEMORY_TAG_BATCH].liveBytes/1048576.0f, heap[MEMORY_TAG_GAME].liveBytes/1048576.0f), x+8, y+282, 10, WHITE);
+
+	int n = profiler->historyCount;
+	if (n == 0) {
+		rlSetDrawLayer(0);
+		return;
+	}
+
+	float sorted[PROFILER_HISTORY];
+	for (int i = 0; i < n; i++) {
+		sorted[i] = profiler->history[i];
+	}
+	qsort(sorted, n, sizeof(float), compareFloat);
+
+	DrawText(TextFormat("p50 %.2f  p99 %.2f  max %.2f ms",
+		sorted[n/2]*1000.0f, sorted[(n*99)/100]*1000.0f, sorted[n-1]*1000.0f), x+8, y+88, 10, YELLOW);
+	DrawText(TextFormat("%d culled off-screen", profiler->culled), x+8, y+100, 10, WHITE);
+	// A swap much longer than the GPU frame is waiting on vsync, not on the GPU
+	DrawText(TextFormat("gpu %.2f ms, batches %.2f ms, %d late", profiler->gpuFrame*1000.0f, profiler->gpuBatch*1000.0f, profiler->gpuLatency), x+8, y+112, 10, WHITE);
+
+	// Frame time graph, newest on the right, the line marks 60Hz
+	int graphY = y+190, graphH = 64;
+	float scale = graphH/(1.0f/30.0f);
+	for (int i = 0; i < n; i++) {
+		int index = (profiler->historyHead - n + i + PROFILER_HISTORY) % PROFILER_HISTORY;
+		int h = profiler->history[index]*scale;
+		if (h > graphH) h = graphH;
+		DrawRectangle(x+8 + i*224/PROFILER_HISTORY, graphY-h, 1, h, profiler->history[index] > 1.0f/60.0f ? RED : LIME);
+	}
+	DrawRectangle(x+8, graphY - graphH/2, 224, 1, GRAY);
+	rlSetDrawLayer(0);
+}
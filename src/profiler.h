@@ -0,0 +1,55 @@
+#ifndef _profiler_h_
+#define _profiler_h_
+
+#include "raylib.h"
+
+#define PROFILER_HISTORY 240
+
+enum {
+	PROFILE_SIM,
+	PROFILE_DRAW,
+	PROFILE_BATCH,
+	PROFILE_SWAP,
+	PROFILE_WAIT,
+	PROFILE_SECTION_COUNT
+};
+
+typedef struct Profiler {
+	bool visible;
+
+	double start[PROFILE_SECTION_COUNT];
+	float sections[PROFILE_SECTION_COUNT];
+	int drawCalls;
+	int vertices;
+	int batchOverflows;
+	int culled;
+	// GPU time of a frame a few frames back, 0 without timer queries
+	float gpuFrame;
+	float gpuBatch;
+	int gpuLatency;
+	AudioMixerStats audio;
+	FrameMemoryStats frameMemory;
+	// Heap by tag, the last entry is the total
+	MemoryTagStats memory[MEMORY_TAG_COUNT + 1];
+
+	// When the input used by the frame was sampled, set by the game loop. latchTime is 0 if not late-latched
+	double inputTime;
+	double latchTime;
+	// Seconds from those samples to the frame swap, the display adds its own latency on top
+	float inputLatency;
+	float latchLatency;
+
+	// Ring of recent frame times in seconds
+	float history[PROFILER_HISTORY];
+	int historyHead;
+	int historyCount;
+} Profiler;
+
+void profilerBegin(Profiler *profiler, int section);
+void profilerEnd(Profiler *profiler, int section);
+
+// Call once per frame after EndDrawing() to collect rcore's frame breakdown and the mixer stats
+void profilerFrame(Profiler *profiler);
+void profilerDraw(const Profiler *profiler);
+
+#endif //_profiler_h_
@@ -0,0 +1,64 @@
+#include "quality.h"
+
+#include "defs.h"
+#include "particles.h"
+#include "trail.h"
+
+// Cheapest knobs go first, the resolution only drops once the effects are already cut
+static const QualitySettings levels[QUALITY_LEVELS] = {
+	{ MAX_PARTICLES, TRAIL_LENGTH, 0.5f, 1.0f, MIXED_VOICES },
+	{ MAX_PARTICLES/2, 8, 1.0f, 1.0f, MIXED_VOICES },
+	{ MAX_PARTICLES/4, 6, 1.5f, 0.75f, MIXED_VOICES*3/4 },
+	{ MAX_PARTICLES/8, 4, 2.0f, 0.5f, MIXED_VOICES/2 },
+};
+
+// Close to a quarter second of frames to settle, so one slow frame doesn't move the cost far
+#define COST_SMOOTHING 0.1f
+
+void qualityInit(QualityGovernor *governor, int level, float budget, bool enabled) {
+	governor->enabled = enabled;
+	governor->level = level < 0 ? 0 : level >= QUALITY_LEVELS ? QUALITY_LEVELS - 1 : level;
+	governor->budget = budget;
+	governor->cost = 0.0f;
+	governor->overFrames = 0;
+	governor->underFrames = 0;
+	governor->settleFrames = QUALITY_SETTLE_FRAMES;
+}
+
+static bool step(QualityGovernor *governor, int level) {
+	governor->level = level;
+	governor->overFrames = 0;
+	governor->underFrames = 0;
+	governor->settleFrames = QUALITY_SETTLE_FRAMES;
+	return true;
+}
+
+bool qualityFrame(QualityGovernor *governor, const Profiler *profiler) {
+	if (!governor->enabled)
+		return false;
+
+	// Swap and the frame rate wait block on the display, not on work, so they're left out. Without
+	// timer queries gpuFrame is 0 and the CPU side alone decides
+	float cpu = profiler->sections[PROFILE_SIM] + profiler->sections[PROFILE_DRAW] + profiler->sections[PROFILE_BATCH];
+	float frame = cpu > profiler->gpuFrame ? cpu : profiler->gpuFrame;
+
+	if (governor->settleFrames > 0) {
+		governor->settleFrames--;
+		governor->cost = frame;
+		return false;
+	}
+	governor->cost += (frame - governor->cost)*COST_SMOOTHING;
+
+	governor->overFrames = governor->cost > governor->budget*QUALITY_DOWN_LOAD ? governor->overFrames + 1 : 0;
+	governor->underFrames = governor->cost < governor->budget*QUALITY_UP_LOAD ? governor->underFrames + 1 : 0;
+
+	if (governor->overFrames >= QUALITY_DOWN_FRAMES && governor->level < QUALITY_LEVELS - 1)
+		return step(governor, governor->level + 1);
+	if (governor->underFrames >= QUALITY_UP_FRAMES && governor->level > 0)
+		return step(governor, governor->level - 1);
+	return false;
+}
+
+QualitySettings qualitySettings(int level) {
+	return levels[level];
+}
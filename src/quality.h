@@ -0,0 +1,53 @@
+#ifndef _quality_h_
+#define _quality_h_
+
+#include "raylib.h"
+#include "profiler.h"
+
+// Level 0 is full quality, each level after it is cheaper to draw
+#define QUALITY_LEVELS 4
+// Fractions of the frame budget the smoothed frame cost has to stay over to step down, and under to
+// step back up. The gap between them keeps a frame near the edge from flipping levels
+#define QUALITY_DOWN_LOAD 0.9f
+#define QUALITY_UP_LOAD 0.6f
+// Frames the cost has to stay past either mark. Stepping up waits far longer, a level that was too
+// slow once likely will be again
+#define QUALITY_DOWN_FRAMES 30
+#define QUALITY_UP_FRAMES 300
+// Frames after a step before the cost counts again, GPU times arrive a few frames late and the
+// frame that changed level paid for it
+#define QUALITY_SETTLE_FRAMES 60
+
+// What a level draws. Only effects and presentation, the simulation is the same at every level
+typedef struct QualitySettings {
+	int particles;
+	// Points drawn of each ball trail
+	int trailLength;
+	// SetShapesCircleErrorRate(), circles drawn as segments when the distance shader is unsupported
+	float circleError;
+	// Internal render resolution as a fraction of the full one
+	float resolution;
+	int voices;
+} QualitySettings;
+
+// Steps the quality level against the measured frame cost, the larger of the CPU's sim and draw
+// time and the GPU's frame time
+typedef struct QualityGovernor {
+	// Off with the level pinned by --quality or for runs that must draw the same every time
+	bool enabled;
+	int level;
+	float budget;
+	// Smoothed frame cost in seconds
+	float cost;
+	int overFrames;
+	int underFrames;
+	int settleFrames;
+} QualityGovernor;
+
+// budget is the frame time to keep within in seconds, enabled false keeps level where it is put
+void qualityInit(QualityGovernor *governor, int level, float budget, bool enabled);
+// Call once a frame in play after profilerFrame(), returns true when the level changed
+bool qualityFrame(QualityGovernor *governor, const Profiler *profiler);
+QualitySettings qualitySettings(int level);
+
+#endif //_quality_h_
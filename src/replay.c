@@ -0,0 +1,107 @@
+#include "replay.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define REPLAY_MAGIC "ABRP"
+#define REPLAY_VERSION 1
+#define REPLAY_HEADER_SIZE 16
+#define REPLAY_TICK_SIZE 9
+
+void replayInit(Replay *replay, unsigned int seed) {
+	replay->seed = seed;
+	replay->tickCount = 0;
+	replay->capacity = 0;
+	replay->inputs = NULL;
+}
+
+void replayRecord(Replay *replay, GameInput input) {
+	if (replay->tickCount == replay->capacity) {
+		int capacity = replay->capacity ? replay->capacity*2 : 60*TICK_RATE;
+		GameInput *inputs = MemReallocTagged(replay->inputs, capacity*sizeof(GameInput), MEMORY_TAG_GAME);
+		if (!inputs)
+			return;
+
+		replay->inputs = inputs;
+		replay->capacity = capacity;
+	}
+
+	replay->inputs[replay->tickCount++] = input;
+}
+
+void replayFree(Replay *replay) {
+	MemFree(replay->inputs);
+	replayInit(replay, 0);
+}
+
+static void putU32(unsigned char *p, unsigned int v) {
+	p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+
+static unsigned int getU32(const unsigned char *p) {
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+static void putF32(unsigned char *p, float f) {
+	unsigned int v;
+	memcpy(&v, &f, 4);
+	putU32(p, v);
+}
+
+static float getF32(const unsigned char *p) {
+	unsigned int v = getU32(p);
+	float f;
+	memcpy(&f, &v, 4);
+	return f;
+}
+
+// Layout: magic, version, seed, tick count, then x/y/button for every tick, all little-endian
+bool replaySave(const Replay *replay, const char *fileName) {
+	unsigned int size = REPLAY_HEADER_SIZE + replay->tickCount*REPLAY_TICK_SIZE;
+	unsigned char *data = MemAllocTagged(size, MEMORY_TAG_GAME);
+	if (!data)
+		return false;
+
+	memcpy(data, REPLAY_MAGIC, 4);
+	putU32(data+4, REPLAY_VERSION);
+	putU32(data+8, replay->seed);
+	putU32(data+12, replay->tickCount);
+
+	unsigned char *p = data + REPLAY_HEADER_SIZE;
+	for (int i = 0; i < replay->tickCount; i++, p += REPLAY_TICK_SIZE) {
+		putF32(p, replay->inputs[i].mouse.x);
+		putF32(p+4, replay->inputs[i].mouse.y);
+		p[8] = replay->inputs[i].mouseDown;
+	}
+
+	bool ok = SaveFileData(fileName, data, size);
+	MemFree(data);
+	return ok;
+}
+
+bool replayLoad(Replay *replay, const char *fileName) {
+	unsigned int size = 0;
+	unsigned char *data = LoadFileData(fileName, &size);
+	if (!data)
+		return false;
+
+	bool ok = size >= REPLAY_HEADER_SIZE
+		&& memcmp(data, REPLAY_MAGIC, 4) == 0
+		&& getU32(data+4) == REPLAY_VERSION
+		// Divided rather than multiplied, a count from the file could wrap the product
+		&& getU32(data+12) <= (size - REPLAY_HEADER_SIZE)/REPLAY_TICK_SIZE;
+
+	if (ok) {
+		replayInit(replay, getU32(data+8));
+
+		unsigned int tickCount = getU32(data+12);
+		const unsigned char *p = data + REPLAY_HEADER_SIZE;
+		for (unsigned int i = 0; i < tickCount; i++, p += REPLAY_TICK_SIZE) {
+			GameInput input = { { getF32(p), getF32(p+4) }, p[8] != 0 };
+			replayRecord(replay, input);
+		}
+	}
+
+	UnloadFileData(data);
+	return ok;
+}
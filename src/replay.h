@@ -0,0 +1,21 @@
+#ifndef _replay_h_
+#define _replay_h_
+
+#include "game.h"
+
+// A session is reproduced exactly by the RNG seed plus the input fed to every tick
+typedef struct Replay {
+	unsigned int seed;
+	int tickCount;
+	int capacity;
+	GameInput *inputs;
+} Replay;
+
+void replayInit(Replay *replay, unsigned int seed);
+void replayRecord(Replay *replay, GameInput input);
+void replayFree(Replay *replay);
+
+bool replaySave(const Replay *replay, const char *fileName);
+bool replayLoad(Replay *replay, const char *fileName);
+
+#endif //_replay_h_
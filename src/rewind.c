@@ -0,0 +1,43 @@
+#include "rewind.h"
+
+void rewindClear(RewindBuffer *buffer) {
+	buffer->head = 0;
+	buffer->count = 0;
+}
+
+void rewindPush(RewindBuffer *buffer, const Game *game, int tick) {
+	gameSnapshot(game, &buffer->snapshots[buffer->head]);
+	buffer->ticks[buffer->head] = tick;
+	buffer->head = (buffer->head + 1) % REWIND_SNAPSHOTS;
+	if (buffer->count < REWIND_SNAPSHOTS)
+		buffer->count++;
+}
+
+bool rewindPop(RewindBuffer *buffer, Game *game, int *tick) {
+	if (buffer->count == 0)
+		return false;
+
+	buffer->head = (buffer->head + REWIND_SNAPSHOTS - 1) % REWIND_SNAPSHOTS;
+	buffer->count--;
+	gameRestore(game, &buffer->snapshots[buffer->head]);
+	*tick = buffer->ticks[buffer->head];
+	return true;
+}
+
+bool rewindSeek(RewindBuffer *buffer, Game *game, int tick, int *restoredTick) {
+	while (buffer->count > 0) {
+		int newest = (buffer->head + REWIND_SNAPSHOTS - 1) % REWIND_SNAPSHOTS;
+		if (buffer->ticks[newest] <= tick)
+			break;
+		buffer->head = newest;
+		buffer->count--;
+	}
+	if (buffer->count == 0)
+		return false;
+
+	// The snapshot stays, a later seek can land on it again
+	int newest = (buffer->head + REWIND_SNAPSHOTS - 1) % REWIND_SNAPSHOTS;
+	gameRestore(game, &buffer->snapshots[newest]);
+	*restoredTick = buffer->ticks[newest];
+	return true;
+}
@@ -0,0 +1,28 @@
+#ifndef _rewind_h_
+#define _rewind_h_
+
+#include "game.h"
+
+// Seconds of play kept, one snapshot every REWIND_INTERVAL ticks. Ticks in between are
+// reached by restoring the snapshot before them and simulating forward
+#define REWIND_SECONDS 5
+#define REWIND_INTERVAL 6
+#define REWIND_SNAPSHOTS (REWIND_SECONDS*TICK_RATE/REWIND_INTERVAL)
+
+// Ring of the latest snapshots, the oldest is overwritten when it is full
+typedef struct RewindBuffer {
+	GameSnapshot snapshots[REWIND_SNAPSHOTS];
+	int ticks[REWIND_SNAPSHOTS];
+	int head;
+	int count;
+} RewindBuffer;
+
+void rewindClear(RewindBuffer *buffer);
+// Records the game as it was before the given tick ran
+void rewindPush(RewindBuffer *buffer, const Game *game, int tick);
+// Restores the newest snapshot and drops it, for stepping back. False once the buffer is empty
+bool rewindPop(RewindBuffer *buffer, Game *game, int *tick);
+// Restores the newest snapshot taken at or before tick and drops the ones after it
+bool rewindSeek(RewindBuffer *buffer, Game *game, int tick, int *restoredTick);
+
+#endif //_rewind_h_
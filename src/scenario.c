@@ -0,0 +1,85 @@
+#include "scenario.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *columnNames[BENCH_COLUMN_COUNT] = { "frame", "sim", "draw", "batch", "swap", "wait", "gpu" };
+
+static const BenchScenario scenarios[] = {
+	{ "wall", NULL, 0, false, true, false },
+	{ "types", "level02", 8, false, true, false },
+	// 2000 12x5 bricks, up to 20 to a grid cell, and 50 balls for the broadphase, the brick layer and
+	// the particle arena
+	{ "dense", "dense", 49, false, true, false },
+	{ "dense-noparticles", "dense", 49, false, false, false },
+	// Dense with every ball drawing its trail
+	{ "dense-trails", "dense", 49, false, true, true },
+	{ "attack", NULL, 15, true, true, false },
+};
+
+#define SCENARIO_COUNT ((int)(sizeof(scenarios)/sizeof(scenarios[0])))
+
+const BenchScenario *benchScenario(const char *name) {
+	for (int i = 0; i < SCENARIO_COUNT; i++) {
+		if (strcmp(scenarios[i].name, name) == 0)
+			return &scenarios[i];
+	}
+	return NULL;
+}
+
+void benchListScenarios(void) {
+	fprintf(stderr, "scenarios:");
+	for (int i = 0; i < SCENARIO_COUNT; i++) {
+		fprintf(stderr, " %s", scenarios[i].name);
+	}
+	fprintf(stderr, "\n");
+}
+
+bool benchRecord(BenchRun *run, const Profiler *profiler, int frame) {
+	if (frame < BENCH_WARMUP || run->frames == BENCH_FRAMES)
+		return run->frames == BENCH_FRAMES;
+
+	int i = run->frames++;
+	run->samples[BENCH_FRAME][i] = GetFrameTime();
+	run->samples[BENCH_SIM][i] = profiler->sections[PROFILE_SIM];
+	run->samples[BENCH_DRAW][i] = profiler->sections[PROFILE_DRAW];
+	run->samples[BENCH_BATCH][i] = profiler->sections[PROFILE_BATCH];
+	run->samples[BENCH_SWAP][i] = profiler->sections[PROFILE_SWAP];
+	run->samples[BENCH_WAIT][i] = profiler->sections[PROFILE_WAIT];
+	run->samples[BENCH_GPU][i] = profiler->gpuFrame;
+	return run->frames == BENCH_FRAMES;
+}
+
+static int compareFloat(const void *a, const void *b) {
+	float x = *(const float *)a, y = *(const float *)b;
+	return (x > y) - (x < y);
+}
+
+bool benchReport(BenchRun *run, float budgetMs) {
+	int n = run->frames;
+	if (n == 0) {
+		fprintf(stderr, "bench %s: no frames measured\n", run->scenario->name);
+		return false;
+	}
+
+	// Same one object per line as the microbenchmarks, so runs can be diffed and tracked
+	float p99 = 0.0f;
+	for (int c = 0; c < BENCH_COLUMN_COUNT; c++) {
+		float *sorted = run->samples[c];
+		qsort(sorted, n, sizeof(float), compareFloat);
+		if (c == BENCH_FRAME)
+			p99 = sorted[(n - 1)*99/100]*1000.0f;
+
+		printf("{\"scenario\":\"%s\",\"phase\":\"%s\",\"frames\":%d,\"p50_ms\":%.3f,\"p90_ms\":%.3f,\"p99_ms\":%.3f,\"max_ms\":%.3f}\n",
+			run->scenario->name, columnNames[c], n, sorted[(n - 1)/2]*1000.0f, sorted[(n - 1)*90/100]*1000.0f,
+			sorted[(n - 1)*99/100]*1000.0f, sorted[n - 1]*1000.0f);
+	}
+	fflush(stdout);
+
+	if (budgetMs > 0.0f && p99 > budgetMs) {
+		fprintf(stderr, "bench %s: p99 frame time %.3f ms over the %.3f ms budget\n", run->scenario->name, p99, budgetMs);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,56 @@
+#ifndef _scenario_h_
+#define _scenario_h_
+
+#include "profiler.h"
+
+// Frames measured per run, after the warm-up. One tick each, so a run always simulates the same
+// span of game whatever the frame rate
+#define BENCH_FRAMES 1800
+#define BENCH_WARMUP 60
+// Every run plays the same game, so the frames can be compared between runs
+#define BENCH_SEED 1
+
+// Frame time and the profiler's sections, then the GPU frame
+enum {
+	BENCH_FRAME,
+	BENCH_SIM,
+	BENCH_DRAW,
+	BENCH_BATCH,
+	BENCH_SWAP,
+	BENCH_WAIT,
+	BENCH_GPU,
+	BENCH_COLUMN_COUNT
+};
+
+// A --bench run: the level and game setup, driven by the replay given with --replay or else by
+// the autopilot that keeps the paddle under the first ball
+typedef struct BenchScenario {
+	const char *name;
+	// Pack level name, NULL for the built-in wall
+	const char *level;
+	// Balls added at the start on top of the first
+	int balls;
+	bool attack;
+	bool particles;
+	bool trails;
+} BenchScenario;
+
+typedef struct BenchRun {
+	const BenchScenario *scenario;
+	int frames;
+	float samples[BENCH_COLUMN_COUNT][BENCH_FRAMES];
+} BenchRun;
+
+// NULL if there is none by that name
+const BenchScenario *benchScenario(const char *name);
+// Names to stderr, for an unknown one
+void benchListScenarios(void);
+
+// Call once per frame after profilerFrame(). True once the run has all its frames
+bool benchRecord(BenchRun *run, const Profiler *profiler, int frame);
+
+// Percentiles of each column as JSON lines on stdout. False when the budget is set and the frame
+// time p99 is over it
+bool benchReport(BenchRun *run, float budgetMs);
+
+#endif //_scenario_h_
@@ -0,0 +1,87 @@
+#include "sim_thread.h"
+
+#include "trace.h"
+
+static void publish(SimThread *sim) {
+	SimFrame *frame = &sim->frames[tripleBack(&sim->frameBuffer)];
+	gameSnapshot(sim->game, &frame->game);
+	frame->tick = sim->ticks;
+	frame->time = GetTime();
+	frame->hits = sim->hits;
+	frame->clicks = sim->clicks;
+	triplePublish(&sim->frameBuffer);
+}
+
+static void *simMain(void *arg) {
+	SimThread *sim = arg;
+	if (sim->core >= 0)
+		SetCurrentThreadAffinity(sim->core);
+
+	double next = GetTime();
+	while (!tripleLoad(&sim->quit)) {
+		double now = GetTime();
+		if (now < next) {
+			WaitTime(next - now);
+			continue;
+		}
+		// After a stall the lost time is dropped rather than run in a burst, like the frame loop's cap
+		if (now - next > MAX_FRAME_TICKS*TICK_TIME)
+			next = now;
+		next += TICK_TIME;
+
+		GameInput input = sim->inputs[tripleFront(&sim->inputBuffer)];
+		GameEvents events = { 0 };
+		TRACE_BEGIN("tick");
+		sim->tick(sim->context, input, &events);
+		TRACE_END();
+		sim->ticks++;
+		sim->hits += events.hits;
+		sim->clicks += events.clicks;
+		publish(sim);
+	}
+
+	return NULL;
+}
+
+bool simThreadStart(SimThread *sim, Game *game, SimTickFunc tick, void *context, int core) {
+	sim->game = game;
+	sim->tick = tick;
+	sim->context = context;
+	sim->core = core;
+	sim->ticks = 0;
+	sim->hits = 0;
+	sim->clicks = 0;
+	sim->quit = 0;
+
+	// Every slot starts valid, whichever one a side holds first
+	tripleInit(&sim->frameBuffer);
+	tripleInit(&sim->inputBuffer);
+	for (int i = 0; i < 3; i++) {
+		gameSnapshot(game, &sim->frames[i].game);
+		sim->frames[i].tick = 0;
+		sim->frames[i].time = GetTime();
+		sim->frames[i].hits = 0;
+		sim->frames[i].clicks = 0;
+		sim->inputs[i] = (GameInput){ 0 };
+	}
+
+	sim->running = pthread_create(&sim->thread, NULL, simMain, sim) == 0;
+	return sim->running;
+}
+
+void simThreadStop(SimThread *sim) {
+	if (!sim->running)
+		return;
+	tripleExchange(&sim->quit, 1);
+	pthread_join(sim->thread, NULL);
+	sim->running = false;
+}
+
+void simThreadInput(SimThread *sim, GameInput input) {
+	sim->inputs[tripleBack(&sim->inputBuffer)] = input;
+	triplePublish(&sim->inputBuffer);
+}
+
+const SimFrame *simThreadFrame(SimThread *sim) {
+	return &sim->frames[tripleFront(&sim->frameBuffer)];
+}
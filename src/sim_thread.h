@@ -0,0 +1,54 @@
+#ifndef _sim_thread_h_
+#define _sim_thread_h_
+
+#include <pthread.h>
+
+#include "game.h"
+#include "triple.h"
+
+// Runs one tick with the latest input, on the simulation thread
+typedef void (*SimTickFunc)(void *context, GameInput input, GameEvents *events);
+
+// What the main thread draws, the game as a tick left it
+typedef struct SimFrame {
+	GameSnapshot game;
+	int tick;
+	// GetTime() when the tick ran, for blending toward it
+	double time;
+	// Totals since the start, a frame the main thread skipped still counts
+	int hits;
+	int clicks;
+} SimFrame;
+
+// Ticks a game on its own thread at TICK_RATE, so drawing and the buffer swap never hold up a
+// tick. The main thread hands over input and takes frames through triple buffers, neither side
+// waits on the other
+typedef struct SimThread {
+	pthread_t thread;
+	Game *game;
+	SimTickFunc tick;
+	void *context;
+	// Core the thread is pinned to, -1 for any
+	int core;
+
+	SimFrame frames[3];
+	TripleBuffer frameBuffer;
+	GameInput inputs[3];
+	TripleBuffer inputBuffer;
+
+	int ticks;
+	int hits;
+	int clicks;
+	long quit;
+	bool running;
+} SimThread;
+
+// The game belongs to the simulation thread until simThreadStop
+bool simThreadStart(SimThread *sim, Game *game, SimTickFunc tick, void *context, int core);
+void simThreadStop(SimThread *sim);
+
+void simThreadInput(SimThread *sim, GameInput input);
+// Newest frame, valid until the next call
+const SimFrame *simThreadFrame(SimThread *sim);
+
+#endif //_sim_thread_h_
@@ -1,7 +0,0 @@
-#ifndef _snd_click_h_
-#define _snd_click_h_
-
-extern const unsigned char snd_click[];
-extern const int snd_click_size;
-
-#endif //_snd_click_h_
@@ -1,7 +0,0 @@
-#ifndef _snd_hit_h_
-#define _snd_hit_h_
-
-extern const unsigned char snd_hit[];
-extern const int snd_hit_size;
-
-#endif //_snd_hit_h_
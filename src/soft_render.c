@@ -0,0 +1,194 @@
+#include "soft_render.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "defs.h"
+
+#define HUD_FONT_SIZE 20
+// Glyph pixels at least this opaque are drawn, the bitmap font is one bit anyway
+#define GLYPH_THRESHOLD 128
+
+bool softRenderInit(SoftRender *soft, Font font) {
+	if (!font.glyphs)
+		return false;
+	soft->glyphs = MemAllocTagged(font.glyphCount*sizeof(Image), MEMORY_TAG_GAME);
+	if (!soft->glyphs)
+		return false;
+
+	for (int i = 0; i < font.glyphCount; i++) {
+		soft->glyphs[i] = ImageCopy(font.glyphs[i].image);
+		ImageFormat(&soft->glyphs[i], PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
+	}
+	soft->font = font;
+
+	for (int i = 0; i < 2; i++) {
+		soft->frames[i] = GenImageColor(SCREEN_WIDTH, SCREEN_HEIGHT, BLACK);
+	}
+	soft->current = 0;
+	soft->uploadedRows = 0;
+	soft->texture = LoadTextureFromImage(soft->frames[1]);
+	return IsTextureReady(soft->texture);
+}
+
+void softRenderUnload(SoftRender *soft) {
+	UnloadTexture(soft->texture);
+	for (int i = 0; i < 2; i++) {
+		UnloadImage(soft->frames[i]);
+	}
+	for (int i = 0; i < soft->font.glyphCount; i++) {
+		UnloadImage(soft->glyphs[i]);
+	}
+	MemFree(soft->glyphs);
+}
+
+// Nearest sampled, the way the GL path scales the bitmap font without filtering
+static void blitGlyph(Image *frame, const Image *glyph, int x, int y, float scale, Color colour) {
+	Color *pixels = frame->data;
+	const unsigned char *coverage = glyph->data;
+	int width = (int)(glyph->width*scale);
+	int height = (int)(glyph->height*scale);
+
+	for (int dy = 0; dy < height; dy++) {
+		int py = y + dy;
+		if (py < 0 || py >= frame->height)
+			continue;
+		const unsigned char *row = coverage + (int)(dy/scale)*glyph->width*2;
+		for (int dx = 0; dx < width; dx++) {
+			int px = x + dx;
+			if (px >= 0 && px < frame->width && row[(int)(dx/scale)*2 + 1] >= GLYPH_THRESHOLD)
+				pixels[py*frame->width + px] = colour;
+		}
+	}
+}
+
+// Same size and spacing as the hud's layouts, which follow DrawText
+static void drawText(const SoftRender *soft, Image *frame, const char *text, Vector2 position, int fontSize, Color colour) {
+	const Font *font = &soft->font;
+	float scale = (float)fontSize/font->baseSize;
+	int spacing = fontSize/10;
+	float x = position.x;
+
+	for (const char *c = text; *c; c++) {
+		int index = GetGlyphIndex(*font, (unsigned char)*c);
+		const GlyphInfo *glyph = &font->glyphs[index];
+		if (*c != ' ')
+			blitGlyph(frame, &soft->glyphs[index], (int)(x + glyph->offsetX*scale), (int)(position.y + glyph->offsetY*scale), scale, colour);
+		x += (glyph->advanceX ? glyph->advanceX : font->recs[index].width)*scale + spacing;
+	}
+}
+
+static void drawNumber(const SoftRender *soft, Image *frame, int value, Vector2 position, Color colour) {
+	char text[16];
+	snprintf(text, sizeof(text), "%d", value > 0 ? value : 0);
+	drawText(soft, frame, text, position, HUD_FONT_SIZE, colour);
+}
+
+// Round ends like the GL paddle, a rect between two circles
+static void drawPaddle(Image *frame, Rectangle paddle, Color colour) {
+	int radius = (int)(paddle.height/2);
+	int y = (int)(paddle.y + paddle.height/2);
+	ImageDrawCircle(frame, (int)paddle.x + radius, y, radius, colour);
+	ImageDrawCircle(frame, (int)(paddle.x + paddle.width) - radius, y, radius, colour);
+	ImageDrawRectangleRec(frame, (Rectangle){ paddle.x + radius, paddle.y, paddle.width - 2*radius, paddle.height }, colour);
+}
+
+// Particles fade over black instead of blending, nothing else is under them for long
+static void drawParticles(Image *frame, const ParticleArena *arena, float alpha) {
+	float step = alpha*TICK_TIME;
+
+	for (int i = 0; i < arena->count; i++) {
+		if (arena->life[i] <= 0)
+			continue;
+
+		float fade = arena->life[i]/PARTICLE_LIFE;
+		Color c = arena->colour[i];
+		c = (Color){ (unsigned char)(c.r*fade), (unsigned char)(c.g*fade), (unsigned char)(c.b*fade), 255 };
+		ImageDrawRectangleRec(frame, (Rectangle){ arena->x[i] + arena->vx[i]*step, arena->y[i] + arena->vy[i]*step,
+			PARTICLE_SIZE, PARTICLE_SIZE }, c);
+	}
+}
+
+// A dot per tick instead of a strip, faded over black like the particles
+static void drawTrails(Image *frame, const BallTrails *trails, const BallPool *balls, float alpha, Color colour) {
+	for (int i = 0; i < balls->count; i++) {
+		Vector2 p[TRAIL_LENGTH];
+		int points = trailPoints(trails, balls, i, alpha, p);
+		for (int k = 1; k < points; k++) {
+			float t = trailTaper(trails, k);
+			float fade = TRAIL_ALPHA*t*colour.a/255.0f;
+			Color c = { (unsigned char)(colour.r*fade), (unsigned char)(colour.g*fade), (unsigned char)(colour.b*fade), 255 };
+			ImageDrawCircle(frame, (int)p[k].x, (int)p[k].y, (int)(TRAIL_WIDTH*BALL_SIZE/2*t), c);
+		}
+	}
+}
+
+static void drawScene(const SoftRender *soft, Image *frame, const Game *game, const ParticleArena *particles, const BallTrails *trails, const Hud *hud, int fps, float alpha, Rectangle paddle) {
+	if (game->state == STATE_TITLE) {
+		ImageDrawRectangle(frame, 330, 190, 165, 60, game->hoveringPlayButton ? DARKGRAY : GRAY);
+		drawText(soft, frame, "Attack Breaker ", (Vector2){ 150, 10 }, 64, YELLOW);
+		drawText(soft, frame, "Play", (Vector2){ 370, 200 }, 40, WHITE);
+	} else if (game->state == STATE_PLAYING) {
+		FOR_EACH_BRICK(&game->bricks, i) {
+			ImageDrawRectangleRec(frame, gameBrickRect(game, i), brickColour(&game->bricks, i));
+		}
+		if (trails)
+			drawTrails(frame, trails, &game->balls, alpha, GRAY);
+
+		drawPaddle(frame, paddle, GRAY);
+		if (game->versus) {
+			Rectangle rival = game->rivalPaddle;
+			rival.x = game->prevRivalPaddleX + (rival.x - game->prevRivalPaddleX)*alpha;
+			drawPaddle(frame, rival, ORANGE);
+		}
+		drawParticles(frame, particles, alpha);
+		for (int i = 0; i < game->balls.count; i++) {
+			Rectangle rect = ballDrawRect(&game->balls, i, alpha);
+			ImageDrawCircle(frame, (int)(rect.x + rect.width/2), (int)(rect.y + rect.height/2), (int)(rect.width/2), GRAY);
+		}
+
+		drawText(soft, frame, "Bricks left: ", (Vector2){ 10, 10 }, HUD_FONT_SIZE, WHITE);
+		drawNumber(soft, frame, brickRemaining(&game->bricks), (Vector2){ 135, 10 }, YELLOW);
+		drawText(soft, frame, "Score: ", (Vector2){ 300, 10 }, HUD_FONT_SIZE, WHITE);
+		drawNumber(soft, frame, game->score, (Vector2){ hud->scoreX, 10 }, YELLOW);
+		drawText(soft, frame, "FPS ", (Vector2){ SCREEN_WIDTH - 100, 10 }, HUD_FONT_SIZE, WHITE);
+		drawNumber(soft, frame, fps, (Vector2){ hud->fpsX, 10 }, fps < TICK_RATE ? RED : LIME);
+		if (game->versus)
+			drawNumber(soft, frame, game->rivalScore, (Vector2){ SCREEN_WIDTH - 100, SCREEN_HEIGHT - 30 }, ORANGE);
+	} else if (game->state == STATE_WON) {
+		drawText(soft, frame, "You win!", (Vector2){ 290, 190 }, 64, YELLOW);
+	} else if (game->state == STATE_LOST) {
+		drawText(soft, frame, "Game over", (Vector2){ 270, 190 }, 64, RED);
+	}
+}
+
+void softRenderFrame(SoftRender *soft, const Game *game, const ParticleArena *particles, const BallTrails *trails, const Hud *hud, int fps, float alpha, Rectangle paddle) {
+	Image *frame = &soft->frames[soft->current];
+	const Image *shown = &soft->frames[1 - soft->current];
+
+	ImageClearBackground(frame, BLACK);
+	drawScene(soft, frame, game, particles, trails, hud, fps, alpha, paddle);
+
+	// Only the band from the first to the last row that differs from the shown frame is uploaded
+	int rowSize = frame->width*sizeof(Color);
+	const unsigned char *drawn = frame->data;
+	const unsigned char *before = shown->data;
+	int first = 0, last = frame->height - 1;
+	while (first < frame->height && memcmp(drawn + first*rowSize, before + first*rowSize, rowSize) == 0)
+		first++;
+	while (last > first && memcmp(drawn + last*rowSize, before + last*rowSize, rowSize) == 0)
+		last--;
+
+	soft->uploadedRows = 0;
+	if (first < frame->height) {
+		soft->uploadedRows = last - first + 1;
+		UpdateTextureRec(soft->texture, (Rectangle){ 0, first, frame->width, soft->uploadedRows }, drawn + first*rowSize);
+		soft->current = 1 - soft->current;
+	}
+}
+
+void softRenderDraw(const SoftRender *soft) {
+	BeginBlendMode(BLEND_OPAQUE);
+	DrawTexture(soft->texture, 0, 0, WHITE);
+	EndBlendMode();
+}
@@ -0,0 +1,35 @@
+#ifndef _soft_render_h_
+#define _soft_render_h_
+
+#include "raylib.h"
+#include "game.h"
+#include "hud.h"
+#include "particles.h"
+#include "trail.h"
+
+// The frame drawn on the CPU for GL drivers too broken or slow to draw the game. The scene is filled
+// into an image with the rtextures drawing functions and text is blitted from the bitmap font's glyph
+// images. Only the rows that differ from the last frame are uploaded, so GL does one partial texture
+// update and one quad
+typedef struct SoftRender {
+	// Drawn into frames[current], the other one holds what the texture shows
+	Image frames[2];
+	int current;
+	Texture2D texture;
+	Font font;
+	// Coverage of each of the font's glyphs as gray-alpha, so text never converts formats per frame
+	Image *glyphs;
+	// Rows the last frame uploaded
+	int uploadedRows;
+} SoftRender;
+
+// font is the bitmap font the hud uses, its glyph images must be loaded
+bool softRenderInit(SoftRender *soft, Font font);
+void softRenderUnload(SoftRender *soft);
+
+// Draws the scene as drawScene would and uploads the rows that changed, trails is NULL with them off
+void softRenderFrame(SoftRender *soft, const Game *game, const ParticleArena *particles, const BallTrails *trails, const Hud *hud, int fps, float alpha, Rectangle paddle);
+// The frame at virtual resolution, the only GL draw
+void softRenderDraw(const SoftRender *soft);
+
+#endif //_soft_render_h_
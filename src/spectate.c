@@ -0,0 +1,398 @@
+#include "spectate.h"
+
+#include <math.h>
+#include <string.h>
+
+#define SPECTATE_MAGIC "ABSP"
+#define SPECTATE_HEADER_SIZE 10
+
+enum {
+	PACKET_KEYFRAME = 1,
+	PACKET_DELTA
+};
+
+// What a delta tick carries besides the paddle and ball moves
+enum {
+	CHANGED_STATE = 1,
+	CHANGED_SCORE = 2,
+	CHANGED_BRICKS = 4,
+	CHANGED_BALLS = 8
+};
+
+static void putU32(unsigned char *p, unsigned int v) {
+	p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+
+static unsigned int getU32(const unsigned char *p) {
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+// LEB128, signed values zigzagged first so small moves either way take one byte
+static unsigned char *putVarint(unsigned char *p, unsigned int v) {
+	while (v >= 0x80) {
+		*p++ = (v & 0x7f) | 0x80;
+		v >>= 7;
+	}
+	*p++ = v;
+	return p;
+}
+
+static unsigned char *putSigned(unsigned char *p, int v) {
+	return putVarint(p, ((unsigned int)v << 1) ^ (unsigned int)(v >> 31));
+}
+
+typedef struct Reader {
+	const unsigned char *p;
+	const unsigned char *end;
+	bool failed;
+} Reader;
+
+static unsigned int getVarint(Reader *r) {
+	unsigned int v = 0;
+	for (int shift = 0; shift < 35; shift += 7) {
+		if (r->p >= r->end) {
+			r->failed = true;
+			return 0;
+		}
+		unsigned char byte = *r->p++;
+		v |= (unsigned int)(byte & 0x7f) << shift;
+		if (!(byte & 0x80))
+			return v;
+	}
+	r->failed = true;
+	return 0;
+}
+
+static int getSigned(Reader *r) {
+	unsigned int v = getVarint(r);
+	return (int)(v >> 1) ^ -(int)(v & 1);
+}
+
+static bool getBit(const uint64_t *bits, int i) {
+	return (bits[i >> 6] >> (i & 63)) & 1;
+}
+
+static void flipBits(uint64_t *bits, int from, int count) {
+	for (int i = from; i < from + count; i++) {
+		bits[i >> 6] ^= (uint64_t)1 << (i & 63);
+	}
+}
+
+static int quarter(float v) {
+	return (int)floorf(v*4 + 0.5f);
+}
+
+static void capture(SpectateView *view, const Game *game, int tick) {
+	view->tick = tick;
+	view->state = game->state;
+	view->score = game->score;
+	view->rivalScore = game->rivalScore;
+	view->versus = game->versus;
+	view->paddleX = quarter(game->paddle.x);
+	view->rivalX = quarter(game->rivalPaddle.x);
+	view->ballCount = game->balls.count;
+	for (int i = 0; i < game->balls.count; i++) {
+		view->ballX[i] = quarter(game->balls.x[i]);
+		view->ballY[i] = quarter(game->balls.y[i]);
+	}
+	view->brickCount = game->bricks.used;
+	memcpy(view->live, game->bricks.live, sizeof(view->live));
+}
+
+// Runs of changed bricks as (gap since the last run, length) pairs. NULL if there are more
+// than fit, the tick goes out as a keyframe then
+static unsigned char *putBrickDiff(unsigned char *p, const SpectateView *from, const SpectateView *to) {
+	unsigned char *count = p++;
+	int runs = 0;
+	int end = 0;
+	int words = (to->brickCount + 63) >> 6;
+	for (int w = 0; w < words; w++) {
+		if (from->live[w] == to->live[w])
+			continue;
+		// A run can carry on from the word before
+		for (int i = end > w << 6 ? end : w << 6; i < (w + 1) << 6; i++) {
+			if (getBit(from->live, i) == getBit(to->live, i))
+				continue;
+			int length = 1;
+			while (i + length < to->brickCount && getBit(from->live, i + length) != getBit(to->live, i + length))
+				length++;
+
+			if (++runs > SPECTATE_MAX_RUNS)
+				return NULL;
+			p = putVarint(p, i - end);
+			p = putVarint(p, length);
+			end = i + length;
+			i = end - 1;
+		}
+	}
+	*count = runs;
+	return p;
+}
+
+// Appends the tick to the packet being built. False if it can't be sent as a delta
+static bool putDelta(Spectate *spectate, const SpectateView *to) {
+	const SpectateView *from = &spectate->sent;
+	if (to->brickCount != from->brickCount || to->versus != from->versus)
+		return false;
+
+	unsigned char *start = spectate->packet + spectate->size;
+	unsigned char *flags = start;
+	unsigned char *p = start + 1;
+	*flags = 0;
+
+	if (to->state != from->state) {
+		*flags |= CHANGED_STATE;
+		p = putVarint(p, to->state);
+	}
+	if (to->score != from->score || to->rivalScore != from->rivalScore) {
+		*flags |= CHANGED_SCORE;
+		p = putVarint(p, to->score);
+		p = putVarint(p, to->rivalScore);
+	}
+	if (memcmp(to->live, from->live, ((to->brickCount + 63) >> 6)*sizeof(uint64_t)) != 0) {
+		*flags |= CHANGED_BRICKS;
+		p = putBrickDiff(p, from, to);
+		if (!p)
+			return false;
+	}
+	if (to->ballCount != from->ballCount) {
+		*flags |= CHANGED_BALLS;
+		p = putVarint(p, to->ballCount);
+		for (int i = from->ballCount; i < to->ballCount; i++) {
+			p = putSigned(p, to->ballX[i]);
+			p = putSigned(p, to->ballY[i]);
+		}
+	}
+
+	p = putSigned(p, to->paddleX - from->paddleX);
+	if (to->versus)
+		p = putSigned(p, to->rivalX - from->rivalX);
+	int moved = to->ballCount < from->ballCount ? to->ballCount : from->ballCount;
+	for (int i = 0; i < moved; i++) {
+		p = putSigned(p, to->ballX[i] - from->ballX[i]);
+		p = putSigned(p, to->ballY[i] - from->ballY[i]);
+	}
+
+	spectate->size += p - start;
+	return true;
+}
+
+static void putKeyframe(Spectate *spectate, const SpectateView *view) {
+	unsigned char *p = spectate->packet;
+	memcpy(p, SPECTATE_MAGIC, 4);
+	p[4] = PACKET_KEYFRAME;
+	putU32(p+5, view->tick);
+	p[9] = 0;
+	p += SPECTATE_HEADER_SIZE;
+
+	p = putVarint(p, view->state);
+	p = putVarint(p, view->score);
+	p = putVarint(p, view->rivalScore);
+	p = putVarint(p, view->versus);
+	p = putSigned(p, view->paddleX);
+	p = putSigned(p, view->rivalX);
+
+	// Alternating runs of live and broken bricks, starting with live
+	p = putVarint(p, view->brickCount);
+	unsigned char *runCount = p;
+	p += 2;
+	int runs = 0;
+	for (int i = 0; i < view->brickCount || runs == 0; runs++) {
+		bool live = !(runs & 1);
+		int length = 0;
+		while (i < view->brickCount && getBit(view->live, i) == live) {
+			i++;
+			length++;
+		}
+		p = putVarint(p, length);
+	}
+	runCount[0] = runs;
+	runCount[1] = runs >> 8;
+
+	p = putVarint(p, view->ballCount);
+	for (int i = 0; i < view->ballCount; i++) {
+		p = putSigned(p, view->ballX[i]);
+		p = putSigned(p, view->ballY[i]);
+	}
+
+	spectate->size = p - spectate->packet;
+}
+
+static void flush(Spectate *spectate) {
+	if (spectate->size == 0)
+		return;
+	if (spectate->packet[4] == PACKET_DELTA)
+		spectate->packet[9] = spectate->packetTicks;
+
+	udpSend(&spectate->udp, spectate->packet, spectate->size);
+	spectate->bytesSent += spectate->size;
+	spectate->packetsSent++;
+	spectate->size = 0;
+	spectate->packetTicks = 0;
+}
+
+bool spectateOpen(Spectate *spectate, const char *address) {
+	memset(spectate, 0, sizeof(*spectate));
+	spectate->sinceKeyframe = SPECTATE_KEYFRAME_TICKS;
+	return udpOpen(&spectate->udp, 0, address);
+}
+
+void spectateClose(Spectate *spectate) {
+	if (spectate->packetTicks > 0)
+		flush(spectate);
+	udpClose(&spectate->udp);
+}
+
+void spectateTick(Spectate *spectate, const Game *game) {
+	SpectateView *view = &spectate->current;
+	capture(view, game, spectate->sent.tick + 1);
+
+	if (spectate->packetTicks == 0) {
+		unsigned char *p = spectate->packet;
+		memcpy(p, SPECTATE_MAGIC, 4);
+		p[4] = PACKET_DELTA;
+		putU32(p+5, view->tick);
+		spectate->size = SPECTATE_HEADER_SIZE;
+	}
+
+	if (spectate->sinceKeyframe >= SPECTATE_KEYFRAME_TICKS || !putDelta(spectate, view)) {
+		// Deltas already in the packet lead up to the keyframe, so they go first
+		if (spectate->packetTicks > 0)
+			flush(spectate);
+		putKeyframe(spectate, view);
+		flush(spectate);
+		spectate->sinceKeyframe = 0;
+	} else {
+		spectate->packetTicks++;
+		spectate->sinceKeyframe++;
+		if (spectate->packetTicks >= SPECTATE_PACKET_TICKS || spectate->size >= SPECTATE_MTU)
+			flush(spectate);
+	}
+
+	spectate->sent = *view;
+}
+
+void spectateReaderInit(SpectateReader *reader) {
+	memset(reader, 0, sizeof(*reader));
+}
+
+static bool readKeyframe(SpectateView *view, Reader *r) {
+	view->state = getVarint(r);
+	view->score = getVarint(r);
+	view->rivalScore = getVarint(r);
+	view->versus = getVarint(r) != 0;
+	view->paddleX = getSigned(r);
+	view->rivalX = getSigned(r);
+
+	view->brickCount = getVarint(r);
+	if (r->failed || view->brickCount > MAX_BRICKS || r->end - r->p < 2)
+		return false;
+	int runs = r->p[0] | (r->p[1] << 8);
+	r->p += 2;
+	memset(view->live, 0, sizeof(view->live));
+	int end = 0;
+	for (int run = 0; run < runs; run++) {
+		int length = getVarint(r);
+		if (r->failed || length > view->brickCount - end)
+			return false;
+		if (!(run & 1))
+			flipBits(view->live, end, length);
+		end += length;
+	}
+
+	view->ballCount = getVarint(r);
+	if (r->failed || view->ballCount > MAX_BALLS)
+		return false;
+	for (int i = 0; i < view->ballCount; i++) {
+		view->ballX[i] = getSigned(r);
+		view->ballY[i] = getSigned(r);
+	}
+	return !r->failed;
+}
+
+static bool readDelta(SpectateView *view, Reader *r) {
+	if (r->p >= r->end)
+		return false;
+	int flags = *r->p++;
+
+	if (flags & CHANGED_STATE)
+		view->state = getVarint(r);
+	if (flags & CHANGED_SCORE) {
+		view->score = getVarint(r);
+		view->rivalScore = getVarint(r);
+	}
+	if (flags & CHANGED_BRICKS) {
+		if (r->p >= r->end)
+			return false;
+		int runs = *r->p++;
+		int end = 0;
+		for (int run = 0; run < runs; run++) {
+			int gap = getVarint(r);
+			int length = getVarint(r);
+			if (r->failed || gap > view->brickCount - end || length > view->brickCount - end - gap)
+				return false;
+			flipBits(view->live, end + gap, length);
+			end += gap + length;
+		}
+	}
+
+	int moved = view->ballCount;
+	if (flags & CHANGED_BALLS) {
+		int count = getVarint(r);
+		if (r->failed || count > MAX_BALLS)
+			return false;
+		for (int i = view->ballCount; i < count; i++) {
+			view->ballX[i] = getSigned(r);
+			view->ballY[i] = getSigned(r);
+		}
+		if (count < moved)
+			moved = count;
+		view->ballCount = count;
+	}
+
+	view->paddleX += getSigned(r);
+	if (view->versus)
+		view->rivalX += getSigned(r);
+	for (int i = 0; i < moved; i++) {
+		view->ballX[i] += getSigned(r);
+		view->ballY[i] += getSigned(r);
+	}
+
+	view->tick++;
+	return !r->failed;
+}
+
+bool spectateRead(SpectateReader *reader, const unsigned char *packet, int size) {
+	if (size < SPECTATE_HEADER_SIZE || memcmp(packet, SPECTATE_MAGIC, 4) != 0)
+		return false;
+	int type = packet[4];
+	int tick = getU32(packet+5);
+	int ticks = packet[9];
+	Reader r = { packet + SPECTATE_HEADER_SIZE, packet + size, false };
+	SpectateView *view = &reader->view;
+
+	if (type == PACKET_KEYFRAME) {
+		// Late duplicates or reordered keyframes would step back
+		if (reader->synced && tick < view->tick)
+			return false;
+		view->tick = tick;
+		reader->synced = readKeyframe(view, &r);
+		reader->keyframes++;
+		return reader->synced;
+	}
+
+	if (type != PACKET_DELTA || !reader->synced || tick <= view->tick)
+		return false;
+	if (tick != view->tick + 1) {
+		reader->dropped++;
+		reader->synced = false;
+		return false;
+	}
+	for (int i = 0; i < ticks; i++) {
+		if (!readDelta(view, &r)) {
+			reader->synced = false;
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,67 @@
+#ifndef _spectate_h_
+#define _spectate_h_
+
+#include "game.h"
+#include "udp.h"
+
+// Packets go out every SPECTATE_PACKET_TICKS ticks and a keyframe every SPECTATE_KEYFRAME_TICKS,
+// which is also the longest a joining or resyncing viewer waits
+#define SPECTATE_PACKET_TICKS 6
+#define SPECTATE_KEYFRAME_TICKS (2*TICK_RATE)
+// A tick that changes more bricks than this is sent as a keyframe instead, like a new level
+#define SPECTATE_MAX_RUNS 64
+// Room for a keyframe of a full store and pool. Delta packets go out once they pass SPECTATE_MTU
+#define SPECTATE_MAX_PACKET 32768
+#define SPECTATE_MTU 1200
+
+// What a viewer sees of the game, positions in quarter pixels. Brick geometry isn't in it,
+// the viewer loads the same level and only follows which bricks are live
+typedef struct SpectateView {
+	int tick;
+	int state;
+	int score;
+	int rivalScore;
+	bool versus;
+	int paddleX;
+	int rivalX;
+	int ballCount;
+	int ballX[MAX_BALLS];
+	int ballY[MAX_BALLS];
+	int brickCount;
+	uint64_t live[BRICK_WORDS];
+} SpectateView;
+
+// Sends the game to one viewer address. Deltas are taken against the view last sent rather than
+// the previous tick, so rewinds and rollbacks need nothing special
+typedef struct Spectate {
+	UdpSocket udp;
+	SpectateView sent;
+	SpectateView current;
+	int sinceKeyframe;
+
+	unsigned char packet[SPECTATE_MAX_PACKET];
+	int size;
+	int packetTicks;
+
+	long bytesSent;
+	int packetsSent;
+} Spectate;
+
+// Follows a stream from any point, syncing on the next keyframe and again after any lost packet
+typedef struct SpectateReader {
+	SpectateView view;
+	bool synced;
+	int keyframes;
+	int dropped;
+} SpectateReader;
+
+bool spectateOpen(Spectate *spectate, const char *address);
+void spectateClose(Spectate *spectate);
+// Call after every tick, game is the state it left
+void spectateTick(Spectate *spectate, const Game *game);
+
+void spectateReaderInit(SpectateReader *reader);
+// False for anything that isn't a stream packet, or one that doesn't follow what came before
+bool spectateRead(SpectateReader *reader, const unsigned char *packet, int size);
+
+#endif //_spectate_h_
@@ -0,0 +1,149 @@
+#include "sweep.h"
+
+#include <math.h>
+
+bool sweepRect(Rectangle a, Vector2 delta, Rectangle b, float *time, Vector2 *normal) {
+	// Grow b by the size of a so a can be treated as a point moving from its corner
+	float left = b.x - a.width, right = b.x + b.width;
+	float top = b.y - a.height, bottom = b.y + b.height;
+
+	float enterX, exitX, enterY, exitY;
+
+	if (delta.x == 0.0f) {
+		if (a.x <= left || a.x >= right) return false;
+		enterX = -INFINITY;
+		exitX = INFINITY;
+	} else {
+		float t1 = (left - a.x) / delta.x;
+		float t2 = (right - a.x) / delta.x;
+		enterX = fminf(t1, t2);
+		exitX = fmaxf(t1, t2);
+	}
+
+	if (delta.y == 0.0f) {
+		if (a.y <= top || a.y >= bottom) return false;
+		enterY = -INFINITY;
+		exitY = INFINITY;
+	} else {
+		float t1 = (top - a.y) / delta.y;
+		float t2 = (bottom - a.y) / delta.y;
+		enterY = fminf(t1, t2);
+		exitY = fmaxf(t1, t2);
+	}
+
+	float enter = fmaxf(enterX, enterY);
+	float exit = fminf(exitX, exitY);
+
+	if (enter >= exit || exit <= 0.0f || enter > 1.0f)
+		return false;
+
+	if (enter < 0.0f) {
+		// Already overlapping, push out along the axis of least penetration
+		float penX = fminf(a.x - left, right - a.x);
+		float penY = fminf(a.y - top, bottom - a.y);
+
+		if (penX < penY) {
+			*normal = (Vector2){ (a.x - left < right - a.x) ? -1.0f : 1.0f, 0.0f };
+		} else {
+			*normal = (Vector2){ 0.0f, (a.y - top < bottom - a.y) ? -1.0f : 1.0f };
+		}
+
+		if (delta.x*normal->x + delta.y*normal->y >= 0.0f)
+			return false;
+
+		*time = 0.0f;
+		return true;
+	}
+
+	if (enterX > enterY) {
+		*normal = (Vector2){ (delta.x > 0.0f) ? -1.0f : 1.0f, 0.0f };
+	} else {
+		*normal = (Vector2){ 0.0f, (delta.y > 0.0f) ? -1.0f : 1.0f };
+	}
+
+	*time = enter;
+	return true;
+}
+
+// Same contact rules as sweepRect. Entry and exit times are kept in 64 bits, a tiny delta
+// puts them far outside the Q16.16 range before they're compared against [0, 1]
+bool sweepRectFixed(FixedRect a, FixedVec delta, FixedRect b, Fixed *time, FixedVec *normal) {
+	Fixed left = b.x - a.width, right = b.x + b.width;
+	Fixed top = b.y - a.height, bottom = b.y + b.height;
+
+	int64_t enterX, exitX, enterY, exitY;
+
+	if (delta.x == 0) {
+		if (a.x <= left || a.x >= right) return false;
+		enterX = INT64_MIN;
+		exitX = INT64_MAX;
+	} else {
+		int64_t t1 = (int64_t)(left - a.x)*FIXED_ONE / delta.x;
+		int64_t t2 = (int64_t)(right - a.x)*FIXED_ONE / delta.x;
+		enterX = t1 < t2 ? t1 : t2;
+		exitX = t1 < t2 ? t2 : t1;
+	}
+
+	if (delta.y == 0) {
+		if (a.y <= top || a.y >= bottom) return false;
+		enterY = INT64_MIN;
+		exitY = INT64_MAX;
+	} else {
+		int64_t t1 = (int64_t)(top - a.y)*FIXED_ONE / delta.y;
+		int64_t t2 = (int64_t)(bottom - a.y)*FIXED_ONE / delta.y;
+		enterY = t1 < t2 ? t1 : t2;
+		exitY = t1 < t2 ? t2 : t1;
+	}
+
+	int64_t enter = enterX > enterY ? enterX : enterY;
+	int64_t exit = exitX < exitY ? exitX : exitY;
+
+	if (enter >= exit || exit <= 0 || enter > FIXED_ONE)
+		return false;
+
+	if (enter < 0) {
+		Fixed penX = a.x - left < right - a.x ? a.x - left : right - a.x;
+		Fixed penY = a.y - top < bottom - a.y ? a.y - top : bottom - a.y;
+
+		if (penX < penY) {
+			*normal = (FixedVec){ (a.x - left < right - a.x) ? -FIXED_ONE : FIXED_ONE, 0 };
+		} else {
+			*normal = (FixedVec){ 0, (a.y - top < bottom - a.y) ? -FIXED_ONE : FIXED_ONE };
+		}
+
+		if ((int64_t)delta.x*normal->x + (int64_t)delta.y*normal->y >= 0)
+			return false;
+
+		*time = 0;
+		return true;
+	}
+
+	if (enterX > enterY) {
+		*normal = (FixedVec){ (delta.x > 0) ? -FIXED_ONE : FIXED_ONE, 0 };
+	} else {
+		*normal = (FixedVec){ 0, (delta.y > 0) ? -FIXED_ONE : FIXED_ONE };
+	}
+
+	*time = (Fixed)enter;
+	return true;
+}
+
+bool contactRectFixed(FixedRect a, FixedRect b, FixedVec *normal, Fixed *depth) {
+	Fixed left = a.x + a.width - b.x, right = b.x + b.width - a.x;
+	Fixed up = a.y + a.height - b.y, down = b.y + b.height - a.y;
+
+	if (left <= 0 || right <= 0 || up <= 0 || down <= 0)
+		return false;
+
+	Fixed depthX = left < right ? left : right;
+	Fixed depthY = up < down ? up : down;
+
+	if (depthX < depthY) {
+		*normal = (FixedVec){ left < right ? -FIXED_ONE : FIXED_ONE, 0 };
+		*depth = depthX;
+	} else {
+		*normal = (FixedVec){ 0, up < down ? -FIXED_ONE : FIXED_ONE };
+		*depth = depthY;
+	}
+	return true;
+}
@@ -0,0 +1,16 @@
+#ifndef _sweep_h_
+#define _sweep_h_
+
+#include "raylib.h"
+#include "fixed.h"
+
+// Moves `a` by `delta` and reports the first contact with the static box `b`.
+// `time` is the fraction of delta travelled before contact and `normal` is the face of b that was hit.
+// A box that already overlaps b only counts as a hit if it is moving further into it.
+bool sweepRect(Rectangle a, Vector2 delta, Rectangle b, float *time, Vector2 *normal);
+// Q16.16 version for fixed-point physics, time is in [0, FIXED_ONE] and normal has unit components
+bool sweepRectFixed(FixedRect a, FixedVec delta, FixedRect b, Fixed *time, FixedVec *normal);
+// GetCollisionRecsContact for fixed-point physics: the unit normal to push a out of b along and how far
+bool contactRectFixed(FixedRect a, FixedRect b, FixedVec *normal, Fixed *depth);
+
+#endif //_sweep_h_
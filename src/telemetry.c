@@ -0,0 +1,106 @@
+#include "telemetry.h"
+
+#define TELEMETRY_HEADER "frame,frame_ms,ticks,draw_calls,vertices,audio_ms,voices,latency_wait_ms,present,frame_latency,quality\n"
+
+static void writeFrame(FILE *file, const TelemetryFrame *frame) {
+	fprintf(file, "%ld,%.3f,%d,%d,%d,%.3f,%d,%.3f,%d,%d,%d\n", frame->index, frame->frameTime*1000.0f, frame->ticks,
+		frame->drawCalls, frame->vertices, frame->audioCallback*1000.0f, frame->voices, frame->latencyWait*1000.0f,
+		frame->presentMode, frame->frameLatency, frame->quality);
+}
+
+static void *telemetryMain(void *arg) {
+	Telemetry *telemetry = arg;
+	static TelemetryFrame batch[TELEMETRY_RING];
+	SetCurrentThreadPriority(PRIORITY_LOW);
+
+	pthread_mutex_lock(&telemetry->lock);
+	for (;;) {
+		while (!telemetry->quit && telemetry->head - telemetry->tail < TELEMETRY_BATCH)
+			pthread_cond_wait(&telemetry->wake, &telemetry->lock);
+
+		// Copied out, so the game only waits on the lock for the copy and never on the file
+		long first = telemetry->tail;
+		int count = telemetry->head - first;
+		for (int i = 0; i < count; i++) {
+			batch[i] = telemetry->frames[(first + i) % TELEMETRY_RING];
+		}
+		telemetry->tail += count;
+		bool quit = telemetry->quit;
+		pthread_mutex_unlock(&telemetry->lock);
+
+		for (int i = 0; i < count; i++) {
+			writeFrame(telemetry->file, &batch[i]);
+		}
+		fflush(telemetry->file);
+
+		pthread_mutex_lock(&telemetry->lock);
+		if (quit)
+			break;
+	}
+	pthread_mutex_unlock(&telemetry->lock);
+
+	return NULL;
+}
+
+bool telemetryOpen(Telemetry *telemetry, const char *fileName) {
+	telemetry->head = 0;
+	telemetry->tail = 0;
+	telemetry->recorded = 0;
+	telemetry->dropped = 0;
+	telemetry->quit = false;
+	telemetry->running = false;
+
+	telemetry->file = fopen(fileName, "w");
+	if (!telemetry->file)
+		return false;
+	fputs(TELEMETRY_HEADER, telemetry->file);
+
+	pthread_mutex_init(&telemetry->lock, NULL);
+	pthread_cond_init(&telemetry->wake, NULL);
+	telemetry->running = pthread_create(&telemetry->thread, NULL, telemetryMain, telemetry) == 0;
+	if (!telemetry->running) {
+		pthread_cond_destroy(&telemetry->wake);
+		pthread_mutex_destroy(&telemetry->lock);
+		fclose(telemetry->file);
+		telemetry->file = NULL;
+	}
+	return telemetry->running;
+}
+
+void telemetryClose(Telemetry *telemetry) {
+	if (!telemetry->running)
+		return;
+
+	pthread_mutex_lock(&telemetry->lock);
+	telemetry->quit = true;
+	pthread_cond_signal(&telemetry->wake);
+	pthread_mutex_unlock(&telemetry->lock);
+
+	pthread_join(telemetry->thread, NULL);
+	pthread_cond_destroy(&telemetry->wake);
+	pthread_mutex_destroy(&telemetry->lock);
+	telemetry->running = false;
+
+	if (telemetry->dropped)
+		fprintf(telemetry->file, "# %ld frames dropped\n", telemetry->dropped);
+	fclose(telemetry->file);
+	telemetry->file = NULL;
+}
+
+void telemetryRecord(Telemetry *telemetry, const TelemetryFrame *frame) {
+	if (!telemetry->running)
+		return;
+
+	pthread_mutex_lock(&telemetry->lock);
+	if (telemetry->head - telemetry->tail < TELEMETRY_RING) {
+		TelemetryFrame *slot = &telemetry->frames[telemetry->head++ % TELEMETRY_RING];
+		*slot = *frame;
+		slot->index = telemetry->recorded;
+	} else {
+		telemetry->dropped++;
+	}
+	telemetry->recorded++;
+	if (telemetry->head - telemetry->tail >= TELEMETRY_BATCH)
+		pthread_cond_signal(&telemetry->wake);
+	pthread_mutex_unlock(&telemetry->lock);
+}
@@ -0,0 +1,56 @@
+#ifndef _telemetry_h_
+#define _telemetry_h_
+
+#include <stdio.h>
+#include <pthread.h>
+
+#include "raylib.h"
+
+// Frames held for the writer, about 8 s at 60 Hz. A full ring drops frames rather than stall the loop
+#define TELEMETRY_RING 512
+// Frames the writer waits for before waking, so the file sees a write about once a second
+#define TELEMETRY_BATCH 64
+
+typedef struct TelemetryFrame {
+	// Set by telemetryRecord(), dropped frames leave gaps
+	long index;
+	float frameTime;
+	int ticks;
+	int drawCalls;
+	int vertices;
+	float audioCallback;
+	int voices;
+	// PresentMode and frames allowed in flight when the frame was presented
+	int presentMode;
+	int frameLatency;
+	float latencyWait;
+	// Quality governor level the frame was drawn at, 0 is full quality
+	int quality;
+} TelemetryFrame;
+
+// Per-frame performance log, one CSV row per frame written on a background thread. Memory is the
+// ring, whatever the session length. tools/telemetry.c summarises a file
+typedef struct Telemetry {
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	bool running;
+	bool quit;
+
+	FILE *file;
+	// Ring positions [tail, head) are waiting, position n in frames[n % TELEMETRY_RING]
+	TelemetryFrame frames[TELEMETRY_RING];
+	long head;
+	long tail;
+	long recorded;
+	long dropped;
+} Telemetry;
+
+bool telemetryOpen(Telemetry *telemetry, const char *fileName);
+// Writes what is still in the ring, then the dropped count as a trailing comment
+void telemetryClose(Telemetry *telemetry);
+
+// Call once per frame, it only copies into the ring
+void telemetryRecord(Telemetry *telemetry, const TelemetryFrame *frame);
+
+#endif //_telemetry_h_
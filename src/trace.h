@@ -0,0 +1,16 @@
+#ifndef _trace_h_
+#define _trace_h_
+
+#include "raylib.h"
+
+// Timeline zones for chrome://tracing or ui.perfetto.dev, each thread records into its own ring
+// and --trace FILE exports them on exit. Built without TRACE_ZONES they compile to nothing
+#if defined(TRACE_ZONES)
+	#define TRACE_BEGIN(name) BeginTraceZone(name)
+	#define TRACE_END() EndTraceZone()
+#else
+	#define TRACE_BEGIN(name) ((void)0)
+	#define TRACE_END() ((void)0)
+#endif
+
+#endif //_trace_h_
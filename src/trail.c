@@ -0,0 +1,126 @@
+#include "trail.h"
+
+#include <math.h>
+
+#include "rlgl.h"
+
+// Further than any ball moves in a tick, so a ball past it was put somewhere rather than moved
+#define TRAIL_BREAK (2.0f*BALL_SIZE)
+
+void trailsClear(BallTrails *trails) {
+	trails->head = 0;
+	trails->count = 0;
+}
+
+void trailsSetLength(BallTrails *trails, int length) {
+	trails->drawn = length < 2 ? 2 : length > TRAIL_LENGTH ? TRAIL_LENGTH : length;
+}
+
+void trailsTick(BallTrails *trails, const BallPool *balls) {
+	// A new game clears the pool, its balls are not the old ones
+	if (balls->count < trails->count)
+		trailsClear(trails);
+
+	int last = (trails->head + TRAIL_LENGTH - 1) % TRAIL_LENGTH;
+	float *x = trails->x[trails->head], *y = trails->y[trails->head];
+	const float *lastX = trails->x[last], *lastY = trails->y[last];
+
+	for (int i = 0; i < balls->count; i++) {
+		x[i] = balls->x[i] + BALL_SIZE/2.0f;
+		y[i] = balls->y[i] + BALL_SIZE/2.0f;
+
+		float dx = x[i] - lastX[i], dy = y[i] - lastY[i];
+		if (i >= trails->count || dx*dx + dy*dy > TRAIL_BREAK*TRAIL_BREAK)
+			trails->length[i] = 0;
+		if (trails->length[i] < TRAIL_LENGTH)
+			trails->length[i]++;
+	}
+
+	trails->count = balls->count;
+	trails->head = (trails->head + 1) % TRAIL_LENGTH;
+}
+
+// Point 0 is where the ball is drawn and point k the tick k before the latest. The latest tick
+// itself is skipped, the drawn ball is between it and the one before
+int trailPoints(const BallTrails *trails, const BallPool *balls, int i, float alpha, Vector2 points[TRAIL_LENGTH]) {
+	// Balls from before a restart are gone until the next tick clears them
+	if (i >= trails->count || i >= balls->count)
+		return 0;
+
+	Rectangle rect = ballDrawRect(balls, i, alpha);
+	points[0] = (Vector2){ rect.x + rect.width/2, rect.y + rect.height/2 };
+	int count = trails->length[i] < trails->drawn ? trails->length[i] : trails->drawn;
+	for (int k = 1; k < count; k++) {
+		int slot = (trails->head + 2*TRAIL_LENGTH - 1 - k) % TRAIL_LENGTH;
+		points[k] = (Vector2){ trails->x[slot][i], trails->y[slot][i] };
+	}
+	return count;
+}
+
+void trailsDraw(const BallTrails *trails, const BallPool *balls, float alpha, Color colour) {
+	Texture2D texture = GetShapesTexture();
+	Rectangle source = GetShapesTextureRectangle();
+	float u = (source.x + source.width/2)/texture.width, v = (source.y + source.height/2)/texture.height;
+
+	rlSetTexture(texture.id);
+	rlBegin(RL_QUADS);
+	rlNormal3f(0.0f, 0.0f, 1.0f);
+
+	for (int i = 0; i < trails->count; i++) {
+		Vector2 p[TRAIL_LENGTH], n[TRAIL_LENGTH];
+		int points = trailPoints(trails, balls, i, alpha, p);
+		if (points < 2)
+			continue;
+		rlCheckRenderBatchLimit(4*(points - 1));
+
+		// Each point gets the normal of the chord through its neighbours, so the joins don't crease
+		for (int k = 0; k < points; k++) {
+			Vector2 a = p[k > 0 ? k - 1 : 0], b = p[k < points - 1 ? k + 1 : k];
+			float dx = b.x - a.x, dy = b.y - a.y;
+			float length = sqrtf(dx*dx + dy*dy);
+			n[k] = length > 0.0f ? (Vector2){ -dy/length, dx/length } : (Vector2){ 0 };
+		}
+
+		// A trail that is still growing is a cut-off full one
+		for (int k = 0; k < points - 1; k++) {
+			float t0 = trailTaper(trails, k), t1 = trailTaper(trails, k + 1);
+			float w0 = TRAIL_WIDTH*BALL_SIZE/2*t0, w1 = TRAIL_WIDTH*BALL_SIZE/2*t1;
+			unsigned char a0 = (unsigned char)(colour.a*TRAIL_ALPHA*t0), a1 = (unsigned char)(colour.a*TRAIL_ALPHA*t1);
+
+			rlColor4ub(colour.r, colour.g, colour.b, a0);
+			rlTexCoord2f(u, v);
+			rlVertex2f(p[k].x - n[k].x*w0, p[k].y - n[k].y*w0);
+			rlTexCoord2f(u, v);
+			rlVertex2f(p[k].x + n[k].x*w0, p[k].y + n[k].y*w0);
+			rlColor4ub(colour.r, colour.g, colour.b, a1);
+			rlTexCoord2f(u, v);
+			rlVertex2f(p[k + 1].x + n[k + 1].x*w1, p[k + 1].y + n[k + 1].y*w1);
+			rlTexCoord2f(u, v);
+			rlVertex2f(p[k + 1].x - n[k + 1].x*w1, p[k + 1].y - n[k + 1].y*w1);
+		}
+	}
+
+	rlEnd();
+	rlSetTexture(0);
+}
+
+Rectangle trailsBounds(const BallTrails *trails, const BallPool *balls, float alpha) {
+	float minX = INFINITY, minY = INFINITY, maxX = -INFINITY, maxY = -INFINITY;
+
+	for (int i = 0; i < trails->count; i++) {
+		Vector2 p[TRAIL_LENGTH];
+		int points = trailPoints(trails, balls, i, alpha, p);
+		for (int k = 0; k < points; k++) {
+			minX = fminf(minX, p[k].x);
+			minY = fminf(minY, p[k].y);
+			maxX = fmaxf(maxX, p[k].x);
+			maxY = fmaxf(maxY, p[k].y);
+		}
+	}
+
+	if (minX > maxX)
+		return (Rectangle){ 0 };
+	// Widest at the ball, so the ball's own half size pads every point
+	float pad = BALL_SIZE/2.0f;
+	return (Rectangle){ minX - pad, minY - pad, maxX - minX + 2*pad, maxY - minY + 2*pad };
+}
@@ -0,0 +1,48 @@
+#ifndef _trail_h_
+#define _trail_h_
+
+#include "raylib.h"
+#include "balls.h"
+
+// Ticks of history per ball, the trail runs from the drawn ball back through them
+#define TRAIL_LENGTH 10
+// The trail starts this wide, as a fraction of the ball, with its alpha at TRAIL_ALPHA. Both run
+// out at the end of a full trail
+#define TRAIL_WIDTH 0.8f
+#define TRAIL_ALPHA 0.5f
+
+// Every ball's centre over the last TRAIL_LENGTH ticks. All balls are sampled on the same tick,
+// so one ring head serves them all and each slot is a copy of the pool's arrays
+typedef struct BallTrails {
+	float x[TRAIL_LENGTH][MAX_BALLS];
+	float y[TRAIL_LENGTH][MAX_BALLS];
+	// Ticks recorded for each ball, less than TRAIL_LENGTH for new balls and ones that jumped
+	unsigned char length[MAX_BALLS];
+	// Slot written next
+	int head;
+	int count;
+	// Points drawn of each trail, TRAIL_LENGTH unless the quality governor shortens them
+	int drawn;
+} BallTrails;
+
+// Leaves the drawn length as it was
+void trailsClear(BallTrails *trails);
+// History is still kept for TRAIL_LENGTH ticks, only the draw is cut and tapered to length points
+void trailsSetLength(BallTrails *trails, int length);
+// Once per tick, after the balls moved
+void trailsTick(BallTrails *trails, const BallPool *balls);
+
+// Ball i's trail from where it is drawn back to its oldest tick, returns the point count
+int trailPoints(const BallTrails *trails, const BallPool *balls, int i, float alpha, Vector2 points[TRAIL_LENGTH]);
+// Fraction of the full width and alpha at point k
+static inline float trailTaper(const BallTrails *trails, int k) {
+	return 1.0f - (float)k/(trails->drawn - 1);
+}
+
+// One tapered strip per ball, all as quads in a single batch. Flat shapes, so call it outside
+// BeginShapesSDF()
+void trailsDraw(const BallTrails *trails, const BallPool *balls, float alpha, Color colour);
+// Area covering every trail, empty when there are none
+Rectangle trailsBounds(const BallTrails *trails, const BallPool *balls, float alpha);
+
+#endif //_trail_h_
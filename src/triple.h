@@ -0,0 +1,48 @@
+#ifndef _triple_h_
+#define _triple_h_
+
+#if defined(__GNUC__) || defined(__clang__)
+	#define tripleExchange(p, v) __atomic_exchange_n(p, v, __ATOMIC_ACQ_REL)
+	#define tripleLoad(p) __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#else
+	#include <intrin.h>
+	#define tripleExchange(p, v) _InterlockedExchange((volatile long *)(p), v)
+	#define tripleLoad(p) _InterlockedOr((volatile long *)(p), 0)
+#endif
+
+#define TRIPLE_FRESH 4
+
+// Lock-free hand-off of the latest of a stream of values between one writer and one reader
+// thread. The caller keeps three slots, this only tracks which is whose: the writer fills back
+// and publishes it, the reader takes the newest published one, and the third is in between.
+// Neither side ever waits, values the reader doesn't get to in time are skipped
+typedef struct TripleBuffer {
+	int back;
+	// Slot last published, with TRIPLE_FRESH until the reader takes it
+	long middle;
+	int front;
+} TripleBuffer;
+
+static inline void tripleInit(TripleBuffer *buffer) {
+	buffer->back = 0;
+	buffer->middle = 1;
+	buffer->front = 2;
+}
+
+// Writer side, the slot to fill and then publish
+static inline int tripleBack(const TripleBuffer *buffer) {
+	return buffer->back;
+}
+
+static inline void triplePublish(TripleBuffer *buffer) {
+	buffer->back = tripleExchange(&buffer->middle, buffer->back | TRIPLE_FRESH) & 3;
+}
+
+// Reader side, the newest published slot. It stays the reader's until the next call
+static inline int tripleFront(TripleBuffer *buffer) {
+	if (tripleLoad(&buffer->middle) & TRIPLE_FRESH)
+		buffer->front = tripleExchange(&buffer->middle, buffer->front) & 3;
+	return buffer->front;
+}
+
+#endif //_triple_h_
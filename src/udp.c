@@ -0,0 +1,102 @@
+#include "udp.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+	#include <fcntl.h>
+	#include <netdb.h>
+	#include <sys/socket.h>
+	#include <unistd.h>
+#endif
+
+#if !defined(_WIN32)
+
+static bool resolve(const char *host, const char *service, struct addrinfo **found) {
+	struct addrinfo hints = { 0 };
+	hints.ai_family = AF_INET;
+	hints.ai_socktype = SOCK_DGRAM;
+	hints.ai_flags = host ? 0 : AI_PASSIVE;
+	return getaddrinfo(host, service, &hints, found) == 0;
+}
+
+bool udpOpen(UdpSocket *udp, int port, const char *peer) {
+	memset(udp, 0, sizeof(*udp));
+	udp->fd = -1;
+
+	struct addrinfo *found = NULL;
+	if (peer) {
+		char host[256];
+		const char *colon = strrchr(peer, ':');
+		if (!colon || colon - peer >= (int)sizeof(host))
+			return false;
+		memcpy(host, peer, colon - peer);
+		host[colon - peer] = '\0';
+
+		if (!resolve(host, colon + 1, &found))
+			return false;
+		bool fits = found->ai_addrlen <= sizeof(udp->peer);
+		if (fits) {
+			memcpy(udp->peer, found->ai_addr, found->ai_addrlen);
+			udp->peerSize = found->ai_addrlen;
+		}
+		freeaddrinfo(found);
+		if (!fits)
+			return false;
+	}
+
+	char service[16];
+	snprintf(service, sizeof(service), "%d", port);
+	if (!resolve(NULL, service, &found))
+		return false;
+
+	udp->fd = socket(AF_INET, SOCK_DGRAM, 0);
+	bool bound = udp->fd >= 0 && bind(udp->fd, found->ai_addr, found->ai_addrlen) == 0;
+	freeaddrinfo(found);
+
+	// The frame never waits on the network
+	if (!bound || fcntl(udp->fd, F_SETFL, fcntl(udp->fd, F_GETFL) | O_NONBLOCK) != 0) {
+		udpClose(udp);
+		return false;
+	}
+	return true;
+}
+
+void udpClose(UdpSocket *udp) {
+	if (udp->fd >= 0)
+		close(udp->fd);
+	udp->fd = -1;
+}
+
+void udpSend(const UdpSocket *udp, const void *data, int size) {
+	if (udp->peerSize == 0)
+		return;
+
+	struct sockaddr_storage peer;
+	memcpy(&peer, udp->peer, udp->peerSize);
+	sendto(udp->fd, data, size, 0, (const struct sockaddr *)&peer, udp->peerSize);
+}
+
+int udpReceive(const UdpSocket *udp, void *data, int capacity) {
+	return (int)recv(udp->fd, data, capacity, 0);
+}
+
+#else
+
+bool udpOpen(UdpSocket *udp, int port, const char *peer) {
+	memset(udp, 0, sizeof(*udp));
+	udp->fd = -1;
+	return false;
+}
+
+void udpClose(UdpSocket *udp) {
+}
+
+void udpSend(const UdpSocket *udp, const void *data, int size) {
+}
+
+int udpReceive(const UdpSocket *udp, void *data, int capacity) {
+	return -1;
+}
+
+#endif
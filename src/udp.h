@@ -0,0 +1,21 @@
+#ifndef _udp_h_
+#define _udp_h_
+
+#include <stdbool.h>
+
+// Non-blocking UDP socket with one fixed peer. Sockets aren't supported on Windows yet, opening fails
+typedef struct UdpSocket {
+	int fd;
+	unsigned char peer[16];
+	int peerSize;
+} UdpSocket;
+
+// Binds port, 0 for any. peer is host:port to send to, or NULL for a socket that only receives
+bool udpOpen(UdpSocket *udp, int port, const char *peer);
+void udpClose(UdpSocket *udp);
+
+void udpSend(const UdpSocket *udp, const void *data, int size);
+// Size of the next waiting datagram, from anyone, or -1 when there is none
+int udpReceive(const UdpSocket *udp, void *data, int capacity);
+
+#endif //_udp_h_
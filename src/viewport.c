@@ -0,0 +1,61 @@
+#include "viewport.h"
+
+#include <math.h>
+
+#include "rlgl.h"
+
+#include "defs.h"
+
+bool viewportLoad(Viewport *viewport, int width, int height, int filter) {
+	viewport->target = LoadRenderTexture(width, height);
+	viewport->filter = filter;
+	if (viewport->target.id == 0)
+		return false;
+
+	SetTextureFilter(viewport->target.texture, filter);
+	return true;
+}
+
+void viewportUnload(Viewport *viewport) {
+	UnloadRenderTexture(viewport->target);
+	SetMouseOffset(0, 0);
+	SetMouseScale(1.0f, 1.0f);
+}
+
+// Largest area with the virtual aspect that fits the window, centred. Nearest filtering keeps
+// to whole multiples of the internal size when the window allows, so pixels stay even
+static Rectangle fitWindow(const Viewport *viewport) {
+	float windowW = GetScreenWidth(), windowH = GetScreenHeight();
+	float scale = fminf(windowW/SCREEN_WIDTH, windowH/SCREEN_HEIGHT);
+
+	if (viewport->filter == TEXTURE_FILTER_POINT) {
+		float textureW = viewport->target.texture.width, textureH = viewport->target.texture.height;
+		float whole = floorf(fminf(windowW/textureW, windowH/textureH));
+		if (whole >= 1.0f)
+			scale = fminf(whole*textureW/SCREEN_WIDTH, whole*textureH/SCREEN_HEIGHT);
+	}
+
+	float w = SCREEN_WIDTH*scale, h = SCREEN_HEIGHT*scale;
+	return (Rectangle){ floorf((windowW - w)/2), floorf((windowH - h)/2), w, h };
+}
+
+void viewportBegin(Viewport *viewport) {
+	viewport->dest = fitWindow(viewport);
+	SetMouseOffset(-viewport->dest.x, -viewport->dest.y);
+	SetMouseScale(SCREEN_WIDTH/viewport->dest.width, SCREEN_HEIGHT/viewport->dest.height);
+
+	BeginTextureMode(viewport->target);
+	rlScalef((float)viewport->target.texture.width/SCREEN_WIDTH, (float)viewport->target.texture.height/SCREEN_HEIGHT, 1.0f);
+}
+
+void viewportEnd(const Viewport *viewport) {
+	EndTextureMode();
+
+	// Render textures are stored bottom up. The scene is on black, so it's copied without blending,
+	// which also keeps blended alpha left in the target from darkening it
+	Texture2D texture = viewport->target.texture;
+	ClearBackground(BLACK);
+	BeginBlendMode(BLEND_OPAQUE);
+	DrawTexturePro(texture, (Rectangle){ 0, 0, texture.width, -texture.height }, viewport->dest, (Vector2){ 0, 0 }, 0.0f, WHITE);
+	EndBlendMode();
+}
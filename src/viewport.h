@@ -0,0 +1,23 @@
+#ifndef _viewport_h_
+#define _viewport_h_
+
+#include "raylib.h"
+
+// Renders the SCREEN_WIDTH x SCREEN_HEIGHT virtual space into a texture at any internal resolution,
+// then scales it to fit the window. Layout and input stay in virtual coordinates
+typedef struct Viewport {
+	RenderTexture2D target;
+	int filter;
+	// Where the target lands on the window, kept in step with the window size by viewportBegin()
+	Rectangle dest;
+} Viewport;
+
+bool viewportLoad(Viewport *viewport, int width, int height, int filter);
+void viewportUnload(Viewport *viewport);
+
+// Between BeginDrawing() and EndDrawing(). Drawing in between goes to the internal target, and mouse
+// positions read afterwards are in virtual coordinates
+void viewportBegin(Viewport *viewport);
+void viewportEnd(const Viewport *viewport);
+
+#endif //_viewport_h_
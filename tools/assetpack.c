@@ -0,0 +1,412 @@
+// Builds the asset pack the game loads its content from, see src/pack.h for the layout
+//
+//   assetpack [--embed pack.c] output.pak [-z] [-f] name=file ...
+//
+// Sounds are decoded and converted to the device format, images the build can decode are stored
+// as RGBA8 pixels and .lvl files as they are. .dds and .ktx2 files holding a BC, ETC2 or ASTC
+// texture keep their compressed mipmaps, under a name ending in @bc, @etc2 or @astc to match.
+// Anything else is kept as the original file bytes.
+// -z puts the next entry in the compressed section, -f keeps it as file bytes whatever it is
+// (music is streamed from the encoded file). --embed also writes the pack as a C array.
+
+#include "raylib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "level.h"
+#include "lz.h"
+#include "pack.h"
+
+#define MAX_PACK_ENTRIES 256
+#define ALIGN_UP(x) (((x) + PACK_ALIGN - 1) & ~(PACK_ALIGN - 1))
+
+typedef struct Payload {
+	PackEntry entry;
+	unsigned char *data;
+	bool compress;
+	bool raw;
+} Payload;
+
+static bool isSound(const char *ext) {
+	return strcmp(ext, ".ogg") == 0 || strcmp(ext, ".wav") == 0 || strcmp(ext, ".mp3") == 0
+		|| strcmp(ext, ".flac") == 0 || strcmp(ext, ".qoa") == 0;
+}
+
+static bool isImage(const char *ext) {
+	return strcmp(ext, ".png") == 0 || strcmp(ext, ".bmp") == 0 || strcmp(ext, ".tga") == 0
+		|| strcmp(ext, ".jpg") == 0 || strcmp(ext, ".qoi") == 0;
+}
+
+typedef struct TextureLevel {
+	uint64_t offset;
+	uint64_t size;
+} TextureLevel;
+
+typedef struct TextureFile {
+	int format;
+	int width;
+	int height;
+	int mipmaps;
+	TextureLevel levels[16];
+} TextureFile;
+
+static uint32_t read32(const unsigned char *p) {
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t read64(const unsigned char *p) {
+	return read32(p) | ((uint64_t)read32(p + 4) << 32);
+}
+
+// The variant packTexture() looks for
+static const char *textureVariant(int format) {
+	if (format >= PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA)
+		return "astc";
+	if (format >= PIXELFORMAT_COMPRESSED_ETC1_RGB)
+		return "etc2";
+	return "bc";
+}
+
+static bool validSize(const TextureFile *texture) {
+	return texture->width > 0 && texture->height > 0
+		&& texture->width <= PACK_TEXTURE_MAX_SIZE && texture->height <= PACK_TEXTURE_MAX_SIZE;
+}
+
+// DXT1/3/5 from the legacy header or BC1/2/3 from a DX10 one, mipmaps follow the header
+static bool parseDds(TextureFile *texture, const unsigned char *data, unsigned int size) {
+	if (size < 128 || memcmp(data, "DDS ", 4) != 0 || read32(data + 4) != 124 || (read32(data + 112) & 0x200))
+		return false;
+
+	texture->height = read32(data + 12);
+	texture->width = read32(data + 16);
+	texture->mipmaps = (read32(data + 8) & 0x20000) && read32(data + 28) ? read32(data + 28) : 1;
+
+	const unsigned char *fourCC = data + 84;
+	uint64_t offset = 128;
+	if (memcmp(fourCC, "DXT1", 4) == 0)
+		texture->format = (read32(data + 80) & 0x1) ? PIXELFORMAT_COMPRESSED_DXT1_RGBA : PIXELFORMAT_COMPRESSED_DXT1_RGB;
+	else if (memcmp(fourCC, "DXT3", 4) == 0)
+		texture->format = PIXELFORMAT_COMPRESSED_DXT3_RGBA;
+	else if (memcmp(fourCC, "DXT5", 4) == 0)
+		texture->format = PIXELFORMAT_COMPRESSED_DXT5_RGBA;
+	else if (memcmp(fourCC, "DX10", 4) == 0 && size >= 148 && read32(data + 132) == 3 && read32(data + 140) <= 1) {
+		uint32_t dxgiFormat = read32(data + 128);
+		offset = 148;
+		if (dxgiFormat == 71 || dxgiFormat == 72)
+			texture->format = PIXELFORMAT_COMPRESSED_DXT1_RGBA;
+		else if (dxgiFormat == 74 || dxgiFormat == 75)
+			texture->format = PIXELFORMAT_COMPRESSED_DXT3_RGBA;
+		else if (dxgiFormat == 77 || dxgiFormat == 78)
+			texture->format = PIXELFORMAT_COMPRESSED_DXT5_RGBA;
+		else
+			return false;
+	} else
+		return false;
+
+	if (texture->mipmaps > 16 || !validSize(texture))
+		return false;
+	int width = texture->width, height = texture->height;
+	for (int i = 0; i < texture->mipmaps; i++) {
+		texture->levels[i].offset = offset;
+		texture->levels[i].size = GetPixelDataSize(width, height, texture->format);
+		offset += texture->levels[i].size;
+		width = width > 1 ? width/2 : 1;
+		height = height > 1 ? height/2 : 1;
+	}
+	return true;
+}
+
+// The level index points at each mipmap, supercompressed files (Basis) would need transcoding
+static bool parseKtx2(TextureFile *texture, const unsigned char *data, unsigned int size) {
+	static const unsigned char identifier[12] = { 0xab, 'K', 'T', 'X', ' ', '2', '0', 0xbb, '\r', '\n', 0x1a, '\n' };
+	if (size < 80 || memcmp(data, identifier, 12) != 0)
+		return false;
+
+	switch (read32(data + 12)) {
+	case 131: case 132: texture->format = PIXELFORMAT_COMPRESSED_DXT1_RGB; break;
+	case 133: case 134: texture->format = PIXELFORMAT_COMPRESSED_DXT1_RGBA; break;
+	case 135: case 136: texture->format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;
+	case 137: case 138: texture->format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
+	case 147: case 148: texture->format = PIXELFORMAT_COMPRESSED_ETC2_RGB; break;
+	case 151: case 152: texture->format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA; break;
+	case 157: case 158: texture->format = PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA; break;
+	case 171: case 172: texture->format = PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA; break;
+	default: return false;
+	}
+
+	texture->width = read32(data + 20);
+	texture->height = read32(data + 24);
+	uint32_t levelCount = read32(data + 40);
+	texture->mipmaps = levelCount ? levelCount : 1;
+	if (read32(data + 28) != 0 || read32(data + 32) > 1 || read32(data + 36) != 1 || read32(data + 44) != 0
+		|| texture->mipmaps > 16 || size < 80 + (unsigned int)texture->mipmaps*24)
+		return false;
+
+	for (int i = 0; i < texture->mipmaps; i++) {
+		texture->levels[i].offset = read64(data + 80 + i*24);
+		texture->levels[i].size = read64(data + 80 + i*24 + 8);
+	}
+	return true;
+}
+
+// A mipmap chain with a level the upload would read differently is cut to the largest level,
+// a partial chain would leave the texture incomplete
+static bool loadGpuTexture(Payload *payload, const char *ext, const unsigned char *data, unsigned int size) {
+	TextureFile texture = { 0 };
+	bool parsed = strcmp(ext, ".dds") == 0 ? parseDds(&texture, data, size) : parseKtx2(&texture, data, size);
+	if (!parsed || !validSize(&texture)) {
+		fprintf(stderr, "%s is not a 2D texture in a compressed format raylib loads\n", payload->entry.name);
+		return false;
+	}
+
+	const char *variant = textureVariant(texture.format);
+	const char *suffix = strrchr(payload->entry.name, PACK_TEXTURE_VARIANT);
+	if (!suffix || strcmp(suffix + 1, variant) != 0) {
+		fprintf(stderr, "%s holds %s data, name it name%c%s\n", payload->entry.name, variant, PACK_TEXTURE_VARIANT, variant);
+		return false;
+	}
+
+	int mipmaps = 0;
+	uint64_t dataSize = 0;
+	int width = texture.width, height = texture.height;
+	for (int i = 0; i < texture.mipmaps; i++) {
+		const TextureLevel *level = &texture.levels[i];
+		if (level->offset + level->size > size || level->size != (uint64_t)GetPixelDataSize(width, height, texture.format))
+			break;
+		mipmaps++;
+		dataSize += level->size;
+		width = width > 1 ? width/2 : 1;
+		height = height > 1 ? height/2 : 1;
+	}
+	if (mipmaps == 0) {
+		fprintf(stderr, "%s is shorter than its %dx%d texture\n", payload->entry.name, texture.width, texture.height);
+		return false;
+	}
+	if (mipmaps < texture.mipmaps) {
+		fprintf(stderr, "%s: mipmap %dx%d is not the size expected, keeping only the largest level\n", payload->entry.name, width, height);
+		mipmaps = 1;
+		dataSize = texture.levels[0].size;
+	}
+
+	PackEntry *entry = &payload->entry;
+	entry->format = PACK_FORMAT_GPU_TEXTURE;
+	entry->size = sizeof(PackTexture) + dataSize;
+	entry->param[0] = texture.width;
+	entry->param[1] = texture.height;
+	payload->data = malloc(entry->size);
+
+	PackTexture info = { texture.format, texture.width, texture.height, mipmaps };
+	memcpy(payload->data, &info, sizeof(info));
+	unsigned char *out = payload->data + sizeof(info);
+	for (int i = 0; i < mipmaps; i++) {
+		memcpy(out, data + texture.levels[i].offset, texture.levels[i].size);
+		out += texture.levels[i].size;
+	}
+	return true;
+}
+
+static bool loadPayload(Payload *payload, const char *fileName) {
+	const char *ext = GetFileExtension(fileName);
+	if (!ext)
+		ext = "";
+	PackEntry *entry = &payload->entry;
+
+	if (isSound(ext) && !payload->raw) {
+		Wave wave = LoadWave(fileName);
+		if (!IsWaveReady(wave))
+			return false;
+		WaveFormat(&wave, PACK_SOUND_SAMPLE_RATE, 32, PACK_SOUND_CHANNELS);
+
+		entry->format = PACK_FORMAT_PCM_F32;
+		entry->size = wave.frameCount*PACK_SOUND_CHANNELS*sizeof(float);
+		entry->param[0] = PACK_SOUND_SAMPLE_RATE;
+		entry->param[1] = PACK_SOUND_CHANNELS;
+		payload->data = malloc(entry->size);
+		memcpy(payload->data, wave.data, entry->size);
+		UnloadWave(wave);
+		return true;
+	}
+
+	if (isImage(ext) && !payload->raw) {
+		Image image = LoadImage(fileName);
+		if (IsImageReady(image)) {
+			ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+			entry->format = PACK_FORMAT_IMAGE;
+			entry->size = image.width*image.height*4;
+			entry->param[0] = image.width;
+			entry->param[1] = image.height;
+			payload->data = malloc(entry->size);
+			memcpy(payload->data, image.data, entry->size);
+			UnloadImage(image);
+			return true;
+		}
+		// Formats this raylib build can't decode are kept as files for a build that can
+	}
+
+	unsigned int size = 0;
+	unsigned char *data = LoadFileData(fileName, &size);
+	if (!data)
+		return false;
+
+	if ((strcmp(ext, ".dds") == 0 || strcmp(ext, ".ktx2") == 0) && !payload->raw) {
+		bool loaded = loadGpuTexture(payload, ext, data, size);
+		UnloadFileData(data);
+		return loaded;
+	}
+
+	entry->format = PACK_FORMAT_FILE;
+	if (strcmp(ext, ".lvl") == 0) {
+		Level level;
+		if (!levelLoadMemory(&level, data, size)) {
+			UnloadFileData(data);
+			return false;
+		}
+		entry->format = PACK_FORMAT_LEVEL;
+	}
+	strncpy(entry->type, ext, sizeof(entry->type) - 1);
+	entry->size = size;
+	payload->data = malloc(size);
+	memcpy(payload->data, data, size);
+	UnloadFileData(data);
+	return true;
+}
+
+static int compareEntries(const void *a, const void *b) {
+	return strcmp(((const Payload *)a)->entry.name, ((const Payload *)b)->entry.name);
+}
+
+static bool writeEmbedded(const char *fileName, const unsigned char *data, unsigned int size) {
+	FILE *out = fopen(fileName, "w");
+	if (!out)
+		return false;
+
+	fprintf(out, "// Generated by tools/assetpack.c, do not edit\n\n#include \"asset_pack.h\"\n\n");
+	fprintf(out, "#if defined(_MSC_VER)\n__declspec(align(%d))\n#else\n__attribute__((aligned(%d)))\n#endif\n", PACK_ALIGN, PACK_ALIGN);
+	fprintf(out, "const unsigned char asset_pack[] = {\n");
+	for (unsigned int i = 0; i < size; i++) {
+		fprintf(out, "%s0x%02x,%s", i % 16 == 0 ? "\t" : "", data[i], i % 16 == 15 || i == size - 1 ? "\n" : "");
+	}
+	fprintf(out, "};\n\nconst unsigned int asset_pack_size = %u;\n", size);
+
+	fclose(out);
+	return true;
+}
+
+int main(int argc, char **argv) {
+	const char *embedPath = NULL;
+	int arg = 1;
+	if (arg + 1 < argc && strcmp(argv[arg], "--embed") == 0) {
+		embedPath = argv[arg + 1];
+		arg += 2;
+	}
+	if (arg >= argc) {
+		fprintf(stderr, "usage: %s [--embed pack.c] output.pak [-z] [-f] name=file ...\n", argv[0]);
+		return 1;
+	}
+	const char *outPath = argv[arg++];
+
+	SetTraceLogLevel(LOG_WARNING);
+
+	static Payload payloads[MAX_PACK_ENTRIES];
+	int count = 0;
+	bool compressNext = false;
+	bool rawNext = false;
+
+	for (; arg < argc; arg++) {
+		if (strcmp(argv[arg], "-z") == 0) {
+			compressNext = true;
+			continue;
+		}
+		if (strcmp(argv[arg], "-f") == 0) {
+			rawNext = true;
+			continue;
+		}
+
+		const char *eq = strchr(argv[arg], '=');
+		if (!eq || eq == argv[arg] || eq - argv[arg] >= PACK_NAME_SIZE || count == MAX_PACK_ENTRIES) {
+			fprintf(stderr, "bad entry %s, expected name=file with a name under %d characters\n", argv[arg], PACK_NAME_SIZE);
+			return 1;
+		}
+
+		Payload *payload = &payloads[count++];
+		memcpy(payload->entry.name, argv[arg], eq - argv[arg]);
+		payload->compress = compressNext;
+		payload->raw = rawNext;
+		compressNext = false;
+		rawNext = false;
+
+		if (!loadPayload(payload, eq + 1)) {
+			fprintf(stderr, "could not load %s\n", eq + 1);
+			return 1;
+		}
+	}
+
+	// Sorted so the game can binary search the index
+	qsort(payloads, count, sizeof(Payload), compareEntries);
+	for (int i = 1; i < count; i++) {
+		if (strcmp(payloads[i - 1].entry.name, payloads[i].entry.name) == 0) {
+			fprintf(stderr, "duplicate entry %s\n", payloads[i].entry.name);
+			return 1;
+		}
+	}
+
+	// Stored payloads are aligned within the file, compressed ones within the unpacked section
+	unsigned int offset = ALIGN_UP(sizeof(PackHeader) + count*sizeof(PackEntry));
+	unsigned int unpackedSize = 0;
+	for (int i = 0; i < count; i++) {
+		PackEntry *entry = &payloads[i].entry;
+		if (payloads[i].compress) {
+			entry->flags = PACK_ENTRY_COMPRESSED;
+			entry->offset = unpackedSize;
+			unpackedSize = ALIGN_UP(unpackedSize + entry->size);
+		} else {
+			entry->offset = offset;
+			offset = ALIGN_UP(offset + entry->size);
+		}
+	}
+
+	unsigned char *unpacked = calloc(unpackedSize + 1, 1);
+	for (int i = 0; i < count; i++) {
+		if (payloads[i].compress)
+			memcpy(unpacked + payloads[i].entry.offset, payloads[i].data, payloads[i].entry.size);
+	}
+
+	int compressedSize = 0;
+	unsigned char *compressed = NULL;
+	if (unpackedSize) {
+		compressed = malloc(LZ_BOUND(unpackedSize));
+		compressedSize = lzCompress(unpacked, unpackedSize, compressed, LZ_BOUND(unpackedSize));
+	}
+
+	unsigned int size = offset + compressedSize;
+	unsigned char *data = calloc(size, 1);
+
+	PackHeader header = { { 0 }, PACK_VERSION, PACK_BYTE_ORDER, count, offset, compressedSize, unpackedSize, 0 };
+	memcpy(header.magic, PACK_MAGIC, 4);
+	memcpy(data, &header, sizeof(header));
+
+	for (int i = 0; i < count; i++) {
+		memcpy(data + sizeof(header) + i*sizeof(PackEntry), &payloads[i].entry, sizeof(PackEntry));
+		if (!payloads[i].compress)
+			memcpy(data + payloads[i].entry.offset, payloads[i].data, payloads[i].entry.size);
+		free(payloads[i].data);
+	}
+	if (compressedSize)
+		memcpy(data + offset, compressed, compressedSize);
+
+	bool ok = true;
+	if (!SaveFileData(outPath, data, size)) {
+		fprintf(stderr, "could not write %s\n", outPath);
+		ok = false;
+	} else if (embedPath && !writeEmbedded(embedPath, data, size)) {
+		fprintf(stderr, "could not write %s\n", embedPath);
+		ok = false;
+	}
+
+	free(data);
+	free(compressed);
+	free(unpacked);
+	return ok ? 0 : 1;
+}
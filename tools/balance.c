@@ -0,0 +1,228 @@
+// Plays thousands of headless games of each level with the autoplayer and summarises them
+//
+//   balance [--games N] [--workers N] [--seed N] [--fixed-physics] [--attack] [--minutes N] [level.lvl]...
+//
+// Without a level it plays the built-in layout, or the attack field, which is never cleared and
+// only ends lost or at the time limit. Each worker runs its own simulation, game n is
+// seeded from n alone, so the results are the same whatever the worker count
+
+#include "raylib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "autoplay.h"
+#include "defs.h"
+#include "game.h"
+#include "jobs.h"
+#include "level.h"
+
+// Ticks without a brick broken before the balls count as stuck in a loop
+#define STUCK_TICKS (30*TICK_RATE)
+
+enum {
+	OUTCOME_CLEARED,
+	OUTCOME_LOST,
+	OUTCOME_STUCK,
+	OUTCOME_TIMEOUT,
+	OUTCOME_COUNT
+};
+
+static const char *outcomeNames[OUTCOME_COUNT] = { "cleared", "lost", "stuck", "timeout" };
+
+typedef struct GameResult {
+	int outcome;
+	int ticks;
+	// Every contact that made a sound, bricks, walls and the paddle
+	int bounces;
+} GameResult;
+
+typedef struct Farm {
+	const Level *level;
+	unsigned int seed;
+	bool fixedPhysics;
+	bool attack;
+	int maxTicks;
+	int games;
+	int lanes;
+	// One game per lane, allocated once, nothing is allocated while playing
+	Game *lanesGame;
+	GameResult *results;
+} Farm;
+
+static GameResult playGame(const Farm *farm, Game *game, int index) {
+	unsigned int seed = farm->seed + (unsigned int)index*0x9e3779b9u;
+	game->fixedPhysics = farm->fixedPhysics;
+	game->attack = farm->attack;
+	gameSeed(game, seed);
+	if (farm->level)
+		gameInitLevel(game, farm->level);
+	else
+		gameInit(game);
+	game->state = STATE_PLAYING;
+
+	Autoplayer autoplayer;
+	autoplayInit(&autoplayer, seed);
+
+	GameResult result = { OUTCOME_TIMEOUT, 0, 0 };
+	int lastScore = game->score, lastBreak = 0;
+	for (int tick = 0; tick < farm->maxTicks; tick++) {
+		GameEvents events = { 0 };
+		gameTick(game, autoplayInput(&autoplayer, game), &events);
+		result.bounces += events.hits + events.clicks;
+		result.ticks = tick + 1;
+
+		if (game->score != lastScore) {
+			lastScore = game->score;
+			lastBreak = tick;
+		}
+		if (game->state == STATE_WON) {
+			result.outcome = OUTCOME_CLEARED;
+			break;
+		}
+		if (game->state == STATE_LOST) {
+			result.outcome = OUTCOME_LOST;
+			break;
+		}
+		if (tick - lastBreak >= STUCK_TICKS) {
+			result.outcome = OUTCOME_STUCK;
+			break;
+		}
+	}
+	return result;
+}
+
+// Lanes [begin, end) on one thread, lane l plays games l, l + lanes, ...
+static void runLanes(void *context, int begin, int end) {
+	Farm *farm = context;
+	for (int lane = begin; lane < end; lane++) {
+		for (int g = lane; g < farm->games; g += farm->lanes) {
+			farm->results[g] = playGame(farm, &farm->lanesGame[lane], g);
+		}
+	}
+}
+
+static int compareInt(const void *a, const void *b) {
+	int x = *(const int *)a, y = *(const int *)b;
+	return (x > y) - (x < y);
+}
+
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+static void report(const char *name, const Farm *farm, int *clearTicks, double elapsed) {
+	int counts[OUTCOME_COUNT] = { 0 };
+	long ticks = 0, bounces = 0;
+	int cleared = 0;
+	for (int g = 0; g < farm->games; g++) {
+		const GameResult *result = &farm->results[g];
+		counts[result->outcome]++;
+		ticks += result->ticks;
+		bounces += result->bounces;
+		if (result->outcome == OUTCOME_CLEARED)
+			clearTicks[cleared++] = result->ticks;
+	}
+
+	printf("%s: %d games, %ld ticks in %.2f s (%.0f ticks/s)\n", name, farm->games, ticks, elapsed,
+		elapsed > 0 ? ticks/elapsed : 0.0);
+	for (int o = 0; o < OUTCOME_COUNT; o++) {
+		printf("  %-8s %6d (%5.1f%%)\n", outcomeNames[o], counts[o], 100.0*counts[o]/farm->games);
+	}
+	printf("  bounces  %8.1f per game, %.2f per second played\n", (double)bounces/farm->games,
+		ticks ? (double)bounces*TICK_RATE/ticks : 0.0);
+	if (cleared > 0) {
+		qsort(clearTicks, cleared, sizeof(int), compareInt);
+		printf("  clear s  p10 %.1f  p50 %.1f  p90 %.1f  max %.1f\n", (double)clearTicks[(cleared - 1)*10/100]/TICK_RATE,
+			(double)clearTicks[(cleared - 1)*50/100]/TICK_RATE, (double)clearTicks[(cleared - 1)*90/100]/TICK_RATE,
+			(double)clearTicks[cleared - 1]/TICK_RATE);
+	}
+}
+
+int main(int argc, char **argv) {
+	Farm farm = { 0 };
+	farm.games = 1000;
+	farm.seed = 1;
+	farm.maxTicks = 10*60*TICK_RATE;
+	int workers = jobsDefaultWorkers();
+	int firstLevel = argc;
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--games") == 0 && i+1 < argc) {
+			farm.games = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--workers") == 0 && i+1 < argc) {
+			workers = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--seed") == 0 && i+1 < argc) {
+			farm.seed = strtoul(argv[++i], NULL, 0);
+		} else if (strcmp(argv[i], "--fixed-physics") == 0) {
+			farm.fixedPhysics = true;
+		} else if (strcmp(argv[i], "--attack") == 0) {
+			farm.attack = true;
+		} else if (strcmp(argv[i], "--minutes") == 0 && i+1 < argc) {
+			farm.maxTicks = atof(argv[++i])*60*TICK_RATE;
+		} else if (argv[i][0] == '-') {
+			fprintf(stderr, "usage: %s [--games N] [--workers N] [--seed N] [--fixed-physics] [--attack] [--minutes N] [level.lvl]...\n", argv[0]);
+			return 1;
+		} else {
+			firstLevel = i;
+			break;
+		}
+	}
+	if (farm.games <= 0 || farm.maxTicks <= 0) {
+		fprintf(stderr, "nothing to play\n");
+		return 1;
+	}
+	// The attack field generates its own rows, like the game it takes no level
+	if (farm.attack && firstLevel < argc) {
+		fprintf(stderr, "--attack plays its own field, levels can't be given\n");
+		return 1;
+	}
+
+	SetTraceLogLevel(LOG_WARNING);
+
+	static JobPool pool;
+	if (!jobsInit(&pool, workers < 0 ? 0 : workers)) {
+		fprintf(stderr, "could not start the workers\n");
+		return 1;
+	}
+	farm.lanes = pool.workerCount + 1;
+
+	farm.lanesGame = calloc(farm.lanes, sizeof(Game));
+	farm.results = malloc(farm.games*sizeof(GameResult));
+	int *clearTicks = malloc(farm.games*sizeof(int));
+	if (!farm.lanesGame || !farm.results || !clearTicks) {
+		fprintf(stderr, "out of memory\n");
+		return 1;
+	}
+
+	int status = 0;
+	int levelCount = argc - firstLevel;
+	for (int i = 0; i < (levelCount ? levelCount : 1); i++) {
+		Level level;
+		const char *name = levelCount ? argv[firstLevel + i] : "built-in";
+		farm.level = NULL;
+		if (levelCount) {
+			if (!levelLoad(&level, name)) {
+				fprintf(stderr, "could not load level %s\n", name);
+				status = 1;
+				continue;
+			}
+			farm.level = &level;
+		}
+
+		double start = now();
+		jobsRun(&pool, runLanes, &farm, farm.lanes);
+		report(name, &farm, clearTicks, now() - start);
+
+		if (farm.level)
+			levelUnload(&level);
+	}
+
+	jobsShutdown(&pool);
+	free(clearTicks);
+	free(farm.results);
+	free(farm.lanesGame);
+	return status;
+}
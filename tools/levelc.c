@@ -0,0 +1,131 @@
+// Compiles a text level into the binary format src/level.h loads
+//
+// A level is a list of lines, # starts a comment:
+//   size <width> <height>     brick size for the rows that follow, default 40 20
+//   spacing <pixels>          gap between bricks in a row, default 5
+//   origin <x> <y>            top left of the next row, default 40 50
+//   type <n>                  type of the bricks that follow, default 1: 1 normal, 2 three hits,
+//                             3 indestructible, 4 explosive, 5 multiball
+//   brick <x> <y> <w> <h> <c> one brick anywhere, c is a colour letter
+//   YRO.BLP                    a row of bricks, one colour letter per column, '.' leaves a gap
+//
+// Colour letters: Y yellow, R red, O orange, B blue, L lime, P dark purple, G gray, W white
+
+#include "raylib.h"
+#include <stdio.h>
+#include <string.h>
+
+#include "level.h"
+
+static bool colourFor(char c, Color *colour) {
+	switch (c) {
+		case 'Y': *colour = YELLOW; return true;
+		case 'R': *colour = RED; return true;
+		case 'O': *colour = ORANGE; return true;
+		case 'B': *colour = BLUE; return true;
+		case 'L': *colour = LIME; return true;
+		case 'P': *colour = DARKPURPLE; return true;
+		case 'G': *colour = GRAY; return true;
+		case 'W': *colour = WHITE; return true;
+		default: return false;
+	}
+}
+
+static bool isRow(const char *line) {
+	Color colour;
+	return *line == '.' || colourFor(*line, &colour);
+}
+
+int main(int argc, char **argv) {
+	if (argc != 3) {
+		fprintf(stderr, "usage: %s level.txt level.lvl\n", argv[0]);
+		return 1;
+	}
+
+	SetTraceLogLevel(LOG_WARNING);
+
+	FILE *in = fopen(argv[1], "r");
+	if (!in) {
+		fprintf(stderr, "could not open %s\n", argv[1]);
+		return 1;
+	}
+
+	static BrickStore store;
+	brickClear(&store);
+
+	float width = BLOCK_WIDTH, height = BLOCK_HEIGHT, spacing = BLOCK_SPACING;
+	float x = 40, y = 50;
+	int type = 1;
+
+	char line[1024];
+	int lineNumber = 0;
+	bool ok = true;
+
+	while (ok && fgets(line, sizeof(line), in)) {
+		lineNumber++;
+
+		char *comment = strchr(line, '#');
+		if (comment)
+			*comment = '\0';
+		line[strcspn(line, "\r\n")] = '\0';
+
+		char *p = line + strspn(line, " \t");
+		if (*p == '\0')
+			continue;
+
+		float bx, by, bw, bh;
+		char c;
+		Color colour;
+
+		if (isRow(p)) {
+			for (int col = 0; p[col] && p[col] != ' ' && p[col] != '\t'; col++) {
+				if (p[col] == '.')
+					continue;
+				if (!colourFor(p[col], &colour)) {
+					fprintf(stderr, "%s:%d: unknown colour '%c'\n", argv[1], lineNumber, p[col]);
+					ok = false;
+					break;
+				}
+				Rectangle rect = { x + col*(width+spacing), y, width, height };
+				if (brickAdd(&store, rect, type, colour) < 0) {
+					fprintf(stderr, "%s:%d: more than %d bricks\n", argv[1], lineNumber, MAX_BRICKS);
+					ok = false;
+					break;
+				}
+			}
+			y += height + spacing;
+		} else if (sscanf(p, "size %f %f", &width, &height) == 2) {
+		} else if (sscanf(p, "spacing %f", &spacing) == 1) {
+		} else if (sscanf(p, "origin %f %f", &x, &y) == 2) {
+		} else if (sscanf(p, "type %d", &type) == 1) {
+			if (type <= BRICK_NONE || type >= BRICK_TYPE_COUNT) {
+				fprintf(stderr, "%s:%d: unknown brick type %d\n", argv[1], lineNumber, type);
+				ok = false;
+			}
+		} else if (sscanf(p, "brick %f %f %f %f %c", &bx, &by, &bw, &bh, &c) == 5 && colourFor(c, &colour)) {
+			if (brickAdd(&store, (Rectangle){ bx, by, bw, bh }, type, colour) < 0) {
+				fprintf(stderr, "%s:%d: more than %d bricks\n", argv[1], lineNumber, MAX_BRICKS);
+				ok = false;
+			}
+		} else {
+			fprintf(stderr, "%s:%d: cannot parse '%s'\n", argv[1], lineNumber, p);
+			ok = false;
+		}
+	}
+	fclose(in);
+
+	if (!ok)
+		return 1;
+	// The game's grid holds so many bricks a cell, a level packed tighter is rejected when it loads
+	if (!gridFits(store.x, store.y, store.w, store.h, store.used)) {
+		fprintf(stderr, "%s: more than %d bricks in one %dx%d grid cell\n", argv[1], GRID_CELL_CAPACITY,
+			GRID_CELL_WIDTH, GRID_CELL_HEIGHT);
+		return 1;
+	}
+
+	if (!levelSave(&store, argv[2])) {
+		fprintf(stderr, "could not write %s\n", argv[2]);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,68 @@
+// Follows a game's spectator stream (attack_breaker --stream HOST:PORT) and prints what it sees
+//
+//   spectate <port>
+//
+// Once a second: tick, state, scores, live bricks, balls and the bytes that came in for it
+
+#include "raylib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "spectate.h"
+
+static int liveBricks(const SpectateView *view) {
+	int count = 0;
+	for (int i = 0; i < view->brickCount; i++) {
+		count += (view->live[i >> 6] >> (i & 63)) & 1;
+	}
+	return count;
+}
+
+int main(int argc, char **argv) {
+	if (argc != 2) {
+		fprintf(stderr, "usage: %s port\n", argv[0]);
+		return 1;
+	}
+
+	SetTraceLogLevel(LOG_WARNING);
+
+	UdpSocket udp;
+	if (!udpOpen(&udp, atoi(argv[1]), NULL)) {
+		fprintf(stderr, "could not listen on port %s\n", argv[1]);
+		return 1;
+	}
+
+	static SpectateReader reader;
+	spectateReaderInit(&reader);
+
+	static unsigned char packet[SPECTATE_MAX_PACKET];
+	long bytes = 0;
+	time_t last = time(NULL);
+	for (;;) {
+		int size;
+		while ((size = udpReceive(&udp, packet, sizeof(packet))) >= 0) {
+			bytes += size;
+			spectateRead(&reader, packet, size);
+		}
+
+		time_t now = time(NULL);
+		if (now != last) {
+			const SpectateView *view = &reader.view;
+			if (reader.synced) {
+				printf("tick %d state %d score %d", view->tick, view->state, view->score);
+				if (view->versus)
+					printf(" rival %d", view->rivalScore);
+				printf(" bricks %d/%d balls %d paddle %.2f, %ld bytes/s\n",
+					liveBricks(view), view->brickCount, view->ballCount, view->paddleX/4.0f, bytes/(long)(now - last));
+			} else {
+				printf("waiting for a keyframe, %ld bytes/s\n", bytes/(long)(now - last));
+			}
+			fflush(stdout);
+			bytes = 0;
+			last = now;
+		}
+
+		WaitTime(0.005);
+	}
+}
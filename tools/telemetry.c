@@ -0,0 +1,171 @@
+// Summarises a telemetry file (attack_breaker --telemetry FILE)
+//
+//   telemetry <file.csv>...
+//
+// Percentiles for every column, frames over the 60 Hz budget and frames missing from the file, then
+// the same budget per present mode and frame latency limit and per quality level when the file
+// records them
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define COLUMNS 7
+#define PRESENT_MODES 4
+#define MAX_FRAME_LATENCY 3
+// QUALITY_LEVELS in src/quality.h
+#define QUALITY_LEVELS 4
+#define FRAME_BUDGET_MS (1000.0/60.0)
+
+static const char *columnNames[COLUMNS] = { "frame ms", "ticks", "draw calls", "vertices", "audio ms", "voices", "latency ms" };
+// PresentMode order in raylib.h
+static const char *presentNames[PRESENT_MODES] = { "immediate", "vsync", "adaptive", "vrr" };
+
+typedef struct Samples {
+	double *values[COLUMNS];
+	long count;
+	long capacity;
+	long missing;
+	long lastIndex;
+	// Frames and frames over budget per present mode and latency limit
+	long modeFrames[PRESENT_MODES][MAX_FRAME_LATENCY + 1];
+	long modeOver[PRESENT_MODES][MAX_FRAME_LATENCY + 1];
+	long qualityFrames[QUALITY_LEVELS];
+	long qualityOver[QUALITY_LEVELS];
+} Samples;
+
+static int compareDouble(const void *a, const void *b) {
+	double x = *(const double *)a, y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+static bool addRow(Samples *samples, const double *row) {
+	if (samples->count == samples->capacity) {
+		long capacity = samples->capacity ? samples->capacity*2 : 4096;
+		for (int c = 0; c < COLUMNS; c++) {
+			double *values = realloc(samples->values[c], capacity*sizeof(double));
+			if (!values)
+				return false;
+			samples->values[c] = values;
+		}
+		samples->capacity = capacity;
+	}
+
+	for (int c = 0; c < COLUMNS; c++) {
+		samples->values[c][samples->count] = row[c];
+	}
+	samples->count++;
+	return true;
+}
+
+static bool readFile(Samples *samples, const char *fileName) {
+	FILE *file = fopen(fileName, "r");
+	if (!file) {
+		fprintf(stderr, "could not open %s\n", fileName);
+		return false;
+	}
+
+	// Each file is a session, frame indices restart at 0. Gaps count the frames dropped mid-session,
+	// the trailer written on exit counts all of them and wins when present
+	samples->lastIndex = -1;
+	long gaps = 0, dropped = -1;
+	char line[256];
+	while (fgets(line, sizeof(line), file)) {
+		if (sscanf(line, "# %ld frames dropped", &dropped) == 1)
+			continue;
+
+		long index;
+		double row[COLUMNS] = { 0 };
+		int mode, latency, quality;
+		int fields = sscanf(line, "%ld,%lf,%lf,%lf,%lf,%lf,%lf,%lf,%d,%d,%d", &index, &row[0], &row[1], &row[2], &row[3],
+			&row[4], &row[5], &row[6], &mode, &latency, &quality);
+		if (fields < 7)
+			continue;
+
+		// Files from before the present columns leave the latency wait at zero and stay out of the breakdown
+		if (fields >= 10 && mode >= 0 && mode < PRESENT_MODES && latency >= 0 && latency <= MAX_FRAME_LATENCY) {
+			samples->modeFrames[mode][latency]++;
+			if (row[0] > FRAME_BUDGET_MS)
+				samples->modeOver[mode][latency]++;
+		}
+		if (fields == 11 && quality >= 0 && quality < QUALITY_LEVELS) {
+			samples->qualityFrames[quality]++;
+			if (row[0] > FRAME_BUDGET_MS)
+				samples->qualityOver[quality]++;
+		}
+
+		if (index > samples->lastIndex + 1)
+			gaps += index - samples->lastIndex - 1;
+		samples->lastIndex = index;
+		if (!addRow(samples, row)) {
+			fclose(file);
+			fprintf(stderr, "out of memory reading %s\n", fileName);
+			return false;
+		}
+	}
+
+	fclose(file);
+	samples->missing += dropped >= 0 ? dropped : gaps;
+	return true;
+}
+
+static double percentile(const double *sorted, long count, int p) {
+	return sorted[(count - 1)*p/100];
+}
+
+int main(int argc, char **argv) {
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s file.csv...\n", argv[0]);
+		return 1;
+	}
+
+	static Samples samples;
+	for (int i = 1; i < argc; i++) {
+		if (!readFile(&samples, argv[i]))
+			return 1;
+	}
+	if (samples.count == 0) {
+		fprintf(stderr, "no frames\n");
+		return 1;
+	}
+
+	long over = 0;
+	double total = 0.0;
+	for (long i = 0; i < samples.count; i++) {
+		if (samples.values[0][i] > FRAME_BUDGET_MS)
+			over++;
+		total += samples.values[0][i];
+	}
+
+	printf("%ld frames, %.1f s, %ld over %.1f ms (%.2f%%), %ld missing\n", samples.count, total/1000.0,
+		over, FRAME_BUDGET_MS, 100.0*over/samples.count, samples.missing);
+	printf("%-12s %10s %10s %10s %10s %10s\n", "", "p50", "p90", "p99", "p99.9", "max");
+	for (int c = 0; c < COLUMNS; c++) {
+		double *sorted = samples.values[c];
+		qsort(sorted, samples.count, sizeof(double), compareDouble);
+		printf("%-12s %10.2f %10.2f %10.2f %10.2f %10.2f\n", columnNames[c],
+			percentile(sorted, samples.count, 50), percentile(sorted, samples.count, 90), percentile(sorted, samples.count, 99),
+			sorted[(samples.count - 1)*999/1000], sorted[samples.count - 1]);
+	}
+
+	for (int mode = 0; mode < PRESENT_MODES; mode++) {
+		for (int latency = 0; latency <= MAX_FRAME_LATENCY; latency++) {
+			long frames = samples.modeFrames[mode][latency];
+			if (frames == 0)
+				continue;
+			long modeOver = samples.modeOver[mode][latency];
+			printf("%-9s latency %d: %ld frames, %ld over budget (%.2f%%)\n", presentNames[mode], latency, frames,
+				modeOver, 100.0*modeOver/frames);
+		}
+	}
+	for (int quality = 0; quality < QUALITY_LEVELS; quality++) {
+		long frames = samples.qualityFrames[quality];
+		if (frames == 0)
+			continue;
+		long qualityOver = samples.qualityOver[quality];
+		printf("quality %d: %ld frames, %ld over budget (%.2f%%)\n", quality, frames, qualityOver, 100.0*qualityOver/frames);
+	}
+
+	return 0;
+}